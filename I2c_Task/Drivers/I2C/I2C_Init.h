@@ -7,6 +7,9 @@
  * @note          This driver still under development, so it doesn't support:
  *                - uDMA Mode
  *                - Remaining Interrupts handling
+ * @note          Interrupt driven transfers need I2c_Service() to be called
+ *                periodically (main loop or timer), arbitration loss retries
+ *                are deferred to it instead of waiting in I2C ISR
  *******************************************************************************/
 
 #ifndef DRIVERS_I2C_I2C_INIT_H_
@@ -33,6 +36,22 @@
 #define I2C_RECEIVE_MODE_SINGLE       (0x0)
 #define I2C_RECEIVE_MODE_MULTIPLE     (0x1)
 
+/* Define used to choose the I2C speed mode through I2cFreq (maximum SCL frequency of each mode)
+ * Note: The mode is the slowest one whose maximum is >= I2cFreq */
+#define I2C_FREQ_STANDARD             (100000UL)    /* Standard mode    (SCL_LP = 6, SCL_HP = 4)    */
+#define I2C_FREQ_FAST                 (400000UL)    /* Fast mode        (SCL_LP = 6, SCL_HP = 4)    */
+#define I2C_FREQ_FAST_PLUS            (1000000UL)   /* Fast-mode plus   (SCL_LP = 6, SCL_HP = 4)    */
+#define I2C_FREQ_HIGH_SPEED           (3400000UL)   /* High-speed mode  (SCL_LP = 2, SCL_HP = 1)    */
+
+/* Define used to know the result of an interrupt driven transfer @ref I2C_STATUS */
+#define I2C_STATUS_OK                 (0x0)     /* All bytes transferred and STOP sent          */
+#define I2C_STATUS_ADDRESS_NACK       (0x1)     /* No slave acknowledged the address            */
+#define I2C_STATUS_DATA_NACK          (0x2)     /* Slave didn't acknowledge a transmitted byte  */
+#define I2C_STATUS_ARBITRATION_LOST   (0x3)     /* Another master won the bus                   */
+#define I2C_STATUS_BUS_BUSY           (0x4)     /* Transfer couldn't start (bus or I2C busy)    */
+#define I2C_STATUS_CLOCK_TIMEOUT      (0x5)     /* SCL held low too long, or wait timed out     */
+#define I2C_STATUS_PENDING            (0xF)     /* Batch transaction not run (yet)              */
+
 /*******************************************************************************
  *                              User Defined Data Types                        *
  *******************************************************************************/
@@ -137,6 +156,34 @@ typedef struct{
 }I2c_Config;
 
 
+/*******************************************************************************
+ * @struct  I2c_Transaction
+ *
+ * @brief   Structure Holds one master transaction: optional write phase then
+ *          optional read phase after a repeated START (e.g. register read)
+ *
+ * @var     I2c_Transaction::Address
+ *          7 bits slave address
+ *
+ * @var     I2c_Transaction::TxBuffer, I2c_Transaction::TxLength
+ *          Bytes sent first (TxLength can be 0)
+ *
+ * @var     I2c_Transaction::RxBuffer, I2c_Transaction::RxLength
+ *          Bytes received after repeated START (RxLength can be 0)
+ *
+ * @var     I2c_Transaction::Status
+ *          Result of the transaction, You can find its value @ref I2C_STATUS
+ ******************************************************************************/
+typedef struct{
+    uint8           Address;            /** 7 bits slave address                    */
+    const uint8*    TxBuffer;           /** Bytes to be sent                        */
+    uint32          TxLength;           /** Number of bytes to be sent              */
+    uint8*          RxBuffer;           /** Bytes received                          */
+    uint32          RxLength;           /** Number of bytes to be received          */
+    volatile uint8  Status;             /** @ref I2C_STATUS                         */
+}I2c_Transaction;
+
+
 /*******************************************************************************
  *                              Functions Prototypes                          *
  *******************************************************************************/
@@ -145,6 +192,18 @@ void I2c1_SetCallBack(void (*f_ptr)(void));
 void I2c2_SetCallBack(void (*f_ptr)(void));
 void I2c3_SetCallBack(void (*f_ptr)(void));
 uint8 I2c_Init(const I2c_Config* ConfigPtr);
+uint32 I2c_SolveClock(uint32 ClkValue, uint32 I2cFreq, uint32* Tpr);
+uint32 I2c_GetFrequency(I2c_Instance I2cNum);
+uint8 I2c_BusRecover(const I2c_Config* ConfigPtr);
+uint8 I2c_Service(I2c_Instance I2cNum);
+uint8 I2c_GetLastError(I2c_Instance I2cNum);
 uint8 I2c_Transmit(const I2c_Config* ConfigPtr, const uint8* DataPtr, uint8 BufferSize);
 uint8 I2c_Receive(const I2c_Config* ConfigPtr, uint8* DataPtr, uint8 BufferSize);
+uint8 I2c_TransmitIT(const I2c_Config* ConfigPtr, const uint8* DataPtr, uint32 Length, void (*CallBack)(uint8 Status));
+uint8 I2c_ReceiveIT(const I2c_Config* ConfigPtr, uint8* DataPtr, uint32 Length, void (*CallBack)(uint8 Status));
+uint8 I2c_WriteRead(const I2c_Config* ConfigPtr, uint8 Address, const uint8* TxBuffer, uint32 TxLength,
+                    uint8* RxBuffer, uint32 RxLength);
+uint8 I2c_WriteReadIT(const I2c_Config* ConfigPtr, uint8 Address, const uint8* TxBuffer, uint32 TxLength,
+                      uint8* RxBuffer, uint32 RxLength, void (*CallBack)(uint8 Status));
+uint8 I2c_BatchIT(const I2c_Config* ConfigPtr, I2c_Transaction* List, uint32 Count, void (*CallBack)(uint8 Status));
 #endif /* DRIVERS_I2C_I2C_PRIV_H_ */
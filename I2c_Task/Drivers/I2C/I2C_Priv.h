@@ -11,6 +11,9 @@
 #ifndef DRIVERS_I2C_I2C_PRIV_H_
 #define DRIVERS_I2C_I2C_PRIV_H_
 
+#include "std_types.h"
+#include "I2C_Init.h"
+
 /********************************************************************************
  *                                  Bits Defines                                *
  *******************************************************************************/
@@ -31,6 +34,12 @@
 
 #define MTPR_REG_HS_ENABLE         ((uint8)0x1)    /* High Speed Enable Value*/
 
+#define MTPR_REG_TPR_MIN           ((uint32)1)     /* Smallest Timer Period value               */
+#define MTPR_REG_TPR_MAX           ((uint32)127)   /* Largest Timer Period value (7 bits)       */
+
+/************************** I2C_PP Register defines *****************************/
+#define PP_REG_HS_POS              ((uint8)0x0)    /* High-Speed Capable Bit Position           */
+
 /********************* I2C_MCS Register defines (ReadOnly) ************************/
 #define MCR_REG_BUSY_POS           ((uint8)0x0)    /* I2C Busy Bit Position                     */
 #define MCR_REG_ERROR_POS          ((uint8)0x1)    /* Error Bit Position                        */
@@ -63,6 +72,23 @@
 #define MCR_REG_ACK_ENABLE         ((uint8)0x1)    /* Received data byte is ACK auto by Master  */
 #define MCR_REG_HS_ENABLE          ((uint8)0x1)    /* The master operates in High-Speed mode    */
 
+/************************** I2C_MIMR Register defines *****************************/
+#define MIMR_REG_IM_POS            ((uint8)0x0)    /* Master Interrupt Mask Bit Position         */
+#define MIMR_REG_CLKIM_POS         ((uint8)0x1)    /* Clock Timeout Interrupt Mask Bit Position  */
+
+/************************** I2C_MICR Register defines *****************************/
+#define MICR_REG_IC_POS            ((uint8)0x0)    /* Master Interrupt Clear Bit Position        */
+#define MICR_REG_CLKIC_POS         ((uint8)0x1)    /* Clock Timeout Interrupt Clear Bit Position */
+
+/************************** I2C_MCLKOCNT Register defines *****************************/
+#define MCLKOCNT_REG_CNTL_MIN      ((uint32)0x02)  /* Smallest allowed count                     */
+#define MCLKOCNT_REG_CNTL_MAX      ((uint32)0xFF)  /* Largest count (8 bits)                     */
+#define MCLKOCNT_REG_CNTL_SCALE    ((uint32)16)    /* SCL periods of each count (upper 8 of 12 bits) */
+
+/************************** I2C_MBMON Register defines *****************************/
+#define MBMON_REG_SCL_POS          ((uint8)0x0)    /* SCL line state Bit Position                */
+#define MBMON_REG_SDA_POS          ((uint8)0x1)    /* SDA line state Bit Position                */
+
 /************************** I2C_MMIS Register defines *****************************/
 #define MMIS_REG_MIS_POS           ((uint8)0x0)    /* Masked Interrupt Status Bit Position       */
 #define MMIS_REG_CLKMIS_POS        ((uint8)0x1)    /* Clock Timeout Interrupt Status Bit Position*/
@@ -108,6 +134,83 @@
 #define SCL_HP_HIGH_SPEED           ((uint8)0x1)     /* SCL_HP Value in High Speed Mode */
 #define ONE_MEGA_HERTZ_CLK_VALUE    ((uint32)1000000)/* 1 MHz Clock Value  */
 
+/* Master code (0000 1xxx) sent at Fast speed before each High-speed transfer, no slave acknowledges it */
+#define I2C_HS_MASTER_CODE          ((uint8)0x0A)
+
+/************************** Error recovery defines *****************************/
+/* SCL held low longer than this is a clock timeout (SMBus tTIMEOUT) */
+#define I2C_CLOCK_TIMEOUT_MS        (35UL)
+
+/* Polling iterations before waiting for the bus to be free gives up (several ms at 80 MHz) */
+#define I2C_WAIT_TIMEOUT            (100000UL)
+
+/* SCL periods of one master operation (START, 8 bits, ACK and STOP), the wait for
+ * it is bounded by these periods plus the clock low timeout (MCLKOCNT) */
+#define I2C_OPERATION_SCL_PERIODS   (11UL)
+
+/* Arbitration loss retries, the backoff (polling iterations) is doubled on each one */
+#define I2C_ARBITRATION_RETRIES     ((uint8)3)
+#define I2C_ARBITRATION_BACKOFF     (256UL)
+
+/* Interrupt driven transfers retry from I2c_Service(): calls skipped before the
+ * retry (doubled on each one), then calls the bus may stay busy before giving up */
+#define I2C_RETRY_BACKOFF_CALLS     (1UL)
+#define I2C_RETRY_BUSY_CALLS        (100UL)
+
+/* Clock pulses sent to a slave holding SDA low (it releases SDA after its byte) */
+#define I2C_BUS_CLEAR_CLOCKS        ((uint8)9)
+
+/* R/S bit of MSA Register (0: Master transmits, 1: Master receives) */
+#define MSA_REG_RECEIVE            ((uint8)0x1)
+
+/* Mask/restore IRQs (PRIMASK), used when the transfer is polled instead of served by I2C ISR */
+#if defined(__TI_ARM__)
+#define I2C_ENTER_CRITICAL()       ((uint32)_disable_interrupts())
+#define I2C_EXIT_CRITICAL(KEY)     ((void)_restore_interrupts(KEY))
+#elif defined(__GNUC__) && defined(__ARM_ARCH)
+#define I2C_ENTER_CRITICAL()       __extension__({ uint32 Key_; __asm volatile ("mrs %0, primask\n\tcpsid i" : "=r" (Key_) : : "memory"); Key_; })
+#define I2C_EXIT_CRITICAL(KEY)     __asm volatile ("msr primask, %0" : : "r" (KEY) : "memory")
+#elif defined(HOST_TEST)
+#include "Test_Critical.h"
+#define I2C_ENTER_CRITICAL()       Test_EnterCritical()
+#define I2C_EXIT_CRITICAL(KEY)     Test_ExitCritical(KEY)
+#else
+#error "I2C: no critical section (PRIMASK) implementation for this toolchain"
+#endif
+
+/*******************************************************************************
+ *                           Private Data Types                                 *
+ *******************************************************************************/
+/*******************************************************************************
+ * @struct I2c_ItTransfer
+ *
+ * @brief  Structure holds the state of the interrupt driven master transfer
+ *         of one I2C instance (write phase, then read phase after repeated START)
+ *         Batch transactions follow each other with repeated START, STOP is
+ *         sent after the last one only
+ ******************************************************************************/
+typedef struct{
+    const uint8*    TxNext;                     /* Next byte to send                            */
+    uint8*          RxNext;                     /* Next received byte                           */
+    uint32          TxRemaining;                /* Bytes not written to MDR yet                 */
+    uint32          RxRemaining;                /* Bytes not read from MDR yet                  */
+    uint8           Address;                    /* 7 bits slave address                         */
+    uint8           Receiving;                  /* TRUE in read phase                           */
+    uint8           StopSent;                   /* TRUE if the last command had STOP            */
+    I2c_Transaction* Current;                   /* Batch transaction running (or NULL_PTR)      */
+    uint32          BatchRemaining;             /* Batch transactions after Current             */
+    uint8           Stopping;                   /* TRUE while STOP after an error is on the bus */
+    uint8           MasterCode;                 /* TRUE while High-speed master code is sent    */
+    uint8           Retries;                    /* Arbitration loss retries done                */
+    volatile uint8  RetryPending;               /* TRUE while the retry waits for I2c_Service() */
+    uint32          RetryWait;                  /* I2c_Service() calls left before the retry    */
+    uint32          RetryBusy;                  /* I2c_Service() calls left while bus is busy   */
+    uint8           Status;                     /* @ref I2C_STATUS reported to CallBack         */
+    volatile uint8  Busy;                       /* TRUE while the transfer is running           */
+    uint32          SavedMask;                  /* Master interrupts restored when done         */
+    void (*CallBack)(uint8 Status);             /* Called when the whole transfer is done       */
+}I2c_ItTransfer;
+
 
 
 #endif /* DRIVERS_I2C_I2C_PRIV_H_ */
@@ -19,6 +19,23 @@
  *                          Static Functions Prototype                          *
  *******************************************************************************/
 static void I2c_ChooseModule(const I2c_Config* ConfigPtr, volatile uint32** Ptr);
+static uint8 I2c_TransmitOnce(const I2c_Config* ConfigPtr, const uint8* DataPtr, uint8 BufferSize);
+static uint8 I2c_ReceiveOnce(const I2c_Config* ConfigPtr, uint8* DataPtr, uint8 BufferSize);
+static uint8 I2c_McsStatus(uint32 Mcs);
+static uint8 I2c_WaitBusIdle(volatile uint32* I2c_Ptr);
+static uint8 I2c_WaitMaster(const I2c_Config* ConfigPtr, volatile uint32* I2c_Ptr);
+static void I2c_Delay(uint32 Count);
+static uint8 I2c_MasterError(I2c_Instance I2cNum, volatile uint32* I2c_Ptr);
+static uint8 I2c_ItStartSingle(const I2c_Config* ConfigPtr, uint8 Address, const uint8* TxBuffer, uint32 TxLength,
+                               uint8* RxBuffer, uint32 RxLength, void (*CallBack)(uint8 Status));
+static uint8 I2c_ItStart(const I2c_Config* ConfigPtr, I2c_Transaction* List, uint32 Count, void (*CallBack)(uint8 Status));
+static void I2c_ItLoad(I2c_ItTransfer* Transfer);
+static void I2c_ItBegin(volatile uint32* I2c_Ptr, I2c_ItTransfer* Transfer);
+static uint8 I2c_ItRetry(I2c_ItTransfer* Transfer);
+static void I2c_ItStartPhase(volatile uint32* I2c_Ptr, I2c_ItTransfer* Transfer);
+static void I2c_ItNext(volatile uint32* I2c_Ptr, I2c_ItTransfer* Transfer);
+static void I2c_ItFinish(volatile uint32* I2c_Ptr, I2c_ItTransfer* Transfer);
+static uint8 I2c_ItIsrHandler(I2c_Instance I2cNum, volatile uint32* I2c_Ptr);
 
 /*******************************************************************************
  *                           Global Variables                                  *
@@ -35,6 +52,33 @@ static void (*volatile g_callBackPtrI2c2Interrupt)(void)      = NULL_PTR;
 /* Global volatile function pointer to hold the address of the call back function for I2c3 in the application */
 static void (*volatile g_callBackPtrI2c3Interrupt)(void)      = NULL_PTR;
 
+/* State of interrupt driven master transfer of each I2C instance */
+static I2c_ItTransfer g_i2cItTransfer[I2C_NUMBER_OF_INSTANCES];
+
+/* Transaction of single transfers (I2c_TransmitIT, I2c_ReceiveIT, I2c_WriteRead..) of each I2C instance */
+static I2c_Transaction g_i2cItSingle[I2C_NUMBER_OF_INSTANCES];
+
+/* Achieved SCL frequency of each I2C instance (0 if not initialized) */
+static uint32 g_i2cFrequency[I2C_NUMBER_OF_INSTANCES];
+
+/* TRUE if the I2C instance runs in High-speed mode (master code before each transfer) */
+static uint8 g_i2cHighSpeed[I2C_NUMBER_OF_INSTANCES];
+
+/* Result of the last blocking transfer or master error served by I2C ISR @ref I2C_STATUS */
+static volatile uint8 g_i2cLastError[I2C_NUMBER_OF_INSTANCES];
+
+/* Base address of each I2C instance (I2c_Service has no configuration) */
+static const uint32 g_i2cBaseAddress[I2C_NUMBER_OF_INSTANCES] = {
+    I2C_0_BASE_ADDRESS, I2C_1_BASE_ADDRESS, I2C_2_BASE_ADDRESS, I2C_3_BASE_ADDRESS
+};
+
+/* GPIO port, SCL pin and SDA pin of each I2C instance (bus clear) */
+static const uint32 g_i2cGpioBase[I2C_NUMBER_OF_INSTANCES] = {
+    I2C_0_GPIO_BASE_ADDRESS, I2C_1_GPIO_BASE_ADDRESS, I2C_2_GPIO_BASE_ADDRESS, I2C_3_GPIO_BASE_ADDRESS
+};
+static const uint8 g_i2cSclPin[I2C_NUMBER_OF_INSTANCES] = {2U, 6U, 4U, 0U};
+static const uint8 g_i2cSdaPin[I2C_NUMBER_OF_INSTANCES] = {3U, 7U, 5U, 1U};
+
 
 /*******************************************************************************
  *                       Interrupt Service Routines                            *
@@ -50,25 +94,19 @@ static void (*volatile g_callBackPtrI2c3Interrupt)(void)      = NULL_PTR;
  *******************************************************************************/
 void I2C0_ISR(void)
 {
-    /******************************** Errors Checking Before Calling the Callback Function ********************************/
-    /* These error checks for the Master mode according to DataSheet instructions (See page 1006 "I2C Master Interrupts") */
-
-    /* First Check for ERROR Bit in MCS to ensure that
-     *  that an error didn't occur during the last transaction */
-    if( BIT_IS_SET( (*(volatile uint32*)(I2C_0_BASE_ADDRESS + I2C_MCS_REG_OFFSET)), MCR_REG_ERROR_POS) )
+    /* Serve interrupt driven master transfer first, its errors are reported to its callback */
+    if(I2c_ItIsrHandler(I2c0, (volatile uint32*)I2C_0_BASE_ADDRESS) == TRUE)
     {
-        /* There's an error occurred in the last transaction, don't call the callback function */
-        /* Future work: There Should be function to handle the error occurred in the last transaction */
-
-        /* use keyword return to get out of the ISR */
+        /* Pending slave interrupts enter the ISR again */
         return;
     }
-    /* Second, Check for ARBLST bit to ensure that arbitration has not been lost */
-    else if (BIT_IS_SET( (*(volatile uint32*)(I2C_0_BASE_ADDRESS + I2C_MCS_REG_OFFSET)), MCR_REG_ARBLST_POS) )
-    {
-        /* The Master lost the Arbitration, don't call the callback function */
-        /* Future work: There Should be function to handle the arbitration loss */
 
+    /******************************** Errors Checking Before Calling the Callback Function ********************************/
+    /* These error checks for the Master mode according to DataSheet instructions (See page 1006 "I2C Master Interrupts")
+     * ERROR, ARBLST and CLKTO end the transaction (STOP if the bus is still owned), the result is
+     * saved for I2c_GetLastError() and the callback function isn't called */
+    if(I2c_MasterError(I2c0, (volatile uint32*)I2C_0_BASE_ADDRESS) == TRUE)
+    {
         /* use keyword return to get out of the ISR */
         return;
     }
@@ -163,25 +201,19 @@ void I2C0_ISR(void)
  *******************************************************************************/
 void I2C1_ISR(void)
 {
-    /******************************** Errors Checking Before Calling the Callback Function ********************************/
-    /* These error checks for the Master mode according to DataSheet instructions (See page 1006 "I2C Master Interrupts") */
-
-    /* First Check for ERROR Bit in MCS to ensure that
-     *  that an error didn't occur during the last transaction */
-    if( BIT_IS_SET( (*(volatile uint32*)(I2C_1_BASE_ADDRESS + I2C_MCS_REG_OFFSET))  , MCR_REG_ERROR_POS) )
+    /* Serve interrupt driven master transfer first, its errors are reported to its callback */
+    if(I2c_ItIsrHandler(I2c1, (volatile uint32*)I2C_1_BASE_ADDRESS) == TRUE)
     {
-        /* There's an error occurred in the last transaction, don't call the callback function */
-        /* Future work: There Should be function to handle the error occurred in the last transaction */
-
-        /* use keyword return to get out of the ISR */
+        /* Pending slave interrupts enter the ISR again */
         return;
     }
-    /* Second, Check for ARBLST bit to ensure that arbitration has not been lost */
-    else if (BIT_IS_SET( (*(volatile uint32*)(I2C_1_BASE_ADDRESS + I2C_MCS_REG_OFFSET))  , MCR_REG_ARBLST_POS) )
-    {
-        /* The Master lost the Arbitration, don't call the callback function */
-        /* Future work: There Should be function to handle the arbitration loss */
 
+    /******************************** Errors Checking Before Calling the Callback Function ********************************/
+    /* These error checks for the Master mode according to DataSheet instructions (See page 1006 "I2C Master Interrupts")
+     * ERROR, ARBLST and CLKTO end the transaction (STOP if the bus is still owned), the result is
+     * saved for I2c_GetLastError() and the callback function isn't called */
+    if(I2c_MasterError(I2c1, (volatile uint32*)I2C_1_BASE_ADDRESS) == TRUE)
+    {
         /* use keyword return to get out of the ISR */
         return;
     }
@@ -276,25 +308,19 @@ void I2C1_ISR(void)
  *******************************************************************************/
 void I2C2_ISR(void)
 {
-    /******************************** Errors Checking Before Calling the Callback Function ********************************/
-    /* These error checks for the Master mode according to DataSheet instructions (See page 1006 "I2C Master Interrupts") */
-
-    /* First Check for ERROR Bit in MCS to ensure that
-     *  that an error didn't occur during the last transaction */
-    if( BIT_IS_SET( (*(volatile uint32*)(I2C_2_BASE_ADDRESS + I2C_MCS_REG_OFFSET))  , MCR_REG_ERROR_POS) )
+    /* Serve interrupt driven master transfer first, its errors are reported to its callback */
+    if(I2c_ItIsrHandler(I2c2, (volatile uint32*)I2C_2_BASE_ADDRESS) == TRUE)
     {
-        /* There's an error occurred in the last transaction, don't call the callback function */
-        /* Future work: There Should be function to handle the error occurred in the last transaction */
-
-        /* use keyword return to get out of the ISR */
+        /* Pending slave interrupts enter the ISR again */
         return;
     }
-    /* Second, Check for ARBLST bit to ensure that arbitration has not been lost */
-    else if (BIT_IS_SET( (*(volatile uint32*)(I2C_2_BASE_ADDRESS + I2C_MCS_REG_OFFSET))  , MCR_REG_ARBLST_POS ) )
-    {
-        /* The Master lost the Arbitration, don't call the callback function */
-        /* Future work: There Should be function to handle the arbitration loss */
 
+    /******************************** Errors Checking Before Calling the Callback Function ********************************/
+    /* These error checks for the Master mode according to DataSheet instructions (See page 1006 "I2C Master Interrupts")
+     * ERROR, ARBLST and CLKTO end the transaction (STOP if the bus is still owned), the result is
+     * saved for I2c_GetLastError() and the callback function isn't called */
+    if(I2c_MasterError(I2c2, (volatile uint32*)I2C_2_BASE_ADDRESS) == TRUE)
+    {
         /* use keyword return to get out of the ISR */
         return;
     }
@@ -389,25 +415,19 @@ void I2C2_ISR(void)
  *******************************************************************************/
 void I2C3_ISR(void)
 {
-    /******************************** Errors Checking Before Calling the Callback Function ********************************/
-    /* These error checks for the Master mode according to DataSheet instructions (See page 1006 "I2C Master Interrupts") */
-
-    /* First Check for ERROR Bit in MCS to ensure that
-     *  that an error didn't occur during the last transaction */
-    if( BIT_IS_SET( (*(volatile uint32*)(I2C_3_BASE_ADDRESS + I2C_MCS_REG_OFFSET))  , MCR_REG_ERROR_POS ) )
+    /* Serve interrupt driven master transfer first, its errors are reported to its callback */
+    if(I2c_ItIsrHandler(I2c3, (volatile uint32*)I2C_3_BASE_ADDRESS) == TRUE)
     {
-        /* There's an error occurred in the last transaction, don't call the callback function */
-        /* Future work: There Should be function to handle the error occurred in the last transaction */
-
-        /* use keyword return to get out of the ISR */
+        /* Pending slave interrupts enter the ISR again */
         return;
     }
-    /* Second, Check for ARBLST bit to ensure that arbitration has not been lost */
-    else if (BIT_IS_SET( (*(volatile uint32*)(I2C_3_BASE_ADDRESS + I2C_MCS_REG_OFFSET))  , MCR_REG_ARBLST_POS ) )
-    {
-        /* The Master lost the Arbitration, don't call the callback function */
-        /* Future work: There Should be function to handle the arbitration loss */
 
+    /******************************** Errors Checking Before Calling the Callback Function ********************************/
+    /* These error checks for the Master mode according to DataSheet instructions (See page 1006 "I2C Master Interrupts")
+     * ERROR, ARBLST and CLKTO end the transaction (STOP if the bus is still owned), the result is
+     * saved for I2c_GetLastError() and the callback function isn't called */
+    if(I2c_MasterError(I2c3, (volatile uint32*)I2C_3_BASE_ADDRESS) == TRUE)
+    {
         /* use keyword return to get out of the ISR */
         return;
     }
@@ -568,6 +588,12 @@ uint8 I2c_Init(const I2c_Config* ConfigPtr)
     /* Variable used to calculate TPR in it */
     uint32 Tpr = 0;
 
+    /* Achieved SCL frequency */
+    uint32 Frequency = 0;
+
+    /* Clock low timeout count */
+    uint32 TimeoutCount = 0;
+
     /* Pointer to Requested I2c Base address Register */
     volatile uint32* I2c_Ptr = NULL_PTR;
 
@@ -582,6 +608,15 @@ uint8 I2c_Init(const I2c_Config* ConfigPtr)
     }
     /* There is no need for else because if the if statement occurred, a return will happened */
 
+    /* Calculate TPR (see I2c_SolveClock) before touching the module */
+    Frequency = I2c_SolveClock(ConfigPtr->ClkValue, ConfigPtr->I2cFreq, &Tpr);
+    if(Frequency == 0)
+    {
+        /* Requested frequency can't be generated from the System Clock. Return with RET_NOT_OK */
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
     /* Function Call to choose which I2c Module will be used */
     I2c_ChooseModule(ConfigPtr, &I2c_Ptr);
 
@@ -591,6 +626,15 @@ uint8 I2c_Init(const I2c_Config* ConfigPtr)
     /* Delay to waste sometime to ensure clock stability */
     delay = SYSCTL_RCGCI2C_REG;
 
+    /* High Speed mode (I2C Freq is bigger than Fast-mode plus) needs an I2C module which supports it,
+     * PP Register is read only and needs the module clock, nothing is configured yet */
+    if( (ConfigPtr->I2cFreq > I2C_FREQ_FAST_PLUS) &&
+        BIT_IS_CLEAR( (*(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_PP_REG_OFFSET)), PP_REG_HS_POS) )
+    {
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
     /*********************** I2C Configurations **********************/
 
     /* First, Set the Mode of I2C module in MCR Register */
@@ -613,39 +657,39 @@ uint8 I2c_Init(const I2c_Config* ConfigPtr)
 
     }
 
-    /* Second, TPR Calculations */
-    /********************* Frequency Calculations **********************
-     *            TPR = (Freq / (2*(SCL_LP + SCL_HP)*SCL_CLK)          *
-     *                   Freq = System Clock Frequency                 *
-     *                   TPR = Timer Period (0->127)                   *
-     *              SCL_LP = Serial Clock Line Low Phase               *
-     *         (SCL_LP = 0x6 in Standard, Fast and FastPlus Modes)     *
-     *                  (SCL_LP = 0x2 in High Speed Mode)              *
-     *                                                                 *
-     *              SCL_HP = Serial Clock Line High Phase              *
-     *         (SCL_HP = 0x4 in Standard, Fast and FastPlus Modes)     *
-     *                  (SCL_HP = 0x1 in High Speed Mode)              *
-     *           SCL_CLK= Serial Clock Line Frequency needed           *
-     ******************************************************************/
-    /* Check if the I2C Freq is bigger than 1 MHz then High Speed mode selected */
-    if(ConfigPtr->I2cFreq > ONE_MEGA_HERTZ_CLK_VALUE)
+    /* Second, Write the solved TPR Value */
+    if(ConfigPtr->I2cFreq > I2C_FREQ_FAST_PLUS)
     {
-        /* Calculate the TPR Value using LP & HP Values for High Speed Mode */
-        Tpr = ( ( (ConfigPtr->ClkValue) / (2 *(SCL_LP_HIGH_SPEED + SCL_HP_HIGH_SPEED) * (ConfigPtr->I2cFreq) ) ) - 1 );
-
-        /* Enable High Speed Mode */
-        *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MTPR_REG_OFFSET) = (MTPR_REG_HS_ENABLE << MTPR_REG_HS_POS );
-
+        /* Enable High Speed Mode and write the corresponding TPR Value */
+        *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MTPR_REG_OFFSET) = (MTPR_REG_HS_ENABLE << MTPR_REG_HS_POS ) | Tpr;
+        g_i2cHighSpeed[ConfigPtr->I2cNum] = TRUE;
     }
     else
     {
-        /* Calculate the TPR Value using LP & HP Values for Standard, Fast and FastPlus Modes */
-        Tpr = ( ( (ConfigPtr->ClkValue) / (2 *(SCL_LP_NORMAL + SCL_HP_NORMAL) * (ConfigPtr->I2cFreq) ) ) - 1 );
-
+        /* Write the corresponding TPR Value (Standard, Fast and FastPlus Modes) */
+        *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MTPR_REG_OFFSET) = Tpr;
+        g_i2cHighSpeed[ConfigPtr->I2cNum] = FALSE;
     }
 
-    /* Write the corresponding TPR Value */
-    *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MTPR_REG_OFFSET) |= Tpr;
+    g_i2cFrequency[ConfigPtr->I2cNum] = Frequency;
+    g_i2cLastError[ConfigPtr->I2cNum] = I2C_STATUS_OK;
+
+    /* Third, Clock low timeout: a slave holding SCL low ends the master operation with CLKTO
+     * Count is in steps of 16 SCL periods, so Count = (SCL_CLK * Timeout) / 16 */
+    if( ( (ConfigPtr->I2cMode) & I2C_MODE_MASTER) == I2C_MODE_MASTER )
+    {
+        TimeoutCount = (Frequency * I2C_CLOCK_TIMEOUT_MS) / (1000UL * MCLKOCNT_REG_CNTL_SCALE);
+        if(TimeoutCount < MCLKOCNT_REG_CNTL_MIN)
+        {
+            TimeoutCount = MCLKOCNT_REG_CNTL_MIN;
+        }
+        else if(TimeoutCount > MCLKOCNT_REG_CNTL_MAX)
+        {
+            /* Shorter than I2C_CLOCK_TIMEOUT_MS above Standard mode */
+            TimeoutCount = MCLKOCNT_REG_CNTL_MAX;
+        }
+        *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCLKOCNT_REG_OFFSET) = TimeoutCount;
+    }
 
     /* Check which mode is selected to enable the corresponding interrupts of it */
     if( ( (ConfigPtr->I2cMode) && I2C_MODE_MASTER) == TRUE )
@@ -662,384 +706,562 @@ uint8 I2c_Init(const I2c_Config* ConfigPtr)
     return RET_OK;
 }
 
-
 /*******************************************************************************
- * @fn              uint8 I2c_Transmit(const I2c_Config* ConfigPtr, const uint8* DataPtr, uint8 BufferSize)
- * @brief           Function to transmit Data through I2C (For both Master or Slave)
- * @param (in):     ConfigPtr - Pointer to configuration set
- *                  DataPtr   - Pointer to data that will be sent
- *                  BufferSize- Number of bytes that will be sent in multiple mode (Master mode only)
- * @param (out):    None
+ * @fn              uint32 I2c_SolveClock(uint32 ClkValue, uint32 I2cFreq, uint32* Tpr)
+ * @brief           Function to calculate TPR value giving the fastest SCL clock
+ *                  which doesn't exceed the requested frequency
+ *
+ *            SCL_CLK = Freq / (2 * (SCL_LP + SCL_HP) * (1 + TPR))
+ *                   Freq = System Clock Frequency
+ *                   TPR = Timer Period (1->127)
+ *              SCL_LP = Serial Clock Line Low Phase
+ *         (SCL_LP = 0x6 in Standard, Fast and FastPlus Modes)
+ *                  (SCL_LP = 0x2 in High Speed Mode)
+ *              SCL_HP = Serial Clock Line High Phase
+ *         (SCL_HP = 0x4 in Standard, Fast and FastPlus Modes)
+ *                  (SCL_HP = 0x1 in High Speed Mode)
+ *
+ *                  So (1 + TPR) = ceil(Freq / (2 * (SCL_LP + SCL_HP) * I2cFreq))
+ *                  (plain division truncates and gives a faster SCL than requested)
+ * @param (in):     ClkValue - System Clock in Hz
+ *                  I2cFreq  - Maximum requested SCL frequency in Hz, High Speed mode
+ *                             is used above I2C_FREQ_FAST_PLUS
+ * @param (out):    Tpr      - TPR value
  * @param (inout):  None
- * @return          Return Status (RET_OK if everything is ok)
- *****************************************************************************/
-uint8 I2c_Transmit(const I2c_Config* ConfigPtr, const uint8* DataPtr, uint8 BufferSize)
+ * @return          Achieved SCL frequency in Hz (0 if I2cFreq is 0, above
+ *                  I2C_FREQ_HIGH_SPEED or too slow for the System Clock)
+ *******************************************************************************/
+uint32 I2c_SolveClock(uint32 ClkValue, uint32 I2cFreq, uint32* Tpr)
 {
-    /* Pointer to Requested I2c Base address Register */
-    volatile uint32* I2c_Ptr = NULL_PTR;
+    /* Number of System Clocks in one SCL period for (1 + TPR) = 1 */
+    uint32 PeriodUnit = 0;
 
-    /* Variable to iterate through it */
-    uint8 iteration = 0;
+    /* (1 + TPR) value */
+    uint32 TprPlusOne = 0;
 
-    /* Check if the input configuration pointer to structure is Not a Null Pointer */
-    if(NULL_PTR == ConfigPtr)
+    if( (0 == ClkValue) || (0 == I2cFreq) || (I2cFreq > I2C_FREQ_HIGH_SPEED) || (NULL_PTR == Tpr) )
     {
-        /* ConfigPtr is a Null Pointer. Return with RET_NOT_OK */
-        return RET_NOT_OK;
+        return 0;
     }
     /* There is no need for else because if the if statement occurred, a return will happened */
 
-    /* Function Call to choose which I2c Module will be used */
-    I2c_ChooseModule(ConfigPtr, &I2c_Ptr);
+    PeriodUnit = (I2cFreq > I2C_FREQ_FAST_PLUS) ? (2U * (SCL_LP_HIGH_SPEED + SCL_HP_HIGH_SPEED)) :
+                                                  (2U * (SCL_LP_NORMAL + SCL_HP_NORMAL));
 
-    /* Check if the I2cMode is master or slave to operate with the right registers */
-    if( ( (ConfigPtr->I2cMode) & I2C_MODE_MASTER) == I2C_MODE_MASTER )
+    /* ceil(ClkValue / (PeriodUnit * I2cFreq)) */
+    TprPlusOne = ClkValue / (PeriodUnit * I2cFreq);
+    if( ( (uint64)TprPlusOne * PeriodUnit * I2cFreq ) < ClkValue )
     {
-        /* Master mode selected, operate with Master registers */
-
-        /* Check if the Transmit Mode is Single or multiple data transmission */
-        if( (ConfigPtr->I2cTransmitMode) == I2C_TRANSMIT_MODE_SINGLE )
-        {
-            /*
-             * Single Data transmission selected
-             * Follow the Master Single TRANSMIT Flow chart in DataSheet (Page 1008)
-             */
-
-            /* First, write the slave address to MSA Register */
-            *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MSA_REG_OFFSET) =  (ConfigPtr->I2cSlaveAddress << 1);
-
-            /* Second, Write the data on the MDR Register */
-            *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MDR_REG_OFFSET) = (*DataPtr);
-
-            /* Third, Wait until BUSBSY bit in MCS Register = 0*/
-            while(BIT_IS_SET( (*(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) ) , MCR_REG_BUSBSY_POS) );
-
+        TprPlusOne++;
+    }
 
-            /* Forth, write the RUN, START, and STOP Bits in MCS Register */
-            *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) = ( (0b00111) );
+    /* Timer Period can't be lower than 1 */
+    if(TprPlusOne < (MTPR_REG_TPR_MIN + 1U))
+    {
+        TprPlusOne = MTPR_REG_TPR_MIN + 1U;
+    }
 
-            /* Fifth, Wait until BUSY bit in MCS Register = 0*/
-            while( ( (*(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) ) && (MCR_REG_BUSY_ENABLE << MCR_REG_BUSY_POS) ) == FALSE);
+    /* Slowest clock is still faster than requested */
+    if(TprPlusOne > (MTPR_REG_TPR_MAX + 1U))
+    {
+        return 0;
+    }
 
+    *Tpr = TprPlusOne - 1U;
 
-            /* Sixth, Check for ERROR But in MCS Register */
-            if( ( (*(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) ) & (MCR_REG_ERROR_ENABLE << MCR_REG_ERROR_POS) ) == FALSE)
-            {
-                /* There are no errors occurred, return with RET_Ok */
-                return RET_OK;
-            }
-            else
-            {
-                /* There is an error occurred, return with RET_NOT_OK */
-                /* Future work: There should be an Error Service Algorithm Function
-                 * which will be called here to operate with this error */
-                return RET_NOT_OK;
-            }
-        }
+    return ClkValue / (PeriodUnit * TprPlusOne);
+}
 
-        else if( (ConfigPtr->I2cTransmitMode) == I2C_TRANSMIT_MODE_MULTIPLE)
-        {
-            /*
-             * Multiple Data transmission selected
-             * Follow the Master TRANSMIT of Multiple Data Bytes Flow chart in DataSheet (Page 1010)
-             */
+/*******************************************************************************
+ * @fn              uint32 I2c_GetFrequency(I2c_Instance I2cNum)
+ * @brief           Function to get the SCL frequency achieved by I2c_Init
+ * @param (in):     I2cNum - I2C instance
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          SCL frequency in Hz (0 if the instance is not initialized)
+ *******************************************************************************/
+uint32 I2c_GetFrequency(I2c_Instance I2cNum)
+{
+    if(I2cNum >= I2C_NUMBER_OF_INSTANCES)
+    {
+        return 0;
+    }
 
-            /* First, write the slave address to MSA Register */
-            *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MSA_REG_OFFSET) =  ConfigPtr->I2cSlaveAddress;
+    return g_i2cFrequency[I2cNum];
+}
 
-            /* Second, Write the data on the MDR Register */
-            *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MDR_REG_OFFSET) = (*DataPtr);
+/*******************************************************************************
+ * @fn              uint8 I2c_BusRecover(const I2c_Config* ConfigPtr)
+ * @brief           Function to clear a stuck bus (Master mode): SCL and SDA are taken
+ *                  from the I2C module as GPIO, SCL is clocked (up to 9 pulses) until
+ *                  the slave holding SDA low releases it, then STOP is sent and the
+ *                  pins are given back to the I2C module
+ * @note            GPIO port clock and I2C pins must be configured by the application,
+ *                  the bus is clocked at Standard mode speed or slower
+ * @note            It busy waits the SCL pulses, so it MUST NOT be called from an ISR,
+ *                  and the bus is cleared only when the master is idle (no master
+ *                  operation nor interrupt driven transfer running) or disabled
+ * @param (in):     ConfigPtr - Pointer to configuration set
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Return Status (RET_OK if both lines are high at the end,
+ *                  RET_NOT_OK if they aren't or the master is not idle)
+ *******************************************************************************/
+uint8 I2c_BusRecover(const I2c_Config* ConfigPtr)
+{
+    /* Pointer to Requested I2c Base address Register */
+    volatile uint32* I2c_Ptr = NULL_PTR;
 
-            /* Third, Wait until BUSBSY bit in MCS Register = 0*/
-            while( BIT_IS_SET( (*(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) ) , MCR_REG_BUSBSY_POS) );
+    /* Pointer to GPIO port of I2C pins */
+    volatile uint32* Gpio_Ptr = NULL_PTR;
 
-            /* Forth, write the RUN, and START Bits only in MCS Register
-             * STOP Bit didn't set because Repeated start is used right now */
-            *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) = ( (MCR_REG_START_ENABLE << MCR_REG_START_POS)|
-                    (MCR_REG_RUN_ENABLE   << MCR_REG_RUN_POS) );
+    /* SCL and SDA pins masks */
+    uint32 Scl = 0;
+    uint32 Sda = 0;
 
-            /* For loop to iterate till BufferSize value
-             * Iteration starts from 1 because the first byte is already sent in the second operation in the algorithm */
-            for(iteration = 1; iteration < BufferSize; iteration++)
-            {
-                /* Fifth, Wait until BUSY bit in MCS Register = 0*/
-                while( ( (*(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) ) && (MCR_REG_BUSY_ENABLE << MCR_REG_BUSY_POS) ) == FALSE);
+    /* Pins direction and open drain saved before the bus clear */
+    uint32 SavedDir = 0;
+    uint32 SavedOdr = 0;
 
-                /* Sixth, Check for ERROR But in MCS Register */
-                if( ( (*(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) ) && (MCR_REG_ERROR_ENABLE << MCR_REG_ERROR_POS) ) == FALSE)
-                {
-                    /*
-                     * There are no errors occurred,
-                     * Increment the pointer to the next element of the Buffer
-                     * then send this byte
-                     */
-                    DataPtr++;
+    /* Delay of half SCL period */
+    uint32 HalfPeriod = 0;
 
-                    /* Write the data on the MDR Register */
-                    *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MDR_REG_OFFSET) = (*DataPtr);
+    /* Clock pulses sent */
+    uint8 Clock = 0;
 
-                    /* Seventh, Write the RUN Bit in MCS Register */
-                    *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) = ( (MCR_REG_RUN_ENABLE << MCR_REG_RUN_POS) );
+    /* Check if the input configuration pointer to structure is Not a Null Pointer */
+    if( (NULL_PTR == ConfigPtr) || (ConfigPtr->I2cNum >= I2C_NUMBER_OF_INSTANCES) )
+    {
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
 
-                }
-                else
-                {
-                    /*
-                     * There is an error occurred,
-                     * Check for Arbitration Lost Bit in MCS Register = 0
-                     * note: in DataSheet they check on 1, i'm checking here on 0 to save the else instructions
-                     */
-                    if( ( (*(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) ) && (MCR_REG_ARBLST_ENABLE << MCR_REG_ARBLST_POS) ) == FALSE)
-                    {
-                        /* Write the STOP Bit in MCS Register */
-                        *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) = ( (MCR_REG_STOP_ENABLE << MCR_REG_STOP_POS) );
-                    }
+    /* Function Call to choose which I2c Module will be used */
+    I2c_ChooseModule(ConfigPtr, &I2c_Ptr);
 
-                    /* if the 'if condition' didn't happen, then the I2C Controller Lost Arbitration, return with RET_NOT_OK */
-                    /* Future work: There should be an Error Service Algorithm Function
-                     * which will be called here to operate with this error */
-                    return RET_NOT_OK;
+    /* Enabled master still running: taking its pins would corrupt the operation */
+    if( BIT_IS_SET( (*(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCR_REG_OFFSET)), MCR_REG_MFE_POS) &&
+        ( BIT_IS_SET( (*(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET)), MCR_REG_BUSY_POS) ||
+          (g_i2cItTransfer[ConfigPtr->I2cNum].Busy == TRUE) ) )
+    {
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
 
-                }
-            }
-            /* Data should be sent successfully or there's an error happened which stopped the data transfer
-             * if there's an error occurred then this piece of code won't be accessed */
+    /* Nothing to clear if both lines are high */
+    if( BIT_IS_SET( (*(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MBMON_REG_OFFSET)), MBMON_REG_SCL_POS) &&
+        BIT_IS_SET( (*(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MBMON_REG_OFFSET)), MBMON_REG_SDA_POS) )
+    {
+        return RET_OK;
+    }
 
-            /* Write the STOP and RUN Bits in MCS Register  */
-            *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) = ( (MCR_REG_STOP_ENABLE << MCR_REG_STOP_POS) |
-                    (MCR_REG_RUN_ENABLE  << MCR_REG_RUN_POS ) );
-            /* Wait until BUSY bit in MCS Register = 0*/
-            while( ( (*(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) ) && (MCR_REG_BUSY_ENABLE << MCR_REG_BUSY_POS) ) == FALSE);
+    Gpio_Ptr   = (volatile uint32*)g_i2cGpioBase[ConfigPtr->I2cNum];
+    Scl        = (1UL << g_i2cSclPin[ConfigPtr->I2cNum]);
+    Sda        = (1UL << g_i2cSdaPin[ConfigPtr->I2cNum]);
+    HalfPeriod = ConfigPtr->ClkValue / (2UL * I2C_FREQ_STANDARD);
 
+    SavedDir = *(volatile uint32*)((volatile uint8*)Gpio_Ptr + I2C_GPIO_DIR_REG_OFFSET);
+    SavedOdr = *(volatile uint32*)((volatile uint8*)Gpio_Ptr + I2C_GPIO_ODR_REG_OFFSET);
 
-            /* Check for ERROR But in MCS Register */
-            if( ( (*(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) ) && (MCR_REG_ERROR_ENABLE << MCR_REG_ERROR_POS) ) == FALSE)
-            {
-                /* There are no errors occurred, return with RET_Ok */
-                return RET_OK;
-            }
-            else
-            {
-                /* There is an error occurred, return with RET_NOT_OK */
-                /* Future work: There should be an Error Service Algorithm Function
-                 * which will be called here to operate with this error */
-                return RET_NOT_OK;
-            }
+    /* Take the pins: SCL open drain output released (high), SDA input */
+    *(volatile uint32*)((volatile uint8*)Gpio_Ptr + I2C_GPIO_DATA_REG_OFFSET)  |= (Scl | Sda);
+    *(volatile uint32*)((volatile uint8*)Gpio_Ptr + I2C_GPIO_ODR_REG_OFFSET)   |= (Scl | Sda);
+    *(volatile uint32*)((volatile uint8*)Gpio_Ptr + I2C_GPIO_DIR_REG_OFFSET)    = (SavedDir | Scl) & ~Sda;
+    *(volatile uint32*)((volatile uint8*)Gpio_Ptr + I2C_GPIO_AFSEL_REG_OFFSET) &= ~(Scl | Sda);
 
-        }
-    }
-    else if( ( (ConfigPtr->I2cMode) & I2C_MODE_SLAVE) == I2C_MODE_SLAVE )
+    /* Clock the slave until it has shifted out the rest of its byte and released SDA */
+    for(Clock = 0; (Clock < I2C_BUS_CLEAR_CLOCKS) &&
+                   ( ( (*(volatile uint32*)((volatile uint8*)Gpio_Ptr + I2C_GPIO_DATA_REG_OFFSET)) & Sda) == 0 ); Clock++)
     {
-        /* Slave mode selected, operate with Slave registers */
-        /* Note: There's no Multiple data transmission in slave mode */
-
-        /* First, write the OWN slave address to SOAR */
-        *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_SOAR_REG_OFFSET) = (ConfigPtr->I2cSlaveAddress);
-
-        /* Second, Enable I2C Slave Operation from SCSR Register */
-        *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_SCSR_REG_OFFSET) = ( SCSR_REG_DA_ENABLE << SCSR_REG_DA_POS );
-
-        /* Third, Wait until TREQ Bit in SCSR Register = 1 */
-        while( ( (*(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_SCSR_REG_OFFSET) ) && (SCSR_REG_TREQ_ENABLE << SCSR_REG_TREQ_POS ) ) == TRUE);
+        *(volatile uint32*)((volatile uint8*)Gpio_Ptr + I2C_GPIO_DATA_REG_OFFSET) &= ~Scl;
+        I2c_Delay(HalfPeriod);
+        *(volatile uint32*)((volatile uint8*)Gpio_Ptr + I2C_GPIO_DATA_REG_OFFSET) |= Scl;
+        I2c_Delay(HalfPeriod);
+    }
 
-        /* Write data to SDR register */
-        *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_SDR_REG_OFFSET) = (*DataPtr);
+    /* STOP: SDA low while SCL is low, then SDA high while SCL is high */
+    *(volatile uint32*)((volatile uint8*)Gpio_Ptr + I2C_GPIO_DATA_REG_OFFSET) &= ~Scl;
+    I2c_Delay(HalfPeriod);
+    *(volatile uint32*)((volatile uint8*)Gpio_Ptr + I2C_GPIO_DATA_REG_OFFSET) &= ~Sda;
+    *(volatile uint32*)((volatile uint8*)Gpio_Ptr + I2C_GPIO_DIR_REG_OFFSET)  |= Sda;
+    I2c_Delay(HalfPeriod);
+    *(volatile uint32*)((volatile uint8*)Gpio_Ptr + I2C_GPIO_DATA_REG_OFFSET) |= Scl;
+    I2c_Delay(HalfPeriod);
+    *(volatile uint32*)((volatile uint8*)Gpio_Ptr + I2C_GPIO_DATA_REG_OFFSET) |= Sda;
+    I2c_Delay(HalfPeriod);
+
+    /* Give the pins back to the I2C module */
+    *(volatile uint32*)((volatile uint8*)Gpio_Ptr + I2C_GPIO_DIR_REG_OFFSET)    = SavedDir;
+    *(volatile uint32*)((volatile uint8*)Gpio_Ptr + I2C_GPIO_ODR_REG_OFFSET)    = SavedOdr;
+    *(volatile uint32*)((volatile uint8*)Gpio_Ptr + I2C_GPIO_AFSEL_REG_OFFSET) |= (Scl | Sda);
+
+    if( BIT_IS_SET( (*(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MBMON_REG_OFFSET)), MBMON_REG_SCL_POS) &&
+        BIT_IS_SET( (*(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MBMON_REG_OFFSET)), MBMON_REG_SDA_POS) )
+    {
+        return RET_OK;
     }
-    return RET_OK;
-}
 
+    return RET_NOT_OK;
+}
 
 /*******************************************************************************
- * @fn              uint8 I2c_Receive(const I2c_Config* ConfigPtr, uint8* DataPtr, uint8 BufferSize)
- * @brief           Function to Receive Data through I2C (For both Master or Slave)
- * @param (in):     ConfigPtr - Pointer to configuration set
- *                  BufferSize- Number of bytes that will be received in multiple mode (Master mode only)
- * @param (out):    DataPtr   - Pointer to data that will be received
+ * @fn              uint8 I2c_Service(I2c_Instance I2cNum)
+ * @brief           Function to run the deferred work of the interrupt driven master
+ *                  transfer: after an arbitration loss, I2C ISR only schedules the
+ *                  retry, it is restarted from here once the backoff is over and the
+ *                  bus is free (or ends with I2C_STATUS_ARBITRATION_LOST if the bus
+ *                  stays busy, CallBack is then called from here with IRQs masked)
+ * @note            It MUST be called periodically (main loop or timer) while interrupt
+ *                  driven transfers are used, never from I2C ISR
+ * @param (in):     I2cNum - I2C instance
+ * @param (out):    None
  * @param (inout):  None
- * @return          Return Status (RET_OK if everything is ok)
- *****************************************************************************/
-uint8 I2c_Receive(const I2c_Config* ConfigPtr, uint8* DataPtr, uint8 BufferSize)
+ * @return          Return Status (RET_NOT_OK if the I2C instance is invalid)
+ *******************************************************************************/
+uint8 I2c_Service(I2c_Instance I2cNum)
 {
-    /* Pointer to Requested SSI Base address Register */
+    /* Pointer to Requested I2c Base address Register */
     volatile uint32* I2c_Ptr = NULL_PTR;
 
-    /* Variable to iterate through it */
-    uint8 iteration = 0;
+    /* Interrupt driven transfer state of requested I2C */
+    I2c_ItTransfer* Transfer = NULL_PTR;
 
-    /* Check if the input configuration pointer to structure is Not a Null Pointer */
-    if(NULL_PTR == ConfigPtr)
+    /* Saved interrupts state */
+    uint32 Key = 0;
+
+    if(I2cNum >= I2C_NUMBER_OF_INSTANCES)
     {
-        /* ConfigPtr is a Null Pointer. Return with RET_NOT_OK */
         return RET_NOT_OK;
     }
     /* There is no need for else because if the if statement occurred, a return will happened */
 
-    /* Function Call to choose which I2c Module will be used */
-    I2c_ChooseModule(ConfigPtr, &I2c_Ptr);
+    I2c_Ptr  = (volatile uint32*)g_i2cBaseAddress[I2cNum];
+    Transfer = &g_i2cItTransfer[I2cNum];
 
-    /* Check if the I2cMode is master or slave to operate with the right registers */
-    if( ( (ConfigPtr->I2cMode) & I2C_MODE_MASTER) == I2C_MODE_MASTER )
-    {
-        /* Master mode selected, operate with Master registers */
+    /* I2C ISR must not run between the bus check and START */
+    Key = I2C_ENTER_CRITICAL();
 
-        /* Check if the Receive Mode is Single or multiple data transmission */
-        if( (ConfigPtr->I2cReceiveMode) == I2C_RECEIVE_MODE_SINGLE )
+    if( (Transfer->Busy == TRUE) && (Transfer->RetryPending == TRUE) )
+    {
+        if(Transfer->RetryWait != 0)
         {
-            /*
-             * Single Data reception selected
-             * Follow the Master Single RECEIVE Flow chart in DataSheet (Page 1009)
-             */
+            /* Backoff, the other master may start another transfer */
+            Transfer->RetryWait--;
+        }
+        else if( BIT_IS_CLEAR( (*(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET)), MCR_REG_BUSBSY_POS) )
+        {
+            /* Restart the current transaction from its first byte */
+            Transfer->RetryPending = FALSE;
+            I2c_ItLoad(Transfer);
+            Transfer->MasterCode = g_i2cHighSpeed[I2cNum];
+            I2c_ItBegin(I2c_Ptr, Transfer);
+        }
+        else if(Transfer->RetryBusy != 0)
+        {
+            Transfer->RetryBusy--;
+        }
+        else
+        {
+            /* The other master keeps the bus */
+            Transfer->RetryPending = FALSE;
+            Transfer->Status = I2C_STATUS_ARBITRATION_LOST;
+            I2c_ItFinish(I2c_Ptr, Transfer);
+        }
+    }
 
-            /* First, write the slave address to MSA Register and write 1 on R/W bit to tell I2C Controller that Master will receive data */
-            *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MSA_REG_OFFSET) =  ( (ConfigPtr->I2cSlaveAddress << 1) | (1 << 0) ) ;
+    I2C_EXIT_CRITICAL(Key);
 
+    return RET_OK;
+}
 
+/*******************************************************************************
+ * @fn              uint8 I2c_GetLastError(I2c_Instance I2cNum)
+ * @brief           Function to get why the last blocking transfer (I2c_Transmit,
+ *                  I2c_Receive) failed, or the last master error served by I2C ISR
+ *                  (interrupt driven transfers report to their callback instead)
+ * @param (in):     I2cNum - I2C instance
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Status, You can find its value @ref I2C_STATUS
+ *******************************************************************************/
+uint8 I2c_GetLastError(I2c_Instance I2cNum)
+{
+    if(I2cNum >= I2C_NUMBER_OF_INSTANCES)
+    {
+        return I2C_STATUS_OK;
+    }
 
-            /* Second, Wait until BUSBSY bit in MCS Register = 0*/
-            while(BIT_IS_SET( (*(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET)), MCR_REG_BUSBSY_POS));
+    return g_i2cLastError[I2cNum];
+}
 
-            /* Third, write the RUN, START, and STOP Bits in MCS Register */
-            *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) = ( (MCR_REG_START_ENABLE << MCR_REG_START_POS)|
-                    (MCR_REG_RUN_ENABLE << MCR_REG_RUN_POS) | (MCR_REG_STOP_ENABLE << MCR_REG_STOP_POS) );
 
+/*******************************************************************************
+ * @fn              uint8 I2c_Transmit(const I2c_Config* ConfigPtr, const uint8* DataPtr, uint8 BufferSize)
+ * @brief           Function to transmit Data through I2C (For both Master or Slave)
+ *                  Master mode waits are bounded and arbitration loss is retried
+ * @param (in):     ConfigPtr - Pointer to configuration set
+ *                  DataPtr   - Pointer to data that will be sent
+ *                  BufferSize- Number of bytes that will be sent in multiple mode (Master mode only)
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Return Status (RET_OK if everything is ok), the failure reason
+ *                  is saved for I2c_GetLastError()
+ *****************************************************************************/
+uint8 I2c_Transmit(const I2c_Config* ConfigPtr, const uint8* DataPtr, uint8 BufferSize)
+{
+    /* Result of the last attempt */
+    uint8 Result = RET_NOT_OK;
 
+    /* Arbitration loss retries done */
+    uint8 Retries = 0;
 
-            /* Forth, Wait until BUSY bit in MCS Register = 0*/
-            while( ( (*(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) ) && (MCR_REG_BUSY_ENABLE << MCR_REG_BUSY_POS) ) == FALSE);
+    /* Check if the input configuration pointer to structure is Not a Null Pointer */
+    if(NULL_PTR == ConfigPtr)
+    {
+        /* ConfigPtr is a Null Pointer. Return with RET_NOT_OK */
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
 
+    Result = I2c_TransmitOnce(ConfigPtr, DataPtr, BufferSize);
 
-            /* Fifth, Check for ERROR But in MCS Register */
-            if( ( (*(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) ) & (MCR_REG_ERROR_ENABLE << MCR_REG_ERROR_POS) ) == FALSE)
-            {
-                /* There are no errors occurred */
+    /* Another master won the bus, try again after it is done with a growing backoff */
+    while( (Result != RET_OK) && (g_i2cLastError[ConfigPtr->I2cNum] == I2C_STATUS_ARBITRATION_LOST) &&
+           (Retries < I2C_ARBITRATION_RETRIES) )
+    {
+        I2c_Delay(I2C_ARBITRATION_BACKOFF << Retries);
+        Retries++;
+        Result = I2c_TransmitOnce(ConfigPtr, DataPtr, BufferSize);
+    }
 
-                /* Sixth, Read the data from MDR Register */
-                *DataPtr = (*(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MDR_REG_OFFSET));
+    return Result;
+}
 
-                /* return with RET_Ok */
-                return RET_OK;
-            }
-            else
-            {
-                /* There is an error occurred, return with RET_NOT_OK */
-                /* Future work: There should be an Error Service Algorithm Function
-                 * which will be called here to operate with this error */
-                return RET_NOT_OK;
-            }
-        }
-        else if( (ConfigPtr->I2cReceiveMode) == I2C_RECEIVE_MODE_MULTIPLE)
-        {
-            /*
-             * Multiple Data reception selected
-             * Follow the Master RECEIVE of Multiple Data Bytes Flow chart in DataSheet (Page 1011)
-             */
+/*******************************************************************************
+ * @fn              uint8 I2c_Receive(const I2c_Config* ConfigPtr, uint8* DataPtr, uint8 BufferSize)
+ * @brief           Function to Receive Data through I2C (For both Master or Slave)
+ *                  Master mode waits are bounded and arbitration loss is retried
+ * @param (in):     ConfigPtr - Pointer to configuration set
+ *                  BufferSize- Number of bytes that will be received in multiple mode (Master mode only)
+ * @param (out):    DataPtr   - Pointer to data that will be received
+ * @param (inout):  None
+ * @return          Return Status (RET_OK if everything is ok), the failure reason
+ *                  is saved for I2c_GetLastError()
+ *****************************************************************************/
+uint8 I2c_Receive(const I2c_Config* ConfigPtr, uint8* DataPtr, uint8 BufferSize)
+{
+    /* Result of the last attempt */
+    uint8 Result = RET_NOT_OK;
 
-            /* First, write the slave address to MSA Register */
-            *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MSA_REG_OFFSET) =  ConfigPtr->I2cSlaveAddress;
+    /* Arbitration loss retries done */
+    uint8 Retries = 0;
 
-            /* Second, Wait until BUSBSY bit in MCS Register = 0*/
-            while(BIT_IS_SET( (*(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) ), MCR_REG_BUSBSY_POS) );
+    /* Check if the input configuration pointer to structure is Not a Null Pointer */
+    if(NULL_PTR == ConfigPtr)
+    {
+        /* ConfigPtr is a Null Pointer. Return with RET_NOT_OK */
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
 
-            /* Third Forth, write the RUN, START and ACK Bits only in MCS Register
-             * STOP Bit didn't set because Repeated start is used right now */
-            *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) = ( (MCR_REG_START_ENABLE << MCR_REG_START_POS)|
-                    (MCR_REG_RUN_ENABLE << MCR_REG_RUN_POS) | (MCR_REG_ACK_ENABLE  << MCR_REG_ACK_POS) );
+    Result = I2c_ReceiveOnce(ConfigPtr, DataPtr, BufferSize);
 
-            /* For loop to iterate till BufferSize value
-             * Iteration starts from 0 because No data has been read yet
-             * Note: this loop will iterate till (BufferSize - 1) because
-             * the last byte will be read after the loop as the DataSheet said in the flow chart */
-            for(iteration = 0; iteration < (BufferSize-1); iteration++)
-            {
-                /* Fifth, Wait until BUSY bit in MCS Register = 0*/
-                while( ( (*(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) ) && (MCR_REG_BUSY_ENABLE << MCR_REG_BUSY_POS) ) == FALSE);
+    /* Another master won the bus, try again after it is done with a growing backoff */
+    while( (Result != RET_OK) && (g_i2cLastError[ConfigPtr->I2cNum] == I2C_STATUS_ARBITRATION_LOST) &&
+           (Retries < I2C_ARBITRATION_RETRIES) )
+    {
+        I2c_Delay(I2C_ARBITRATION_BACKOFF << Retries);
+        Retries++;
+        Result = I2c_ReceiveOnce(ConfigPtr, DataPtr, BufferSize);
+    }
 
-                /* Sixth, Check for ERROR But in MCS Register */
-                if( ( (*(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) ) && (MCR_REG_ERROR_ENABLE << MCR_REG_ERROR_POS) ) == FALSE)
-                {
-                    /* There are no errors occurred */
+    return Result;
+}
 
-                    /* read the data from the MDR Register */
-                    (*DataPtr) = ( *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MDR_REG_OFFSET) );
+/*******************************************************************************
+ * @fn              uint8 I2c_TransmitIT(const I2c_Config* ConfigPtr, const uint8* DataPtr, uint32 Length,
+ *                                       void (*CallBack)(uint8 Status))
+ * @brief           Function to start transmitting bytes to the configured slave (Master mode)
+ *                  It returns at once, START/RUN/STOP are sequenced from I2C ISR
+ *                  and CallBack is called from I2C ISR with the result
+ * @note            I2C NVIC interrupt must be enabled by the application
+ * @param (in):     ConfigPtr - Pointer to configuration set (I2cSlaveAddress is the slave)
+ *                  DataPtr   - Bytes to be sent (MUST stay valid until CallBack)
+ *                  Length    - Number of bytes
+ *                  CallBack  - Called with the result @ref I2C_STATUS (can be NULL_PTR)
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Return Status (RET_NOT_OK if a transfer is running or the bus is busy)
+ *******************************************************************************/
+uint8 I2c_TransmitIT(const I2c_Config* ConfigPtr, const uint8* DataPtr, uint32 Length, void (*CallBack)(uint8 Status))
+{
+    /* Check if the input pointers are Not Null Pointers */
+    if( (NULL_PTR == ConfigPtr) || (NULL_PTR == DataPtr) || (0 == Length) )
+    {
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
 
-                    /* Increment the pointer to the next element of the Buffer */
-                    DataPtr++;
+    return I2c_ItStartSingle(ConfigPtr, ConfigPtr->I2cSlaveAddress, DataPtr, Length, NULL_PTR, 0, CallBack);
+}
 
-                    /* Seventh, Write the RUN and ACK Bits in MCS Register */
-                    *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) = ( (MCR_REG_RUN_ENABLE << MCR_REG_RUN_POS) |
-                            (MCR_REG_ACK_ENABLE << MCR_REG_ACK_POS) );
-                }
-                else
-                {
-                    /*
-                     * There is an error occurred,
-                     * Check for Arbitration Lost Bit in MCS Register = 0
-                     * note: in DataSheet they check on 1, i'm checking here on 0 to save the else instructions
-                     */
-                    if( ( (*(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) ) && (MCR_REG_ARBLST_ENABLE << MCR_REG_ARBLST_POS) ) == FALSE)
-                    {
-                        /* Write the STOP Bit in MCS Register */
-                        *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) = ( (MCR_REG_STOP_ENABLE << MCR_REG_STOP_POS) );
-                    }
+/*******************************************************************************
+ * @fn              uint8 I2c_ReceiveIT(const I2c_Config* ConfigPtr, uint8* DataPtr, uint32 Length,
+ *                                      void (*CallBack)(uint8 Status))
+ * @brief           Function to start receiving bytes from the configured slave (Master mode)
+ *                  Every byte is acknowledged except the last one, then STOP is sent
+ *                  It returns at once, CallBack is called from I2C ISR with the result
+ * @note            I2C NVIC interrupt must be enabled by the application
+ * @param (in):     ConfigPtr - Pointer to configuration set (I2cSlaveAddress is the slave)
+ *                  Length    - Number of bytes
+ *                  CallBack  - Called with the result @ref I2C_STATUS (can be NULL_PTR)
+ * @param (out):    DataPtr   - Bytes received (MUST stay valid until CallBack)
+ * @param (inout):  None
+ * @return          Return Status (RET_NOT_OK if a transfer is running or the bus is busy)
+ *******************************************************************************/
+uint8 I2c_ReceiveIT(const I2c_Config* ConfigPtr, uint8* DataPtr, uint32 Length, void (*CallBack)(uint8 Status))
+{
+    /* Check if the input pointers are Not Null Pointers */
+    if( (NULL_PTR == ConfigPtr) || (NULL_PTR == DataPtr) || (0 == Length) )
+    {
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
 
-                    /* if the 'if condition' didn't happen, then the I2C Controller Lost Arbitration, return with RET_NOT_OK */
-                    /* Future work: There should be an Error Service Algorithm Function
-                     * which will be called here to operate with this error */
-                    return RET_NOT_OK;
+    return I2c_ItStartSingle(ConfigPtr, ConfigPtr->I2cSlaveAddress, NULL_PTR, 0, DataPtr, Length, CallBack);
+}
 
-                }
-            }
-            /* Data should be sent successfully or there's an error happened which stopped the data transfer
-             * if there's an error occurred then this piece of code won't be accessed */
+/*******************************************************************************
+ * @fn              uint8 I2c_WriteRead(const I2c_Config* ConfigPtr, uint8 Address, const uint8* TxBuffer,
+ *                                      uint32 TxLength, uint8* RxBuffer, uint32 RxLength)
+ * @brief           Function to write bytes then read bytes after a repeated START
+ *                  (no STOP between the phases, e.g. register address then its value)
+ *                  It waits until the transfer is done, serving it by polling when
+ *                  I2C NVIC interrupt is disabled (arbitration loss retries included)
+ * @param (in):     ConfigPtr - Pointer to configuration set (Master mode)
+ *                  Address   - 7 bits slave address
+ *                  TxBuffer  - Bytes to be sent
+ *                  TxLength  - Number of bytes to be sent (can be 0)
+ *                  RxLength  - Number of bytes to be received (can be 0)
+ * @param (out):    RxBuffer  - Bytes received
+ * @param (inout):  None
+ * @return          Return Status (RET_OK if all bytes were acknowledged)
+ *******************************************************************************/
+uint8 I2c_WriteRead(const I2c_Config* ConfigPtr, uint8 Address, const uint8* TxBuffer, uint32 TxLength,
+                    uint8* RxBuffer, uint32 RxLength)
+{
+    /* Pointer to Requested I2c Base address Register */
+    volatile uint32* I2c_Ptr = NULL_PTR;
 
-            /* Write the STOP and RUN Bits in MCS Register  */
-            *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) = ( (MCR_REG_STOP_ENABLE << MCR_REG_STOP_POS) |
-                    (MCR_REG_RUN_ENABLE  << MCR_REG_RUN_POS ) );
+    /* Saved interrupts state */
+    uint32 Key = 0;
 
-            /* Wait until BUSY bit in MCS Register = 0*/
-            while( ( (*(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) ) && (MCR_REG_BUSY_ENABLE << MCR_REG_BUSY_POS) ) == FALSE);
+    if(I2c_WriteReadIT(ConfigPtr, Address, TxBuffer, TxLength, RxBuffer, RxLength, NULL_PTR) != RET_OK)
+    {
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
 
+    /* Function Call to choose which I2c Module will be used */
+    I2c_ChooseModule(ConfigPtr, &I2c_Ptr);
 
-            /* Check for ERROR But in MCS Register */
-            if( ( (*(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) ) && (MCR_REG_ERROR_ENABLE << MCR_REG_ERROR_POS) ) == FALSE)
-            {
-                /* There are no errors occurred,
-                 * increment the buffer pointer then read the last byte */
-                DataPtr++;
+    /* Serve the transfer here, I2C ISR (if enabled) can't preempt the handler in the middle,
+     * an arbitration loss is only scheduled by the handler, I2c_Service() retries it */
+    while(g_i2cItTransfer[ConfigPtr->I2cNum].Busy == TRUE)
+    {
+        Key = I2C_ENTER_CRITICAL();
+        I2c_ItIsrHandler(ConfigPtr->I2cNum, I2c_Ptr);
+        I2C_EXIT_CRITICAL(Key);
 
-                (*DataPtr) = ( *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MDR_REG_OFFSET) );
+        (void)I2c_Service(ConfigPtr->I2cNum);
+    }
 
-                /* return with RET_Ok */
-                return RET_OK;
-            }
-            else
-            {
-                /* There is an error occurred, return with RET_NOT_OK */
-                /* Future work: There should be an Error Service Algorithm Function
-                 * which will be called here to operate with this error */
-                return RET_NOT_OK;
-            }
+    return (g_i2cItSingle[ConfigPtr->I2cNum].Status == I2C_STATUS_OK) ? RET_OK : RET_NOT_OK;
+}
 
-        }
-    }
-    else if( ( (ConfigPtr->I2cMode) & I2C_MODE_SLAVE) == I2C_MODE_SLAVE )
+/*******************************************************************************
+ * @fn              uint8 I2c_WriteReadIT(const I2c_Config* ConfigPtr, uint8 Address, const uint8* TxBuffer,
+ *                                        uint32 TxLength, uint8* RxBuffer, uint32 RxLength,
+ *                                        void (*CallBack)(uint8 Status))
+ * @brief           Function to start writing bytes then reading bytes after a repeated START
+ *                  It returns at once, CallBack is called from I2C ISR with the result
+ * @note            I2C NVIC interrupt must be enabled by the application
+ * @param (in):     ConfigPtr - Pointer to configuration set (Master mode)
+ *                  Address   - 7 bits slave address
+ *                  TxBuffer  - Bytes to be sent (MUST stay valid until CallBack)
+ *                  TxLength  - Number of bytes to be sent (can be 0)
+ *                  RxLength  - Number of bytes to be received (can be 0)
+ *                  CallBack  - Called with the result @ref I2C_STATUS (can be NULL_PTR)
+ * @param (out):    RxBuffer  - Bytes received (MUST stay valid until CallBack)
+ * @param (inout):  None
+ * @return          Return Status (RET_NOT_OK if a transfer is running or the bus is busy)
+ *******************************************************************************/
+uint8 I2c_WriteReadIT(const I2c_Config* ConfigPtr, uint8 Address, const uint8* TxBuffer, uint32 TxLength,
+                      uint8* RxBuffer, uint32 RxLength, void (*CallBack)(uint8 Status))
+{
+    /* Check if the input pointers are Not Null Pointers and there is something to transfer */
+    if( (NULL_PTR == ConfigPtr) || ( (0 == TxLength) && (0 == RxLength) ) ||
+        ( (0 != TxLength) && (NULL_PTR == TxBuffer) ) || ( (0 != RxLength) && (NULL_PTR == RxBuffer) ) )
     {
-        /* Slave mode selected, operate with Slave registers */
-        /* Note: There's no Multiple data reception in slave mode */
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
 
-        /* First, write the OWN slave address to SOAR */
-        *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_SOAR_REG_OFFSET) = (ConfigPtr->I2cSlaveAddress);
+    return I2c_ItStartSingle(ConfigPtr, Address, TxBuffer, TxLength, RxBuffer, RxLength, CallBack);
+}
 
-        /* Second, Enable I2C Slave Operation from SCSR Register */
-        *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_SCSR_REG_OFFSET) = ( SCSR_REG_DA_ENABLE << SCSR_REG_DA_POS );
+/*******************************************************************************
+ * @fn              uint8 I2c_BatchIT(const I2c_Config* ConfigPtr, I2c_Transaction* List, uint32 Count,
+ *                                    void (*CallBack)(uint8 Status))
+ * @brief           Function to start a list of transactions which run back to back
+ *                  Each one starts with a repeated START right after the previous one,
+ *                  the bus is held until the STOP after the last one
+ *                  The batch ends at the first failing transaction, the next ones
+ *                  keep I2C_STATUS_PENDING status
+ * @note            I2C NVIC interrupt must be enabled by the application
+ * @param (in):     ConfigPtr - Pointer to configuration set (Master mode)
+ *                  Count     - Number of transactions
+ *                  CallBack  - Called with the result of the last run transaction
+ *                              @ref I2C_STATUS (can be NULL_PTR)
+ * @param (out):    None
+ * @param (inout):  List      - Transactions (MUST stay valid until CallBack), their
+ *                              Status are updated while the batch runs
+ * @return          Return Status (RET_NOT_OK if a transfer is running, the bus is busy
+ *                  or a transaction is empty)
+ *******************************************************************************/
+uint8 I2c_BatchIT(const I2c_Config* ConfigPtr, I2c_Transaction* List, uint32 Count, void (*CallBack)(uint8 Status))
+{
+    /* Variable to iterate through the list */
+    uint32 iteration = 0;
 
-        /* Third, Wait until RREQ Bit in SCSR Register = 1 */
-        while( ( (*(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_SCSR_REG_OFFSET) ) && (SCSR_REG_RREQ_ENABLE << SCSR_REG_RREQ_POS ) ) == TRUE);
+    /* Check if the input pointers are Not Null Pointers */
+    if( (NULL_PTR == ConfigPtr) || (NULL_PTR == List) || (0 == Count) )
+    {
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
 
-        /* Read data from SDR register */
-        (*DataPtr) = (*(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_SDR_REG_OFFSET) );
+    for(iteration = 0; iteration < Count; iteration++)
+    {
+        if( ( (0 == List[iteration].TxLength) && (0 == List[iteration].RxLength) ) ||
+            ( (0 != List[iteration].TxLength) && (NULL_PTR == List[iteration].TxBuffer) ) ||
+            ( (0 != List[iteration].RxLength) && (NULL_PTR == List[iteration].RxBuffer) ) )
+        {
+            return RET_NOT_OK;
+        }
     }
-    return RET_OK;
+
+    if(g_i2cItTransfer[ConfigPtr->I2cNum].Busy == TRUE)
+    {
+        return RET_NOT_OK;
+    }
+
+    for(iteration = 0; iteration < Count; iteration++)
+    {
+        List[iteration].Status = I2C_STATUS_PENDING;
+    }
+
+    return I2c_ItStart(ConfigPtr, List, Count, CallBack);
 }
 
 
@@ -1078,3 +1300,976 @@ static void I2c_ChooseModule(const I2c_Config* ConfigPtr, volatile uint32** Ptr)
     }
 
 }
+
+/*******************************************************************************
+ * @fn              static uint8 I2c_TransmitOnce(const I2c_Config* ConfigPtr, const uint8* DataPtr, uint8 BufferSize)
+ * @brief           Function to transmit Data through I2C (For both Master or Slave)
+ * @param (in):     ConfigPtr - Pointer to configuration set
+ *                  DataPtr   - Pointer to data that will be sent
+ *                  BufferSize- Number of bytes that will be sent in multiple mode (Master mode only)
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Return Status (RET_OK if everything is ok), the failure reason
+ *                  is saved for I2c_GetLastError()
+ *****************************************************************************/
+static uint8 I2c_TransmitOnce(const I2c_Config* ConfigPtr, const uint8* DataPtr, uint8 BufferSize)
+{
+    /* Pointer to Requested I2c Base address Register */
+    volatile uint32* I2c_Ptr = NULL_PTR;
+
+    /* Variable to iterate through it */
+    uint8 iteration = 0;
+
+    /* Result of the last master operation @ref I2C_STATUS */
+    uint8 Status = I2C_STATUS_OK;
+
+    /* Check if the input configuration pointer to structure is Not a Null Pointer */
+    if(NULL_PTR == ConfigPtr)
+    {
+        /* ConfigPtr is a Null Pointer. Return with RET_NOT_OK */
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    /* Function Call to choose which I2c Module will be used */
+    I2c_ChooseModule(ConfigPtr, &I2c_Ptr);
+
+    g_i2cLastError[ConfigPtr->I2cNum] = I2C_STATUS_OK;
+
+    /* Check if the I2cMode is master or slave to operate with the right registers */
+    if( ( (ConfigPtr->I2cMode) & I2C_MODE_MASTER) == I2C_MODE_MASTER )
+    {
+        /* Master mode selected, operate with Master registers */
+
+        /* Check if the Transmit Mode is Single or multiple data transmission */
+        if( (ConfigPtr->I2cTransmitMode) == I2C_TRANSMIT_MODE_SINGLE )
+        {
+            /*
+             * Single Data transmission selected
+             * Follow the Master Single TRANSMIT Flow chart in DataSheet (Page 1008)
+             */
+
+            /* First, write the slave address to MSA Register */
+            *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MSA_REG_OFFSET) =  (ConfigPtr->I2cSlaveAddress << 1);
+
+            /* Second, Write the data on the MDR Register */
+            *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MDR_REG_OFFSET) = (*DataPtr);
+
+            /* Third, Wait until BUSBSY bit in MCS Register = 0 (bounded, a stuck bus is cleared for the next call) */
+            if(I2c_WaitBusIdle(I2c_Ptr) != RET_OK)
+            {
+                g_i2cLastError[ConfigPtr->I2cNum] = I2C_STATUS_BUS_BUSY;
+                (void)I2c_BusRecover(ConfigPtr);
+                return RET_NOT_OK;
+            }
+
+
+            /* Forth, write the RUN, START, and STOP Bits in MCS Register */
+            *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) = ( (0b00111) );
+
+            /* Fifth, Wait until BUSY bit in MCS Register = 0 (bounded by the clock low timeout) */
+            Status = I2c_WaitMaster(ConfigPtr, I2c_Ptr);
+
+
+            /* Sixth, Check for ERROR But in MCS Register */
+            if(Status == I2C_STATUS_OK)
+            {
+                /* There are no errors occurred, return with RET_Ok */
+                return RET_OK;
+            }
+            else
+            {
+                /* There is an error occurred, return with RET_NOT_OK (Status is saved by I2c_WaitMaster) */
+                return RET_NOT_OK;
+            }
+        }
+
+        else if( (ConfigPtr->I2cTransmitMode) == I2C_TRANSMIT_MODE_MULTIPLE)
+        {
+            /*
+             * Multiple Data transmission selected
+             * Follow the Master TRANSMIT of Multiple Data Bytes Flow chart in DataSheet (Page 1010)
+             */
+
+            /* First, write the slave address to MSA Register */
+            *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MSA_REG_OFFSET) =  ConfigPtr->I2cSlaveAddress;
+
+            /* Second, Write the data on the MDR Register */
+            *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MDR_REG_OFFSET) = (*DataPtr);
+
+            /* Third, Wait until BUSBSY bit in MCS Register = 0 (bounded, a stuck bus is cleared for the next call) */
+            if(I2c_WaitBusIdle(I2c_Ptr) != RET_OK)
+            {
+                g_i2cLastError[ConfigPtr->I2cNum] = I2C_STATUS_BUS_BUSY;
+                (void)I2c_BusRecover(ConfigPtr);
+                return RET_NOT_OK;
+            }
+
+            /* Forth, write the RUN, and START Bits only in MCS Register
+             * STOP Bit didn't set because Repeated start is used right now */
+            *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) = ( (MCR_REG_START_ENABLE << MCR_REG_START_POS)|
+                    (MCR_REG_RUN_ENABLE   << MCR_REG_RUN_POS) );
+
+            /* For loop to iterate till BufferSize value
+             * Iteration starts from 1 because the first byte is already sent in the second operation in the algorithm */
+            for(iteration = 1; iteration < BufferSize; iteration++)
+            {
+                /* Fifth, Wait until BUSY bit in MCS Register = 0 (bounded by the clock low timeout) */
+                Status = I2c_WaitMaster(ConfigPtr, I2c_Ptr);
+
+                /* Sixth, Check for ERROR But in MCS Register */
+                if(Status == I2C_STATUS_OK)
+                {
+                    /*
+                     * There are no errors occurred,
+                     * Increment the pointer to the next element of the Buffer
+                     * then send this byte
+                     */
+                    DataPtr++;
+
+                    /* Write the data on the MDR Register */
+                    *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MDR_REG_OFFSET) = (*DataPtr);
+
+                    /* Seventh, Write the RUN Bit in MCS Register */
+                    *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) = ( (MCR_REG_RUN_ENABLE << MCR_REG_RUN_POS) );
+
+                }
+                else
+                {
+                    /*
+                     * There is an error occurred,
+                     * Check for Arbitration Lost Bit in MCS Register = 0
+                     * note: in DataSheet they check on 1, i'm checking here on 0 to save the else instructions
+                     */
+                    if(Status != I2C_STATUS_ARBITRATION_LOST)
+                    {
+                        /* Write the STOP Bit in MCS Register */
+                        *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) = ( (MCR_REG_STOP_ENABLE << MCR_REG_STOP_POS) );
+                    }
+
+                    /* if the 'if condition' didn't happen, then the I2C Controller Lost Arbitration, return with RET_NOT_OK
+                     * (I2c_Transmit retries it) */
+                    return RET_NOT_OK;
+
+                }
+            }
+            /* Data should be sent successfully or there's an error happened which stopped the data transfer
+             * if there's an error occurred then this piece of code won't be accessed */
+
+            /* Write the STOP and RUN Bits in MCS Register  */
+            *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) = ( (MCR_REG_STOP_ENABLE << MCR_REG_STOP_POS) |
+                    (MCR_REG_RUN_ENABLE  << MCR_REG_RUN_POS ) );
+            /* Wait until BUSY bit in MCS Register = 0 (bounded by the clock low timeout) */
+            Status = I2c_WaitMaster(ConfigPtr, I2c_Ptr);
+
+
+            /* Check for ERROR But in MCS Register */
+            if(Status == I2C_STATUS_OK)
+            {
+                /* There are no errors occurred, return with RET_Ok */
+                return RET_OK;
+            }
+            else
+            {
+                /* There is an error occurred, return with RET_NOT_OK (Status is saved by I2c_WaitMaster) */
+                return RET_NOT_OK;
+            }
+
+        }
+    }
+    else if( ( (ConfigPtr->I2cMode) & I2C_MODE_SLAVE) == I2C_MODE_SLAVE )
+    {
+        /* Slave mode selected, operate with Slave registers */
+        /* Note: There's no Multiple data transmission in slave mode */
+
+        /* First, write the OWN slave address to SOAR */
+        *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_SOAR_REG_OFFSET) = (ConfigPtr->I2cSlaveAddress);
+
+        /* Second, Enable I2C Slave Operation from SCSR Register */
+        *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_SCSR_REG_OFFSET) = ( SCSR_REG_DA_ENABLE << SCSR_REG_DA_POS );
+
+        /* Third, Wait until TREQ Bit in SCSR Register = 1 */
+        while( ( (*(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_SCSR_REG_OFFSET) ) && (SCSR_REG_TREQ_ENABLE << SCSR_REG_TREQ_POS ) ) == TRUE);
+
+        /* Write data to SDR register */
+        *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_SDR_REG_OFFSET) = (*DataPtr);
+    }
+    return RET_OK;
+}
+
+/*******************************************************************************
+ * @fn              static uint8 I2c_ReceiveOnce(const I2c_Config* ConfigPtr, uint8* DataPtr, uint8 BufferSize)
+ * @brief           Function to Receive Data through I2C (For both Master or Slave)
+ * @param (in):     ConfigPtr - Pointer to configuration set
+ *                  BufferSize- Number of bytes that will be received in multiple mode (Master mode only)
+ * @param (out):    DataPtr   - Pointer to data that will be received
+ * @param (inout):  None
+ * @return          Return Status (RET_OK if everything is ok), the failure reason
+ *                  is saved for I2c_GetLastError()
+ *****************************************************************************/
+static uint8 I2c_ReceiveOnce(const I2c_Config* ConfigPtr, uint8* DataPtr, uint8 BufferSize)
+{
+    /* Pointer to Requested SSI Base address Register */
+    volatile uint32* I2c_Ptr = NULL_PTR;
+
+    /* Variable to iterate through it */
+    uint8 iteration = 0;
+
+    /* Result of the last master operation @ref I2C_STATUS */
+    uint8 Status = I2C_STATUS_OK;
+
+    /* Check if the input configuration pointer to structure is Not a Null Pointer */
+    if(NULL_PTR == ConfigPtr)
+    {
+        /* ConfigPtr is a Null Pointer. Return with RET_NOT_OK */
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    /* Function Call to choose which I2c Module will be used */
+    I2c_ChooseModule(ConfigPtr, &I2c_Ptr);
+
+    g_i2cLastError[ConfigPtr->I2cNum] = I2C_STATUS_OK;
+
+    /* Check if the I2cMode is master or slave to operate with the right registers */
+    if( ( (ConfigPtr->I2cMode) & I2C_MODE_MASTER) == I2C_MODE_MASTER )
+    {
+        /* Master mode selected, operate with Master registers */
+
+        /* Check if the Receive Mode is Single or multiple data transmission */
+        if( (ConfigPtr->I2cReceiveMode) == I2C_RECEIVE_MODE_SINGLE )
+        {
+            /*
+             * Single Data reception selected
+             * Follow the Master Single RECEIVE Flow chart in DataSheet (Page 1009)
+             */
+
+            /* First, write the slave address to MSA Register and write 1 on R/W bit to tell I2C Controller that Master will receive data */
+            *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MSA_REG_OFFSET) =  ( (ConfigPtr->I2cSlaveAddress << 1) | (1 << 0) ) ;
+
+
+
+            /* Second, Wait until BUSBSY bit in MCS Register = 0 (bounded, a stuck bus is cleared for the next call) */
+            if(I2c_WaitBusIdle(I2c_Ptr) != RET_OK)
+            {
+                g_i2cLastError[ConfigPtr->I2cNum] = I2C_STATUS_BUS_BUSY;
+                (void)I2c_BusRecover(ConfigPtr);
+                return RET_NOT_OK;
+            }
+
+            /* Third, write the RUN, START, and STOP Bits in MCS Register */
+            *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) = ( (MCR_REG_START_ENABLE << MCR_REG_START_POS)|
+                    (MCR_REG_RUN_ENABLE << MCR_REG_RUN_POS) | (MCR_REG_STOP_ENABLE << MCR_REG_STOP_POS) );
+
+
+
+            /* Forth, Wait until BUSY bit in MCS Register = 0 (bounded by the clock low timeout) */
+            Status = I2c_WaitMaster(ConfigPtr, I2c_Ptr);
+
+
+            /* Fifth, Check for ERROR But in MCS Register */
+            if(Status == I2C_STATUS_OK)
+            {
+                /* There are no errors occurred */
+
+                /* Sixth, Read the data from MDR Register */
+                *DataPtr = (*(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MDR_REG_OFFSET));
+
+                /* return with RET_Ok */
+                return RET_OK;
+            }
+            else
+            {
+                /* There is an error occurred, return with RET_NOT_OK (Status is saved by I2c_WaitMaster) */
+                return RET_NOT_OK;
+            }
+        }
+        else if( (ConfigPtr->I2cReceiveMode) == I2C_RECEIVE_MODE_MULTIPLE)
+        {
+            /*
+             * Multiple Data reception selected
+             * Follow the Master RECEIVE of Multiple Data Bytes Flow chart in DataSheet (Page 1011)
+             */
+
+            /* First, write the slave address to MSA Register */
+            *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MSA_REG_OFFSET) =  ConfigPtr->I2cSlaveAddress;
+
+            /* Second, Wait until BUSBSY bit in MCS Register = 0 (bounded, a stuck bus is cleared for the next call) */
+            if(I2c_WaitBusIdle(I2c_Ptr) != RET_OK)
+            {
+                g_i2cLastError[ConfigPtr->I2cNum] = I2C_STATUS_BUS_BUSY;
+                (void)I2c_BusRecover(ConfigPtr);
+                return RET_NOT_OK;
+            }
+
+            /* Third Forth, write the RUN, START and ACK Bits only in MCS Register
+             * STOP Bit didn't set because Repeated start is used right now */
+            *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) = ( (MCR_REG_START_ENABLE << MCR_REG_START_POS)|
+                    (MCR_REG_RUN_ENABLE << MCR_REG_RUN_POS) | (MCR_REG_ACK_ENABLE  << MCR_REG_ACK_POS) );
+
+            /* For loop to iterate till BufferSize value
+             * Iteration starts from 0 because No data has been read yet
+             * Note: this loop will iterate till (BufferSize - 1) because
+             * the last byte will be read after the loop as the DataSheet said in the flow chart */
+            for(iteration = 0; iteration < (BufferSize-1); iteration++)
+            {
+                /* Fifth, Wait until BUSY bit in MCS Register = 0 (bounded by the clock low timeout) */
+                Status = I2c_WaitMaster(ConfigPtr, I2c_Ptr);
+
+                /* Sixth, Check for ERROR But in MCS Register */
+                if(Status == I2C_STATUS_OK)
+                {
+                    /* There are no errors occurred */
+
+                    /* read the data from the MDR Register */
+                    (*DataPtr) = ( *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MDR_REG_OFFSET) );
+
+                    /* Increment the pointer to the next element of the Buffer */
+                    DataPtr++;
+
+                    /* Seventh, Write the RUN and ACK Bits in MCS Register */
+                    *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) = ( (MCR_REG_RUN_ENABLE << MCR_REG_RUN_POS) |
+                            (MCR_REG_ACK_ENABLE << MCR_REG_ACK_POS) );
+                }
+                else
+                {
+                    /*
+                     * There is an error occurred,
+                     * Check for Arbitration Lost Bit in MCS Register = 0
+                     * note: in DataSheet they check on 1, i'm checking here on 0 to save the else instructions
+                     */
+                    if(Status != I2C_STATUS_ARBITRATION_LOST)
+                    {
+                        /* Write the STOP Bit in MCS Register */
+                        *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) = ( (MCR_REG_STOP_ENABLE << MCR_REG_STOP_POS) );
+                    }
+
+                    /* if the 'if condition' didn't happen, then the I2C Controller Lost Arbitration, return with RET_NOT_OK
+                     * (I2c_Receive retries it) */
+                    return RET_NOT_OK;
+
+                }
+            }
+            /* Data should be sent successfully or there's an error happened which stopped the data transfer
+             * if there's an error occurred then this piece of code won't be accessed */
+
+            /* Write the STOP and RUN Bits in MCS Register  */
+            *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) = ( (MCR_REG_STOP_ENABLE << MCR_REG_STOP_POS) |
+                    (MCR_REG_RUN_ENABLE  << MCR_REG_RUN_POS ) );
+
+            /* Wait until BUSY bit in MCS Register = 0 (bounded by the clock low timeout) */
+            Status = I2c_WaitMaster(ConfigPtr, I2c_Ptr);
+
+
+            /* Check for ERROR But in MCS Register */
+            if(Status == I2C_STATUS_OK)
+            {
+                /* There are no errors occurred,
+                 * increment the buffer pointer then read the last byte */
+                DataPtr++;
+
+                (*DataPtr) = ( *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MDR_REG_OFFSET) );
+
+                /* return with RET_Ok */
+                return RET_OK;
+            }
+            else
+            {
+                /* There is an error occurred, return with RET_NOT_OK (Status is saved by I2c_WaitMaster) */
+                return RET_NOT_OK;
+            }
+
+        }
+    }
+    else if( ( (ConfigPtr->I2cMode) & I2C_MODE_SLAVE) == I2C_MODE_SLAVE )
+    {
+        /* Slave mode selected, operate with Slave registers */
+        /* Note: There's no Multiple data reception in slave mode */
+
+        /* First, write the OWN slave address to SOAR */
+        *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_SOAR_REG_OFFSET) = (ConfigPtr->I2cSlaveAddress);
+
+        /* Second, Enable I2C Slave Operation from SCSR Register */
+        *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_SCSR_REG_OFFSET) = ( SCSR_REG_DA_ENABLE << SCSR_REG_DA_POS );
+
+        /* Third, Wait until RREQ Bit in SCSR Register = 1 */
+        while( ( (*(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_SCSR_REG_OFFSET) ) && (SCSR_REG_RREQ_ENABLE << SCSR_REG_RREQ_POS ) ) == TRUE);
+
+        /* Read data from SDR register */
+        (*DataPtr) = (*(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_SDR_REG_OFFSET) );
+    }
+    return RET_OK;
+}
+
+/*******************************************************************************
+ * @fn              static uint8 I2c_McsStatus(uint32 Mcs)
+ * @brief           Function to decode the result of the last master operation
+ * @param (in):     Mcs - MCS Register value (BUSY bit is cleared)
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Status, You can find its value @ref I2C_STATUS
+ *******************************************************************************/
+static uint8 I2c_McsStatus(uint32 Mcs)
+{
+    if(BIT_IS_SET(Mcs, MCR_REG_ARBLST_POS))
+    {
+        return I2C_STATUS_ARBITRATION_LOST;
+    }
+    else if(BIT_IS_SET(Mcs, MCR_REG_CLKTO_POS))
+    {
+        return I2C_STATUS_CLOCK_TIMEOUT;
+    }
+    else if(BIT_IS_SET(Mcs, MCR_REG_ERROR_POS))
+    {
+        return BIT_IS_SET(Mcs, MCR_REG_ADRACK_POS) ? I2C_STATUS_ADDRESS_NACK : I2C_STATUS_DATA_NACK;
+    }
+
+    return I2C_STATUS_OK;
+}
+
+/*******************************************************************************
+ * @fn              static uint8 I2c_WaitBusIdle(volatile uint32* I2c_Ptr)
+ * @brief           Function to wait until BUSBSY bit in MCS Register = 0
+ *                  (another master or a stuck slave owns the bus), at most I2C_WAIT_TIMEOUT polls
+ * @param (in):     I2c_Ptr - Pointer to I2C Base address
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Return Status (RET_NOT_OK if the bus is still busy)
+ *******************************************************************************/
+static uint8 I2c_WaitBusIdle(volatile uint32* I2c_Ptr)
+{
+    /* Polls left */
+    uint32 Timeout = I2C_WAIT_TIMEOUT;
+
+    while( BIT_IS_SET( (*(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET)), MCR_REG_BUSBSY_POS) )
+    {
+        if(Timeout == 0)
+        {
+            return RET_NOT_OK;
+        }
+        Timeout--;
+    }
+
+    return RET_OK;
+}
+
+/*******************************************************************************
+ * @fn              static uint8 I2c_WaitMaster(const I2c_Config* ConfigPtr, volatile uint32* I2c_Ptr)
+ * @brief           Function to wait until BUSY bit in MCS Register = 0, then get the
+ *                  result of the master operation and save it for I2c_GetLastError()
+ *                  SCL held low ends the operation with CLKTO (clock low timeout), so
+ *                  the wait is bounded by the operation and the clock low timeout
+ *                  SCL periods, then the bus is cleared for the next transfer
+ *                  (only if the master is idle, see I2c_BusRecover)
+ * @param (in):     ConfigPtr - Pointer to configuration set
+ *                  I2c_Ptr   - Pointer to I2C Base address
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Status, You can find its value @ref I2C_STATUS
+ *******************************************************************************/
+static uint8 I2c_WaitMaster(const I2c_Config* ConfigPtr, volatile uint32* I2c_Ptr)
+{
+    /* SCL periods before the controller ends the operation: the operation itself,
+     * then the clock low timeout (MCLKOCNT counts 16 SCL periods steps) */
+    uint32 Periods = I2C_OPERATION_SCL_PERIODS +
+                     ( ( (*(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCLKOCNT_REG_OFFSET)) & MCLKOCNT_REG_CNTL_MAX ) *
+                       MCLKOCNT_REG_CNTL_SCALE );
+
+    /* Polls left, each poll takes at least one System Clock (I2C_WAIT_TIMEOUT if I2c_Init wasn't called) */
+    uint32 Timeout = I2C_WAIT_TIMEOUT;
+
+    if(g_i2cFrequency[ConfigPtr->I2cNum] != 0)
+    {
+        Timeout = Periods * (ConfigPtr->ClkValue / g_i2cFrequency[ConfigPtr->I2cNum]);
+    }
+
+    /* Result of the operation */
+    uint8 Status = I2C_STATUS_CLOCK_TIMEOUT;
+
+    while( BIT_IS_SET( (*(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET)), MCR_REG_BUSY_POS) &&
+           (Timeout != 0) )
+    {
+        Timeout--;
+    }
+
+    if(Timeout != 0)
+    {
+        Status = I2c_McsStatus(*(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET));
+    }
+
+    /* Still BUSY after the bound: I2c_BusRecover refuses to take the pins of a running master */
+    if(Status == I2C_STATUS_CLOCK_TIMEOUT)
+    {
+        (void)I2c_BusRecover(ConfigPtr);
+    }
+
+    g_i2cLastError[ConfigPtr->I2cNum] = Status;
+
+    return Status;
+}
+
+/*******************************************************************************
+ * @fn              static void I2c_Delay(uint32 Count)
+ * @brief           Function to waste time (bus clear pulses, arbitration backoff)
+ * @param (in):     Count - Number of loop iterations
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+static void I2c_Delay(uint32 Count)
+{
+    /* Variable to waste time */
+    volatile uint32 delay = 0;
+
+    for(delay = Count; delay != 0; delay--);
+}
+
+/*******************************************************************************
+ * @fn              static uint8 I2c_MasterError(I2c_Instance I2cNum, volatile uint32* I2c_Ptr)
+ * @brief           Function to serve a failed master operation in I2C ISR: the master
+ *                  interrupt is cleared, STOP is sent if the controller still owns the
+ *                  bus (NACK), and the result is saved for I2c_GetLastError()
+ * @param (in):     I2cNum  - I2C instance
+ *                  I2c_Ptr - Pointer to I2C Base address
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          TRUE if the master operation failed
+ *******************************************************************************/
+static uint8 I2c_MasterError(I2c_Instance I2cNum, volatile uint32* I2c_Ptr)
+{
+    /* MCS Register value after the last operation */
+    uint32 Mcs = *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET);
+
+    /* Result of the last operation */
+    uint8 Status = I2C_STATUS_OK;
+
+    if(BIT_IS_SET(Mcs, MCR_REG_BUSY_POS))
+    {
+        return FALSE;
+    }
+
+    Status = I2c_McsStatus(Mcs);
+    if(Status == I2C_STATUS_OK)
+    {
+        return FALSE;
+    }
+
+    /* Clear master interrupts, otherwise I2C ISR is entered again */
+    *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MICR_REG_OFFSET) = (1 << MICR_REG_IC_POS) | (1 << MICR_REG_CLKIC_POS);
+
+    /* Release the bus after a NACK, arbitration loss already left it and SCL held low can't send STOP */
+    if( ( (Status == I2C_STATUS_ADDRESS_NACK) || (Status == I2C_STATUS_DATA_NACK) ) && BIT_IS_CLEAR(Mcs, MCR_REG_IDLE_POS) )
+    {
+        *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) = (MCR_REG_STOP_ENABLE << MCR_REG_STOP_POS);
+    }
+
+    g_i2cLastError[I2cNum] = Status;
+
+    return TRUE;
+}
+
+/*******************************************************************************
+ * @fn              static uint8 I2c_ItStartSingle(const I2c_Config* ConfigPtr, uint8 Address, const uint8* TxBuffer,
+ *                                                 uint32 TxLength, uint8* RxBuffer, uint32 RxLength,
+ *                                                 void (*CallBack)(uint8 Status))
+ * @brief           Function to start one transaction kept in the driver
+ * @param (in):     ConfigPtr - Pointer to configuration set
+ *                  Address   - 7 bits slave address
+ *                  TxBuffer  - Bytes to be sent
+ *                  TxLength  - Number of bytes to be sent
+ *                  RxLength  - Number of bytes to be received
+ *                  CallBack  - Called with the result
+ * @param (out):    RxBuffer  - Bytes received
+ * @param (inout):  None
+ * @return          Return Status (RET_NOT_OK if a transfer is running or the bus is busy)
+ *******************************************************************************/
+static uint8 I2c_ItStartSingle(const I2c_Config* ConfigPtr, uint8 Address, const uint8* TxBuffer, uint32 TxLength,
+                               uint8* RxBuffer, uint32 RxLength, void (*CallBack)(uint8 Status))
+{
+    /* Transaction kept in the driver for this I2C */
+    I2c_Transaction* Single = &g_i2cItSingle[ConfigPtr->I2cNum];
+
+    /* The running transfer may still use it */
+    if(g_i2cItTransfer[ConfigPtr->I2cNum].Busy == TRUE)
+    {
+        return RET_NOT_OK;
+    }
+
+    Single->Address  = Address;
+    Single->TxBuffer = TxBuffer;
+    Single->TxLength = TxLength;
+    Single->RxBuffer = RxBuffer;
+    Single->RxLength = RxLength;
+    Single->Status   = I2C_STATUS_PENDING;
+
+    return I2c_ItStart(ConfigPtr, Single, 1, CallBack);
+}
+
+/*******************************************************************************
+ * @fn              static uint8 I2c_ItStart(const I2c_Config* ConfigPtr, I2c_Transaction* List, uint32 Count,
+ *                                           void (*CallBack)(uint8 Status))
+ * @brief           Function to start an interrupt driven master transfer of one or
+ *                  more transactions (write phase, then read phase after repeated START,
+ *                  any of them can be empty)
+ * @param (in):     ConfigPtr - Pointer to configuration set
+ *                  Count     - Number of transactions
+ *                  CallBack  - Called with the result
+ * @param (out):    None
+ * @param (inout):  List      - Transactions to run
+ * @return          Return Status (RET_NOT_OK if a transfer is running or the bus is busy)
+ *******************************************************************************/
+static uint8 I2c_ItStart(const I2c_Config* ConfigPtr, I2c_Transaction* List, uint32 Count, void (*CallBack)(uint8 Status))
+{
+    /* Pointer to Requested I2c Base address Register */
+    volatile uint32* I2c_Ptr = NULL_PTR;
+
+    /* Pointer to interrupt driven transfer state of requested I2C */
+    I2c_ItTransfer* Transfer = NULL_PTR;
+
+    /* Interrupt driven transfers are supported on Master mode only */
+    if( ( (ConfigPtr->I2cMode) & I2C_MODE_MASTER) != I2C_MODE_MASTER )
+    {
+        return RET_NOT_OK;
+    }
+
+    Transfer = &g_i2cItTransfer[ConfigPtr->I2cNum];
+
+    /* Function Call to choose which I2c Module will be used */
+    I2c_ChooseModule(ConfigPtr, &I2c_Ptr);
+
+    /* Only one transfer per I2C at a time, and another master may own the bus */
+    if( (Transfer->Busy == TRUE) ||
+        BIT_IS_SET( (*(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET)), MCR_REG_BUSBSY_POS) )
+    {
+        return RET_NOT_OK;
+    }
+
+    /* Save transfer state */
+    Transfer->Current        = List;
+    Transfer->BatchRemaining = Count - 1U;
+    Transfer->Stopping       = FALSE;
+    Transfer->MasterCode     = g_i2cHighSpeed[ConfigPtr->I2cNum];
+    Transfer->Retries        = 0;
+    Transfer->RetryPending   = FALSE;
+    Transfer->Status         = I2C_STATUS_OK;
+    Transfer->CallBack       = CallBack;
+    Transfer->Busy           = TRUE;
+    I2c_ItLoad(Transfer);
+
+    /* Save configured master interrupts, then enable master (each byte done) and clock timeout interrupts only */
+    Transfer->SavedMask = *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MIMR_REG_OFFSET);
+    *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MICR_REG_OFFSET) = (1 << MICR_REG_IC_POS) | (1 << MICR_REG_CLKIC_POS);
+    *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MIMR_REG_OFFSET) = (1 << MIMR_REG_IM_POS) | (1 << MIMR_REG_CLKIM_POS);
+
+    I2c_ItBegin(I2c_Ptr, Transfer);
+
+    return RET_OK;
+}
+
+/*******************************************************************************
+ * @fn              static void I2c_ItLoad(I2c_ItTransfer* Transfer)
+ * @brief           Function to load the buffers of the current transaction
+ * @param (in):     None
+ * @param (out):    None
+ * @param (inout):  Transfer - Transfer state
+ * @return          None
+ *******************************************************************************/
+static void I2c_ItLoad(I2c_ItTransfer* Transfer)
+{
+    Transfer->TxNext      = Transfer->Current->TxBuffer;
+    Transfer->RxNext      = Transfer->Current->RxBuffer;
+    Transfer->TxRemaining = Transfer->Current->TxLength;
+    Transfer->RxRemaining = Transfer->Current->RxLength;
+    Transfer->Address     = Transfer->Current->Address;
+    Transfer->Receiving   = FALSE;
+}
+
+/*******************************************************************************
+ * @fn              static void I2c_ItBegin(volatile uint32* I2c_Ptr, I2c_ItTransfer* Transfer)
+ * @brief           Function to send START of the current transaction, preceded by
+ *                  the master code in High Speed mode
+ * @param (in):     I2c_Ptr  - Pointer to I2C Base address
+ * @param (out):    None
+ * @param (inout):  Transfer - Transfer state
+ * @return          None
+ *******************************************************************************/
+static void I2c_ItBegin(volatile uint32* I2c_Ptr, I2c_ItTransfer* Transfer)
+{
+    if(Transfer->MasterCode == TRUE)
+    {
+        /* High Speed mode: master code at Fast speed first, the transfer follows with repeated START */
+        *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MSA_REG_OFFSET) = I2C_HS_MASTER_CODE;
+        *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) = (MCR_REG_HS_ENABLE    << MCR_REG_HS_POS)    |
+                                                                             (MCR_REG_START_ENABLE << MCR_REG_START_POS) |
+                                                                             (MCR_REG_RUN_ENABLE   << MCR_REG_RUN_POS);
+    }
+    else
+    {
+        I2c_ItStartPhase(I2c_Ptr, Transfer);
+    }
+}
+
+/*******************************************************************************
+ * @fn              static uint8 I2c_ItRetry(I2c_ItTransfer* Transfer)
+ * @brief           Function called from I2C ISR when another master won the bus, it
+ *                  schedules the retry of the current transaction from its first byte
+ *                  (the transfer stays busy), I2c_Service() restarts it after the
+ *                  backoff (doubled on each retry) once the bus is free
+ * @note            Nothing is waited in I2C ISR
+ * @param (in):     None
+ * @param (out):    None
+ * @param (inout):  Transfer - Transfer state
+ * @return          TRUE if the retry is scheduled, FALSE if no retries are left
+ *******************************************************************************/
+static uint8 I2c_ItRetry(I2c_ItTransfer* Transfer)
+{
+    if(Transfer->Retries >= I2C_ARBITRATION_RETRIES)
+    {
+        return FALSE;
+    }
+
+    Transfer->RetryWait    = I2C_RETRY_BACKOFF_CALLS << Transfer->Retries;
+    Transfer->RetryBusy    = I2C_RETRY_BUSY_CALLS;
+    Transfer->Retries++;
+    Transfer->RetryPending = TRUE;
+
+    return TRUE;
+}
+
+/*******************************************************************************
+ * @fn              static void I2c_ItStartPhase(volatile uint32* I2c_Ptr, I2c_ItTransfer* Transfer)
+ * @brief           Function to send START (or repeated START) with the slave address
+ *                  - Write phase: with the first byte, STOP too if it is the last byte of the batch
+ *                  - Read phase:  ACK if more than one byte is expected, otherwise
+ *                                 NACK (and STOP if it is the last byte of the batch)
+ * @param (in):     I2c_Ptr  - Pointer to I2C Base address
+ * @param (out):    None
+ * @param (inout):  Transfer - Transfer state
+ * @return          None
+ *******************************************************************************/
+static void I2c_ItStartPhase(volatile uint32* I2c_Ptr, I2c_ItTransfer* Transfer)
+{
+    /* Command written to MCS Register */
+    uint32 Command = (MCR_REG_START_ENABLE << MCR_REG_START_POS) | (MCR_REG_RUN_ENABLE << MCR_REG_RUN_POS);
+
+    if(Transfer->TxRemaining != 0)
+    {
+        *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MSA_REG_OFFSET) = (uint32)(Transfer->Address << 1);
+        *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MDR_REG_OFFSET) = *Transfer->TxNext;
+        Transfer->TxNext++;
+        Transfer->TxRemaining--;
+
+        Transfer->StopSent = ( (Transfer->TxRemaining == 0) && (Transfer->RxRemaining == 0) &&
+                               (Transfer->BatchRemaining == 0) ) ? TRUE : FALSE;
+    }
+    else
+    {
+        *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MSA_REG_OFFSET) = (uint32)( (Transfer->Address << 1) | MSA_REG_RECEIVE );
+        Transfer->Receiving = TRUE;
+
+        if(Transfer->RxRemaining != 1)
+        {
+            Command |= (MCR_REG_ACK_ENABLE << MCR_REG_ACK_POS);
+        }
+        Transfer->StopSent = ( (Transfer->RxRemaining == 1) && (Transfer->BatchRemaining == 0) ) ? TRUE : FALSE;
+    }
+
+    if(Transfer->StopSent == TRUE)
+    {
+        Command |= (MCR_REG_STOP_ENABLE << MCR_REG_STOP_POS);
+    }
+
+    *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) = Command;
+}
+
+/*******************************************************************************
+ * @fn              static void I2c_ItNext(volatile uint32* I2c_Ptr, I2c_ItTransfer* Transfer)
+ * @brief           Function called when all bytes of the current transaction are done,
+ *                  it starts the next batch transaction with repeated START, or ends
+ *                  the transfer (STOP was sent with the last byte)
+ * @param (in):     I2c_Ptr  - Pointer to I2C Base address
+ * @param (out):    None
+ * @param (inout):  Transfer - Transfer state
+ * @return          None
+ *******************************************************************************/
+static void I2c_ItNext(volatile uint32* I2c_Ptr, I2c_ItTransfer* Transfer)
+{
+    if(Transfer->BatchRemaining == 0)
+    {
+        I2c_ItFinish(I2c_Ptr, Transfer);
+        return;
+    }
+
+    Transfer->Current->Status = I2C_STATUS_OK;
+    Transfer->Current++;
+    Transfer->BatchRemaining--;
+    I2c_ItLoad(Transfer);
+    I2c_ItStartPhase(I2c_Ptr, Transfer);
+}
+
+/*******************************************************************************
+ * @fn              static void I2c_ItFinish(volatile uint32* I2c_Ptr, I2c_ItTransfer* Transfer)
+ * @brief           Function to end the transfer, restore master interrupts, save the
+ *                  result in the current transaction and call the application with it
+ * @param (in):     I2c_Ptr  - Pointer to I2C Base address
+ * @param (out):    None
+ * @param (inout):  Transfer - Transfer state
+ * @return          None
+ *******************************************************************************/
+static void I2c_ItFinish(volatile uint32* I2c_Ptr, I2c_ItTransfer* Transfer)
+{
+    *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MIMR_REG_OFFSET) = Transfer->SavedMask;
+    Transfer->Current->Status = Transfer->Status;
+    Transfer->Busy = FALSE;
+
+    if(Transfer->CallBack != NULL_PTR)
+    {
+        (*Transfer->CallBack)(Transfer->Status);
+    }
+}
+
+/*******************************************************************************
+ * @fn              static uint8 I2c_ItIsrHandler(I2c_Instance I2cNum, volatile uint32* I2c_Ptr)
+ * @brief           Function to serve the interrupt driven master transfer of one
+ *                  I2C instance, called when the last byte/address is done or the
+ *                  clock low timeout expired
+ *                  Follows Master Transmit/Receive of Multiple Data Bytes Flow charts
+ *                  in DataSheet (Pages 1010, 1011) without waiting on BUSY
+ * @param (in):     I2cNum  - I2C instance
+ *                  I2c_Ptr - Pointer to I2C Base address
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          TRUE if a master interrupt of the transfer was served
+ *******************************************************************************/
+static uint8 I2c_ItIsrHandler(I2c_Instance I2cNum, volatile uint32* I2c_Ptr)
+{
+    /* Interrupt driven transfer state of this I2C */
+    I2c_ItTransfer* Transfer = &g_i2cItTransfer[I2cNum];
+
+    /* MMIS Register value (byte done or clock timeout) */
+    uint32 Mmis = 0;
+
+    /* MCS Register value after the last command */
+    uint32 Mcs = 0;
+
+    /* Command written to MCS Register */
+    uint32 Command = (MCR_REG_RUN_ENABLE << MCR_REG_RUN_POS);
+
+    if(Transfer->Busy != TRUE)
+    {
+        return FALSE;
+    }
+
+    Mmis = *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MMIS_REG_OFFSET);
+    if( BIT_IS_CLEAR(Mmis, MMIS_REG_MIS_POS) && BIT_IS_CLEAR(Mmis, MMIS_REG_CLKMIS_POS) )
+    {
+        return FALSE;
+    }
+
+    *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MICR_REG_OFFSET) = (1 << MICR_REG_IC_POS) | (1 << MICR_REG_CLKIC_POS);
+    Mcs = *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET);
+
+    /* SCL held low by a slave, no STOP can be sent (I2c_BusRecover clears the bus) */
+    if( BIT_IS_SET(Mmis, MMIS_REG_CLKMIS_POS) || BIT_IS_SET(Mcs, MCR_REG_CLKTO_POS) )
+    {
+        Transfer->Status = I2C_STATUS_CLOCK_TIMEOUT;
+        I2c_ItFinish(I2c_Ptr, Transfer);
+        return TRUE;
+    }
+
+    /* STOP after an error is done */
+    if(Transfer->Stopping == TRUE)
+    {
+        I2c_ItFinish(I2c_Ptr, Transfer);
+        return TRUE;
+    }
+
+    /* Controller left the bus to the other master (no STOP is needed), I2c_Service() retries after it is done */
+    if(BIT_IS_SET(Mcs, MCR_REG_ARBLST_POS))
+    {
+        if(I2c_ItRetry(Transfer) == FALSE)
+        {
+            Transfer->Status = I2C_STATUS_ARBITRATION_LOST;
+            I2c_ItFinish(I2c_Ptr, Transfer);
+        }
+        return TRUE;
+    }
+
+    /* Master code is never acknowledged */
+    if(Transfer->MasterCode == TRUE)
+    {
+        Transfer->MasterCode = FALSE;
+
+        /* Bus is in High Speed mode until STOP */
+        I2c_ItStartPhase(I2c_Ptr, Transfer);
+        return TRUE;
+    }
+
+    if(BIT_IS_SET(Mcs, MCR_REG_ERROR_POS))
+    {
+        Transfer->Status = BIT_IS_SET(Mcs, MCR_REG_ADRACK_POS) ? I2C_STATUS_ADDRESS_NACK : I2C_STATUS_DATA_NACK;
+
+        if(Transfer->StopSent == TRUE)
+        {
+            I2c_ItFinish(I2c_Ptr, Transfer);
+        }
+        else
+        {
+            /* Release the bus, the transfer ends when STOP is done */
+            Transfer->Stopping = TRUE;
+            *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) = (MCR_REG_STOP_ENABLE << MCR_REG_STOP_POS);
+        }
+        return TRUE;
+    }
+
+    if(Transfer->Receiving == TRUE)
+    {
+        *Transfer->RxNext = (uint8)(*(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MDR_REG_OFFSET));
+        Transfer->RxNext++;
+        Transfer->RxRemaining--;
+
+        if(Transfer->RxRemaining == 0)
+        {
+            I2c_ItNext(I2c_Ptr, Transfer);
+            return TRUE;
+        }
+
+        /* Acknowledge all bytes except the last one, which comes with STOP at the end of the batch */
+        if(Transfer->RxRemaining != 1)
+        {
+            Command |= (MCR_REG_ACK_ENABLE << MCR_REG_ACK_POS);
+        }
+        Transfer->StopSent = ( (Transfer->RxRemaining == 1) && (Transfer->BatchRemaining == 0) ) ? TRUE : FALSE;
+        if(Transfer->StopSent == TRUE)
+        {
+            Command |= (MCR_REG_STOP_ENABLE << MCR_REG_STOP_POS);
+        }
+        *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) = Command;
+    }
+    else if(Transfer->TxRemaining != 0)
+    {
+        *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MDR_REG_OFFSET) = *Transfer->TxNext;
+        Transfer->TxNext++;
+        Transfer->TxRemaining--;
+
+        /* STOP with the last byte unless a read phase or another batch transaction follows */
+        Transfer->StopSent = ( (Transfer->TxRemaining == 0) && (Transfer->RxRemaining == 0) &&
+                               (Transfer->BatchRemaining == 0) ) ? TRUE : FALSE;
+        if(Transfer->StopSent == TRUE)
+        {
+            Command |= (MCR_REG_STOP_ENABLE << MCR_REG_STOP_POS);
+        }
+        *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_MCS_REG_OFFSET) = Command;
+    }
+    else if(Transfer->RxRemaining != 0)
+    {
+        /* Write phase done, repeated START in receive direction */
+        I2c_ItStartPhase(I2c_Ptr, Transfer);
+    }
+    else
+    {
+        I2c_ItNext(I2c_Ptr, Transfer);
+    }
+
+    return TRUE;
+}
@@ -21,6 +21,9 @@
 #define I2C_2_BASE_ADDRESS      0x40022000  /* I2C2 Base Address */
 #define I2C_3_BASE_ADDRESS      0x40023000  /* I2C3 Base Address */
 
+/* Number of I2C modules */
+#define I2C_NUMBER_OF_INSTANCES (4U)
+
 /*******************************************************************************
  *                        I2C(s) Registers Offset Address                      *
  *******************************************************************************/
@@ -53,6 +56,19 @@
 #define I2C_PP_REG_OFFSET          0xFC0       /* I2C Peripheral Properties             */
 #define I2C_PC_REG_OFFSET          0xFC4       /* I2C Peripheral Configuration          */
 
+/*******************************************************************************
+ *              GPIO Registers of I2C pins (used by bus clear only)            *
+ *******************************************************************************/
+#define I2C_0_GPIO_BASE_ADDRESS    0x40005000  /* GPIO Port B (PB2 SCL, PB3 SDA)  */
+#define I2C_1_GPIO_BASE_ADDRESS    0x40004000  /* GPIO Port A (PA6 SCL, PA7 SDA)  */
+#define I2C_2_GPIO_BASE_ADDRESS    0x40024000  /* GPIO Port E (PE4 SCL, PE5 SDA)  */
+#define I2C_3_GPIO_BASE_ADDRESS    0x40007000  /* GPIO Port D (PD0 SCL, PD1 SDA)  */
+
+#define I2C_GPIO_DATA_REG_OFFSET   0x3FC       /* GPIO Data (all bits unmasked)         */
+#define I2C_GPIO_DIR_REG_OFFSET    0x400       /* GPIO Direction                        */
+#define I2C_GPIO_AFSEL_REG_OFFSET  0x420       /* GPIO Alternate Function Select        */
+#define I2C_GPIO_ODR_REG_OFFSET    0x50C       /* GPIO Open Drain Select                */
+
 /*******************************************************************************
  *                   System Control I2C Enable Clock Register                  *
  *******************************************************************************/
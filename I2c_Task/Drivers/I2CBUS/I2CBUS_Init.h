@@ -0,0 +1,92 @@
+/********************************************************************************
+ * @headerfile    I2CBUS_Init.h
+ * @brief         Header file for I2C bus manager (several device drivers sharing
+ *                one I2C module) on TM4C123GH6PM Microcontroller
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ * @note          Transactions are queued by priority and run one after the other
+ *                from the I2C interrupt, so callers never block on the bus
+ * @note          I2cBus_Service() MUST be called periodically (main loop or timer),
+ *                it serves the I2C driver (I2c_Service), clears the bus after a
+ *                clock timeout and restarts transactions
+ *                which couldn't start because the bus was busy
+ * @note          Each device has its own descriptor (bus and slave address), so
+ *                device drivers never touch the shared I2c_Config
+ *******************************************************************************/
+
+#ifndef DRIVERS_I2CBUS_I2CBUS_INIT_H_
+#define DRIVERS_I2CBUS_I2CBUS_INIT_H_
+
+#include "std_types.h"
+#include "common_macros.h"
+#include "I2C_Init.h"
+
+
+/*******************************************************************************
+ *                                   Defines                                   *
+ *******************************************************************************/
+/* Maximum devices of all buses                                 */
+#define I2CBUS_MAX_DEVICES              (16U)
+
+/* Device index returned when no more devices can be added      */
+#define I2CBUS_NO_DEVICE                ((uint8) 0xFF)
+
+/* Transaction priorities (any value 0 -> 255 can be used, higher runs first) */
+#define I2CBUS_PRIORITY_LOW             ((uint8) 0x00)
+#define I2CBUS_PRIORITY_NORMAL          ((uint8) 0x80)
+#define I2CBUS_PRIORITY_HIGH            ((uint8) 0xFF)
+
+
+/*******************************************************************************
+ *                              User Defined Data Types                        *
+ *******************************************************************************/
+/*******************************************************************************
+ * @struct  I2cBus_Transaction
+ *
+ * @brief   Structure Holds one transaction (write phase, then read phase after
+ *          repeated START, any of them can be empty)
+ *          It is owned by the bus from I2cBus_Submit() until it is not
+ *          I2C_STATUS_PENDING anymore
+ *
+ * @var     I2cBus_Transaction::Device
+ *          Device index returned by I2cBus_AddDevice()
+ *
+ * @var     I2cBus_Transaction::Priority
+ *          Transactions with higher priority are run first, same priority
+ *          transactions are run in submit order
+ *
+ * @var     I2cBus_Transaction::TxBuffer, I2cBus_Transaction::TxLength
+ *          Bytes sent first (TxLength can be 0)
+ *
+ * @var     I2cBus_Transaction::RxBuffer, I2cBus_Transaction::RxLength
+ *          Bytes received after repeated START (RxLength can be 0)
+ *
+ * @var     I2cBus_Transaction::CallBack
+ *          Function called from I2C ISR when the transaction is done (can be NULL_PTR)
+ *
+ * @var     I2cBus_Transaction::Status
+ *          Result, You can find its value @ref I2C_STATUS
+ *          (I2C_STATUS_PENDING while queued or running)
+ ******************************************************************************/
+typedef struct{
+    uint8           Device;             /** Device index                            */
+    uint8           Priority;           /** Higher runs first                       */
+    const uint8*    TxBuffer;           /** Bytes to be sent                        */
+    uint32          TxLength;           /** Number of bytes to be sent              */
+    uint8*          RxBuffer;           /** Bytes received                          */
+    uint32          RxLength;           /** Number of bytes to be received          */
+    void (*CallBack)(uint8 Status);     /** Called when the transaction is done     */
+    volatile uint8  Status;             /** @ref I2C_STATUS                         */
+}I2cBus_Transaction;
+
+
+/*******************************************************************************
+ *                              Functions Prototype                            *
+ *******************************************************************************/
+uint8 I2cBus_Init(const I2c_Config* BusConfig);
+uint8 I2cBus_AddDevice(I2c_Instance Bus, uint8 Address);
+uint8 I2cBus_Submit(I2cBus_Transaction* Transaction);
+uint8 I2cBus_Service(I2c_Instance Bus);
+
+#endif /* DRIVERS_I2CBUS_I2CBUS_INIT_H_ */
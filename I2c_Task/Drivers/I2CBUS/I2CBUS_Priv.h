@@ -0,0 +1,72 @@
+/********************************************************************************
+ * @headerfile    I2CBUS_Priv.h
+ * @brief         Header file for I2C bus manager defines and private types on
+ *                TM4C123GH6PM Microcontroller
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ *
+ *******************************************************************************/
+
+
+#ifndef DRIVERS_I2CBUS_I2CBUS_PRIV_H_
+#define DRIVERS_I2CBUS_I2CBUS_PRIV_H_
+
+#include "std_types.h"
+#include "I2C_Init.h"
+#include "I2CBUS_Init.h"
+
+
+/************************** Queue defines *****************************/
+/* Transactions waiting per bus */
+#define I2CBUS_QUEUE_DEPTH              (8U)
+
+/* Number of I2C instances (one bus each) */
+#define I2CBUS_NUMBER_OF_BUSES          (4U)
+
+/* Mask/restore IRQs (PRIMASK), transactions are submitted from any context */
+#if defined(__TI_ARM__)
+#define I2CBUS_ENTER_CRITICAL()         ((uint32)_disable_interrupts())
+#define I2CBUS_EXIT_CRITICAL(KEY)       ((void)_restore_interrupts(KEY))
+#elif defined(__GNUC__) && defined(__ARM_ARCH)
+#define I2CBUS_ENTER_CRITICAL()         __extension__({ uint32 Key_; __asm volatile ("mrs %0, primask\n\tcpsid i" : "=r" (Key_) : : "memory"); Key_; })
+#define I2CBUS_EXIT_CRITICAL(KEY)       __asm volatile ("msr primask, %0" : : "r" (KEY) : "memory")
+#elif defined(HOST_TEST)
+#include "Test_Critical.h"
+#define I2CBUS_ENTER_CRITICAL()         Test_EnterCritical()
+#define I2CBUS_EXIT_CRITICAL(KEY)       Test_ExitCritical(KEY)
+#else
+#error "I2CBUS: no critical section (PRIMASK) implementation for this toolchain"
+#endif
+
+
+/*******************************************************************************
+ * @struct I2cBus_Device
+ *
+ * @brief  Structure holds one device descriptor
+ ******************************************************************************/
+typedef struct{
+    I2c_Instance        Bus;                /* I2C module the device is connected to    */
+    uint8               Address;            /* 7 bits slave address                     */
+}I2cBus_Device;
+
+
+/*******************************************************************************
+ * @struct I2cBus_Bus
+ *
+ * @brief  Structure holds one bus (I2C module) and its queue of transactions
+ *         sorted by priority (Queue[0] runs next)
+ *         Queue has one more slot: a transaction which couldn't start goes
+ *         back even if submits filled the queue while it was being started
+ ******************************************************************************/
+typedef struct{
+    const I2c_Config*   Config;                         /* Bus configuration (NULL_PTR if not initialized)  */
+    I2cBus_Transaction* Queue[I2CBUS_QUEUE_DEPTH + 1U]; /* Transactions waiting                             */
+    uint8               Count;                          /* Number of transactions waiting                   */
+    I2cBus_Transaction* Current;                        /* Running/starting transaction (NULL_PTR if idle)  */
+    volatile uint8      RecoverPending;                 /* TRUE after a clock timeout, queue held until
+                                                           I2cBus_Service() clears the bus                  */
+}I2cBus_Bus;
+
+
+#endif /* DRIVERS_I2CBUS_I2CBUS_PRIV_H_ */
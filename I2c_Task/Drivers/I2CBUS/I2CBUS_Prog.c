@@ -0,0 +1,414 @@
+/********************************************************************************
+ * @file          I2CBUS_Prog.c
+ * @brief         Source file for I2C bus manager (several device drivers sharing
+ *                one I2C module) on TM4C123GH6PM Microcontroller
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ * @note          Each transaction is an interrupt driven I2C transfer
+ *                (I2c_WriteReadIT), its completion (I2C ISR) starts the next
+ *                queued transaction then calls the transaction callback
+ * @note          Nothing blocking runs from the ISR: a transaction which can't
+ *                start (bus busy) stays at the head of the queue, and a clock
+ *                timeout holds the queue, both are handled by I2cBus_Service()
+ * @note          The bus owns its I2C module, it MUST NOT be used directly
+ *                (I2c_Transmit, I2c_WriteReadIT, ..) while transactions are queued
+ *******************************************************************************/
+
+
+/*******************************************************************************
+ *                              Includes                                       *
+ *******************************************************************************/
+#include "I2CBUS_Init.h"
+#include "I2CBUS_Priv.h"
+
+
+/*******************************************************************************
+ *                      Private Functions Prototype                            *
+ *******************************************************************************/
+static void I2cBus_Insert(I2cBus_Bus* Bus, I2cBus_Transaction* Transaction, uint8 Ahead);
+static void I2cBus_StartNext(I2cBus_Bus* Bus);
+static void I2cBus_Complete(I2c_Instance I2cNum, uint8 Status);
+static void I2cBus_I2c0Done(uint8 Status);
+static void I2cBus_I2c1Done(uint8 Status);
+static void I2cBus_I2c2Done(uint8 Status);
+static void I2cBus_I2c3Done(uint8 Status);
+
+
+/*******************************************************************************
+ *                              Global Variables                               *
+ *******************************************************************************/
+/* One bus per I2C instance */
+static I2cBus_Bus g_i2cBuses[I2CBUS_NUMBER_OF_BUSES];
+
+/* Devices of all buses */
+static I2cBus_Device g_i2cBusDevices[I2CBUS_MAX_DEVICES];
+static uint8 g_i2cBusDeviceCount = 0;
+
+/* Transfer completion call back of each bus */
+static void (*const g_i2cBusDoneCallBacks[I2CBUS_NUMBER_OF_BUSES])(uint8 Status) = {
+    I2cBus_I2c0Done, I2cBus_I2c1Done, I2cBus_I2c2Done, I2cBus_I2c3Done
+};
+
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * @fn              static void I2cBus_Insert(I2cBus_Bus* Bus, I2cBus_Transaction* Transaction,
+ *                                            uint8 Ahead)
+ * @brief           Function to put a transaction in the queue after all queued
+ *                  transactions with higher priority
+ * @note            Called with interrupts masked
+ * @param (in):     Transaction - Transaction to be queued
+ *                  Ahead       - TRUE to put it before queued transactions with the
+ *                                same priority (it was taken from the head), FALSE
+ *                                to put it after them (submit order)
+ * @param (out):    None
+ * @param (inout):  Bus - Bus of the transaction
+ * @return          None
+ *******************************************************************************/
+static void I2cBus_Insert(I2cBus_Bus* Bus, I2cBus_Transaction* Transaction, uint8 Ahead)
+{
+    /* Position of the transaction in the queue */
+    uint8 Position = 0;
+
+    /* Variable to iterate through the queue */
+    uint8 iteration = 0;
+
+    /* Skip transactions with higher (or the same) priority, then make room */
+    while( (Position < Bus->Count) &&
+           ( (Bus->Queue[Position]->Priority > Transaction->Priority) ||
+             ( (Ahead == FALSE) && (Bus->Queue[Position]->Priority == Transaction->Priority) ) ) )
+    {
+        Position++;
+    }
+    for(iteration = Bus->Count; iteration > Position; iteration--)
+    {
+        Bus->Queue[iteration] = Bus->Queue[iteration - 1U];
+    }
+
+    Bus->Queue[Position] = Transaction;
+    Bus->Count++;
+}
+
+/*******************************************************************************
+ * @fn              static void I2cBus_StartNext(I2cBus_Bus* Bus)
+ * @brief           Function to put the highest priority queued transaction on the bus
+ * @note            If the transfer can't start (bus owned by another master), the
+ *                  transaction goes back to the head of the queue and the bus is idle
+ *                  until I2cBus_Service() or I2cBus_Submit() tries again
+ * @note            Called with the bus claimed (Current is not NULL_PTR), from I2C ISR
+ *                  of the bus or with IRQs enabled, only the queue is locked so the
+ *                  I2C driver is never called masked
+ * @param (in):     None
+ * @param (out):    None
+ * @param (inout):  Bus - Bus to be served
+ * @return          None
+ *******************************************************************************/
+static void I2cBus_StartNext(I2cBus_Bus* Bus)
+{
+    /* Transaction taken from the head of the queue */
+    I2cBus_Transaction* Transaction = NULL_PTR;
+
+    /* Variable to iterate through the queue */
+    uint8 iteration = 0;
+
+    /* Saved interrupts state */
+    uint32 Key = 0;
+
+    Key = I2CBUS_ENTER_CRITICAL();
+
+    /* Queue is empty or held until the bus is cleared, bus is idle */
+    if( (Bus->Count == 0) || (Bus->RecoverPending == TRUE) )
+    {
+        Bus->Current = NULL_PTR;
+        I2CBUS_EXIT_CRITICAL(Key);
+        return;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    /* Taken before the transfer starts, its completion (I2C ISR) may run before I2c_WriteReadIT() returns */
+    Transaction  = Bus->Queue[0];
+    Bus->Current = Transaction;
+    Bus->Count--;
+    for(iteration = 0; iteration < Bus->Count; iteration++)
+    {
+        Bus->Queue[iteration] = Bus->Queue[iteration + 1U];
+    }
+
+    I2CBUS_EXIT_CRITICAL(Key);
+
+    if(I2c_WriteReadIT(Bus->Config, g_i2cBusDevices[Transaction->Device].Address,
+                       Transaction->TxBuffer, Transaction->TxLength, Transaction->RxBuffer, Transaction->RxLength,
+                       g_i2cBusDoneCallBacks[Bus->Config->I2cNum]) == RET_OK)
+    {
+        return;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    /* Bus is owned by another master, keep the transaction first in line for the next try */
+    Key = I2CBUS_ENTER_CRITICAL();
+    I2cBus_Insert(Bus, Transaction, TRUE);
+    Bus->Current = NULL_PTR;
+    I2CBUS_EXIT_CRITICAL(Key);
+}
+
+/*******************************************************************************
+ * @fn              static void I2cBus_Complete(I2c_Instance I2cNum, uint8 Status)
+ * @brief           Function called from I2C ISR when the transfer of the current
+ *                  transaction is done, it starts the next transaction then
+ *                  calls the transaction callback
+ * @param (in):     I2cNum - I2C instance of the bus
+ *                  Status - Result of the transfer
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+static void I2cBus_Complete(I2c_Instance I2cNum, uint8 Status)
+{
+    /* Bus of this I2C instance */
+    I2cBus_Bus* Bus = &g_i2cBuses[I2cNum];
+
+    /* Transaction which is done */
+    I2cBus_Transaction* Transaction = Bus->Current;
+
+    if(Transaction == NULL_PTR)
+    {
+        return;
+    }
+
+    Transaction->Status = Status;
+
+    /* A slave held SCL low, hold the queue until I2cBus_Service() clears the bus
+     * (bus recovery clocks SCL by software, it doesn't belong to the ISR) */
+    if(Status == I2C_STATUS_CLOCK_TIMEOUT)
+    {
+        Bus->RecoverPending = TRUE;
+    }
+
+    /* Keep the bus busy before running application code */
+    I2cBus_StartNext(Bus);
+
+    if(Transaction->CallBack != NULL_PTR)
+    {
+        (*Transaction->CallBack)(Status);
+    }
+}
+
+/*******************************************************************************
+ * @fn              static void I2cBus_I2cnDone(uint8 Status)
+ * @brief           Transfer completion call backs of each bus
+ *                  (I2C transfer call back has no instance argument)
+ * @param (in):     Status - Result of the transfer
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+static void I2cBus_I2c0Done(uint8 Status) { I2cBus_Complete(I2c0, Status); }
+static void I2cBus_I2c1Done(uint8 Status) { I2cBus_Complete(I2c1, Status); }
+static void I2cBus_I2c2Done(uint8 Status) { I2cBus_Complete(I2c2, Status); }
+static void I2cBus_I2c3Done(uint8 Status) { I2cBus_Complete(I2c3, Status); }
+
+
+/*******************************************************************************
+ *                      Public Functions Definitions                           *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * @fn              uint8 I2cBus_Init(const I2c_Config* BusConfig)
+ * @brief           Function to initialize an I2C module as a bus (Master mode)
+ * @note            I2C NVIC interrupt must be enabled by the application
+ * @param (in):     BusConfig - Configuration of the I2C module (MUST stay valid),
+ *                              its slave address and transmit/receive modes are not used
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Return Status (RET_OK if everything is ok)
+ *******************************************************************************/
+uint8 I2cBus_Init(const I2c_Config* BusConfig)
+{
+    /* Bus of the requested I2C instance */
+    I2cBus_Bus* Bus = NULL_PTR;
+
+    /* Check if the input configuration is valid */
+    if( (NULL_PTR == BusConfig) || (BusConfig->I2cNum >= I2CBUS_NUMBER_OF_BUSES) ||
+        ( ( (BusConfig->I2cMode) & I2C_MODE_MASTER) != I2C_MODE_MASTER ) )
+    {
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    Bus = &g_i2cBuses[BusConfig->I2cNum];
+
+    if(I2c_Init(BusConfig) != RET_OK)
+    {
+        return RET_NOT_OK;
+    }
+
+    Bus->Config         = BusConfig;
+    Bus->Count          = 0;
+    Bus->Current        = NULL_PTR;
+    Bus->RecoverPending = FALSE;
+
+    return RET_OK;
+}
+
+/*******************************************************************************
+ * @fn              uint8 I2cBus_AddDevice(I2c_Instance Bus, uint8 Address)
+ * @brief           Function to add a device descriptor to a bus
+ * @param (in):     Bus     - I2C instance the device is connected to (initialized by I2cBus_Init)
+ *                  Address - 7 bits slave address of the device
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Device index used in transactions, or I2CBUS_NO_DEVICE
+ *******************************************************************************/
+uint8 I2cBus_AddDevice(I2c_Instance Bus, uint8 Address)
+{
+    /* Check if the bus is initialized and there is room for the device */
+    if( (Bus >= I2CBUS_NUMBER_OF_BUSES) || (NULL_PTR == g_i2cBuses[Bus].Config) ||
+        (g_i2cBusDeviceCount >= I2CBUS_MAX_DEVICES) )
+    {
+        return I2CBUS_NO_DEVICE;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    g_i2cBusDevices[g_i2cBusDeviceCount].Bus     = Bus;
+    g_i2cBusDevices[g_i2cBusDeviceCount].Address = Address;
+
+    g_i2cBusDeviceCount++;
+
+    return (uint8)(g_i2cBusDeviceCount - 1U);
+}
+
+/*******************************************************************************
+ * @fn              uint8 I2cBus_Submit(I2cBus_Transaction* Transaction)
+ * @brief           Function to queue a transaction on the bus of its device,
+ *                  after all queued transactions with the same or higher priority
+ *                  It returns at once, the transaction runs from I2C ISR
+ * @param (in):     None
+ * @param (out):    None
+ * @param (inout):  Transaction - Transaction to run (MUST stay valid until its
+ *                                Status is not I2C_STATUS_PENDING anymore)
+ * @return          Return Status (RET_NOT_OK if the transaction is invalid,
+ *                  already queued or the bus queue is full)
+ *******************************************************************************/
+uint8 I2cBus_Submit(I2cBus_Transaction* Transaction)
+{
+    /* Bus of the transaction device */
+    I2cBus_Bus* Bus = NULL_PTR;
+
+    /* TRUE if the bus was idle and is claimed to start the queue */
+    uint8 Start = FALSE;
+
+    /* Saved interrupts state */
+    uint32 Key = 0;
+
+    /* Check if the transaction is valid */
+    if( (NULL_PTR == Transaction) || (Transaction->Device >= g_i2cBusDeviceCount) ||
+        ( (0 == Transaction->TxLength) && (0 == Transaction->RxLength) ) ||
+        ( (0 != Transaction->TxLength) && (NULL_PTR == Transaction->TxBuffer) ) ||
+        ( (0 != Transaction->RxLength) && (NULL_PTR == Transaction->RxBuffer) ) ||
+        (Transaction->Status == I2C_STATUS_PENDING) )
+    {
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    Bus = &g_i2cBuses[g_i2cBusDevices[Transaction->Device].Bus];
+
+    Key = I2CBUS_ENTER_CRITICAL();
+
+    if(Bus->Count >= I2CBUS_QUEUE_DEPTH)
+    {
+        I2CBUS_EXIT_CRITICAL(Key);
+        return RET_NOT_OK;
+    }
+
+    Transaction->Status = I2C_STATUS_PENDING;
+    I2cBus_Insert(Bus, Transaction, FALSE);
+
+    /* Idle bus, claim it to start at once (otherwise the running transaction completion starts it) */
+    if(Bus->Current == NULL_PTR)
+    {
+        Bus->Current = Transaction;
+        Start = TRUE;
+    }
+
+    I2CBUS_EXIT_CRITICAL(Key);
+
+    /* I2C transfer is started with IRQs enabled */
+    if(Start == TRUE)
+    {
+        I2cBus_StartNext(Bus);
+    }
+
+    return RET_OK;
+}
+
+/*******************************************************************************
+ * @fn              uint8 I2cBus_Service(I2c_Instance Bus)
+ * @brief           Function to serve the I2C driver (deferred arbitration loss
+ *                  retry), clear the bus after a clock timeout and restart
+ *                  the queue if it is idle (transaction which couldn't start
+ *                  because the bus was busy, or queue held by the clock timeout)
+ * @note            It MUST be called periodically (main loop or timer), never from
+ *                  I2C ISR (bus recovery clocks SCL by software)
+ * @param (in):     Bus - I2C instance of the bus (initialized by I2cBus_Init)
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Return Status (RET_NOT_OK if the bus is not initialized or
+ *                  it couldn't be cleared, it is tried again on the next call)
+ *******************************************************************************/
+uint8 I2cBus_Service(I2c_Instance Bus)
+{
+    /* Bus of the requested I2C instance */
+    I2cBus_Bus* BusPtr = NULL_PTR;
+
+    /* TRUE if the bus was idle and is claimed to restart the queue */
+    uint8 Start = FALSE;
+
+    /* Saved interrupts state */
+    uint32 Key = 0;
+
+    /* Check if the bus is initialized */
+    if( (Bus >= I2CBUS_NUMBER_OF_BUSES) || (NULL_PTR == g_i2cBuses[Bus].Config) )
+    {
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    BusPtr = &g_i2cBuses[Bus];
+
+    /* Deferred arbitration loss retry of the running transaction (may complete it) */
+    (void)I2c_Service(Bus);
+
+    /* Queue is held (no transfer on the I2C module) until the bus is cleared */
+    if( (BusPtr->RecoverPending == TRUE) && (BusPtr->Current == NULL_PTR) )
+    {
+        if(I2c_BusRecover(BusPtr->Config) != RET_OK)
+        {
+            return RET_NOT_OK;
+        }
+        /* There is no need for else because if the if statement occurred, a return will happened */
+
+        BusPtr->RecoverPending = FALSE;
+    }
+
+    Key = I2CBUS_ENTER_CRITICAL();
+
+    if( (BusPtr->Current == NULL_PTR) && (BusPtr->Count != 0) )
+    {
+        BusPtr->Current = BusPtr->Queue[0];
+        Start = TRUE;
+    }
+
+    I2CBUS_EXIT_CRITICAL(Key);
+
+    if(Start == TRUE)
+    {
+        I2cBus_StartNext(BusPtr);
+    }
+
+    return RET_OK;
+}
@@ -0,0 +1,97 @@
+/********************************************************************************
+ * @headerfile    SPIBUS_Init.h
+ * @brief         Header file for SPI bus manager (several devices with GPIO
+ *                chip-selects sharing one SSI module) on TM4C123GH6PM Microcontroller
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ * @note          Transactions are queued and run one after the other from the
+ *                SSI interrupt, so callers never block on the bus
+ * @note          CR0/CPSR are rewritten only when the next device needs other
+ *                clock rate, clock polarity/phase or word length
+ *******************************************************************************/
+
+#ifndef DRIVERS_SPIBUS_SPIBUS_INIT_H_
+#define DRIVERS_SPIBUS_SPIBUS_INIT_H_
+
+#include "std_types.h"
+#include "common_macros.h"
+#include "SSI_Init.h"
+
+
+/*******************************************************************************
+ *                                   Defines                                   *
+ *******************************************************************************/
+/* Maximum devices of all buses                                 */
+#define SPIBUS_MAX_DEVICES              (8U)
+
+/* Device index returned when no more devices can be added      */
+#define SPIBUS_NO_DEVICE                ((uint8) 0xFF)
+
+/* Define used to build the masked GPIODATA address of a chip-select pin
+ * (writes to this address change only that pin) */
+#define SPIBUS_CS_PIN_ADDRESS(GPIO_PORT_BASE, PIN)  ((uint32)(GPIO_PORT_BASE) + (((uint32)1 << (PIN)) << 2))
+
+/* Define used to know the state of a transaction @ref SPIBUS_TRANSACTION */
+#define SPIBUS_TRANSACTION_IDLE         ((uint8) 0x0)   /* Never submitted or Completed     */
+#define SPIBUS_TRANSACTION_PENDING      ((uint8) 0x1)   /* Waiting in the bus queue         */
+#define SPIBUS_TRANSACTION_RUNNING      ((uint8) 0x2)   /* Chip-select asserted, on the bus */
+#define SPIBUS_TRANSACTION_FAILED       ((uint8) 0x3)   /* SSI module was busy with another transfer */
+
+
+/*******************************************************************************
+ *                              User Defined Data Types                        *
+ *******************************************************************************/
+/*******************************************************************************
+ * @struct  SpiBus_Transaction
+ *
+ * @brief   Structure Holds one transaction (chip-select asserted during all frames)
+ *          It is owned by the bus from SpiBus_Submit() until it is IDLE again
+ *
+ * @var     SpiBus_Transaction::Device
+ *          Device index returned by SpiBus_AddDevice()
+ *
+ * @var     SpiBus_Transaction::Header
+ *          Command/address bytes sent before the frames while chip-select stays
+ *          asserted, frames received meanwhile are discarded (NULL_PTR if unused)
+ *          The device word length MUST be 8 bits to use it
+ *
+ * @var     SpiBus_Transaction::HeaderLength
+ *          Number of header bytes (0 if unused)
+ *
+ * @var     SpiBus_Transaction::TxBuffer
+ *          Frames to be sent (NULL_PTR sends dummy frames)
+ *
+ * @var     SpiBus_Transaction::RxBuffer
+ *          Frames received (NULL_PTR discards them)
+ *
+ * @var     SpiBus_Transaction::Length
+ *          Number of frames (buffers are uint8 arrays for word length <= 8 bits,
+ *          uint16 arrays otherwise), it can be 0 if there is a header
+ *
+ * @var     SpiBus_Transaction::CallBack
+ *          Function called from SSI ISR after chip-select is released (can be NULL_PTR)
+ *
+ * @var     SpiBus_Transaction::Status
+ *          Transaction state, You can find its value @ref SPIBUS_TRANSACTION
+ ******************************************************************************/
+typedef struct{
+    uint8           Device;             /** Device index                            */
+    const uint8*    Header;             /** Command/address bytes sent first        */
+    uint8           HeaderLength;       /** Number of header bytes                  */
+    const void*     TxBuffer;           /** Frames to be sent                       */
+    void*           RxBuffer;           /** Frames received                         */
+    uint32          Length;             /** Number of frames                        */
+    void (*CallBack)(void);             /** Called when the transaction is done     */
+    volatile uint8  Status;             /** @ref SPIBUS_TRANSACTION                 */
+}SpiBus_Transaction;
+
+
+/*******************************************************************************
+ *                              Functions Prototype                            *
+ *******************************************************************************/
+uint8 SpiBus_Init(const Ssi_Config* BusConfig);
+uint8 SpiBus_AddDevice(const Ssi_Config* DeviceConfig, uint32 CsPinAddress);
+uint8 SpiBus_Submit(SpiBus_Transaction* Transaction);
+
+#endif /* DRIVERS_SPIBUS_SPIBUS_INIT_H_ */
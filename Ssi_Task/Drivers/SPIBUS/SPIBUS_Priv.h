@@ -0,0 +1,77 @@
+/********************************************************************************
+ * @headerfile    SPIBUS_Priv.h
+ * @brief         Header file for SPI bus manager defines and private types on
+ *                TM4C123GH6PM Microcontroller
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ *
+ *******************************************************************************/
+
+
+#ifndef DRIVERS_SPIBUS_SPIBUS_PRIV_H_
+#define DRIVERS_SPIBUS_SPIBUS_PRIV_H_
+
+#include "std_types.h"
+#include "SSI_Init.h"
+#include "SPIBUS_Init.h"
+
+
+/************************** Queue defines *****************************/
+/* Transactions waiting per bus (MUST be a power of 2) */
+#define SPIBUS_QUEUE_DEPTH              (8U)
+#define SPIBUS_QUEUE_MASK               ((uint8) (SPIBUS_QUEUE_DEPTH - 1U))
+
+/* Number of SSI instances (one bus each) */
+#define SPIBUS_NUMBER_OF_BUSES          (4U)
+
+/************************** Chip-select defines *****************************/
+/* Values written to the masked GPIODATA address of a chip-select (active low) */
+#define SPIBUS_CS_ASSERT                ((uint32) 0x00)
+#define SPIBUS_CS_RELEASE               ((uint32) 0xFF)
+
+/* Mask/restore IRQs (PRIMASK), transactions are submitted from any context */
+#if defined(__TI_ARM__)
+#define SPIBUS_ENTER_CRITICAL()         ((uint32)_disable_interrupts())
+#define SPIBUS_EXIT_CRITICAL(KEY)       ((void)_restore_interrupts(KEY))
+#elif defined(__GNUC__) && defined(__ARM_ARCH)
+#define SPIBUS_ENTER_CRITICAL()         __extension__({ uint32 Key_; __asm volatile ("mrs %0, primask\n\tcpsid i" : "=r" (Key_) : : "memory"); Key_; })
+#define SPIBUS_EXIT_CRITICAL(KEY)       __asm volatile ("msr primask, %0" : : "r" (KEY) : "memory")
+#elif defined(HOST_TEST)
+#include "Test_Critical.h"
+#define SPIBUS_ENTER_CRITICAL()         Test_EnterCritical()
+#define SPIBUS_EXIT_CRITICAL(KEY)       Test_ExitCritical(KEY)
+#else
+#error "SPIBUS: no critical section (PRIMASK) implementation for this toolchain"
+#endif
+
+
+/*******************************************************************************
+ * @struct SpiBus_Device
+ *
+ * @brief  Structure holds one device and its precalculated CR0/CPSR values
+ ******************************************************************************/
+typedef struct{
+    const Ssi_Config*   Config;             /* Device configuration (SSI module, rate, mode, word length) */
+    Ssi_FrameSettings   Settings;           /* CR0 and CPSR values of the device                          */
+    uint32              CsPinAddress;       /* Masked GPIODATA address of chip-select pin                 */
+}SpiBus_Device;
+
+
+/*******************************************************************************
+ * @struct SpiBus_Bus
+ *
+ * @brief  Structure holds one bus (SSI module) and its queue of transactions
+ ******************************************************************************/
+typedef struct{
+    const Ssi_Config*   Config;                         /* Bus configuration (NULL_PTR if not initialized)  */
+    Ssi_FrameSettings   Active;                         /* CR0 and CPSR values currently in the module      */
+    SpiBus_Transaction* Queue[SPIBUS_QUEUE_DEPTH];      /* Transactions waiting                             */
+    uint8               Head;                           /* Producer index (free running)                    */
+    uint8               Tail;                           /* Consumer index (free running)                    */
+    SpiBus_Transaction* Current;                        /* Running/starting transaction (NULL_PTR if idle)  */
+    uint8               InHeader;                       /* TRUE while header of Current is on the bus       */
+}SpiBus_Bus;
+
+
+#endif /* DRIVERS_SPIBUS_SPIBUS_PRIV_H_ */
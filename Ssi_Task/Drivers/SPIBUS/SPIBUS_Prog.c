@@ -0,0 +1,372 @@
+/********************************************************************************
+ * @file          SPIBUS_Prog.c
+ * @brief         Source file for SPI bus manager (several devices with GPIO
+ *                chip-selects sharing one SSI module) on TM4C123GH6PM Microcontroller
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ * @note          Each transaction is an interrupt driven SSI transfer (two when
+ *                it has a header), its completion (SSI ISR) releases the
+ *                chip-select and starts the next queued transaction
+ * @note          The bus owns its SSI module, it MUST NOT be used directly
+ *                (Ssi_Transmit, Ssi_TransmitDMA, ..) while transactions are queued
+ *******************************************************************************/
+
+
+/*******************************************************************************
+ *                              Includes                                       *
+ *******************************************************************************/
+#include "SPIBUS_Init.h"
+#include "SPIBUS_Priv.h"
+
+
+/*******************************************************************************
+ *                      Private Functions Prototype                            *
+ *******************************************************************************/
+static void SpiBus_StartNext(SpiBus_Bus* Bus);
+static void SpiBus_Fail(SpiBus_Transaction* Transaction);
+static void SpiBus_Complete(Ssi_Instance SsiNum);
+static void SpiBus_Ssi0Done(void);
+static void SpiBus_Ssi1Done(void);
+static void SpiBus_Ssi2Done(void);
+static void SpiBus_Ssi3Done(void);
+
+
+/*******************************************************************************
+ *                              Global Variables                               *
+ *******************************************************************************/
+/* One bus per SSI instance */
+static SpiBus_Bus g_spiBuses[SPIBUS_NUMBER_OF_BUSES];
+
+/* Devices of all buses */
+static SpiBus_Device g_spiBusDevices[SPIBUS_MAX_DEVICES];
+static uint8 g_spiBusDeviceCount = 0;
+
+/* Transfer completion call back of each bus */
+static void (*const g_spiBusDoneCallBacks[SPIBUS_NUMBER_OF_BUSES])(void) = {
+    SpiBus_Ssi0Done, SpiBus_Ssi1Done, SpiBus_Ssi2Done, SpiBus_Ssi3Done
+};
+
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * @fn              static void SpiBus_StartNext(SpiBus_Bus* Bus)
+ * @brief           Function to put the next queued transaction on the bus
+ *                  - Rewrites CR0/CPSR only if the device needs other values
+ *                  - Asserts the device chip-select and starts the SSI transfer
+ * @note            Called with IRQs enabled: the bus is claimed (Current is not
+ *                  NULL_PTR) by the caller, only the queue is locked, so the
+ *                  callbacks of failed transactions never run masked
+ * @param (in):     None
+ * @param (out):    None
+ * @param (inout):  Bus - Bus to be served
+ * @return          None
+ *******************************************************************************/
+static void SpiBus_StartNext(SpiBus_Bus* Bus)
+{
+    /* Transaction taken from the queue */
+    SpiBus_Transaction* Transaction = NULL_PTR;
+
+    /* Device of the transaction */
+    const SpiBus_Device* Device = NULL_PTR;
+
+    /* Saved interrupts state */
+    uint32 Key = 0;
+
+    for(;;)
+    {
+        Key = SPIBUS_ENTER_CRITICAL();
+
+        if(Bus->Head == Bus->Tail)
+        {
+            /* Queue is empty, bus is idle (a later submit starts it again) */
+            Bus->Current = NULL_PTR;
+            SPIBUS_EXIT_CRITICAL(Key);
+            return;
+        }
+
+        Transaction = Bus->Queue[Bus->Tail & SPIBUS_QUEUE_MASK];
+        Bus->Tail++;
+
+        SPIBUS_EXIT_CRITICAL(Key);
+
+        Device = &g_spiBusDevices[Transaction->Device];
+
+        /* Switch the module only when clock rate, mode or word length differ */
+        if( (Device->Settings.Cr0 != Bus->Active.Cr0) || (Device->Settings.Cpsr != Bus->Active.Cpsr) )
+        {
+            Ssi_ApplyFrameSettings(Device->Config, &Device->Settings);
+            Bus->Active = Device->Settings;
+        }
+
+        Bus->Current = Transaction;
+        Bus->InHeader = (Transaction->HeaderLength != 0) ? TRUE : FALSE;
+        Transaction->Status = SPIBUS_TRANSACTION_RUNNING;
+        *(volatile uint32*)Device->CsPinAddress = SPIBUS_CS_ASSERT;
+
+        /* Header first (if any), the frames are started from its completion */
+        if(Bus->InHeader == TRUE)
+        {
+            if(Ssi_TransferIT(Device->Config, Transaction->Header, NULL_PTR, Transaction->HeaderLength,
+                              g_spiBusDoneCallBacks[Device->Config->SsiNum]) == RET_OK)
+            {
+                return;
+            }
+        }
+        else if(Ssi_TransferIT(Device->Config, Transaction->TxBuffer, Transaction->RxBuffer, Transaction->Length,
+                               g_spiBusDoneCallBacks[Device->Config->SsiNum]) == RET_OK)
+        {
+            return;
+        }
+
+        /* SSI module is used by another transfer, report it and go on with the queue */
+        SpiBus_Fail(Transaction);
+    }
+}
+
+/*******************************************************************************
+ * @fn              static void SpiBus_Fail(SpiBus_Transaction* Transaction)
+ * @brief           Function to release the chip-select of a transaction which
+ *                  couldn't get the SSI module, and report it to the application
+ * @param (in):     None
+ * @param (out):    None
+ * @param (inout):  Transaction - Transaction which failed
+ * @return          None
+ *******************************************************************************/
+static void SpiBus_Fail(SpiBus_Transaction* Transaction)
+{
+    *(volatile uint32*)g_spiBusDevices[Transaction->Device].CsPinAddress = SPIBUS_CS_RELEASE;
+    Transaction->Status = SPIBUS_TRANSACTION_FAILED;
+    if(Transaction->CallBack != NULL_PTR)
+    {
+        (*Transaction->CallBack)();
+    }
+}
+
+/*******************************************************************************
+ * @fn              static void SpiBus_Complete(Ssi_Instance SsiNum)
+ * @brief           Function called from SSI ISR when the transfer of the current
+ *                  transaction is done
+ *                  - Header done: starts the frames with chip-select still asserted
+ *                  - Frames done: releases the chip-select, starts the next
+ *                    transaction then calls the transaction callback
+ * @param (in):     SsiNum - SSI instance of the bus
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+static void SpiBus_Complete(Ssi_Instance SsiNum)
+{
+    /* Bus of this SSI instance */
+    SpiBus_Bus* Bus = &g_spiBuses[SsiNum];
+
+    /* Transaction which is done */
+    SpiBus_Transaction* Transaction = Bus->Current;
+
+    /* Final state of the transaction */
+    uint8 Result = SPIBUS_TRANSACTION_IDLE;
+
+    if(Transaction == NULL_PTR)
+    {
+        return;
+    }
+
+    if( (Bus->InHeader == TRUE) && (Transaction->Length != 0) )
+    {
+        Bus->InHeader = FALSE;
+
+        /* Frames follow the header with chip-select still asserted */
+        if(Ssi_TransferIT(g_spiBusDevices[Transaction->Device].Config, Transaction->TxBuffer,
+                          Transaction->RxBuffer, Transaction->Length, g_spiBusDoneCallBacks[SsiNum]) == RET_OK)
+        {
+            return;
+        }
+
+        /* SSI module was taken between header and frames */
+        Result = SPIBUS_TRANSACTION_FAILED;
+    }
+
+    *(volatile uint32*)g_spiBusDevices[Transaction->Device].CsPinAddress = SPIBUS_CS_RELEASE;
+    Transaction->Status = Result;
+
+    /* Keep the bus busy before running application code */
+    SpiBus_StartNext(Bus);
+
+    if(Transaction->CallBack != NULL_PTR)
+    {
+        (*Transaction->CallBack)();
+    }
+}
+
+/*******************************************************************************
+ * @fn              static void SpiBus_SsinDone(void)
+ * @brief           Transfer completion call backs of each bus
+ *                  (SSI transfer call back has no arguments)
+ * @param (in):     None
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+static void SpiBus_Ssi0Done(void) { SpiBus_Complete(Ssi0); }
+static void SpiBus_Ssi1Done(void) { SpiBus_Complete(Ssi1); }
+static void SpiBus_Ssi2Done(void) { SpiBus_Complete(Ssi2); }
+static void SpiBus_Ssi3Done(void) { SpiBus_Complete(Ssi3); }
+
+
+/*******************************************************************************
+ *                      Public Functions Definitions                           *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * @fn              uint8 SpiBus_Init(const Ssi_Config* BusConfig)
+ * @brief           Function to initialize the SSI module of a bus as master
+ * @note            SSI NVIC interrupt must be enabled by the application
+ * @param (in):     BusConfig - SSI configuration of the bus (MUST stay valid),
+ *                              rate/mode/word length are replaced by each device ones
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Return Status (RET_OK if everything is ok)
+ *******************************************************************************/
+uint8 SpiBus_Init(const Ssi_Config* BusConfig)
+{
+    /* Bus of the requested SSI instance */
+    SpiBus_Bus* Bus = NULL_PTR;
+
+    /* Check if the input configuration is valid */
+    if( (NULL_PTR == BusConfig) || (BusConfig->SsiNum >= SPIBUS_NUMBER_OF_BUSES) ||
+        (BusConfig->SsiMode != SSI_MODE_MASTER) )
+    {
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    Bus = &g_spiBuses[BusConfig->SsiNum];
+
+    if(Ssi_Init(BusConfig) != RET_OK)
+    {
+        return RET_NOT_OK;
+    }
+
+    Ssi_GetFrameSettings(BusConfig, &Bus->Active);
+    Bus->Config  = BusConfig;
+    Bus->Head    = 0;
+    Bus->Tail    = 0;
+    Bus->Current = NULL_PTR;
+
+    return RET_OK;
+}
+
+/*******************************************************************************
+ * @fn              uint8 SpiBus_AddDevice(const Ssi_Config* DeviceConfig, uint32 CsPinAddress)
+ * @brief           Function to add a device on an initialized bus
+ *                  Its CR0/CPSR values are calculated once and its chip-select is released
+ * @note            Chip-select pin MUST be configured as GPIO output by the application
+ * @param (in):     DeviceConfig - Device configuration (MUST stay valid), SsiNum selects the bus,
+ *                                 SsiFreq, WordLength, SsiClkPolarity and SsiClkPhase are used
+ *                  CsPinAddress - Masked GPIODATA address of chip-select pin
+ *                                 (see SPIBUS_CS_PIN_ADDRESS)
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Device index (SPIBUS_NO_DEVICE if it can't be added)
+ *******************************************************************************/
+uint8 SpiBus_AddDevice(const Ssi_Config* DeviceConfig, uint32 CsPinAddress)
+{
+    /* Device being added */
+    SpiBus_Device* Device = NULL_PTR;
+
+    /* Check if the input configuration is valid and its bus is initialized */
+    if( (NULL_PTR == DeviceConfig) || (DeviceConfig->SsiNum >= SPIBUS_NUMBER_OF_BUSES) ||
+        (NULL_PTR == g_spiBuses[DeviceConfig->SsiNum].Config) || (g_spiBusDeviceCount >= SPIBUS_MAX_DEVICES) )
+    {
+        return SPIBUS_NO_DEVICE;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    Device = &g_spiBusDevices[g_spiBusDeviceCount];
+
+    if(Ssi_GetFrameSettings(DeviceConfig, &Device->Settings) != RET_OK)
+    {
+        return SPIBUS_NO_DEVICE;
+    }
+
+    Device->Config       = DeviceConfig;
+    Device->CsPinAddress = CsPinAddress;
+
+    /* Device is not selected until it has a transaction */
+    *(volatile uint32*)CsPinAddress = SPIBUS_CS_RELEASE;
+
+    g_spiBusDeviceCount++;
+
+    return (uint8)(g_spiBusDeviceCount - 1U);
+}
+
+/*******************************************************************************
+ * @fn              uint8 SpiBus_Submit(SpiBus_Transaction* Transaction)
+ * @brief           Function to queue a transaction on the bus of its device
+ *                  It returns at once, the transaction runs from SSI ISR
+ * @note            On an idle bus the transaction is started after IRQs are
+ *                  enabled again, its callback runs from here if the SSI
+ *                  module is used by another transfer (FAILED)
+ * @param (in):     None
+ * @param (out):    None
+ * @param (inout):  Transaction - Transaction to run (MUST stay valid until its
+ *                                Status is not PENDING/RUNNING anymore)
+ * @return          Return Status (RET_NOT_OK if the transaction is invalid,
+ *                  already queued or the bus queue is full)
+ *******************************************************************************/
+uint8 SpiBus_Submit(SpiBus_Transaction* Transaction)
+{
+    /* Bus of the transaction device */
+    SpiBus_Bus* Bus = NULL_PTR;
+
+    /* Saved interrupts state */
+    uint32 Key = 0;
+
+    /* TRUE if the bus was idle and this call starts it */
+    uint8 Start = FALSE;
+
+    /* Check if the transaction is valid */
+    if( (NULL_PTR == Transaction) || (Transaction->Device >= g_spiBusDeviceCount) ||
+        ( (0 == Transaction->Length) && (0 == Transaction->HeaderLength) ) ||
+        ( (0 != Transaction->HeaderLength) && (NULL_PTR == Transaction->Header) ) ||
+        (Transaction->Status == SPIBUS_TRANSACTION_PENDING) || (Transaction->Status == SPIBUS_TRANSACTION_RUNNING) )
+    {
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    Bus = &g_spiBuses[g_spiBusDevices[Transaction->Device].Config->SsiNum];
+
+    Key = SPIBUS_ENTER_CRITICAL();
+
+    if( (uint8)(Bus->Head - Bus->Tail) >= SPIBUS_QUEUE_DEPTH )
+    {
+        SPIBUS_EXIT_CRITICAL(Key);
+        return RET_NOT_OK;
+    }
+
+    Transaction->Status = SPIBUS_TRANSACTION_PENDING;
+    Bus->Queue[Bus->Head & SPIBUS_QUEUE_MASK] = Transaction;
+    Bus->Head++;
+
+    /* Idle bus: claim it, so a submit from an ISR only queues (otherwise the
+     * running transaction completion starts the next one) */
+    if(Bus->Current == NULL_PTR)
+    {
+        Bus->Current = Transaction;
+        Start = TRUE;
+    }
+
+    SPIBUS_EXIT_CRITICAL(Key);
+
+    /* SSI transfer is started, or a failure reported, with IRQs enabled */
+    if(Start == TRUE)
+    {
+        SpiBus_StartNext(Bus);
+    }
+
+    return RET_OK;
+}
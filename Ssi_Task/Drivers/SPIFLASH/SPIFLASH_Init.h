@@ -0,0 +1,76 @@
+/********************************************************************************
+ * @headerfile    SPIFLASH_Init.h
+ * @brief         Header file for SPI NOR flash (JEDEC standard commands) on top
+ *                of the SPI bus manager on TM4C123GH6PM Microcontroller
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ * @note          All operations return at once, the application polls
+ *                SpiFlash_Poll() until it is not SPIFLASH_STATE_BUSY anymore
+ * @note          The flash device MUST be added to the bus with 8 bits word
+ *                length and SPI mode 0 or 3, 24 bits addresses (up to 16 MB)
+ *******************************************************************************/
+
+#ifndef DRIVERS_SPIFLASH_SPIFLASH_INIT_H_
+#define DRIVERS_SPIFLASH_SPIFLASH_INIT_H_
+
+#include "std_types.h"
+#include "common_macros.h"
+#include "SPIBUS_Init.h"
+
+
+/*******************************************************************************
+ *                                   Defines                                   *
+ *******************************************************************************/
+/* Page Program can't cross a page, Sector Erase clears a whole sector  */
+#define SPIFLASH_PAGE_SIZE              (256U)
+#define SPIFLASH_SECTOR_SIZE            (4096U)
+
+/* Define used to know the state of a flash @ref SPIFLASH_STATE */
+#define SPIFLASH_STATE_READY            ((uint8) 0x0)   /* No operation in progress                         */
+#define SPIFLASH_STATE_BUSY             ((uint8) 0x1)   /* Transfer queued or program/erase not finished    */
+#define SPIFLASH_STATE_ERROR            ((uint8) 0x2)   /* Last operation couldn't get the bus              */
+
+/* Command (1 byte) + address (3 bytes) + dummy byte of fast read */
+#define SPIFLASH_HEADER_MAX             (5U)
+
+
+/*******************************************************************************
+ *                              User Defined Data Types                        *
+ *******************************************************************************/
+/*******************************************************************************
+ * @struct  SpiFlash_Handle
+ *
+ * @brief   Structure Holds one flash device and its operation in progress
+ *          It is owned by the application, initialized by SpiFlash_Init()
+ *          and MUST NOT be changed directly
+ ******************************************************************************/
+typedef struct{
+    uint8               Device;                         /** Bus device index (SpiBus_AddDevice)         */
+    uint8               Operation;                      /** Operation in progress                       */
+    uint8               State;                          /** @ref SPIFLASH_STATE                         */
+    uint8               StatusPolling;                  /** TRUE while Read Status is queued            */
+    uint8               StatusRegister;                 /** Last Status Register value                  */
+    uint8               JedecId[3];                     /** Manufacturer, memory type and capacity      */
+    uint8               EnableHeader[1];                /** Write Enable command                        */
+    uint8               StatusHeader[1];                /** Read Status Register command                */
+    uint8               Header[SPIFLASH_HEADER_MAX];    /** Command and address of the operation        */
+    SpiBus_Transaction  Enable;                         /** Write Enable before program/erase           */
+    SpiBus_Transaction  Command;                        /** The operation itself                        */
+    SpiBus_Transaction  Status;                         /** Read Status Register polling                */
+}SpiFlash_Handle;
+
+
+/*******************************************************************************
+ *                              Functions Prototype                            *
+ *******************************************************************************/
+uint8  SpiFlash_Init(SpiFlash_Handle* Flash, uint8 Device);
+uint8  SpiFlash_ReadJedecId(SpiFlash_Handle* Flash);
+uint32 SpiFlash_GetJedecId(const SpiFlash_Handle* Flash);
+uint32 SpiFlash_GetCapacity(const SpiFlash_Handle* Flash);
+uint8  SpiFlash_Read(SpiFlash_Handle* Flash, uint32 Address, void* Buffer, uint32 Length);
+uint8  SpiFlash_ProgramPage(SpiFlash_Handle* Flash, uint32 Address, const void* Data, uint32 Length);
+uint8  SpiFlash_EraseSector(SpiFlash_Handle* Flash, uint32 Address);
+uint8  SpiFlash_Poll(SpiFlash_Handle* Flash);
+
+#endif /* DRIVERS_SPIFLASH_SPIFLASH_INIT_H_ */
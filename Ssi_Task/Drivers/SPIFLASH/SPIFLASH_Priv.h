@@ -0,0 +1,46 @@
+/********************************************************************************
+ * @headerfile    SPIFLASH_Priv.h
+ * @brief         Header file for SPI NOR flash commands and private defines on
+ *                TM4C123GH6PM Microcontroller
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ *
+ *******************************************************************************/
+
+
+#ifndef DRIVERS_SPIFLASH_SPIFLASH_PRIV_H_
+#define DRIVERS_SPIFLASH_SPIFLASH_PRIV_H_
+
+#include "std_types.h"
+
+
+/************************** JEDEC standard commands *****************************/
+#define SPIFLASH_CMD_WRITE_ENABLE       ((uint8) 0x06)
+#define SPIFLASH_CMD_READ_STATUS        ((uint8) 0x05)
+#define SPIFLASH_CMD_FAST_READ          ((uint8) 0x0B)  /* Address then one dummy byte, full clock rate */
+#define SPIFLASH_CMD_PAGE_PROGRAM       ((uint8) 0x02)
+#define SPIFLASH_CMD_SECTOR_ERASE       ((uint8) 0x20)
+#define SPIFLASH_CMD_READ_JEDEC_ID      ((uint8) 0x9F)
+
+/************************** Operations in progress *****************************/
+#define SPIFLASH_OPERATION_NONE         ((uint8) 0x0)
+#define SPIFLASH_OPERATION_TRANSFER     ((uint8) 0x1)   /* Read or JEDEC ID, done when its transaction is done */
+#define SPIFLASH_OPERATION_WRITE        ((uint8) 0x2)   /* Program or Erase, done when WIP bit is cleared      */
+
+/************************** Status Register bits *****************************/
+#define SPIFLASH_STATUS_WIP_POS         0               /* Write (program/erase) In Progress */
+
+/************************** Header lengths *****************************/
+#define SPIFLASH_ADDRESS_HEADER_LENGTH  (4U)            /* Command + 24 bits address                */
+#define SPIFLASH_FAST_READ_HEADER_LENGTH (5U)           /* Command + 24 bits address + dummy byte   */
+
+/* Last address reachable with 3 address bytes */
+#define SPIFLASH_ADDRESS_MAX            (0xFFFFFFUL)
+
+/* Capacity byte of JEDEC ID is log2 of the size in bytes (for most vendors) */
+#define SPIFLASH_CAPACITY_CODE_MIN      (0x10U)         /* 64 KB    */
+#define SPIFLASH_CAPACITY_CODE_MAX      (0x18U)         /* 16 MB    */
+
+
+#endif /* DRIVERS_SPIFLASH_SPIFLASH_PRIV_H_ */
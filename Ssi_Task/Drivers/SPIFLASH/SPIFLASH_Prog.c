@@ -0,0 +1,409 @@
+/********************************************************************************
+ * @file          SPIFLASH_Prog.c
+ * @brief         Source file for SPI NOR flash (JEDEC standard commands) on top
+ *                of the SPI bus manager on TM4C123GH6PM Microcontroller
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ * @note          Command, address and dummy bytes are the header of one bus
+ *                transaction: the bus sends them and the data frames as two
+ *                interrupt driven SSI transfers with the chip-select held, so
+ *                the serial clock pauses for one SSI ISR between them
+ * @note          SSI has one data line, so only single I/O commands are used
+ *                (Fast Read 0x0B instead of Dual/Quad Read)
+ *******************************************************************************/
+
+
+/*******************************************************************************
+ *                              Includes                                       *
+ *******************************************************************************/
+#include "SPIFLASH_Init.h"
+#include "SPIFLASH_Priv.h"
+
+
+/*******************************************************************************
+ *                      Private Functions Prototype                            *
+ *******************************************************************************/
+static uint8 SpiFlash_InFlight(const SpiBus_Transaction* Transaction);
+static uint8 SpiFlash_IsFree(const SpiFlash_Handle* Flash);
+static void  SpiFlash_SetHeader(SpiFlash_Handle* Flash, uint8 Command, uint32 Address);
+static uint8 SpiFlash_Start(SpiFlash_Handle* Flash, uint8 Operation);
+
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * @fn              static uint8 SpiFlash_InFlight(const SpiBus_Transaction* Transaction)
+ * @brief           Function to check if a transaction is still owned by the bus
+ * @param (in):     Transaction - Transaction to be checked
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          TRUE if the transaction is PENDING or RUNNING, FALSE otherwise
+ *******************************************************************************/
+static uint8 SpiFlash_InFlight(const SpiBus_Transaction* Transaction)
+{
+    if( (Transaction->Status == SPIBUS_TRANSACTION_PENDING) || (Transaction->Status == SPIBUS_TRANSACTION_RUNNING) )
+    {
+        return TRUE;
+    }
+    return FALSE;
+}
+
+/*******************************************************************************
+ * @fn              static uint8 SpiFlash_IsFree(const SpiFlash_Handle* Flash)
+ * @brief           Function to check if a new operation can be started
+ * @param (in):     Flash - Flash handle
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          TRUE if no operation is in progress and no transaction is queued
+ *******************************************************************************/
+static uint8 SpiFlash_IsFree(const SpiFlash_Handle* Flash)
+{
+    if( (Flash->State == SPIFLASH_STATE_BUSY) || (SpiFlash_InFlight(&Flash->Enable) == TRUE) ||
+        (SpiFlash_InFlight(&Flash->Command) == TRUE) || (SpiFlash_InFlight(&Flash->Status) == TRUE) )
+    {
+        return FALSE;
+    }
+    return TRUE;
+}
+
+/*******************************************************************************
+ * @fn              static void SpiFlash_SetHeader(SpiFlash_Handle* Flash, uint8 Command, uint32 Address)
+ * @brief           Function to fill the operation header with a command and
+ *                  a 24 bits address (most significant byte first)
+ * @param (in):     Command - Flash command
+ *                  Address - Flash address
+ * @param (out):    None
+ * @param (inout):  Flash   - Flash handle
+ * @return          None
+ *******************************************************************************/
+static void SpiFlash_SetHeader(SpiFlash_Handle* Flash, uint8 Command, uint32 Address)
+{
+    Flash->Header[0] = Command;
+    Flash->Header[1] = (uint8)(Address >> 16);
+    Flash->Header[2] = (uint8)(Address >> 8);
+    Flash->Header[3] = (uint8)(Address);
+    Flash->Header[4] = 0x00;                    /* Dummy byte (Fast Read only) */
+}
+
+/*******************************************************************************
+ * @fn              static uint8 SpiFlash_Start(SpiFlash_Handle* Flash, uint8 Operation)
+ * @brief           Function to queue the operation transaction (after Write Enable
+ *                  for program/erase), both are queued together so the bus runs
+ *                  them back to back
+ * @param (in):     Operation - SPIFLASH_OPERATION_TRANSFER or SPIFLASH_OPERATION_WRITE
+ * @param (out):    None
+ * @param (inout):  Flash     - Flash handle (its Command transaction is ready)
+ * @return          Return Status (RET_NOT_OK if the bus queue is full)
+ *******************************************************************************/
+static uint8 SpiFlash_Start(SpiFlash_Handle* Flash, uint8 Operation)
+{
+    if(Operation == SPIFLASH_OPERATION_WRITE)
+    {
+        if(SpiBus_Submit(&Flash->Enable) != RET_OK)
+        {
+            return RET_NOT_OK;
+        }
+    }
+
+    Flash->Operation     = Operation;
+    Flash->StatusPolling = FALSE;
+
+    if(SpiBus_Submit(&Flash->Command) != RET_OK)
+    {
+        /* Write Enable alone does no harm, it is cleared by the next program/erase */
+        Flash->Operation = SPIFLASH_OPERATION_NONE;
+        Flash->State     = SPIFLASH_STATE_ERROR;
+        return RET_NOT_OK;
+    }
+
+    Flash->State = SPIFLASH_STATE_BUSY;
+
+    return RET_OK;
+}
+
+
+/*******************************************************************************
+ *                      Public Functions Definitions                           *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * @fn              uint8 SpiFlash_Init(SpiFlash_Handle* Flash, uint8 Device)
+ * @brief           Function to initialize a flash handle
+ * @param (in):     Device - Bus device index returned by SpiBus_AddDevice()
+ * @param (out):    Flash  - Flash handle
+ * @param (inout):  None
+ * @return          Return Status (RET_OK if everything is ok)
+ *******************************************************************************/
+uint8 SpiFlash_Init(SpiFlash_Handle* Flash, uint8 Device)
+{
+    /* Check if the input pointer is Not Null Pointer and the device is valid */
+    if( (NULL_PTR == Flash) || (SPIBUS_NO_DEVICE == Device) )
+    {
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    Flash->Device          = Device;
+    Flash->Operation       = SPIFLASH_OPERATION_NONE;
+    Flash->State           = SPIFLASH_STATE_READY;
+    Flash->StatusPolling   = FALSE;
+    Flash->StatusRegister  = 0;
+    Flash->JedecId[0]      = 0;
+    Flash->JedecId[1]      = 0;
+    Flash->JedecId[2]      = 0;
+    Flash->EnableHeader[0] = SPIFLASH_CMD_WRITE_ENABLE;
+    Flash->StatusHeader[0] = SPIFLASH_CMD_READ_STATUS;
+
+    /* Write Enable: command only */
+    Flash->Enable.Device       = Device;
+    Flash->Enable.Header       = Flash->EnableHeader;
+    Flash->Enable.HeaderLength = 1;
+    Flash->Enable.TxBuffer     = NULL_PTR;
+    Flash->Enable.RxBuffer     = NULL_PTR;
+    Flash->Enable.Length       = 0;
+    Flash->Enable.CallBack     = NULL_PTR;
+    Flash->Enable.Status       = SPIBUS_TRANSACTION_IDLE;
+
+    /* Read Status Register: command then one byte */
+    Flash->Status.Device       = Device;
+    Flash->Status.Header       = Flash->StatusHeader;
+    Flash->Status.HeaderLength = 1;
+    Flash->Status.TxBuffer     = NULL_PTR;
+    Flash->Status.RxBuffer     = &Flash->StatusRegister;
+    Flash->Status.Length       = 1;
+    Flash->Status.CallBack     = NULL_PTR;
+    Flash->Status.Status       = SPIBUS_TRANSACTION_IDLE;
+
+    /* Operation: filled by each operation */
+    Flash->Command.Device       = Device;
+    Flash->Command.Header       = Flash->Header;
+    Flash->Command.HeaderLength = 0;
+    Flash->Command.TxBuffer     = NULL_PTR;
+    Flash->Command.RxBuffer     = NULL_PTR;
+    Flash->Command.Length       = 0;
+    Flash->Command.CallBack     = NULL_PTR;
+    Flash->Command.Status       = SPIBUS_TRANSACTION_IDLE;
+
+    return RET_OK;
+}
+
+/*******************************************************************************
+ * @fn              uint8 SpiFlash_ReadJedecId(SpiFlash_Handle* Flash)
+ * @brief           Function to start reading the JEDEC ID (probe the device)
+ *                  The result is read by SpiFlash_GetJedecId() when ready
+ * @param (in):     None
+ * @param (out):    None
+ * @param (inout):  Flash - Flash handle
+ * @return          Return Status (RET_NOT_OK if an operation is in progress)
+ *******************************************************************************/
+uint8 SpiFlash_ReadJedecId(SpiFlash_Handle* Flash)
+{
+    if( (NULL_PTR == Flash) || (SpiFlash_IsFree(Flash) == FALSE) )
+    {
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    Flash->Header[0]            = SPIFLASH_CMD_READ_JEDEC_ID;
+    Flash->Command.HeaderLength = 1;
+    Flash->Command.TxBuffer     = NULL_PTR;
+    Flash->Command.RxBuffer     = Flash->JedecId;
+    Flash->Command.Length       = sizeof(Flash->JedecId);
+
+    return SpiFlash_Start(Flash, SPIFLASH_OPERATION_TRANSFER);
+}
+
+/*******************************************************************************
+ * @fn              uint32 SpiFlash_GetJedecId(const SpiFlash_Handle* Flash)
+ * @brief           Function to get the JEDEC ID read by SpiFlash_ReadJedecId()
+ * @param (in):     Flash - Flash handle
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Manufacturer ID (bits 23:16), memory type (bits 15:8) and
+ *                  capacity (bits 7:0), 0 if not read yet
+ *                  (0xFFFFFF or 0 means no device answered)
+ *******************************************************************************/
+uint32 SpiFlash_GetJedecId(const SpiFlash_Handle* Flash)
+{
+    if(NULL_PTR == Flash)
+    {
+        return 0;
+    }
+
+    return ( ((uint32)Flash->JedecId[0] << 16) | ((uint32)Flash->JedecId[1] << 8) | (uint32)Flash->JedecId[2] );
+}
+
+/*******************************************************************************
+ * @fn              uint32 SpiFlash_GetCapacity(const SpiFlash_Handle* Flash)
+ * @brief           Function to get the device size from its JEDEC ID
+ * @param (in):     Flash - Flash handle
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Size in bytes (0 if the capacity code is unknown or not
+ *                  reachable with 24 bits addresses)
+ *******************************************************************************/
+uint32 SpiFlash_GetCapacity(const SpiFlash_Handle* Flash)
+{
+    if( (NULL_PTR == Flash) || (Flash->JedecId[2] < SPIFLASH_CAPACITY_CODE_MIN) ||
+        (Flash->JedecId[2] > SPIFLASH_CAPACITY_CODE_MAX) )
+    {
+        return 0;
+    }
+
+    return ((uint32)1 << Flash->JedecId[2]);
+}
+
+/*******************************************************************************
+ * @fn              uint8 SpiFlash_Read(SpiFlash_Handle* Flash, uint32 Address, void* Buffer, uint32 Length)
+ * @brief           Function to start reading data using Fast Read command
+ *                  Any length in one chip-select cycle, the address wraps
+ *                  inside the device
+ * @param (in):     Address - First flash address
+ *                  Length  - Number of bytes
+ * @param (out):    Buffer  - Data read (MUST stay valid until the flash is ready)
+ * @param (inout):  Flash   - Flash handle
+ * @return          Return Status (RET_NOT_OK if an operation is in progress or
+ *                  the arguments are invalid)
+ *******************************************************************************/
+uint8 SpiFlash_Read(SpiFlash_Handle* Flash, uint32 Address, void* Buffer, uint32 Length)
+{
+    if( (NULL_PTR == Flash) || (NULL_PTR == Buffer) || (0 == Length) || (Address > SPIFLASH_ADDRESS_MAX) ||
+        (SpiFlash_IsFree(Flash) == FALSE) )
+    {
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    SpiFlash_SetHeader(Flash, SPIFLASH_CMD_FAST_READ, Address);
+    Flash->Command.HeaderLength = SPIFLASH_FAST_READ_HEADER_LENGTH;
+    Flash->Command.TxBuffer     = NULL_PTR;
+    Flash->Command.RxBuffer     = Buffer;
+    Flash->Command.Length       = Length;
+
+    return SpiFlash_Start(Flash, SPIFLASH_OPERATION_TRANSFER);
+}
+
+/*******************************************************************************
+ * @fn              uint8 SpiFlash_ProgramPage(SpiFlash_Handle* Flash, uint32 Address,
+ *                                             const void* Data, uint32 Length)
+ * @brief           Function to start programming bytes inside one page
+ *                  (Write Enable then Page Program), the flash is ready when
+ *                  its Write In Progress bit is cleared
+ * @note            Programming only clears bits, the area MUST be erased first
+ * @param (in):     Address - First flash address
+ *                  Data    - Bytes to be programmed (MUST stay valid until the flash is ready)
+ *                  Length  - Number of bytes (the last one in the same page)
+ * @param (out):    None
+ * @param (inout):  Flash   - Flash handle
+ * @return          Return Status (RET_NOT_OK if an operation is in progress or
+ *                  the data crosses a page)
+ *******************************************************************************/
+uint8 SpiFlash_ProgramPage(SpiFlash_Handle* Flash, uint32 Address, const void* Data, uint32 Length)
+{
+    if( (NULL_PTR == Flash) || (NULL_PTR == Data) || (0 == Length) || (Address > SPIFLASH_ADDRESS_MAX) ||
+        ( ((Address % SPIFLASH_PAGE_SIZE) + Length) > SPIFLASH_PAGE_SIZE ) || (SpiFlash_IsFree(Flash) == FALSE) )
+    {
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    SpiFlash_SetHeader(Flash, SPIFLASH_CMD_PAGE_PROGRAM, Address);
+    Flash->Command.HeaderLength = SPIFLASH_ADDRESS_HEADER_LENGTH;
+    Flash->Command.TxBuffer     = Data;
+    Flash->Command.RxBuffer     = NULL_PTR;
+    Flash->Command.Length       = Length;
+
+    return SpiFlash_Start(Flash, SPIFLASH_OPERATION_WRITE);
+}
+
+/*******************************************************************************
+ * @fn              uint8 SpiFlash_EraseSector(SpiFlash_Handle* Flash, uint32 Address)
+ * @brief           Function to start erasing (all bytes 0xFF) the sector which
+ *                  contains Address, the flash is ready when its Write In
+ *                  Progress bit is cleared
+ * @param (in):     Address - Any address inside the sector
+ * @param (out):    None
+ * @param (inout):  Flash   - Flash handle
+ * @return          Return Status (RET_NOT_OK if an operation is in progress)
+ *******************************************************************************/
+uint8 SpiFlash_EraseSector(SpiFlash_Handle* Flash, uint32 Address)
+{
+    if( (NULL_PTR == Flash) || (Address > SPIFLASH_ADDRESS_MAX) || (SpiFlash_IsFree(Flash) == FALSE) )
+    {
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    SpiFlash_SetHeader(Flash, SPIFLASH_CMD_SECTOR_ERASE, Address & ~(SPIFLASH_SECTOR_SIZE - 1U));
+    Flash->Command.HeaderLength = SPIFLASH_ADDRESS_HEADER_LENGTH;
+    Flash->Command.TxBuffer     = NULL_PTR;
+    Flash->Command.RxBuffer     = NULL_PTR;
+    Flash->Command.Length       = 0;
+
+    return SpiFlash_Start(Flash, SPIFLASH_OPERATION_WRITE);
+}
+
+/*******************************************************************************
+ * @fn              uint8 SpiFlash_Poll(SpiFlash_Handle* Flash)
+ * @brief           Function to advance the operation in progress, it never waits
+ *                  - Read/JEDEC ID: ready when its transaction is done
+ *                  - Program/Erase: queues Read Status Register each call until
+ *                    the Write In Progress bit is cleared
+ *                  It is called periodically (main loop or timer) while BUSY
+ * @param (in):     None
+ * @param (out):    None
+ * @param (inout):  Flash - Flash handle
+ * @return          Flash state, You can find its value @ref SPIFLASH_STATE
+ *******************************************************************************/
+uint8 SpiFlash_Poll(SpiFlash_Handle* Flash)
+{
+    if(NULL_PTR == Flash)
+    {
+        return SPIFLASH_STATE_ERROR;
+    }
+
+    if(Flash->State != SPIFLASH_STATE_BUSY)
+    {
+        return Flash->State;
+    }
+
+    /* Transactions of the operation are still queued or on the bus */
+    if( (SpiFlash_InFlight(&Flash->Enable) == TRUE) || (SpiFlash_InFlight(&Flash->Command) == TRUE) ||
+        (SpiFlash_InFlight(&Flash->Status) == TRUE) )
+    {
+        return SPIFLASH_STATE_BUSY;
+    }
+
+    if( (Flash->Command.Status == SPIBUS_TRANSACTION_FAILED) ||
+        ( (Flash->Operation == SPIFLASH_OPERATION_WRITE) && (Flash->Enable.Status == SPIBUS_TRANSACTION_FAILED) ) ||
+        ( (Flash->StatusPolling == TRUE) && (Flash->Status.Status == SPIBUS_TRANSACTION_FAILED) ) )
+    {
+        Flash->Operation = SPIFLASH_OPERATION_NONE;
+        Flash->State     = SPIFLASH_STATE_ERROR;
+        return Flash->State;
+    }
+
+    if(Flash->Operation == SPIFLASH_OPERATION_WRITE)
+    {
+        /* Status Register just read, check if program/erase finished */
+        if( (Flash->StatusPolling == TRUE) && BIT_IS_CLEAR(Flash->StatusRegister, SPIFLASH_STATUS_WIP_POS) )
+        {
+            Flash->StatusPolling = FALSE;
+            Flash->Operation     = SPIFLASH_OPERATION_NONE;
+            Flash->State         = SPIFLASH_STATE_READY;
+            return Flash->State;
+        }
+
+        /* Still writing, read the Status Register again (a full queue is retried next call) */
+        Flash->StatusPolling = (SpiBus_Submit(&Flash->Status) == RET_OK) ? TRUE : FALSE;
+        return SPIFLASH_STATE_BUSY;
+    }
+
+    Flash->Operation = SPIFLASH_OPERATION_NONE;
+    Flash->State     = SPIFLASH_STATE_READY;
+
+    return Flash->State;
+}
@@ -5,9 +5,7 @@
  * @author        Islam Ehab Ezzat
  * @version       1.0.0
  * @note          This driver still under development, so it doesn't support:
- *                - uDMA Mode
  *                - Remaining Interrupts handling
- *                - FIFO Mode
  *******************************************************************************/
 
 #ifndef DRIVERS_SSI_SSI_INIT_H_
@@ -96,6 +94,45 @@ typedef enum{
     SsiInterruptMaskEndofTransmission   = (1<<4)//!< SsiInterruptMaskEndofTransmission
 }Ssi_Interrupts;
 
+/*******************************************************************************
+ * @struct  Ssi_FrameSettings
+ *
+ * @brief   Structure Holds CR0 and CPSR Registers values of one configuration
+ *          (calculated once, applied whenever the module switches to it)
+ *
+ * @var     Ssi_FrameSettings::Cr0
+ *          Serial clock rate, frame format, word length, clock polarity and phase
+ *
+ * @var     Ssi_FrameSettings::Cpsr
+ *          Clock prescale divisor
+ *
+ * @var     Ssi_FrameSettings::Frequency
+ *          Achieved SSI clock in Hz (the highest one not exceeding SsiFreq)
+ ******************************************************************************/
+typedef struct{
+    uint32 Cr0;             /** CR0 Register value                  */
+    uint32 Cpsr;            /** CPSR Register value                 */
+    uint32 Frequency;       /** Achieved SSI clock in Hz            */
+}Ssi_FrameSettings;
+
+/*******************************************************************************
+ * @struct  Ssi_DmaSegment
+ *
+ * @brief   Structure Holds one buffer of a scatter-gather uDMA transmit
+ *          (e.g. command header, framebuffer payload and trailer)
+ *
+ * @var     Ssi_DmaSegment::Buffer
+ *          Frames to be sent (uint8 array for word length <= 8 bits,
+ *          uint16 array otherwise). It MUST stay valid until the transfer is done
+ *
+ * @var     Ssi_DmaSegment::Length
+ *          Number of frames in Buffer
+ ******************************************************************************/
+typedef struct{
+    const void* Buffer;     /** Frames to be sent                   */
+    uint32      Length;     /** Number of frames in Buffer          */
+}Ssi_DmaSegment;
+
 /*******************************************************************************
  * @struct  Ssi_Config
  *
@@ -192,6 +229,32 @@ typedef struct{
 
 }Ssi_Config;
 
+/*******************************************************************************
+ * @struct  Ssi_StreamConfig
+ *
+ * @brief   Structure Holds the two buffers of each direction of a stream
+ *          (uint8 arrays for word length <= 8 bits, uint16 arrays otherwise)
+ *
+ * @var     Ssi_StreamConfig::TxBuffers
+ *          Frames sent alternately (both NULL_PTR sends dummy frames, e.g. ADC only)
+ *
+ * @var     Ssi_StreamConfig::RxBuffers
+ *          Frames received alternately (both NULL_PTR discards them, e.g. DAC only)
+ *
+ * @var     Ssi_StreamConfig::Frames
+ *          Frames in each buffer (1 -> 1024)
+ *
+ * @var     Ssi_StreamConfig::CallBack
+ *          Function called from SSI ISR with the index (0 or 1) of the buffers
+ *          which are done and free to be refilled/read
+ ******************************************************************************/
+typedef struct{
+    const void* TxBuffers[2];           /** Tx buffers (or both NULL_PTR)           */
+    void*       RxBuffers[2];           /** Rx buffers (or both NULL_PTR)           */
+    uint32      Frames;                 /** Frames in each buffer                   */
+    void (*CallBack)(uint8 Half);       /** Called when buffers of Half are done    */
+}Ssi_StreamConfig;
+
 /*******************************************************************************
  *                              Functions Prototypes                          *
  *******************************************************************************/
@@ -204,6 +267,21 @@ uint8  Ssi_Transmit    (const Ssi_Config* ConfigPtr, const uint16 Data);
 void   Ssi_SendString  (const Ssi_Config* ConfigPtr, const uint8* String);
 uint16 Ssi_Receive     (const Ssi_Config* ConfigPtr);
 uint16 Ssi_ReceiveIT   (const Ssi_Config* ConfigPtr);
+uint8  Ssi_TransferBuffer(const Ssi_Config* ConfigPtr, const void* TxBuffer, void* RxBuffer, uint32 Length);
+uint8  Ssi_TransferIT  (const Ssi_Config* ConfigPtr, const void* TxBuffer, void* RxBuffer, uint32 Length, void (*CallBack)(void));
+uint32 Ssi_SolveClock  (uint32 ClkValue, uint32 SsiFreq, uint32* PreScaler, uint32* Scr);
+uint8  Ssi_GetFrameSettings  (const Ssi_Config* ConfigPtr, Ssi_FrameSettings* Settings);
+uint8  Ssi_ApplyFrameSettings(const Ssi_Config* ConfigPtr, const Ssi_FrameSettings* Settings);
+uint8  Ssi_SlaveStart  (const Ssi_Config* ConfigPtr, void (*CallBack)(void));
+void   Ssi_SlaveStop   (const Ssi_Config* ConfigPtr);
+uint32 Ssi_SlaveWrite  (const Ssi_Config* ConfigPtr, const void* Buffer, uint32 Length);
+uint32 Ssi_SlaveRead   (const Ssi_Config* ConfigPtr, void* Buffer, uint32 Length);
+uint32 Ssi_SlaveGetOverrunCount(Ssi_Instance SsiNum);
+uint8  Ssi_StreamStart (const Ssi_Config* ConfigPtr, const Ssi_StreamConfig* StreamPtr);
+void   Ssi_StreamStop  (const Ssi_Config* ConfigPtr);
+void   Ssi_StreamGetErrors(Ssi_Instance SsiNum, uint32* Underruns, uint32* Overruns);
+uint8  Ssi_TransmitDMA (const Ssi_Config* ConfigPtr, const Ssi_DmaSegment* SegmentList, uint8 SegmentCount, void (*CallBack)(void));
+uint8  Ssi_ReceiveDMA  (const Ssi_Config* ConfigPtr, void* Buffer, uint32 Length, void (*CallBack)(void));
 
 
 
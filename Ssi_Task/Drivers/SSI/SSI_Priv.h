@@ -5,16 +5,14 @@
  * @author        Islam Ehab Ezzat
  * @version       1.0.0
  * @note          This driver still under development, so it doesn't support:
- *                - uDMA Mode
  *                - Remaining Interrupts handling
- *                - FIFO Mode
  *******************************************************************************/
 
 
 #ifndef DRIVERS_SSI_SSI_PRIV_H_
 #define DRIVERS_SSI_SSI_PRIV_H_
 
-
+#include "UDMA_Init.h"
 
 
 /********************************************************************************
@@ -83,6 +81,170 @@
 #define IM_REG_RXIM_ENABLE         ((uint8)0x1)   /* SSI Receive FIFO Interrupt Mask Enable Value       */
 #define IM_REG_TXIM_ENABLE         ((uint8)0x1)   /* SSI Transmit FIFO Interrupt Mask Enable Value      */
 
+/************************** SSI_CPSR Register defines ****************************/
+#define SSI_CPSDVSR_MIN            (2U)             /* Smallest (even) Clock Prescale Divisor       */
+#define SSI_CPSDVSR_MAX            (254U)           /* Biggest (even) Clock Prescale Divisor        */
+#define SSI_SCR_PLUS_ONE_MAX       (256U)           /* Biggest (1 + SCR) divisor of CR0             */
+
+/************************** SSI FIFO defines *************************************/
+#define SSI_FIFO_DEPTH             ((uint8)0x8)      /* Number of entries in each of Tx and Rx FIFOs                */
+#define SSI_DUMMY_FRAME            ((uint16)0xFFFF)  /* Frame clocked out when no Tx buffer is given (MOSI kept high) */
+#define SSI_WORD_LENGTH_BYTE_MAX   SsiEightBits      /* Largest word length stored in uint8 buffers                  */
+
+/************************** SSI_DMACTL Register defines **************************/
+#define DMACTL_REG_RXDMAE_POS      ((uint8)0x0)    /* Receive DMA Enable Bit Position               */
+#define DMACTL_REG_TXDMAE_POS      ((uint8)0x1)    /* Transmit DMA Enable Bit Position              */
+
+/************************** SSI_ICR Register defines *****************************/
+#define ICR_REG_RORIC_POS          ((uint8)0x0)    /* SSI Receive Overrun Interrupt Clear Bit Position  */
+#define ICR_REG_RTIC_POS           ((uint8)0x1)    /* SSI Receive Time-Out Interrupt Clear Bit Position */
+
+/************************** SSI uDMA Channels defines ****************************/
+/* uDMA channel assignments of each SSI (See Data sheet page 587) */
+#define SSI0_DMA_RX_CHANNEL        ((uint8)10U)
+#define SSI0_DMA_TX_CHANNEL        ((uint8)11U)
+#define SSI0_DMA_ENCODING          ((uint8)0U)
+#define SSI1_DMA_RX_CHANNEL        ((uint8)24U)
+#define SSI1_DMA_TX_CHANNEL        ((uint8)25U)
+#define SSI1_DMA_ENCODING          ((uint8)0U)
+#define SSI2_DMA_RX_CHANNEL        ((uint8)12U)
+#define SSI2_DMA_TX_CHANNEL        ((uint8)13U)
+#define SSI2_DMA_ENCODING          ((uint8)2U)
+#define SSI3_DMA_RX_CHANNEL        ((uint8)14U)
+#define SSI3_DMA_TX_CHANNEL        ((uint8)15U)
+#define SSI3_DMA_ENCODING          ((uint8)2U)
+
+/* Maximum uDMA tasks of one scatter-gather transmit (each task moves up to 1024 frames),
+ * enough for a 32 KB framebuffer plus a header and a trailer segment               */
+#define SSI_DMA_MAX_TASKS          (34U)
+
+/************************** SSI Slave engine defines *****************************/
+/* Frames buffered in each of Rx and Tx rings (MUST be a power of 2) */
+#define SSI_SLAVE_RING_SIZE        (64U)
+#define SSI_SLAVE_RING_MASK        ((uint16)(SSI_SLAVE_RING_SIZE - 1U))
+
+/* Interrupts used by the slave engine (Transmit one is enabled only while there are frames to send) */
+#define SSI_SLAVE_RX_INTERRUPTS_MASK ( (1 << IM_REG_RORIM_POS) | (1 << IM_REG_RTIM_POS) | (1 << IM_REG_RXIM_POS) )
+
+/* Mask/restore IRQs (PRIMASK), Interrupt Mask Register is shared with the SSI ISR */
+#if defined(__TI_ARM__)
+#define SSI_ENTER_CRITICAL()       ((uint32)_disable_interrupts())
+#define SSI_EXIT_CRITICAL(KEY)     ((void)_restore_interrupts(KEY))
+#elif defined(__GNUC__) && defined(__ARM_ARCH)
+#define SSI_ENTER_CRITICAL()       __extension__({ uint32 Key_; __asm volatile ("mrs %0, primask\n\tcpsid i" : "=r" (Key_) : : "memory"); Key_; })
+#define SSI_EXIT_CRITICAL(KEY)     __asm volatile ("msr primask, %0" : : "r" (KEY) : "memory")
+#elif defined(HOST_TEST)
+#include "Test_Critical.h"
+#define SSI_ENTER_CRITICAL()       Test_EnterCritical()
+#define SSI_EXIT_CRITICAL(KEY)     Test_ExitCritical(KEY)
+#else
+#error "SSI: no critical section (PRIMASK) implementation for this toolchain"
+#endif
+
+/* Receive interrupts masked while a uDMA transfer owns the Receive FIFO */
+#define SSI_DMA_RX_INTERRUPTS_MASK ( (1 << IM_REG_RORIM_POS) | (1 << IM_REG_RTIM_POS) | (1 << IM_REG_RXIM_POS) )
+
+
+/********************************************************************************
+ *                             Private Data Types                               *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * @struct Ssi_DmaChannels
+ *
+ * @brief  Structure holds uDMA channels used by one SSI instance
+ ******************************************************************************/
+typedef struct{
+    uint8 RxChannel;    /* uDMA channel serving SSI Rx requests     */
+    uint8 TxChannel;    /* uDMA channel serving SSI Tx requests     */
+    uint8 Encoding;     /* Channel encoding selecting this SSI      */
+}Ssi_DmaChannels;
+
+
+/*******************************************************************************
+ * @struct Ssi_DmaTransfer
+ *
+ * @brief  Structure holds the state of the uDMA transfer of one SSI instance
+ *         - Transmit: all segments are described by one scatter-gather task list
+ *         - Receive : chunks of up to 1024 frames are re-armed from the SSI ISR,
+ *                     Tx channel clocks out dummy frames for every chunk
+ ******************************************************************************/
+typedef struct{
+    uint8*          Next;                       /* Receive: first byte of the next chunk        */
+    volatile uint32 Remaining;                  /* Receive: frames not handed to uDMA yet       */
+    uint8           FrameBytes;                 /* 1 (word length <= 8 bits) or 2               */
+    uint8           Receiving;                  /* TRUE for Receive, FALSE for Transmit         */
+    volatile uint8  Busy;                       /* TRUE while the transfer is running           */
+    volatile uint8  Draining;                   /* Transmit: last frames are leaving the bus    */
+    uint32          SavedMask;                  /* Rx (and Tx) interrupts restored when done    */
+    uint32          SavedEot;                   /* CR1 EOT bit restored when done               */
+    void (*CallBack)(void);                     /* Called when the whole transfer is done       */
+    Udma_Task       Tasks[SSI_DMA_MAX_TASKS];   /* Scatter-gather task list of Transmit         */
+}Ssi_DmaTransfer;
+
+
+/*******************************************************************************
+ * @struct Ssi_ItTransfer
+ *
+ * @brief  Structure holds the state of the interrupt driven transfer
+ *         (Ssi_TransferIT) of one SSI instance
+ ******************************************************************************/
+typedef struct{
+    const uint8*    TxNext;                     /* Next frame to send (NULL_PTR: dummy frames)  */
+    uint8*          RxNext;                     /* Next received frame (NULL_PTR: discard)      */
+    uint32          TxRemaining;                /* Frames not written to Transmit FIFO yet      */
+    uint32          RxRemaining;                /* Frames not read from Receive FIFO yet        */
+    uint8           FrameBytes;                 /* 1 (word length <= 8 bits) or 2               */
+    volatile uint8  Busy;                       /* TRUE while the transfer is running           */
+    uint32          SavedMask;                  /* Interrupts restored when done                */
+    uint32          SavedEot;                   /* CR1 EOT bit restored when done               */
+    void (*CallBack)(void);                     /* Called when the whole transfer is done       */
+}Ssi_ItTransfer;
+
+
+/*******************************************************************************
+ * @struct Ssi_SlaveState
+ *
+ * @brief  Structure holds the slave engine state of one SSI instance
+ *         Rings are single producer / single consumer (free running indexes)
+ ******************************************************************************/
+typedef struct{
+    uint16          RxRing[SSI_SLAVE_RING_SIZE];    /* Frames received from the master              */
+    uint16          TxRing[SSI_SLAVE_RING_SIZE];    /* Frames waiting to be clocked by the master   */
+    volatile uint16 RxHead;                         /* Rx producer index (ISR)                      */
+    volatile uint16 RxTail;                         /* Rx consumer index (Ssi_SlaveRead)            */
+    volatile uint16 TxHead;                         /* Tx producer index (Ssi_SlaveWrite)           */
+    volatile uint16 TxTail;                         /* Tx consumer index (ISR)                      */
+    volatile uint32 Overruns;                       /* Receive FIFO overruns (RORMIS)               */
+    volatile uint32 RxDropped;                      /* Frames dropped because Rx ring was full      */
+    uint32          SavedMask;                      /* Interrupts restored by Ssi_SlaveStop         */
+    uint32          SavedEot;                       /* CR1 EOT bit restored by Ssi_SlaveStop        */
+    volatile uint8  Active;                         /* TRUE while the engine runs                   */
+    void (*CallBack)(void);                         /* Called when frames are received              */
+}Ssi_SlaveState;
+
+
+/*******************************************************************************
+ * @struct Ssi_StreamState
+ *
+ * @brief  Structure holds the streaming engine state of one SSI instance
+ *         Half 0 is served by the primary uDMA structure, Half 1 by the Alternate one
+ ******************************************************************************/
+typedef struct{
+    const void*     TxBuffers[2];               /* Application Tx buffers (or NULL_PTR)         */
+    void*           RxBuffers[2];               /* Application Rx buffers (or NULL_PTR)         */
+    uint32          Frames;                     /* Frames in each buffer                        */
+    void (*CallBack)(uint8 Half);               /* Called when buffers of Half are done         */
+    uint8           FrameBytes;                 /* 1 (word length <= 8 bits) or 2               */
+    uint8           Receive;                    /* TRUE when Rx channel runs (and leads)        */
+    uint8           TxNextHalf;                 /* Half which Tx channel completes next         */
+    uint8           RxNextHalf;                 /* Half which Rx channel completes next         */
+    volatile uint32 Underruns;                  /* Tx channel stopped (gap on the bus)          */
+    volatile uint32 Overruns;                   /* Rx channel stopped or Receive FIFO overran   */
+    uint32          SavedMask;                  /* Rx interrupts restored by Ssi_StreamStop     */
+    volatile uint8  Active;                     /* TRUE while streaming                         */
+}Ssi_StreamState;
+
 
 
 #endif /* DRIVERS_SSI_SSI_PRIV_H_ */
@@ -5,9 +5,7 @@
  * @author        Islam Ehab Ezzat
  * @version       1.0.0
  * @note          This driver still under development, so it doesn't support:
- *                - uDMA Mode
  *                - Remaining Interrupts handling (Transmit, Receive timeout, ..)
- *                - FIFO Mode
  *                - TI & MICROWIRE Frames Format Handling
  *******************************************************************************/
 /********************************************************************************
@@ -21,6 +19,17 @@
  *                          Static Functions Prototype                          *
  *******************************************************************************/
 static void Ssi_ChooseModule(const Ssi_Config* ConfigPtr, volatile uint32** Ptr);
+static void Ssi_DmaRxStart(volatile uint32* Ssi_Ptr, Ssi_Instance SsiNum, Ssi_DmaTransfer* Transfer);
+static void Ssi_DmaFinish(volatile uint32* Ssi_Ptr, Ssi_DmaTransfer* Transfer);
+static void Ssi_DmaIsrHandler(Ssi_Instance SsiNum, volatile uint32* Ssi_Ptr);
+static void Ssi_ItService(volatile uint32* Ssi_Ptr, Ssi_ItTransfer* Transfer);
+static void Ssi_ItIsrHandler(Ssi_Instance SsiNum, volatile uint32* Ssi_Ptr);
+static void Ssi_SlaveTxFill(volatile uint32* Ssi_Ptr, Ssi_SlaveState* Slave);
+static void Ssi_SlaveIsrHandler(Ssi_Instance SsiNum, volatile uint32* Ssi_Ptr);
+static uint8 Ssi_IsBusy(Ssi_Instance SsiNum);
+static void Ssi_StreamArm(volatile uint32* Ssi_Ptr, Ssi_Instance SsiNum, uint8 Receive, uint8 Half);
+static void Ssi_StreamServe(volatile uint32* Ssi_Ptr, Ssi_Instance SsiNum, uint8 Receive);
+static void Ssi_StreamIsrHandler(Ssi_Instance SsiNum, volatile uint32* Ssi_Ptr);
 
 
 /*******************************************************************************
@@ -38,12 +47,35 @@ static void (*volatile g_callBackPtrSsi2Interrupt)(void)      = NULL_PTR;
 /* Global volatile function pointer to hold the address of the call back function for Ssi3 in the application */
 static void (*volatile g_callBackPtrSsi3Interrupt)(void)      = NULL_PTR;
 
+/* uDMA channels of each SSI instance */
+static const Ssi_DmaChannels g_ssiDmaChannels[SSI_NUMBER_OF_INSTANCES] = {
+    {SSI0_DMA_RX_CHANNEL, SSI0_DMA_TX_CHANNEL, SSI0_DMA_ENCODING},
+    {SSI1_DMA_RX_CHANNEL, SSI1_DMA_TX_CHANNEL, SSI1_DMA_ENCODING},
+    {SSI2_DMA_RX_CHANNEL, SSI2_DMA_TX_CHANNEL, SSI2_DMA_ENCODING},
+    {SSI3_DMA_RX_CHANNEL, SSI3_DMA_TX_CHANNEL, SSI3_DMA_ENCODING}
+};
+
+/* State of uDMA transfer of each SSI instance */
+static Ssi_DmaTransfer g_ssiDmaTransfer[SSI_NUMBER_OF_INSTANCES];
+
+/* Frame clocked out by Tx uDMA channel while receiving */
+static const uint16 g_ssiDmaDummyFrame = SSI_DUMMY_FRAME;
+
+/* State of interrupt driven transfer of each SSI instance */
+static Ssi_ItTransfer g_ssiItTransfer[SSI_NUMBER_OF_INSTANCES];
+
+/* State of slave engine of each SSI instance */
+static Ssi_SlaveState g_ssiSlave[SSI_NUMBER_OF_INSTANCES];
+
+/* State of streaming engine of each SSI instance */
+static Ssi_StreamState g_ssiStream[SSI_NUMBER_OF_INSTANCES];
+
 /*******************************************************************************
  *                       Interrupt Service Routines                            *
  *******************************************************************************/
 
 /*******************************************************************************
- * @fn              void UART0ISR(void)
+ * @fn              void SSI0_ISR(void)
  * @brief           Interrupt Service Routine for SSI0
  * @param (in):     None
  * @param (out):    None
@@ -54,6 +86,18 @@ static void (*volatile g_callBackPtrSsi3Interrupt)(void)      = NULL_PTR;
  *******************************************************************************/
 void SSI0_ISR(void)
 {
+    /* Serve uDMA completion first, it isn't reported in MIS Register */
+    Ssi_DmaIsrHandler(Ssi0, (volatile uint32*)SSI_0_BASE_ADDRESS);
+
+    /* Serve interrupt driven transfer (Ssi_TransferIT) */
+    Ssi_ItIsrHandler(Ssi0, (volatile uint32*)SSI_0_BASE_ADDRESS);
+
+    /* Serve slave engine (Ssi_SlaveStart) */
+    Ssi_SlaveIsrHandler(Ssi0, (volatile uint32*)SSI_0_BASE_ADDRESS);
+
+    /* Serve streaming engine (Ssi_StreamStart) */
+    Ssi_StreamIsrHandler(Ssi0, (volatile uint32*)SSI_0_BASE_ADDRESS);
+
     /* Check if Receive Overrun Interrupt Occurred */
     if(BIT_IS_SET( (*(volatile uint32*)(SSI_0_BASE_ADDRESS + SSI_MIS_REG_OFFSET)), MIS_REG_RORMIS_POS) )
     {
@@ -118,11 +162,23 @@ void SSI0_ISR(void)
  * @param (out):    None
  * @param (inout):  None
  * @return          None
- * @note            You should Set this function name "SSI0_ISR" in Startup file
+ * @note            You should Set this function name "SSI1_ISR" in Startup file
  *                  Array of functions pointers for Vector table
  *******************************************************************************/
 void SSI1_ISR(void)
 {
+    /* Serve uDMA completion first, it isn't reported in MIS Register */
+    Ssi_DmaIsrHandler(Ssi1, (volatile uint32*)SSI_1_BASE_ADDRESS);
+
+    /* Serve interrupt driven transfer (Ssi_TransferIT) */
+    Ssi_ItIsrHandler(Ssi1, (volatile uint32*)SSI_1_BASE_ADDRESS);
+
+    /* Serve slave engine (Ssi_SlaveStart) */
+    Ssi_SlaveIsrHandler(Ssi1, (volatile uint32*)SSI_1_BASE_ADDRESS);
+
+    /* Serve streaming engine (Ssi_StreamStart) */
+    Ssi_StreamIsrHandler(Ssi1, (volatile uint32*)SSI_1_BASE_ADDRESS);
+
     /* Check if Receive Overrun Interrupt Occurred */
     if(BIT_IS_SET( (*(volatile uint32*)(SSI_1_BASE_ADDRESS + SSI_MIS_REG_OFFSET)), MIS_REG_RORMIS_POS) )
     {
@@ -187,11 +243,23 @@ void SSI1_ISR(void)
  * @param (out):    None
  * @param (inout):  None
  * @return          None
- * @note            You should Set this function name "SSI0_ISR" in Startup file
+ * @note            You should Set this function name "SSI2_ISR" in Startup file
  *                  Array of functions pointers for Vector table
  *******************************************************************************/
 void SSI2_ISR(void)
 {
+    /* Serve uDMA completion first, it isn't reported in MIS Register */
+    Ssi_DmaIsrHandler(Ssi2, (volatile uint32*)SSI_2_BASE_ADDRESS);
+
+    /* Serve interrupt driven transfer (Ssi_TransferIT) */
+    Ssi_ItIsrHandler(Ssi2, (volatile uint32*)SSI_2_BASE_ADDRESS);
+
+    /* Serve slave engine (Ssi_SlaveStart) */
+    Ssi_SlaveIsrHandler(Ssi2, (volatile uint32*)SSI_2_BASE_ADDRESS);
+
+    /* Serve streaming engine (Ssi_StreamStart) */
+    Ssi_StreamIsrHandler(Ssi2, (volatile uint32*)SSI_2_BASE_ADDRESS);
+
     /* Check if Receive Overrun Interrupt Occurred */
     if(BIT_IS_SET( (*(volatile uint32*)(SSI_2_BASE_ADDRESS + SSI_MIS_REG_OFFSET)), MIS_REG_RORMIS_POS) )
     {
@@ -256,11 +324,23 @@ void SSI2_ISR(void)
  * @param (out):    None
  * @param (inout):  None
  * @return          None
- * @note            You should Set this function name "SSI0_ISR" in Startup file
+ * @note            You should Set this function name "SSI3_ISR" in Startup file
  *                  Array of functions pointers for Vector table
  *******************************************************************************/
 void SSI3_ISR(void)
 {
+    /* Serve uDMA completion first, it isn't reported in MIS Register */
+    Ssi_DmaIsrHandler(Ssi3, (volatile uint32*)SSI_3_BASE_ADDRESS);
+
+    /* Serve interrupt driven transfer (Ssi_TransferIT) */
+    Ssi_ItIsrHandler(Ssi3, (volatile uint32*)SSI_3_BASE_ADDRESS);
+
+    /* Serve slave engine (Ssi_SlaveStart) */
+    Ssi_SlaveIsrHandler(Ssi3, (volatile uint32*)SSI_3_BASE_ADDRESS);
+
+    /* Serve streaming engine (Ssi_StreamStart) */
+    Ssi_StreamIsrHandler(Ssi3, (volatile uint32*)SSI_3_BASE_ADDRESS);
+
     /* Check if Receive Overrun Interrupt Occurred */
     if(BIT_IS_SET( (*(volatile uint32*)(SSI_3_BASE_ADDRESS + SSI_MIS_REG_OFFSET)), MIS_REG_RORMIS_POS) )
     {
@@ -391,14 +471,8 @@ void Ssi3_SetCallBack(void (*f_ptr)(void)){
  *******************************************************************************/
 uint8 Ssi_Init(const Ssi_Config* ConfigPtr)
 {
-    /* Variable to Calculate on it Max Freq Value */
-    uint32 MaxFreq = 0;
-
-    /* Variable to count on it the CPSDVR value     */
-    uint32 PreScaler = 0;
-
-    /* Variable to calculate on it SCR Value    */
-    uint32 SCR = 0;
+    /* Variable to hold CR0 and CPSR values of the configuration */
+    Ssi_FrameSettings Settings;
 
     /* Pointer to Requested SSI Base address Register */
     volatile uint32* Ssi_Ptr = NULL_PTR;
@@ -414,6 +488,13 @@ uint8 Ssi_Init(const Ssi_Config* ConfigPtr)
     }
     /* There is no need for else because if the if statement occurred, a return will happened */
 
+    /* Calculate Clock Dividers and CR0 Register Value (before touching the module) */
+    if(Ssi_GetFrameSettings(ConfigPtr, &Settings) != RET_OK)
+    {
+        /* Requested frequency can't be generated from the clock source. Return with RET_NOT_OK */
+        return RET_NOT_OK;
+    }
+
     /* Function Call to choose which SSI Module will be used */
     Ssi_ChooseModule(ConfigPtr, &Ssi_Ptr);
 
@@ -443,27 +524,8 @@ uint8 Ssi_Init(const Ssi_Config* ConfigPtr)
     /* Third, Configure SSI Clock Source */
     *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_CC_REG_OFFSET) = ConfigPtr->ClkSrc;
 
-    /********************* Frequency Calculations **********************
-     *                   SSICLK = Freq / CPSDVSR*(1+SCR)               *
-     *                   Freq = System Clock or POISC                  *
-     *               CPSDVSR = Even Prescaler Value (2->254)           *
-     *                  SCR = Serial Clock Rate (0->255)               *
-     ******************************************************************/
-    /* Calculate Maximum Frequency */
-    MaxFreq = ( (ConfigPtr->ClkValue) / (ConfigPtr->SsiFreq) );
-
-    do{
-        /* Increment PreScaler Value by 2 every time because it must be an even number */
-        PreScaler +=2;
-
-        /* Calculate SCR Value */
-        SCR = ( (MaxFreq / PreScaler) - 1);
-
-        /* Loop until SCR Value < 255 (Increase PreScaler Divisor Value by 2) */
-    }while(SCR > 255);
-
     /* Fourth, Configure Clock PreScaler Value */
-    *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_CPSR_REG_OFFSET) = PreScaler;
+    *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_CPSR_REG_OFFSET) = Settings.Cpsr;
 
     /*
      * Fifth, Configure CR0 Register
@@ -472,18 +534,9 @@ uint8 Ssi_Init(const Ssi_Config* ConfigPtr)
      * 3- Data Size
      * 4- Clock Polarity and Phase (if FreeScale SSI Mode is selected)
      */
-    *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_CR0_REG_OFFSET) = ( (SCR << CR0_REG_SCR_POS)
-            | ( (ConfigPtr->SsiFrameFormat) << CR0_REG_FRF_POS) | ( (ConfigPtr->WordLength) << CR0_REG_DSS_POS) );
-
-    /* Check if FreeScale SPI Mode is selected or not to set Clock Polarity and Clock Phase Configurations */
-    if( (ConfigPtr->SsiFrameFormat) == SSI_FRAME_FORMAT_FREESCALE_SSI)
-    {
-        /* Set Clock Phase and Clock Polarity Configurations */
-        *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_CR0_REG_OFFSET) |= ( ( (ConfigPtr->SsiClkPhase) << CR0_REG_SPH_POS)
-                | ( (ConfigPtr->SsiClkPolarity) << CR0_REG_SPO_POS ) );
-    }
+    *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_CR0_REG_OFFSET) = Settings.Cr0;
 
-    /********** Configure uDMA for SSI (Future Work) **********/
+    /********** uDMA requests are enabled per transfer (Ssi_TransmitDMA / Ssi_ReceiveDMA) **********/
 
     /***** Set Interrupts Enabled from Configuration Structure ******/
     /* First, Check if End of Transmission Interrupt is enabled or not */
@@ -638,40 +691,1507 @@ uint16 Ssi_ReceiveIT(const Ssi_Config* ConfigPtr)
 
 }
 
-/******************************************************************************************************************/
+/*******************************************************************************
+ * @fn              uint8 Ssi_TransferBuffer(const Ssi_Config* ConfigPtr, const void* TxBuffer,
+ *                                           void* RxBuffer, uint32 Length)
+ * @brief           Function to exchange a buffer of frames in full duplex using Polling Mode
+ *                  The Transmit FIFO is kept filled while the Receive FIFO is drained,
+ *                  so the bus keeps clocking back to back frames
+ * @param (in):     ConfigPtr - Pointer to configuration set
+ *                  TxBuffer: Frames to be sent (NULL_PTR sends SSI_DUMMY_FRAME instead)
+ *                  Length: Number of frames to be exchanged
+ * @param (out):    RxBuffer: Frames received (NULL_PTR discards the received frames)
+ * @param (inout):  None
+ * @return          Return Status (RET_NOT_OK if a uDMA, interrupt driven, slave
+ *                  or stream transfer owns the SSI module)
+ * @note            Buffers are uint8 arrays for word lengths up to 8 bits
+ *                  and uint16 arrays for word lengths from 9 to 16 bits
+ *******************************************************************************/
+uint8 Ssi_TransferBuffer(const Ssi_Config* ConfigPtr, const void* TxBuffer, void* RxBuffer, uint32 Length)
+{
+    /* Pointer to Requested SSI Base address Register */
+    volatile uint32* Ssi_Ptr = NULL_PTR;
+
+    /* Pointer to SSI Data Register */
+    volatile uint32* DataReg = NULL_PTR;
+
+    /* Pointer to SSI Status Register */
+    volatile uint32* StatusReg = NULL_PTR;
+
+    /* Variable to count the frames written to the Transmit FIFO */
+    uint32 TxCount = 0;
+
+    /* Variable to count the frames read from the Receive FIFO */
+    uint32 RxCount = 0;
+
+    /* Variable to hold the frame which will be written or the one which has been read */
+    uint16 Frame = 0;
+
+    /* Variable to know if the buffers are uint16 (word length > 8 bits) or uint8 */
+    uint8 WideFrames = FALSE;
+
+    /* Check if the input configuration pointer to structure is Not a Null Pointer */
+    if(NULL_PTR == ConfigPtr)
+    {
+        /* ConfigPtr is a Null Pointer. Return with RET_NOT_OK */
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    /* Flushing the Receive FIFO and writing SSIDR would corrupt the running engine */
+    if(Ssi_IsBusy(ConfigPtr->SsiNum) == TRUE)
+    {
+        return RET_NOT_OK;
+    }
+
+    /* Function Call to choose which SSI Module will be used */
+    Ssi_ChooseModule(ConfigPtr, &Ssi_Ptr);
+
+    /* Resolve Data and Status Registers once instead of every frame */
+    DataReg   = (volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_DR_REG_OFFSET);
+    StatusReg = (volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_SR_REG_OFFSET);
+
+    /* Decide the buffers element size from the configured word length */
+    WideFrames = ( (ConfigPtr->WordLength) > SSI_WORD_LENGTH_BYTE_MAX );
+
+    /* Flush stale frames left in the Receive FIFO so received frames match the sent ones */
+    while(BIT_IS_SET(*StatusReg, SR_REG_RNE_POS))
+    {
+        Frame = (uint16)(*DataReg);
+    }
+
+    while(RxCount < Length)
+    {
+        /*
+         * Fill the Transmit FIFO, but never let more than FIFO depth frames be in flight,
+         * otherwise the Receive FIFO could overrun before it gets drained
+         */
+        while( (TxCount < Length) && ( (TxCount - RxCount) < SSI_FIFO_DEPTH )
+                && BIT_IS_SET(*StatusReg, SR_REG_TNF_POS) )
+        {
+            if(NULL_PTR == TxBuffer)
+            {
+                /* No data to be sent, clock out a dummy frame */
+                Frame = SSI_DUMMY_FRAME;
+            }
+            else if(WideFrames)
+            {
+                Frame = ((const uint16*)TxBuffer)[TxCount];
+            }
+            else
+            {
+                Frame = ((const uint8*)TxBuffer)[TxCount];
+            }
+            *DataReg = Frame;
+            TxCount++;
+        }
+
+        /* Drain every frame already received */
+        while(BIT_IS_SET(*StatusReg, SR_REG_RNE_POS))
+        {
+            Frame = (uint16)(*DataReg);
+
+            if(NULL_PTR == RxBuffer)
+            {
+                /* Received frame is discarded */
+            }
+            else if(WideFrames)
+            {
+                ((uint16*)RxBuffer)[RxCount] = Frame;
+            }
+            else
+            {
+                ((uint8*)RxBuffer)[RxCount] = (uint8)Frame;
+            }
+            RxCount++;
+        }
+    }
+
+    /* Return OK */
+    return RET_OK;
+}
 
 /*******************************************************************************
- *                        Static Functions Deceleration                        *
+ * @fn              uint32 Ssi_SolveClock(uint32 ClkValue, uint32 SsiFreq, uint32* PreScaler, uint32* Scr)
+ * @brief           Function to find the clock dividers giving the highest SSI clock
+ *                  not exceeding SsiFreq (i.e. the smallest frequency error)
+ *
+ *                  SSICLK  = ClkValue / (CPSDVSR * (1 + SCR))
+ *                  CPSDVSR = Even Prescaler Value (2->254)
+ *                  SCR     = Serial Clock Rate (0->255)
+ *
+ *                  The total divisor must be >= ceil(ClkValue / SsiFreq), for every
+ *                  CPSDVSR the smallest (1 + SCR) reaching it is taken, and the
+ *                  smallest total divisor of all of them wins (127 candidates)
+ * @note            It only depends on its arguments, so settings of constant
+ *                  configurations can be calculated once and cached
+ * @param (in):     ClkValue - SSI module clock (System Clock or PIOSC) in Hz
+ *                  SsiFreq  - Maximum requested SSI clock in Hz
+ * @param (out):    PreScaler - CPSDVSR value
+ *                  Scr       - SCR value
+ * @param (inout):  None
+ * @return          Achieved SSI clock in Hz (0 if SsiFreq is 0 or lower than
+ *                  ClkValue / 65024, the slowest possible clock)
  *******************************************************************************/
+uint32 Ssi_SolveClock(uint32 ClkValue, uint32 SsiFreq, uint32* PreScaler, uint32* Scr)
+{
+    /* Smallest total divisor keeping SSICLK <= SsiFreq */
+    uint32 MinDivisor = 0;
+
+    /* Best total divisor found so far */
+    uint32 BestDivisor = 0;
+
+    /* Candidate CPSDVSR and (1 + SCR) values */
+    uint32 Cpsdvsr = 0;
+    uint32 ScrPlusOne = 0;
+
+    if( (0 == SsiFreq) || (0 == ClkValue) || (NULL_PTR == PreScaler) || (NULL_PTR == Scr) )
+    {
+        return 0;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    /* ceil(ClkValue / SsiFreq) without overflow */
+    MinDivisor = (ClkValue / SsiFreq) + ( ( (ClkValue % SsiFreq) != 0 ) ? 1U : 0U );
+
+    /* Slowest clock is still faster than requested */
+    if(MinDivisor > (SSI_CPSDVSR_MAX * SSI_SCR_PLUS_ONE_MAX))
+    {
+        return 0;
+    }
+
+    for(Cpsdvsr = SSI_CPSDVSR_MIN; Cpsdvsr <= SSI_CPSDVSR_MAX; Cpsdvsr += 2U)
+    {
+        /* Smallest (1 + SCR) giving Cpsdvsr * (1 + SCR) >= MinDivisor */
+        ScrPlusOne = (MinDivisor + Cpsdvsr - 1U) / Cpsdvsr;
+
+        if(ScrPlusOne > SSI_SCR_PLUS_ONE_MAX)
+        {
+            /* Prescaler too small for this divisor, try a bigger one */
+            continue;
+        }
+
+        if(ScrPlusOne == 0)
+        {
+            ScrPlusOne = 1U;
+        }
+
+        if( (BestDivisor == 0) || ( (Cpsdvsr * ScrPlusOne) < BestDivisor ) )
+        {
+            BestDivisor = Cpsdvsr * ScrPlusOne;
+            *PreScaler  = Cpsdvsr;
+            *Scr        = ScrPlusOne - 1U;
+
+            /* Exact divisor can't be improved */
+            if(BestDivisor == MinDivisor)
+            {
+                break;
+            }
+        }
+    }
+
+    return (ClkValue / BestDivisor);
+}
 
 /*******************************************************************************
- * @fn              static void Ssi_ChooseModule(const Ssi_Config* ConfigPtr, uint32** Ptr)
- * @brief           Function to choose which SSI module base address to work with
+ * @fn              uint8 Ssi_GetFrameSettings(const Ssi_Config* ConfigPtr, Ssi_FrameSettings* Settings)
+ * @brief           Function to calculate CR0 and CPSR Registers values of a configuration
+ *                  (clock rate, frame format, word length, clock polarity and phase)
+ *                  without touching the SSI module
  * @param (in):     ConfigPtr - Pointer to configuration set
- * @param (out):    Ptr: Pointer to the SSI Pointer base address
+ * @param (out):    Settings - CR0 and CPSR values and the achieved SSI clock frequency
  * @param (inout):  None
- * @return          None
+ * @return          Return Status (RET_NOT_OK if SsiFreq can't be generated from ClkValue)
  *******************************************************************************/
-static void Ssi_ChooseModule(const Ssi_Config* ConfigPtr, volatile uint32** Ptr)
+uint8 Ssi_GetFrameSettings(const Ssi_Config* ConfigPtr, Ssi_FrameSettings* Settings)
 {
-    /* Switch case to decide which SSI will operate */
-    switch (ConfigPtr->SsiNum) {
-    case Ssi0:
-        /* Point the pointer to SSI0 Base Address */
-        *Ptr = (volatile uint32*)SSI_0_BASE_ADDRESS;
-         break;
-    case Ssi1:
-        /* Point the pointer to SSI1 Base Address */
-        *Ptr = (volatile uint32*)SSI_1_BASE_ADDRESS;
-         break;
-    case Ssi2:
-        /* Point the pointer to SSI2 Base Address */
-        *Ptr = (volatile uint32*)SSI_2_BASE_ADDRESS;
-         break;
-    case Ssi3:
-        /* Point the pointer to SSI3 Base Address */
-        *Ptr = (volatile uint32*)SSI_3_BASE_ADDRESS;
-         break;
+    /* Variable to hold on it the CPSDVSR value */
+    uint32 PreScaler = 0;
+
+    /* Variable to hold on it SCR Value         */
+    uint32 SCR = 0;
+
+    /* Check if the input pointers are Not Null Pointers */
+    if( (NULL_PTR == ConfigPtr) || (NULL_PTR == Settings) )
+    {
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    /* Find the closest clock dividers not exceeding the requested frequency */
+    Settings->Frequency = Ssi_SolveClock(ConfigPtr->ClkValue, ConfigPtr->SsiFreq, &PreScaler, &SCR);
+    if(Settings->Frequency == 0)
+    {
+        return RET_NOT_OK;
+    }
+
+    Settings->Cpsr = PreScaler;
+
+    /* SCR Value, Protocol Mode (Frame Format) and Data Size */
+    Settings->Cr0 = ( (SCR << CR0_REG_SCR_POS) | ( (ConfigPtr->SsiFrameFormat) << CR0_REG_FRF_POS)
+                    | ( (ConfigPtr->WordLength) << CR0_REG_DSS_POS) );
+
+    /* Check if FreeScale SPI Mode is selected or not to set Clock Polarity and Clock Phase Configurations */
+    if( (ConfigPtr->SsiFrameFormat) == SSI_FRAME_FORMAT_FREESCALE_SSI)
+    {
+        Settings->Cr0 |= ( ( (ConfigPtr->SsiClkPhase) << CR0_REG_SPH_POS) | ( (ConfigPtr->SsiClkPolarity) << CR0_REG_SPO_POS ) );
+    }
+
+    return RET_OK;
+}
+
+/*******************************************************************************
+ * @fn              uint8 Ssi_ApplyFrameSettings(const Ssi_Config* ConfigPtr, const Ssi_FrameSettings* Settings)
+ * @brief           Function to switch an initialized SSI module to other CR0 and CPSR values
+ *                  (e.g. before talking to another device on the same bus)
+ *                  It waits until the module is idle, then disables it while changing them
+ * @param (in):     ConfigPtr - Pointer to configuration set (selects the SSI module)
+ *                  Settings - CR0 and CPSR values from Ssi_GetFrameSettings()
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Return Status (RET_OK if everything is ok)
+ *******************************************************************************/
+uint8 Ssi_ApplyFrameSettings(const Ssi_Config* ConfigPtr, const Ssi_FrameSettings* Settings)
+{
+    /* Pointer to Requested SSI Base address Register */
+    volatile uint32* Ssi_Ptr = NULL_PTR;
+
+    /* Check if the input pointers are Not Null Pointers */
+    if( (NULL_PTR == ConfigPtr) || (NULL_PTR == Settings) )
+    {
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    /* Function Call to choose which SSI Module will be used */
+    Ssi_ChooseModule(ConfigPtr, &Ssi_Ptr);
+
+    /* Wait until the last frame left the bus */
+    while(BIT_IS_SET( (*(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_SR_REG_OFFSET)), SR_REG_BSY_POS) );
+
+    /* CR0 and CPSR can only be changed while SSI is disabled */
+    *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_CR1_REG_OFFSET) &= ~(CR1_REG_SSE_ENABLE << CR1_REG_SSE_POS);
+    *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_CPSR_REG_OFFSET) = Settings->Cpsr;
+    *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_CR0_REG_OFFSET)  = Settings->Cr0;
+    *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_CR1_REG_OFFSET) |= (CR1_REG_SSE_ENABLE << CR1_REG_SSE_POS);
+
+    return RET_OK;
+}
+
+/*******************************************************************************
+ * @fn              uint8 Ssi_TransferIT(const Ssi_Config* ConfigPtr, const void* TxBuffer,
+ *                                       void* RxBuffer, uint32 Length, void (*CallBack)(void))
+ * @brief           Function to exchange a buffer of frames in full duplex using interrupts
+ *                  (non blocking version of Ssi_TransferBuffer)
+ *                  - Receive FIFO interrupt refills Transmit FIFO while frames are left
+ *                  - End of Transmission interrupt collects the last frames
+ * @note            SSI NVIC interrupt must be enabled by the application
+ * @note            SSI interrupts are owned by the transfer while it runs,
+ *                  the configured ones are restored when it is done
+ * @param (in):     ConfigPtr - Pointer to configuration set
+ *                  TxBuffer: Frames to be sent (NULL_PTR sends SSI_DUMMY_FRAME instead)
+ *                  Length: Number of frames to be exchanged
+ *                  CallBack: Function called from SSI ISR when transfer is done
+ *                            (can be NULL_PTR)
+ * @param (out):    RxBuffer: Frames received (NULL_PTR discards the received frames)
+ * @param (inout):  None
+ * @return          Return Status (RET_NOT_OK if a transfer is already running)
+ * @note            Buffers are uint8 arrays for word lengths up to 8 bits
+ *                  and uint16 arrays for word lengths from 9 to 16 bits,
+ *                  they MUST stay valid until CallBack is called
+ *******************************************************************************/
+uint8 Ssi_TransferIT(const Ssi_Config* ConfigPtr, const void* TxBuffer, void* RxBuffer, uint32 Length, void (*CallBack)(void))
+{
+    /* Pointer to Requested SSI Base address Register */
+    volatile uint32* Ssi_Ptr = NULL_PTR;
+
+    /* Pointer to interrupt driven transfer state of requested SSI */
+    Ssi_ItTransfer* Transfer = NULL_PTR;
+
+    /* Check if the input configuration pointer is Not a Null Pointer */
+    if( (NULL_PTR == ConfigPtr) || (0 == Length) )
+    {
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    Transfer = &g_ssiItTransfer[ConfigPtr->SsiNum];
+
+    /* Only one uDMA, interrupt driven, slave or stream engine per SSI at a time */
+    if(Ssi_IsBusy(ConfigPtr->SsiNum) == TRUE)
+    {
+        return RET_NOT_OK;
+    }
+
+    /* Function Call to choose which SSI Module will be used */
+    Ssi_ChooseModule(ConfigPtr, &Ssi_Ptr);
+
+    /* Save configured interrupts and End of Transmission mode, then mask all interrupts */
+    Transfer->SavedMask = *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_IM_REG_OFFSET);
+    Transfer->SavedEot  = *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_CR1_REG_OFFSET) & (CR1_REG_EOT_ENABLE << CR1_REG_EOT_POS);
+    *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_IM_REG_OFFSET) = 0;
+
+    /* Transmit interrupt is raised when the last bit left the bus */
+    *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_CR1_REG_OFFSET) |= (CR1_REG_EOT_ENABLE << CR1_REG_EOT_POS);
+
+    /* Flush stale frames so received frames match the sent ones */
+    while(BIT_IS_SET( (*(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_SR_REG_OFFSET)), SR_REG_RNE_POS) )
+    {
+        (void)(*(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_DR_REG_OFFSET));
+    }
+
+    /* Save transfer state */
+    Transfer->TxNext      = (const uint8*)TxBuffer;
+    Transfer->RxNext      = (uint8*)RxBuffer;
+    Transfer->TxRemaining = Length;
+    Transfer->RxRemaining = Length;
+    Transfer->FrameBytes  = ( (ConfigPtr->WordLength) > SSI_WORD_LENGTH_BYTE_MAX ) ? 2U : 1U;
+    Transfer->CallBack    = CallBack;
+    Transfer->Busy        = TRUE;
+
+    /* Fill Transmit FIFO */
+    Ssi_ItService(Ssi_Ptr, Transfer);
+
+    /* Wait for Receive FIFO half full while frames are left, otherwise for End of Transmission */
+    *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_IM_REG_OFFSET) =
+            (Transfer->TxRemaining != 0) ? (IM_REG_RXIM_ENABLE << IM_REG_RXIM_POS) : (IM_REG_TXIM_ENABLE << IM_REG_TXIM_POS);
+
+    return RET_OK;
+}
+
+/*******************************************************************************
+ * @fn              uint8 Ssi_TransmitDMA(const Ssi_Config* ConfigPtr, const Ssi_DmaSegment* SegmentList,
+ *                                        uint8 SegmentCount, void (*CallBack)(void))
+ * @brief           Function to Transmit a list of buffers as one uDMA transfer (zero copy)
+ *                  Segments are chained using a peripheral scatter-gather task list,
+ *                  so e.g. header, payload and trailer go out back to back without CPU
+ *                  Received frames are discarded
+ * @note            Udma_Init() and SSI NVIC interrupt must be enabled by the application
+ * @param (in):     ConfigPtr - Pointer to configuration set
+ *                  SegmentList: Buffers to be sent in order (MUST stay valid until CallBack)
+ *                  SegmentCount: Number of segments in SegmentList
+ *                  CallBack: Function called from SSI ISR when the last frame left the bus
+ *                            (can be NULL_PTR)
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Return Status (RET_NOT_OK if a uDMA transfer is already running
+ *                  or the segments need more than SSI_DMA_MAX_TASKS tasks)
+ *******************************************************************************/
+uint8 Ssi_TransmitDMA(const Ssi_Config* ConfigPtr, const Ssi_DmaSegment* SegmentList, uint8 SegmentCount, void (*CallBack)(void))
+{
+    /* Pointer to Requested SSI Base address Register */
+    volatile uint32* Ssi_Ptr = NULL_PTR;
+
+    /* Pointer to uDMA transfer state of requested SSI */
+    Ssi_DmaTransfer* Transfer = NULL_PTR;
+
+    /* Variable to hold the next frame of the current segment */
+    const uint8* Next = NULL_PTR;
+
+    /* Variable to hold frames of the current segment not described by a task yet */
+    uint32 Remaining = 0;
+
+    /* Variable to hold the frames of the current task */
+    uint32 Chunk = 0;
+
+    /* Variable to count the tasks of the list */
+    uint32 TaskCount = 0;
+
+    /* Variable to hold the item size and increment part of the control word */
+    uint32 ItemControl = 0;
+
+    /* Loop counter */
+    uint8 Index = 0;
+
+    /* Check if the input configuration pointer and segment list are Not Null Pointers */
+    if( (NULL_PTR == ConfigPtr) || (NULL_PTR == SegmentList) || (0 == SegmentCount) )
+    {
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    Transfer = &g_ssiDmaTransfer[ConfigPtr->SsiNum];
+
+    /* Only one uDMA, interrupt driven, slave or stream engine per SSI at a time */
+    if(Ssi_IsBusy(ConfigPtr->SsiNum) == TRUE)
+    {
+        return RET_NOT_OK;
+    }
+
+    Transfer->FrameBytes = ( (ConfigPtr->WordLength) > SSI_WORD_LENGTH_BYTE_MAX ) ? 2U : 1U;
+    ItemControl = (Transfer->FrameBytes == 2U) ? (UDMA_SIZE_16 | UDMA_SRC_INC_16) : (UDMA_SIZE_8 | UDMA_SRC_INC_8);
+
+    /* Function Call to choose which SSI Module will be used */
+    Ssi_ChooseModule(ConfigPtr, &Ssi_Ptr);
+
+    /* Describe every segment by tasks of up to 1024 frames each */
+    for(Index = 0; Index < SegmentCount; Index++)
+    {
+        Next      = (const uint8*)SegmentList[Index].Buffer;
+        Remaining = SegmentList[Index].Length;
+
+        while(Remaining != 0)
+        {
+            if(TaskCount == SSI_DMA_MAX_TASKS)
+            {
+                return RET_NOT_OK;
+            }
+
+            Chunk = (Remaining > UDMA_MAX_TRANSFER_SIZE) ? UDMA_MAX_TRANSFER_SIZE : Remaining;
+
+            /* Memory (incrementing) -> SSI Data Register (fixed), mode is added below */
+            Udma_TaskSet(&Transfer->Tasks[TaskCount],
+                         Next + ((Chunk - 1U) * Transfer->FrameBytes),
+                         (volatile uint8*)Ssi_Ptr + SSI_DR_REG_OFFSET,
+                         (ItemControl | UDMA_DST_INC_NONE | UDMA_ARB_4 | UDMA_XFER_SIZE(Chunk)) );
+
+            Next      += Chunk * Transfer->FrameBytes;
+            Remaining -= Chunk;
+            TaskCount++;
+        }
+    }
+
+    /* Nothing to be sent */
+    if(TaskCount == 0)
+    {
+        return RET_NOT_OK;
+    }
+
+    /* Every task hands over to the next one, the last task ends the transfer */
+    for(Remaining = 0; Remaining < (TaskCount - 1U); Remaining++)
+    {
+        Transfer->Tasks[Remaining].Control |= (UDMA_MODE_PER_SCATTER_GATHER | UDMA_MODE_ALT_SELECT);
     }
+    Transfer->Tasks[TaskCount - 1U].Control |= UDMA_MODE_BASIC;
+
+    /* Save transfer state */
+    Transfer->Receiving = FALSE;
+    Transfer->Draining  = FALSE;
+    Transfer->CallBack  = CallBack;
+    Transfer->Busy      = TRUE;
+
+    /* Save Rx interrupts mask, then mask them because Receive FIFO will overrun,
+     * Transmit interrupt and End of Transmission mode are borrowed at the end */
+    Transfer->SavedMask = *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_IM_REG_OFFSET) &
+                          (SSI_DMA_RX_INTERRUPTS_MASK | (IM_REG_TXIM_ENABLE << IM_REG_TXIM_POS));
+    Transfer->SavedEot  = *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_CR1_REG_OFFSET) & (CR1_REG_EOT_ENABLE << CR1_REG_EOT_POS);
+    *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_IM_REG_OFFSET) &= ~SSI_DMA_RX_INTERRUPTS_MASK;
 
+    /* Connect Tx uDMA channel to this SSI and hand it the task list */
+    Udma_ChannelAssign(g_ssiDmaChannels[ConfigPtr->SsiNum].TxChannel, g_ssiDmaChannels[ConfigPtr->SsiNum].Encoding);
+    Udma_ChannelScatterGatherSet(g_ssiDmaChannels[ConfigPtr->SsiNum].TxChannel, Transfer->Tasks, TaskCount, TRUE);
+    Udma_ChannelEnable(g_ssiDmaChannels[ConfigPtr->SsiNum].TxChannel);
+
+    /* Let SSI request Tx uDMA transfers */
+    SET_BIT( (*(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_DMACTL_REG_OFFSET) ), DMACTL_REG_TXDMAE_POS);
+
+    return RET_OK;
+}
+
+/*******************************************************************************
+ * @fn              uint8 Ssi_ReceiveDMA(const Ssi_Config* ConfigPtr, void* Buffer,
+ *                                       uint32 Length, void (*CallBack)(void))
+ * @brief           Function to Receive a buffer using uDMA (zero copy)
+ *                  Tx uDMA channel clocks out SSI_DUMMY_FRAME for every frame
+ *                  while Rx uDMA channel writes the received frames to Buffer
+ * @note            Udma_Init() and SSI NVIC interrupt must be enabled by the application
+ * @note            Receive interrupts are masked while the transfer runs
+ *                  and restored when it is done
+ * @param (in):     ConfigPtr - Pointer to configuration set
+ *                  Length: Number of frames to receive
+ *                  CallBack: Function called from SSI ISR when transfer is done
+ *                            (can be NULL_PTR)
+ * @param (out):    Buffer: Buffer to receive frames on it (uint8 array for word
+ *                  length <= 8 bits, uint16 array otherwise)
+ * @param (inout):  None
+ * @return          Return Status (RET_NOT_OK if a uDMA transfer is already running)
+ *******************************************************************************/
+uint8 Ssi_ReceiveDMA(const Ssi_Config* ConfigPtr, void* Buffer, uint32 Length, void (*CallBack)(void))
+{
+    /* Pointer to Requested SSI Base address Register */
+    volatile uint32* Ssi_Ptr = NULL_PTR;
+
+    /* Pointer to uDMA transfer state of requested SSI */
+    Ssi_DmaTransfer* Transfer = NULL_PTR;
+
+    /* Check if the input configuration pointer and buffer are Not Null Pointers */
+    if( (NULL_PTR == ConfigPtr) || (NULL_PTR == Buffer) || (0 == Length) )
+    {
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    Transfer = &g_ssiDmaTransfer[ConfigPtr->SsiNum];
+
+    /* Only one uDMA, interrupt driven, slave or stream engine per SSI at a time */
+    if(Ssi_IsBusy(ConfigPtr->SsiNum) == TRUE)
+    {
+        return RET_NOT_OK;
+    }
+
+    /* Function Call to choose which SSI Module will be used */
+    Ssi_ChooseModule(ConfigPtr, &Ssi_Ptr);
+
+    /* Save transfer state */
+    Transfer->Next       = (uint8*)Buffer;
+    Transfer->Remaining  = Length;
+    Transfer->FrameBytes = ( (ConfigPtr->WordLength) > SSI_WORD_LENGTH_BYTE_MAX ) ? 2U : 1U;
+    Transfer->Receiving  = TRUE;
+    Transfer->Draining   = FALSE;
+    Transfer->CallBack   = CallBack;
+    Transfer->Busy       = TRUE;
+
+    /* Save Rx interrupts mask, then mask them so Rx ISR doesn't steal frames from uDMA */
+    Transfer->SavedMask = *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_IM_REG_OFFSET) & SSI_DMA_RX_INTERRUPTS_MASK;
+    *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_IM_REG_OFFSET) &= ~SSI_DMA_RX_INTERRUPTS_MASK;
+
+    /* Flush stale frames so received frames match the clocked ones */
+    while(BIT_IS_SET( (*(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_SR_REG_OFFSET)), SR_REG_RNE_POS) )
+    {
+        (void)(*(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_DR_REG_OFFSET));
+    }
+
+    /* Connect Rx and Tx uDMA channels to this SSI */
+    Udma_ChannelAssign(g_ssiDmaChannels[ConfigPtr->SsiNum].RxChannel, g_ssiDmaChannels[ConfigPtr->SsiNum].Encoding);
+    Udma_ChannelAssign(g_ssiDmaChannels[ConfigPtr->SsiNum].TxChannel, g_ssiDmaChannels[ConfigPtr->SsiNum].Encoding);
+
+    /* Hand the first chunk to uDMA */
+    Ssi_DmaRxStart(Ssi_Ptr, ConfigPtr->SsiNum, Transfer);
+
+    /* Let SSI request Rx and Tx uDMA transfers */
+    *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_DMACTL_REG_OFFSET) |=
+            ( (1 << DMACTL_REG_RXDMAE_POS) | (1 << DMACTL_REG_TXDMAE_POS) );
+
+    return RET_OK;
+}
+
+/*******************************************************************************
+ * @fn              uint8 Ssi_SlaveStart(const Ssi_Config* ConfigPtr, void (*CallBack)(void))
+ * @brief           Function to run an initialized SSI slave from interrupts
+ *                  - Receive FIFO is drained to the Rx ring on half full, and on
+ *                    Receive Time-Out to flush the tail of a transfer
+ *                  - Transmit FIFO is kept loaded from the Tx ring
+ *                  - Receive overruns (RORMIS) are counted
+ * @note            SSI NVIC interrupt must be enabled by the application
+ * @param (in):     ConfigPtr - Pointer to configuration set (SsiMode MUST be a slave mode)
+ *                  CallBack: Function called from SSI ISR when frames are
+ *                            received (can be NULL_PTR)
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Return Status (RET_OK if everything is ok)
+ *******************************************************************************/
+uint8 Ssi_SlaveStart(const Ssi_Config* ConfigPtr, void (*CallBack)(void))
+{
+    /* Pointer to Requested SSI Base address Register */
+    volatile uint32* Ssi_Ptr = NULL_PTR;
+
+    /* Pointer to slave engine state of requested SSI */
+    Ssi_SlaveState* Slave = NULL_PTR;
+
+    /* Check if the input configuration pointer is Not a Null Pointer and it is a slave */
+    if( (NULL_PTR == ConfigPtr) ||
+        ( (ConfigPtr->SsiMode != SSI_MODE_SLAVE_OUTPUT_ENABLED) && (ConfigPtr->SsiMode != SSI_MODE_SLAVE_OUTPUT_DISABLED) ) )
+    {
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    /* Only one uDMA, interrupt driven, slave or stream engine per SSI at a time */
+    if(Ssi_IsBusy(ConfigPtr->SsiNum) == TRUE)
+    {
+        return RET_NOT_OK;
+    }
+
+    Slave = &g_ssiSlave[ConfigPtr->SsiNum];
+
+    /* Function Call to choose which SSI Module will be used */
+    Ssi_ChooseModule(ConfigPtr, &Ssi_Ptr);
+
+    /* Save configured interrupts and End of Transmission mode, then mask all interrupts */
+    Slave->SavedMask = *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_IM_REG_OFFSET);
+    Slave->SavedEot  = *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_CR1_REG_OFFSET) & (CR1_REG_EOT_ENABLE << CR1_REG_EOT_POS);
+    *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_IM_REG_OFFSET) = 0;
+
+    Slave->RxHead       = 0;
+    Slave->RxTail       = 0;
+    Slave->TxHead       = 0;
+    Slave->TxTail       = 0;
+    Slave->Overruns     = 0;
+    Slave->RxDropped    = 0;
+    Slave->CallBack     = CallBack;
+    Slave->Active       = TRUE;
+
+    /* Transmit FIFO interrupt is raised on half empty (not End of Transmission) */
+    *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_CR1_REG_OFFSET) &= ~(CR1_REG_EOT_ENABLE << CR1_REG_EOT_POS);
+
+    /* Clear old overrun and time-out status */
+    *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_ICR_REG_OFFSET) = ( (1 << ICR_REG_RORIC_POS) | (1 << ICR_REG_RTIC_POS) );
+
+    /* Transmit interrupt is enabled by Ssi_SlaveWrite when there are frames to send */
+    *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_IM_REG_OFFSET) = SSI_SLAVE_RX_INTERRUPTS_MASK;
+
+    return RET_OK;
+}
+
+/*******************************************************************************
+ * @fn              void Ssi_SlaveStop(const Ssi_Config* ConfigPtr)
+ * @brief           Function to stop the slave engine and restore configured interrupts
+ *                  and End of Transmission mode
+ *                  Frames left in the rings are discarded
+ * @param (in):     ConfigPtr - Pointer to configuration set
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+void Ssi_SlaveStop(const Ssi_Config* ConfigPtr)
+{
+    /* Pointer to Requested SSI Base address Register */
+    volatile uint32* Ssi_Ptr = NULL_PTR;
+
+    if( (NULL_PTR == ConfigPtr) || (g_ssiSlave[ConfigPtr->SsiNum].Active != TRUE) )
+    {
+        return;
+    }
+
+    /* Function Call to choose which SSI Module will be used */
+    Ssi_ChooseModule(ConfigPtr, &Ssi_Ptr);
+
+    g_ssiSlave[ConfigPtr->SsiNum].Active = FALSE;
+
+    /* Restore End of Transmission mode with interrupts masked, then configured interrupts */
+    *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_IM_REG_OFFSET) = 0;
+    *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_CR1_REG_OFFSET) =
+            (*(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_CR1_REG_OFFSET) & ~(CR1_REG_EOT_ENABLE << CR1_REG_EOT_POS)) |
+            g_ssiSlave[ConfigPtr->SsiNum].SavedEot;
+    *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_IM_REG_OFFSET) = g_ssiSlave[ConfigPtr->SsiNum].SavedMask;
+}
+
+/*******************************************************************************
+ * @fn              uint32 Ssi_SlaveWrite(const Ssi_Config* ConfigPtr, const void* Buffer, uint32 Length)
+ * @brief           Function to queue frames which will be sent when the master clocks them
+ * @param (in):     ConfigPtr - Pointer to configuration set
+ *                  Buffer: Frames to be sent (uint8 array for word length <= 8 bits,
+ *                          uint16 array otherwise)
+ *                  Length: Number of frames in Buffer
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Number of frames queued (less than Length if Tx ring is full)
+ *******************************************************************************/
+uint32 Ssi_SlaveWrite(const Ssi_Config* ConfigPtr, const void* Buffer, uint32 Length)
+{
+    /* Pointer to Requested SSI Base address Register */
+    volatile uint32* Ssi_Ptr = NULL_PTR;
+
+    /* Pointer to slave engine state of requested SSI */
+    Ssi_SlaveState* Slave = NULL_PTR;
+
+    /* Variable to count the queued frames */
+    uint32 Count = 0;
+
+    /* Saved interrupts state */
+    uint32 Key = 0;
+
+    if( (NULL_PTR == ConfigPtr) || (NULL_PTR == Buffer) || (g_ssiSlave[ConfigPtr->SsiNum].Active != TRUE) )
+    {
+        return 0;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    Slave = &g_ssiSlave[ConfigPtr->SsiNum];
+
+    /* Function Call to choose which SSI Module will be used */
+    Ssi_ChooseModule(ConfigPtr, &Ssi_Ptr);
+
+    /* Only this function moves TxHead, Tx ISR only moves TxTail */
+    while( (Count < Length) && ( (uint16)(Slave->TxHead - Slave->TxTail) < SSI_SLAVE_RING_SIZE ) )
+    {
+        Slave->TxRing[Slave->TxHead & SSI_SLAVE_RING_MASK] = ( (ConfigPtr->WordLength) > SSI_WORD_LENGTH_BYTE_MAX ) ?
+                                                             ((const uint16*)Buffer)[Count] : ((const uint8*)Buffer)[Count];
+        Slave->TxHead++;
+        Count++;
+    }
+
+    /* Pre-load Transmit FIFO and let Transmit interrupt keep it loaded */
+    Key = SSI_ENTER_CRITICAL();
+    Ssi_SlaveTxFill(Ssi_Ptr, Slave);
+    SSI_EXIT_CRITICAL(Key);
+
+    return Count;
+}
+
+/*******************************************************************************
+ * @fn              uint32 Ssi_SlaveRead(const Ssi_Config* ConfigPtr, void* Buffer, uint32 Length)
+ * @brief           Function to take frames received from the master
+ * @param (in):     ConfigPtr - Pointer to configuration set
+ *                  Length: Maximum number of frames to take
+ * @param (out):    Buffer: Received frames (uint8 array for word length <= 8 bits,
+ *                          uint16 array otherwise)
+ * @param (inout):  None
+ * @return          Number of frames taken
+ *******************************************************************************/
+uint32 Ssi_SlaveRead(const Ssi_Config* ConfigPtr, void* Buffer, uint32 Length)
+{
+    /* Pointer to slave engine state of requested SSI */
+    Ssi_SlaveState* Slave = NULL_PTR;
+
+    /* Variable to count the taken frames */
+    uint32 Count = 0;
+
+    if( (NULL_PTR == ConfigPtr) || (NULL_PTR == Buffer) )
+    {
+        return 0;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    Slave = &g_ssiSlave[ConfigPtr->SsiNum];
+
+    /* Only this function moves RxTail, Rx ISR only moves RxHead */
+    while( (Count < Length) && (Slave->RxTail != Slave->RxHead) )
+    {
+        if( (ConfigPtr->WordLength) > SSI_WORD_LENGTH_BYTE_MAX )
+        {
+            ((uint16*)Buffer)[Count] = Slave->RxRing[Slave->RxTail & SSI_SLAVE_RING_MASK];
+        }
+        else
+        {
+            ((uint8*)Buffer)[Count] = (uint8)Slave->RxRing[Slave->RxTail & SSI_SLAVE_RING_MASK];
+        }
+        Slave->RxTail++;
+        Count++;
+    }
+
+    return Count;
+}
+
+/*******************************************************************************
+ * @fn              uint32 Ssi_SlaveGetOverrunCount(Ssi_Instance SsiNum)
+ * @brief           Function to get the number of slave receive errors
+ *                  (Receive FIFO overruns reported by RORMIS and frames dropped
+ *                  because the Rx ring was full)
+ * @param (in):     SsiNum - SSI instance
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Number of overruns and dropped frames since Ssi_SlaveStart
+ *******************************************************************************/
+uint32 Ssi_SlaveGetOverrunCount(Ssi_Instance SsiNum)
+{
+    if(SsiNum >= SSI_NUMBER_OF_INSTANCES)
+    {
+        return 0;
+    }
+
+    return (g_ssiSlave[SsiNum].Overruns + g_ssiSlave[SsiNum].RxDropped);
+}
+
+/*******************************************************************************
+ * @fn              uint8 Ssi_StreamStart(const Ssi_Config* ConfigPtr, const Ssi_StreamConfig* StreamPtr)
+ * @brief           Function to start continuous (gapless) streaming using uDMA ping-pong
+ *                  Tx and/or Rx channels alternate between two application buffers,
+ *                  while one buffer is on the bus the application refills/reads the other
+ *                  CallBack(Half) is called from SSI ISR each time buffer Half is done
+ *                  (Rx buffers filled, or Tx buffers sent when there are no Rx buffers)
+ * @note            Udma_Init() and SSI NVIC interrupt must be enabled by the application
+ * @note            Buffers of a done half MUST be refilled/read before the other half
+ *                  is done, otherwise the old data is sent/overwritten
+ * @param (in):     ConfigPtr - Pointer to configuration set (master mode)
+ *                  StreamPtr - Buffers (MUST stay valid while streaming), frames per buffer and callback
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Return Status (RET_NOT_OK if the SSI is busy or the stream is invalid)
+ *******************************************************************************/
+uint8 Ssi_StreamStart(const Ssi_Config* ConfigPtr, const Ssi_StreamConfig* StreamPtr)
+{
+    /* Pointer to Requested SSI Base address Register */
+    volatile uint32* Ssi_Ptr = NULL_PTR;
+
+    /* Pointer to streaming engine state of requested SSI */
+    Ssi_StreamState* Stream = NULL_PTR;
+
+    /* Check if the input pointers are Not Null Pointers and the stream is valid */
+    if( (NULL_PTR == ConfigPtr) || (NULL_PTR == StreamPtr) ||
+        (0 == StreamPtr->Frames) || (StreamPtr->Frames > UDMA_MAX_TRANSFER_SIZE) ||
+        ( (NULL_PTR == StreamPtr->TxBuffers[0]) != (NULL_PTR == StreamPtr->TxBuffers[1]) ) ||
+        ( (NULL_PTR == StreamPtr->RxBuffers[0]) != (NULL_PTR == StreamPtr->RxBuffers[1]) ) )
+    {
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    /* Only one uDMA, interrupt driven, slave or stream engine per SSI at a time */
+    if(Ssi_IsBusy(ConfigPtr->SsiNum) == TRUE)
+    {
+        return RET_NOT_OK;
+    }
+
+    Stream = &g_ssiStream[ConfigPtr->SsiNum];
+
+    /* Function Call to choose which SSI Module will be used */
+    Ssi_ChooseModule(ConfigPtr, &Ssi_Ptr);
+
+    Stream->TxBuffers[0] = StreamPtr->TxBuffers[0];
+    Stream->TxBuffers[1] = StreamPtr->TxBuffers[1];
+    Stream->RxBuffers[0] = StreamPtr->RxBuffers[0];
+    Stream->RxBuffers[1] = StreamPtr->RxBuffers[1];
+    Stream->Frames       = StreamPtr->Frames;
+    Stream->CallBack     = StreamPtr->CallBack;
+    Stream->FrameBytes = ( (ConfigPtr->WordLength) > SSI_WORD_LENGTH_BYTE_MAX ) ? 2U : 1U;
+    Stream->Receive    = (NULL_PTR != StreamPtr->RxBuffers[0]) ? TRUE : FALSE;
+    Stream->TxNextHalf = 0;
+    Stream->RxNextHalf = 0;
+    Stream->Underruns  = 0;
+    Stream->Overruns   = 0;
+    Stream->Active     = TRUE;
+
+    /* Save Rx interrupts mask, then mask them so Rx ISR doesn't steal frames from uDMA */
+    Stream->SavedMask = *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_IM_REG_OFFSET) & SSI_DMA_RX_INTERRUPTS_MASK;
+    *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_IM_REG_OFFSET) &= ~SSI_DMA_RX_INTERRUPTS_MASK;
+
+    /* Flush stale frames and old overrun status */
+    while(BIT_IS_SET( (*(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_SR_REG_OFFSET)), SR_REG_RNE_POS) )
+    {
+        (void)(*(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_DR_REG_OFFSET));
+    }
+    *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_ICR_REG_OFFSET) = ( (1 << ICR_REG_RORIC_POS) | (1 << ICR_REG_RTIC_POS) );
+
+    /* Arm both halves of each used channel, Rx channel first so it is ready before the first frame */
+    if(Stream->Receive == TRUE)
+    {
+        Udma_ChannelAssign(g_ssiDmaChannels[ConfigPtr->SsiNum].RxChannel, g_ssiDmaChannels[ConfigPtr->SsiNum].Encoding);
+        Ssi_StreamArm(Ssi_Ptr, ConfigPtr->SsiNum, TRUE, 0);
+        Ssi_StreamArm(Ssi_Ptr, ConfigPtr->SsiNum, TRUE, 1);
+        Udma_ChannelEnable(g_ssiDmaChannels[ConfigPtr->SsiNum].RxChannel);
+        SET_BIT( (*(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_DMACTL_REG_OFFSET) ), DMACTL_REG_RXDMAE_POS);
+    }
+
+    /* Tx channel always runs, it generates the serial clock */
+    Udma_ChannelAssign(g_ssiDmaChannels[ConfigPtr->SsiNum].TxChannel, g_ssiDmaChannels[ConfigPtr->SsiNum].Encoding);
+    Ssi_StreamArm(Ssi_Ptr, ConfigPtr->SsiNum, FALSE, 0);
+    Ssi_StreamArm(Ssi_Ptr, ConfigPtr->SsiNum, FALSE, 1);
+    Udma_ChannelEnable(g_ssiDmaChannels[ConfigPtr->SsiNum].TxChannel);
+    SET_BIT( (*(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_DMACTL_REG_OFFSET) ), DMACTL_REG_TXDMAE_POS);
+
+    return RET_OK;
+}
+
+/*******************************************************************************
+ * @fn              void Ssi_StreamStop(const Ssi_Config* ConfigPtr)
+ * @brief           Function to stop streaming (the serial clock stops after
+ *                  the frames already in Transmit FIFO)
+ * @param (in):     ConfigPtr - Pointer to configuration set
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+void Ssi_StreamStop(const Ssi_Config* ConfigPtr)
+{
+    /* Pointer to Requested SSI Base address Register */
+    volatile uint32* Ssi_Ptr = NULL_PTR;
+
+    if( (NULL_PTR == ConfigPtr) || (g_ssiStream[ConfigPtr->SsiNum].Active != TRUE) )
+    {
+        return;
+    }
+
+    /* Function Call to choose which SSI Module will be used */
+    Ssi_ChooseModule(ConfigPtr, &Ssi_Ptr);
+
+    g_ssiStream[ConfigPtr->SsiNum].Active = FALSE;
+
+    /* Stop uDMA channels and requests */
+    Udma_ChannelDisable(g_ssiDmaChannels[ConfigPtr->SsiNum].TxChannel);
+    Udma_ChannelDisable(g_ssiDmaChannels[ConfigPtr->SsiNum].RxChannel);
+    *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_DMACTL_REG_OFFSET) &=
+            ~( (1 << DMACTL_REG_RXDMAE_POS) | (1 << DMACTL_REG_TXDMAE_POS) );
+
+    /* Wait for the last frames, discard what is left in Receive FIFO and restore Rx interrupts */
+    while(BIT_IS_SET( (*(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_SR_REG_OFFSET)), SR_REG_BSY_POS) );
+    while(BIT_IS_SET( (*(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_SR_REG_OFFSET)), SR_REG_RNE_POS) )
+    {
+        (void)(*(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_DR_REG_OFFSET));
+    }
+    *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_ICR_REG_OFFSET) = ( (1 << ICR_REG_RORIC_POS) | (1 << ICR_REG_RTIC_POS) );
+    *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_IM_REG_OFFSET) |= g_ssiStream[ConfigPtr->SsiNum].SavedMask;
+}
+
+/*******************************************************************************
+ * @fn              void Ssi_StreamGetErrors(Ssi_Instance SsiNum, uint32* Underruns, uint32* Overruns)
+ * @brief           Function to get streaming gaps since Ssi_StreamStart
+ * @param (in):     SsiNum - SSI instance
+ * @param (out):    Underruns - Times Tx channel ran out of armed buffers
+ *                              (the serial clock stopped, a gap is on the bus)
+ *                  Overruns  - Times Rx channel ran out of armed buffers or
+ *                              Receive FIFO overran (received frames are lost)
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+void Ssi_StreamGetErrors(Ssi_Instance SsiNum, uint32* Underruns, uint32* Overruns)
+{
+    if( (SsiNum >= SSI_NUMBER_OF_INSTANCES) || (NULL_PTR == Underruns) || (NULL_PTR == Overruns) )
+    {
+        return;
+    }
+
+    *Underruns = g_ssiStream[SsiNum].Underruns;
+    *Overruns  = g_ssiStream[SsiNum].Overruns;
+}
+
+/******************************************************************************************************************/
+
+/*******************************************************************************
+ *                        Static Functions Deceleration                        *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * @fn              static void Ssi_ChooseModule(const Ssi_Config* ConfigPtr, uint32** Ptr)
+ * @brief           Function to choose which SSI module base address to work with
+ * @param (in):     ConfigPtr - Pointer to configuration set
+ * @param (out):    Ptr: Pointer to the SSI Pointer base address
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+static void Ssi_ChooseModule(const Ssi_Config* ConfigPtr, volatile uint32** Ptr)
+{
+    /* Switch case to decide which SSI will operate */
+    switch (ConfigPtr->SsiNum) {
+    case Ssi0:
+        /* Point the pointer to SSI0 Base Address */
+        *Ptr = (volatile uint32*)SSI_0_BASE_ADDRESS;
+         break;
+    case Ssi1:
+        /* Point the pointer to SSI1 Base Address */
+        *Ptr = (volatile uint32*)SSI_1_BASE_ADDRESS;
+         break;
+    case Ssi2:
+        /* Point the pointer to SSI2 Base Address */
+        *Ptr = (volatile uint32*)SSI_2_BASE_ADDRESS;
+         break;
+    case Ssi3:
+        /* Point the pointer to SSI3 Base Address */
+        *Ptr = (volatile uint32*)SSI_3_BASE_ADDRESS;
+         break;
+    }
+
+}
+
+/*******************************************************************************
+ * @fn              static void Ssi_DmaRxStart(volatile uint32* Ssi_Ptr, Ssi_Instance SsiNum,
+ *                                             Ssi_DmaTransfer* Transfer)
+ * @brief           Function to hand the next Rx chunk (up to 1024 frames) to uDMA
+ *                  with the same number of dummy frames on Tx channel
+ * @param (in):     Ssi_Ptr - Pointer to SSI Base address
+ *                  SsiNum  - SSI instance
+ * @param (out):    None
+ * @param (inout):  Transfer - uDMA transfer state
+ * @return          None
+ *******************************************************************************/
+static void Ssi_DmaRxStart(volatile uint32* Ssi_Ptr, Ssi_Instance SsiNum, Ssi_DmaTransfer* Transfer)
+{
+    /* Number of frames of this chunk */
+    uint32 Chunk = Transfer->Remaining;
+
+    /* Item size part of the control word */
+    uint32 SizeControl = (Transfer->FrameBytes == 2U) ? UDMA_SIZE_16 : UDMA_SIZE_8;
+
+    if(Chunk > UDMA_MAX_TRANSFER_SIZE)
+    {
+        Chunk = UDMA_MAX_TRANSFER_SIZE;
+    }
+
+    /* SSI Data Register (fixed) -> Memory (incrementing) */
+    Udma_ChannelTransferSet(g_ssiDmaChannels[SsiNum].RxChannel,
+                            (volatile uint8*)Ssi_Ptr + SSI_DR_REG_OFFSET,
+                            Transfer->Next + ((Chunk - 1U) * Transfer->FrameBytes),
+                            (SizeControl | UDMA_SRC_INC_NONE | ((Transfer->FrameBytes == 2U) ? UDMA_DST_INC_16 : UDMA_DST_INC_8) |
+                             UDMA_ARB_4 | UDMA_XFER_SIZE(Chunk) | UDMA_MODE_BASIC) );
+
+    /* Dummy frame (fixed) -> SSI Data Register (fixed) */
+    Udma_ChannelTransferSet(g_ssiDmaChannels[SsiNum].TxChannel,
+                            &g_ssiDmaDummyFrame,
+                            (volatile uint8*)Ssi_Ptr + SSI_DR_REG_OFFSET,
+                            (SizeControl | UDMA_SRC_INC_NONE | UDMA_DST_INC_NONE | UDMA_ARB_4 | UDMA_XFER_SIZE(Chunk) | UDMA_MODE_BASIC) );
+
+    Transfer->Next      += Chunk * Transfer->FrameBytes;
+    Transfer->Remaining -= Chunk;
+
+    /* Rx channel first, so it is ready before the first frame is clocked */
+    Udma_ChannelEnable(g_ssiDmaChannels[SsiNum].RxChannel);
+    Udma_ChannelEnable(g_ssiDmaChannels[SsiNum].TxChannel);
+}
+
+/*******************************************************************************
+ * @fn              static void Ssi_DmaFinish(volatile uint32* Ssi_Ptr, Ssi_DmaTransfer* Transfer)
+ * @brief           Function to end the uDMA transfer of one SSI instance
+ *                  - Stops uDMA requests
+ *                  - Flushes Receive FIFO and clears its overrun/time-out status
+ *                  - Restores Receive interrupts and calls the transfer callback
+ * @param (in):     Ssi_Ptr - Pointer to SSI Base address
+ * @param (out):    None
+ * @param (inout):  Transfer - uDMA transfer state
+ * @return          None
+ *******************************************************************************/
+static void Ssi_DmaFinish(volatile uint32* Ssi_Ptr, Ssi_DmaTransfer* Transfer)
+{
+    /* Stop Rx and Tx uDMA requests */
+    *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_DMACTL_REG_OFFSET) &=
+            ~( (1 << DMACTL_REG_RXDMAE_POS) | (1 << DMACTL_REG_TXDMAE_POS) );
+
+    /* Discard frames received while transmitting and clear Receive status */
+    while(BIT_IS_SET( (*(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_SR_REG_OFFSET)), SR_REG_RNE_POS) )
+    {
+        (void)(*(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_DR_REG_OFFSET));
+    }
+    *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_ICR_REG_OFFSET) = ( (1 << ICR_REG_RORIC_POS) | (1 << ICR_REG_RTIC_POS) );
+
+    /* Restore Receive interrupts */
+    *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_IM_REG_OFFSET) |= Transfer->SavedMask;
+    Transfer->Busy = FALSE;
+
+    if(Transfer->CallBack != NULL_PTR)
+    {
+        (*Transfer->CallBack)();
+    }
+}
+
+/*******************************************************************************
+ * @fn              static void Ssi_DmaIsrHandler(Ssi_Instance SsiNum, volatile uint32* Ssi_Ptr)
+ * @brief           Function to serve uDMA completion of one SSI instance
+ *                  It re-arms the next Rx chunk or finishes the transfer, a
+ *                  Transmit finishes on End of Transmission interrupt
+ * @param (in):     SsiNum  - SSI instance
+ *                  Ssi_Ptr - Pointer to SSI Base address
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+static void Ssi_DmaIsrHandler(Ssi_Instance SsiNum, volatile uint32* Ssi_Ptr)
+{
+    /* uDMA transfer state of this SSI */
+    Ssi_DmaTransfer* Transfer = &g_ssiDmaTransfer[SsiNum];
+
+    if(Transfer->Busy != TRUE)
+    {
+        return;
+    }
+
+    if(Transfer->Receiving == TRUE)
+    {
+        /* Dummy Tx chunk ends before its Rx chunk, only clear its status */
+        (void)Udma_ChannelDone(g_ssiDmaChannels[SsiNum].TxChannel);
+
+        if(Udma_ChannelDone(g_ssiDmaChannels[SsiNum].RxChannel) == TRUE)
+        {
+            if(Transfer->Remaining != 0)
+            {
+                /* Continue with the next chunk */
+                Ssi_DmaRxStart(Ssi_Ptr, SsiNum, Transfer);
+            }
+            else
+            {
+                /* All frames received */
+                Ssi_DmaFinish(Ssi_Ptr, Transfer);
+            }
+        }
+    }
+    else if(Transfer->Draining == TRUE)
+    {
+        /* End of Transmission: Transmit FIFO is empty and the last bit left the bus */
+        if(BIT_IS_SET( (*(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_MIS_REG_OFFSET)), MIS_REG_TXMIS_POS) )
+        {
+            CLEAR_BIT( (*(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_IM_REG_OFFSET)), IM_REG_TXIM_POS);
+            *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_CR1_REG_OFFSET) =
+                    (*(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_CR1_REG_OFFSET) & ~(CR1_REG_EOT_ENABLE << CR1_REG_EOT_POS)) | Transfer->SavedEot;
+            Transfer->Draining = FALSE;
+
+            Ssi_DmaFinish(Ssi_Ptr, Transfer);
+        }
+    }
+    else if(Udma_ChannelDone(g_ssiDmaChannels[SsiNum].TxChannel) == TRUE)
+    {
+        /* Last frames are still in Transmit FIFO (at most 8), finish on End of Transmission interrupt */
+        CLEAR_BIT( (*(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_DMACTL_REG_OFFSET) ), DMACTL_REG_TXDMAE_POS);
+        *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_CR1_REG_OFFSET) |= (CR1_REG_EOT_ENABLE << CR1_REG_EOT_POS);
+        Transfer->Draining = TRUE;
+        SET_BIT( (*(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_IM_REG_OFFSET)), IM_REG_TXIM_POS);
+    }
+}
+
+/*******************************************************************************
+ * @fn              static void Ssi_ItService(volatile uint32* Ssi_Ptr, Ssi_ItTransfer* Transfer)
+ * @brief           Function to drain Receive FIFO then refill Transmit FIFO of an
+ *                  interrupt driven transfer, never more than FIFO depth frames
+ *                  are in flight, so Receive FIFO can't overrun
+ * @param (in):     Ssi_Ptr - Pointer to SSI Base address
+ * @param (out):    None
+ * @param (inout):  Transfer - Interrupt driven transfer state
+ * @return          None
+ *******************************************************************************/
+static void Ssi_ItService(volatile uint32* Ssi_Ptr, Ssi_ItTransfer* Transfer)
+{
+    /* Pointer to SSI Data Register */
+    volatile uint32* DataReg = (volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_DR_REG_OFFSET);
+
+    /* Pointer to SSI Status Register */
+    volatile uint32* StatusReg = (volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_SR_REG_OFFSET);
+
+    /* Variable to hold the frame which will be written or the one which has been read */
+    uint16 Frame = 0;
+
+    /* Drain every frame already received */
+    while( (Transfer->RxRemaining != 0) && BIT_IS_SET(*StatusReg, SR_REG_RNE_POS) )
+    {
+        Frame = (uint16)(*DataReg);
+
+        if(Transfer->RxNext != NULL_PTR)
+        {
+            if(Transfer->FrameBytes == 2U)
+            {
+                *(uint16*)Transfer->RxNext = Frame;
+            }
+            else
+            {
+                *Transfer->RxNext = (uint8)Frame;
+            }
+            Transfer->RxNext += Transfer->FrameBytes;
+        }
+        Transfer->RxRemaining--;
+    }
+
+    /* Refill Transmit FIFO */
+    while( (Transfer->TxRemaining != 0) && ( (Transfer->RxRemaining - Transfer->TxRemaining) < SSI_FIFO_DEPTH )
+            && BIT_IS_SET(*StatusReg, SR_REG_TNF_POS) )
+    {
+        if(Transfer->TxNext == NULL_PTR)
+        {
+            Frame = SSI_DUMMY_FRAME;
+        }
+        else
+        {
+            Frame = (Transfer->FrameBytes == 2U) ? *(const uint16*)Transfer->TxNext : *Transfer->TxNext;
+            Transfer->TxNext += Transfer->FrameBytes;
+        }
+        *DataReg = Frame;
+        Transfer->TxRemaining--;
+    }
+}
+
+/*******************************************************************************
+ * @fn              static void Ssi_ItIsrHandler(Ssi_Instance SsiNum, volatile uint32* Ssi_Ptr)
+ * @brief           Function to serve the interrupt driven transfer of one SSI instance
+ *                  It moves frames, switches to End of Transmission interrupt when
+ *                  all frames are written and finishes the transfer
+ * @param (in):     SsiNum  - SSI instance
+ *                  Ssi_Ptr - Pointer to SSI Base address
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+static void Ssi_ItIsrHandler(Ssi_Instance SsiNum, volatile uint32* Ssi_Ptr)
+{
+    /* Interrupt driven transfer state of this SSI */
+    Ssi_ItTransfer* Transfer = &g_ssiItTransfer[SsiNum];
+
+    if(Transfer->Busy != TRUE)
+    {
+        return;
+    }
+
+    Ssi_ItService(Ssi_Ptr, Transfer);
+
+    if(Transfer->RxRemaining == 0)
+    {
+        /* All frames exchanged, restore configured interrupts and End of Transmission mode */
+        *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_CR1_REG_OFFSET) =
+                (*(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_CR1_REG_OFFSET) & ~(CR1_REG_EOT_ENABLE << CR1_REG_EOT_POS)) | Transfer->SavedEot;
+        *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_IM_REG_OFFSET) = Transfer->SavedMask;
+        Transfer->Busy = FALSE;
+
+        if(Transfer->CallBack != NULL_PTR)
+        {
+            (*Transfer->CallBack)();
+        }
+    }
+    else if(Transfer->TxRemaining == 0)
+    {
+        /* Nothing left to write, wait for the last frames to leave the bus */
+        *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_IM_REG_OFFSET) = (IM_REG_TXIM_ENABLE << IM_REG_TXIM_POS);
+    }
+}
+
+/*******************************************************************************
+ * @fn              static void Ssi_SlaveTxFill(volatile uint32* Ssi_Ptr, Ssi_SlaveState* Slave)
+ * @brief           Function to move frames from the Tx ring to Transmit FIFO
+ *                  Transmit interrupt stays enabled only while the ring has frames
+ * @param (in):     Ssi_Ptr - Pointer to SSI Base address
+ * @param (out):    None
+ * @param (inout):  Slave - Slave engine state
+ * @return          None
+ *******************************************************************************/
+static void Ssi_SlaveTxFill(volatile uint32* Ssi_Ptr, Ssi_SlaveState* Slave)
+{
+    while( (Slave->TxTail != Slave->TxHead) &&
+           BIT_IS_SET( (*(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_SR_REG_OFFSET)), SR_REG_TNF_POS) )
+    {
+        *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_DR_REG_OFFSET) = Slave->TxRing[Slave->TxTail & SSI_SLAVE_RING_MASK];
+        Slave->TxTail++;
+    }
+
+    if(Slave->TxTail != Slave->TxHead)
+    {
+        SET_BIT( (*(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_IM_REG_OFFSET)), IM_REG_TXIM_POS);
+    }
+    else
+    {
+        CLEAR_BIT( (*(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_IM_REG_OFFSET)), IM_REG_TXIM_POS);
+    }
+}
+
+/*******************************************************************************
+ * @fn              static void Ssi_SlaveIsrHandler(Ssi_Instance SsiNum, volatile uint32* Ssi_Ptr)
+ * @brief           Function to serve the slave engine of one SSI instance
+ *                  - Counts and clears Receive overrun
+ *                  - Drains Receive FIFO to the Rx ring (half full or time-out flush)
+ *                  - Refills Transmit FIFO from the Tx ring
+ * @param (in):     SsiNum  - SSI instance
+ *                  Ssi_Ptr - Pointer to SSI Base address
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+static void Ssi_SlaveIsrHandler(Ssi_Instance SsiNum, volatile uint32* Ssi_Ptr)
+{
+    /* Slave engine state of this SSI */
+    Ssi_SlaveState* Slave = &g_ssiSlave[SsiNum];
+
+    /* Masked interrupt status read once */
+    uint32 Status = 0;
+
+    /* Variable to hold the received frame */
+    uint16 Frame = 0;
+
+    /* Variable to know if frames were received */
+    uint8 Received = FALSE;
+
+    if(Slave->Active != TRUE)
+    {
+        return;
+    }
+
+    Status = *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_MIS_REG_OFFSET);
+
+    /* Master clocked frames while Receive FIFO was full, they are lost */
+    if(BIT_IS_SET(Status, MIS_REG_RORMIS_POS))
+    {
+        Slave->Overruns++;
+    }
+
+    /* Clear overrun and time-out, FIFO levels clear by themselves */
+    *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_ICR_REG_OFFSET) = ( (1 << ICR_REG_RORIC_POS) | (1 << ICR_REG_RTIC_POS) );
+
+    /* Drain Receive FIFO (Receive Time-Out flushes frames below the half full level) */
+    while(BIT_IS_SET( (*(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_SR_REG_OFFSET)), SR_REG_RNE_POS) )
+    {
+        Frame = (uint16)(*(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_DR_REG_OFFSET));
+
+        if( (uint16)(Slave->RxHead - Slave->RxTail) < SSI_SLAVE_RING_SIZE )
+        {
+            Slave->RxRing[Slave->RxHead & SSI_SLAVE_RING_MASK] = Frame;
+            Slave->RxHead++;
+            Received = TRUE;
+        }
+        else
+        {
+            Slave->RxDropped++;
+        }
+    }
+
+    /* Keep Transmit FIFO loaded for the next frames clocked by the master */
+    Ssi_SlaveTxFill(Ssi_Ptr, Slave);
+
+    if( (Received == TRUE) && (Slave->CallBack != NULL_PTR) )
+    {
+        (*Slave->CallBack)();
+    }
+}
+
+/*******************************************************************************
+ * @fn              static uint8 Ssi_IsBusy(Ssi_Instance SsiNum)
+ * @brief           Function to check if an engine owns the SSI module
+ *                  (uDMA transfer, interrupt driven transfer, slave or stream)
+ * @param (in):     SsiNum - SSI instance
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          TRUE if the module is busy, FALSE otherwise
+ *******************************************************************************/
+static uint8 Ssi_IsBusy(Ssi_Instance SsiNum)
+{
+    if( (g_ssiDmaTransfer[SsiNum].Busy == TRUE) || (g_ssiItTransfer[SsiNum].Busy == TRUE) ||
+        (g_ssiSlave[SsiNum].Active == TRUE) || (g_ssiStream[SsiNum].Active == TRUE) )
+    {
+        return TRUE;
+    }
+    return FALSE;
+}
+
+/*******************************************************************************
+ * @fn              static void Ssi_StreamArm(volatile uint32* Ssi_Ptr, Ssi_Instance SsiNum,
+ *                                            uint8 Receive, uint8 Half)
+ * @brief           Function to point one ping-pong structure (Half 0: primary,
+ *                  Half 1: Alternate) of Tx or Rx channel to its buffer again
+ * @param (in):     Ssi_Ptr - Pointer to SSI Base address
+ *                  SsiNum  - SSI instance
+ *                  Receive - TRUE for Rx channel, FALSE for Tx channel
+ *                  Half    - Buffer index (0 or 1)
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+static void Ssi_StreamArm(volatile uint32* Ssi_Ptr, Ssi_Instance SsiNum, uint8 Receive, uint8 Half)
+{
+    /* Streaming engine state of this SSI */
+    Ssi_StreamState* Stream = &g_ssiStream[SsiNum];
+
+    /* Offset of the last frame of a buffer */
+    uint32 LastOffset = (Stream->Frames - 1U) * Stream->FrameBytes;
+
+    /* Item size, source/destination increment and size part of the control word */
+    uint32 Control = ( (Stream->FrameBytes == 2U) ? UDMA_SIZE_16 : UDMA_SIZE_8 ) |
+                     UDMA_ARB_4 | UDMA_XFER_SIZE(Stream->Frames) | UDMA_MODE_PINGPONG;
+
+    /* Source and destination end addresses */
+    const volatile void* SrcEnd = NULL_PTR;
+    volatile void* DstEnd = NULL_PTR;
+
+    /* Channel to be armed */
+    uint8 Channel = 0;
+
+    if(Receive == TRUE)
+    {
+        /* SSI Data Register (fixed) -> Rx buffer (incrementing) */
+        Channel  = g_ssiDmaChannels[SsiNum].RxChannel;
+        SrcEnd   = (volatile uint8*)Ssi_Ptr + SSI_DR_REG_OFFSET;
+        DstEnd   = (uint8*)Stream->RxBuffers[Half] + LastOffset;
+        Control |= UDMA_SRC_INC_NONE | ( (Stream->FrameBytes == 2U) ? UDMA_DST_INC_16 : UDMA_DST_INC_8 );
+    }
+    else
+    {
+        /* Tx buffer (incrementing) or dummy frame (fixed) -> SSI Data Register (fixed) */
+        Channel  = g_ssiDmaChannels[SsiNum].TxChannel;
+        DstEnd   = (volatile uint8*)Ssi_Ptr + SSI_DR_REG_OFFSET;
+        Control |= UDMA_DST_INC_NONE;
+
+        if(NULL_PTR == Stream->TxBuffers[Half])
+        {
+            SrcEnd   = &g_ssiDmaDummyFrame;
+            Control |= UDMA_SRC_INC_NONE;
+        }
+        else
+        {
+            SrcEnd   = (const uint8*)Stream->TxBuffers[Half] + LastOffset;
+            Control |= (Stream->FrameBytes == 2U) ? UDMA_SRC_INC_16 : UDMA_SRC_INC_8;
+        }
+    }
+
+    if(Half == 0)
+    {
+        Udma_ChannelTransferSet(Channel, SrcEnd, DstEnd, Control);
+    }
+    else
+    {
+        Udma_ChannelAlternateTransferSet(Channel, SrcEnd, DstEnd, Control);
+    }
+}
+
+/*******************************************************************************
+ * @fn              static void Ssi_StreamServe(volatile uint32* Ssi_Ptr, Ssi_Instance SsiNum, uint8 Receive)
+ * @brief           Function to re-arm every done half of Tx or Rx channel in order,
+ *                  call the application for each one (leading channel only), and
+ *                  restart the channel if both halves were done (a gap happened)
+ * @param (in):     Ssi_Ptr - Pointer to SSI Base address
+ *                  SsiNum  - SSI instance
+ *                  Receive - TRUE for Rx channel, FALSE for Tx channel
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+static void Ssi_StreamServe(volatile uint32* Ssi_Ptr, Ssi_Instance SsiNum, uint8 Receive)
+{
+    /* Streaming engine state of this SSI */
+    Ssi_StreamState* Stream = &g_ssiStream[SsiNum];
+
+    /* Channel being served */
+    uint8 Channel = (Receive == TRUE) ? g_ssiDmaChannels[SsiNum].RxChannel : g_ssiDmaChannels[SsiNum].TxChannel;
+
+    /* Half which completes next on this channel */
+    uint8* NextHalf = (Receive == TRUE) ? &Stream->RxNextHalf : &Stream->TxNextHalf;
+
+    /* Halves served in this call (both at most) */
+    uint8 Served = 0;
+
+    /* Rx channel leads the application when it runs, otherwise Tx channel does */
+    uint8 Lead = (Receive == Stream->Receive) ? TRUE : FALSE;
+
+    while( (Served < 2U) && (Udma_ChannelModeGet(Channel, (*NextHalf == 1U) ? TRUE : FALSE) == UDMA_MODE_STOP) )
+    {
+        Ssi_StreamArm(Ssi_Ptr, SsiNum, Receive, *NextHalf);
+
+        if( (Lead == TRUE) && (Stream->CallBack != NULL_PTR) )
+        {
+            (*Stream->CallBack)(*NextHalf);
+        }
+
+        *NextHalf ^= 1U;
+        Served++;
+    }
+
+    /* Both halves were done before being re-armed, the channel stopped */
+    if(Udma_ChannelIsEnabled(Channel) == FALSE)
+    {
+        if(Receive == TRUE)
+        {
+            Stream->Overruns++;
+        }
+        else
+        {
+            Stream->Underruns++;
+        }
+        Udma_ChannelEnable(Channel);
+    }
+}
+
+/*******************************************************************************
+ * @fn              static void Ssi_StreamIsrHandler(Ssi_Instance SsiNum, volatile uint32* Ssi_Ptr)
+ * @brief           Function to serve the streaming engine of one SSI instance
+ * @param (in):     SsiNum  - SSI instance
+ *                  Ssi_Ptr - Pointer to SSI Base address
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+static void Ssi_StreamIsrHandler(Ssi_Instance SsiNum, volatile uint32* Ssi_Ptr)
+{
+    /* Streaming engine state of this SSI */
+    Ssi_StreamState* Stream = &g_ssiStream[SsiNum];
+
+    if(Stream->Active != TRUE)
+    {
+        return;
+    }
+
+    if( (Stream->Receive == TRUE) && (Udma_ChannelDone(g_ssiDmaChannels[SsiNum].RxChannel) == TRUE) )
+    {
+        Ssi_StreamServe(Ssi_Ptr, SsiNum, TRUE);
+    }
+
+    if(Udma_ChannelDone(g_ssiDmaChannels[SsiNum].TxChannel) == TRUE)
+    {
+        Ssi_StreamServe(Ssi_Ptr, SsiNum, FALSE);
+    }
+
+    /* Receive FIFO overran (raw status, Rx interrupts are masked while streaming) */
+    if( (Stream->Receive == TRUE) &&
+        BIT_IS_SET( (*(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_RIS_REG_OFFSET)), MIS_REG_RORMIS_POS) )
+    {
+        Stream->Overruns++;
+        *(volatile uint32*)((volatile uint8*)Ssi_Ptr + SSI_ICR_REG_OFFSET) = (1 << ICR_REG_RORIC_POS);
+    }
 }
@@ -5,9 +5,7 @@
  * @author        Islam Ehab Ezzat
  * @version       1.0.0
  * @note          This driver still under development, so it doesn't support:
- *                - uDMA Mode
  *                - Remaining Interrupts handling
- *                - FIFO Mode
  *******************************************************************************/
 
 #ifndef DRIVERS_SSI_SSI_REG_H_
@@ -20,6 +18,8 @@
 #define SSI_1_BASE_ADDRESS      0x40009000  /* SSI1 Base Address */
 #define SSI_2_BASE_ADDRESS      0x4000A000  /* SSI2 Base Address */
 #define SSI_3_BASE_ADDRESS      0x4000B000  /* SSI3 Base Address */
+
+#define SSI_NUMBER_OF_INSTANCES 4U          /* Number of SSI modules */
 /*******************************************************************************/
 
 /*******************************************************************************
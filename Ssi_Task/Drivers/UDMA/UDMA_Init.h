@@ -0,0 +1,112 @@
+/********************************************************************************
+ * @headerfile    UDMA_Init.h
+ * @brief         Header file for uDMA module on TM4C123GH6PM Microcontroller
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ * @note          This driver still under development, so it doesn't support:
+ *                - Software Requests
+ *******************************************************************************/
+
+#ifndef DRIVERS_UDMA_UDMA_INIT_H_
+#define DRIVERS_UDMA_UDMA_INIT_H_
+
+#include "std_types.h"
+#include "common_macros.h"
+
+
+/*******************************************************************************
+ *                       Defines used in uDMA Control Word                     *
+ *******************************************************************************/
+/* Number of uDMA channels in TM4C123GH6PM                      */
+#define UDMA_NUMBER_OF_CHANNELS     (32U)
+
+/* Maximum number of items moved by one uDMA transfer           */
+#define UDMA_MAX_TRANSFER_SIZE      (1024U)
+
+/* Define used to choose destination address increment          */
+#define UDMA_DST_INC_8              ((uint32)0x0 << 30)
+#define UDMA_DST_INC_16             ((uint32)0x1 << 30)
+#define UDMA_DST_INC_32             ((uint32)0x2 << 30)
+#define UDMA_DST_INC_NONE           ((uint32)0x3 << 30)
+
+/* Define used to choose source address increment               */
+#define UDMA_SRC_INC_8              ((uint32)0x0 << 26)
+#define UDMA_SRC_INC_16             ((uint32)0x1 << 26)
+#define UDMA_SRC_INC_32             ((uint32)0x2 << 26)
+#define UDMA_SRC_INC_NONE           ((uint32)0x3 << 26)
+
+/* Define used to choose data size (source and destination)     */
+#define UDMA_SIZE_8                 (((uint32)0x0 << 28) | ((uint32)0x0 << 24))
+#define UDMA_SIZE_16                (((uint32)0x1 << 28) | ((uint32)0x1 << 24))
+#define UDMA_SIZE_32                (((uint32)0x2 << 28) | ((uint32)0x2 << 24))
+
+/* Define used to choose arbitration size (items per burst)     */
+#define UDMA_ARB_1                  ((uint32)0x0 << 14)
+#define UDMA_ARB_2                  ((uint32)0x1 << 14)
+#define UDMA_ARB_4                  ((uint32)0x2 << 14)
+#define UDMA_ARB_8                  ((uint32)0x3 << 14)
+
+/* Define used to set number of items of the transfer (1 -> 1024) */
+#define UDMA_XFER_SIZE(ITEMS)       ((((uint32)(ITEMS) - 1U) & 0x3FFU) << 4)
+
+/* Define used to choose transfer mode                          */
+#define UDMA_MODE_STOP              ((uint32)0x0)
+#define UDMA_MODE_BASIC             ((uint32)0x1)
+#define UDMA_MODE_AUTO              ((uint32)0x2)
+#define UDMA_MODE_PINGPONG          ((uint32)0x3)
+#define UDMA_MODE_MEM_SCATTER_GATHER ((uint32)0x4)
+#define UDMA_MODE_PER_SCATTER_GATHER ((uint32)0x6)
+
+/* Define ORed with a scatter-gather mode inside a task of the list,
+ * so the task is executed using the channel Alternate structure   */
+#define UDMA_MODE_ALT_SELECT        ((uint32)0x1)
+
+/* Maximum number of tasks of one scatter-gather list            */
+#define UDMA_MAX_TASKS              (UDMA_MAX_TRANSFER_SIZE / 4U)
+
+
+/*******************************************************************************
+ *                              User Defined Data Types                        *
+ *******************************************************************************/
+/*******************************************************************************
+ * @struct  Udma_Task
+ *
+ * @brief   Structure holds one task of a scatter-gather list
+ *          It has the same layout of a channel control structure, because
+ *          uDMA copies each task as is into the channel Alternate structure
+ *
+ * @var     Udma_Task::SrcEnd
+ *          Address of the LAST source item (or register address)
+ *
+ * @var     Udma_Task::DstEnd
+ *          Address of the LAST destination item (or register address)
+ *
+ * @var     Udma_Task::Control
+ *          Control word built from UDMA_xxx defines
+ *          (all tasks except the last one use UDMA_MODE_xxx_SCATTER_GATHER | UDMA_MODE_ALT_SELECT)
+ ******************************************************************************/
+typedef struct{
+    uint32 SrcEnd;          /* Address of the LAST source item                  */
+    uint32 DstEnd;          /* Address of the LAST destination item             */
+    uint32 Control;         /* Control word built from UDMA_xxx defines         */
+    uint32 Reserved;        /* Unused word of the control structure             */
+}Udma_Task;
+
+
+/*******************************************************************************
+ *                              Functions Prototype                            *
+ *******************************************************************************/
+void  Udma_Init(void);
+uint8 Udma_ChannelAssign(uint8 Channel, uint8 Encoding);
+uint8 Udma_ChannelTransferSet(uint8 Channel, const volatile void* SrcEnd, volatile void* DstEnd, uint32 Control);
+uint8 Udma_ChannelAlternateTransferSet(uint8 Channel, const volatile void* SrcEnd, volatile void* DstEnd, uint32 Control);
+uint32 Udma_ChannelModeGet(uint8 Channel, uint8 Alternate);
+void  Udma_ChannelEnable(uint8 Channel);
+void  Udma_ChannelDisable(uint8 Channel);
+uint8 Udma_ChannelIsEnabled(uint8 Channel);
+uint8 Udma_ChannelDone(uint8 Channel);
+void  Udma_TaskSet(Udma_Task* Task, const volatile void* SrcEnd, volatile void* DstEnd, uint32 Control);
+uint8 Udma_ChannelScatterGatherSet(uint8 Channel, const Udma_Task* TaskList, uint32 TaskCount, uint8 Peripheral);
+
+#endif /* DRIVERS_UDMA_UDMA_INIT_H_ */
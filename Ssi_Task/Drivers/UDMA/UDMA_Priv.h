@@ -0,0 +1,52 @@
+/********************************************************************************
+ * @headerfile    UDMA_Priv.h
+ * @brief         Header file for uDMA Defines and bits on TM4C123GH6PM Microcontroller
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ * @note          This driver still under development, so it doesn't support:
+ *                - Software Requests
+ *
+ *******************************************************************************/
+
+
+#ifndef DRIVERS_UDMA_UDMA_PRIV_H_
+#define DRIVERS_UDMA_UDMA_PRIV_H_
+
+
+/************************** DMACFG Register defines *****************************/
+#define CFG_REG_MASTEN_POS              ((uint8) 0x0)   /* Controller Master Enable Bit Position    */
+
+#define CFG_REG_MASTEN_ENABLE           ((uint8) 0x1)   /* Controller Master Enable Value           */
+
+/************************** DMACHMAPn Register defines ***************************/
+#define CHMAP_CHANNELS_PER_REG          ((uint8) 0x8)   /* Channels mapped by each DMACHMAPn Register */
+#define CHMAP_BITS_PER_CHANNEL          ((uint8) 0x4)   /* Encoding bits of each channel              */
+#define CHMAP_CHANNEL_MASK              ((uint32) 0xF)  /* Encoding mask of each channel              */
+
+/********************** Channel Control Structure defines ************************/
+/* Number of uint32 words in one channel control structure
+ * (Source End Pointer, Destination End Pointer, Control Word, Unused) */
+#define UDMA_CHANNEL_STRUCT_WORDS       (4U)
+
+#define UDMA_SRC_END_WORD               (0U)    /* Source End Pointer word index        */
+#define UDMA_DST_END_WORD               (1U)    /* Destination End Pointer word index   */
+#define UDMA_CONTROL_WORD               (2U)    /* Control Word word index              */
+#define UDMA_UNUSED_WORD                (3U)    /* Unused word index                    */
+
+/* Index of the first Alternate structure word in the control table */
+#define UDMA_ALTERNATE_TABLE_WORDS      (UDMA_NUMBER_OF_CHANNELS * UDMA_CHANNEL_STRUCT_WORDS)
+
+/* Words copied from the task list to the Alternate structure for each task */
+#define UDMA_TASK_WORDS                 (4U)
+
+/* Primary + Alternate structures for all channels (1024 bytes) */
+#define UDMA_CONTROL_TABLE_WORDS        (UDMA_NUMBER_OF_CHANNELS * UDMA_CHANNEL_STRUCT_WORDS * 2U)
+
+/* Control table MUST be aligned on 1024 bytes boundary (See Data sheet page 585) */
+#define UDMA_CONTROL_TABLE_ALIGNMENT    (1024U)
+
+#define CHCTL_XFERMODE_MASK             ((uint32) 0x7)  /* Transfer Mode bits of the Control Word   */
+
+
+#endif /* DRIVERS_UDMA_UDMA_PRIV_H_ */
@@ -0,0 +1,333 @@
+/********************************************************************************
+ * @file          UDMA_Prog.c
+ * @brief         Source file for uDMA module on TM4C123GH6PM Microcontroller
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ * @note          This driver still under development, so it doesn't support:
+ *                - Software Requests
+ *
+ *******************************************************************************/
+
+/********************************************************************************
+ *                                Includes Needed                               *
+ *******************************************************************************/
+#include "UDMA_Reg.h"
+#include "UDMA_Init.h"
+#include "UDMA_Priv.h"
+
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+/* Channel control table (Primary structures followed by Alternate structures)
+ * It is owned by this driver and MUST be aligned on 1024 bytes boundary      */
+#if defined(__TI_ARM__)
+#pragma DATA_ALIGN(g_udmaControlTable, UDMA_CONTROL_TABLE_ALIGNMENT)
+static volatile uint32 g_udmaControlTable[UDMA_CONTROL_TABLE_WORDS];
+#else
+static volatile uint32 g_udmaControlTable[UDMA_CONTROL_TABLE_WORDS] __attribute__((aligned(UDMA_CONTROL_TABLE_ALIGNMENT)));
+#endif
+
+
+/*******************************************************************************
+ * @fn              void Udma_Init(void)
+ * @brief           Function to initialize uDMA Controller
+ *                  - Enable uDMA clock
+ *                  - Enable the controller
+ *                  - Set the channel control table base address
+ * @param (in):     None
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+void Udma_Init(void)
+{
+    /* Variable to waste time to ensure clock stability */
+    volatile uint32  delay = 0;
+
+    /* Enable clock for uDMA Module */
+    SYSCTL_RCGCDMA_REG |= (1 << 0);
+
+    /* Delay to waste sometime to ensure clock stability */
+    delay = SYSCTL_RCGCDMA_REG;
+
+    /* Enable uDMA Controller */
+    *(volatile uint32*)(UDMA_BASE_ADDRESS + UDMA_CFG_REG_OFFSET) = (CFG_REG_MASTEN_ENABLE << CFG_REG_MASTEN_POS);
+
+    /* Set the channel control table base address */
+    *(volatile uint32*)(UDMA_BASE_ADDRESS + UDMA_CTLBASE_REG_OFFSET) = (uint32)g_udmaControlTable;
+}
+
+/*******************************************************************************
+ * @fn              uint8 Udma_ChannelAssign(uint8 Channel, uint8 Encoding)
+ * @brief           Function to select which peripheral drives the channel
+ *                  and to prepare the channel for peripheral requests
+ *                  (primary structure, single + burst requests, not masked)
+ * @param (in):     Channel  - uDMA channel number (0 -> 31)
+ *                  Encoding - Channel encoding (See Data sheet page 587)
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Return Status (RET_OK if everything is ok)
+ *******************************************************************************/
+uint8 Udma_ChannelAssign(uint8 Channel, uint8 Encoding)
+{
+    /* Pointer to DMACHMAPn Register of the requested channel */
+    volatile uint32* Map_Ptr = NULL_PTR;
+
+    /* Bits position of the channel in DMACHMAPn Register */
+    uint8 Shift = 0;
+
+    /* Check if the channel number is valid */
+    if(Channel >= UDMA_NUMBER_OF_CHANNELS)
+    {
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    /* Each DMACHMAPn Register holds 8 channels, 4 bits each */
+    Map_Ptr = (volatile uint32*)(UDMA_BASE_ADDRESS + UDMA_CHMAP0_REG_OFFSET + ((Channel / CHMAP_CHANNELS_PER_REG) * 4U));
+    Shift   = (Channel % CHMAP_CHANNELS_PER_REG) * CHMAP_BITS_PER_CHANNEL;
+
+    /* Set channel encoding */
+    *Map_Ptr = (*Map_Ptr & ~(CHMAP_CHANNEL_MASK << Shift)) | (((uint32)Encoding & CHMAP_CHANNEL_MASK) << Shift);
+
+    /* Use primary control structure */
+    *(volatile uint32*)(UDMA_BASE_ADDRESS + UDMA_ALTCLR_REG_OFFSET) = (1UL << Channel);
+
+    /* Respond to both single and burst requests */
+    *(volatile uint32*)(UDMA_BASE_ADDRESS + UDMA_USEBURSTCLR_REG_OFFSET) = (1UL << Channel);
+
+    /* Allow the peripheral to request transfers */
+    *(volatile uint32*)(UDMA_BASE_ADDRESS + UDMA_REQMASKCLR_REG_OFFSET) = (1UL << Channel);
+
+    return RET_OK;
+}
+
+/*******************************************************************************
+ * @fn              uint8 Udma_ChannelTransferSet(uint8 Channel, const volatile void* SrcEnd,
+ *                                                volatile void* DstEnd, uint32 Control)
+ * @brief           Function to fill the primary control structure of a channel
+ * @param (in):     Channel - uDMA channel number (0 -> 31)
+ *                  SrcEnd  - Address of the LAST source item (or register address)
+ *                  DstEnd  - Address of the LAST destination item (or register address)
+ *                  Control - Control word built from UDMA_xxx defines
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Return Status (RET_OK if everything is ok)
+ *******************************************************************************/
+uint8 Udma_ChannelTransferSet(uint8 Channel, const volatile void* SrcEnd, volatile void* DstEnd, uint32 Control)
+{
+    /* Pointer to the primary control structure of the channel */
+    volatile uint32* Struct_Ptr = NULL_PTR;
+
+    /* Check if the channel number is valid */
+    if(Channel >= UDMA_NUMBER_OF_CHANNELS)
+    {
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    Struct_Ptr = &g_udmaControlTable[Channel * UDMA_CHANNEL_STRUCT_WORDS];
+
+    Struct_Ptr[UDMA_SRC_END_WORD] = (uint32)SrcEnd;
+    Struct_Ptr[UDMA_DST_END_WORD] = (uint32)DstEnd;
+    Struct_Ptr[UDMA_CONTROL_WORD] = Control;
+
+    return RET_OK;
+}
+
+/*******************************************************************************
+ * @fn              uint8 Udma_ChannelAlternateTransferSet(uint8 Channel, const volatile void* SrcEnd,
+ *                                                         volatile void* DstEnd, uint32 Control)
+ * @brief           Function to fill the Alternate control structure of a channel
+ *                  (second buffer of a ping-pong transfer)
+ * @param (in):     Channel - uDMA channel number (0 -> 31)
+ *                  SrcEnd  - Address of the LAST source item (or register address)
+ *                  DstEnd  - Address of the LAST destination item (or register address)
+ *                  Control - Control word built from UDMA_xxx defines
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Return Status (RET_OK if everything is ok)
+ *******************************************************************************/
+uint8 Udma_ChannelAlternateTransferSet(uint8 Channel, const volatile void* SrcEnd, volatile void* DstEnd, uint32 Control)
+{
+    /* Pointer to the Alternate control structure of the channel */
+    volatile uint32* Struct_Ptr = NULL_PTR;
+
+    /* Check if the channel number is valid */
+    if(Channel >= UDMA_NUMBER_OF_CHANNELS)
+    {
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    Struct_Ptr = &g_udmaControlTable[UDMA_ALTERNATE_TABLE_WORDS + (Channel * UDMA_CHANNEL_STRUCT_WORDS)];
+
+    Struct_Ptr[UDMA_SRC_END_WORD] = (uint32)SrcEnd;
+    Struct_Ptr[UDMA_DST_END_WORD] = (uint32)DstEnd;
+    Struct_Ptr[UDMA_CONTROL_WORD] = Control;
+
+    return RET_OK;
+}
+
+/*******************************************************************************
+ * @fn              uint32 Udma_ChannelModeGet(uint8 Channel, uint8 Alternate)
+ * @brief           Function to read the transfer mode of a channel control structure
+ *                  uDMA writes UDMA_MODE_STOP on it when its transfer is done
+ * @param (in):     Channel   - uDMA channel number (0 -> 31)
+ *                  Alternate - TRUE for the Alternate structure, FALSE for the primary one
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Transfer mode (UDMA_MODE_xxx)
+ *******************************************************************************/
+uint32 Udma_ChannelModeGet(uint8 Channel, uint8 Alternate)
+{
+    /* Index of the first word of the requested structure */
+    uint32 Index = Channel * UDMA_CHANNEL_STRUCT_WORDS;
+
+    /* Check if the channel number is valid */
+    if(Channel >= UDMA_NUMBER_OF_CHANNELS)
+    {
+        return UDMA_MODE_STOP;
+    }
+
+    if(Alternate == TRUE)
+    {
+        Index += UDMA_ALTERNATE_TABLE_WORDS;
+    }
+
+    return (g_udmaControlTable[Index + UDMA_CONTROL_WORD] & CHCTL_XFERMODE_MASK);
+}
+
+/*******************************************************************************
+ * @fn              void Udma_ChannelEnable(uint8 Channel)
+ * @brief           Function to enable uDMA channel (start servicing requests)
+ * @param (in):     Channel - uDMA channel number (0 -> 31)
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+void Udma_ChannelEnable(uint8 Channel)
+{
+    *(volatile uint32*)(UDMA_BASE_ADDRESS + UDMA_ENASET_REG_OFFSET) = (1UL << Channel);
+}
+
+/*******************************************************************************
+ * @fn              void Udma_ChannelDisable(uint8 Channel)
+ * @brief           Function to disable uDMA channel
+ * @param (in):     Channel - uDMA channel number (0 -> 31)
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+void Udma_ChannelDisable(uint8 Channel)
+{
+    *(volatile uint32*)(UDMA_BASE_ADDRESS + UDMA_ENACLR_REG_OFFSET) = (1UL << Channel);
+}
+
+/*******************************************************************************
+ * @fn              uint8 Udma_ChannelIsEnabled(uint8 Channel)
+ * @brief           Function to check if uDMA channel is still transferring
+ *                  (the controller disables the channel when transfer is done)
+ * @param (in):     Channel - uDMA channel number (0 -> 31)
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          TRUE if channel is enabled, FALSE otherwise
+ *******************************************************************************/
+uint8 Udma_ChannelIsEnabled(uint8 Channel)
+{
+    if( (*(volatile uint32*)(UDMA_BASE_ADDRESS + UDMA_ENASET_REG_OFFSET) & (1UL << Channel)) != 0 )
+    {
+        return TRUE;
+    }
+    return FALSE;
+}
+
+/*******************************************************************************
+ * @fn              uint8 Udma_ChannelDone(uint8 Channel)
+ * @brief           Function to check and clear channel completion interrupt
+ *                  It should be called from the peripheral ISR, because
+ *                  uDMA completion is signaled on the peripheral interrupt vector
+ * @param (in):     Channel - uDMA channel number (0 -> 31)
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          TRUE if the channel completed its transfer, FALSE otherwise
+ *******************************************************************************/
+uint8 Udma_ChannelDone(uint8 Channel)
+{
+    if( (*(volatile uint32*)(UDMA_BASE_ADDRESS + UDMA_CHIS_REG_OFFSET) & (1UL << Channel)) != 0 )
+    {
+        /* Clear completion status by writing 1 on it */
+        *(volatile uint32*)(UDMA_BASE_ADDRESS + UDMA_CHIS_REG_OFFSET) = (1UL << Channel);
+        return TRUE;
+    }
+    return FALSE;
+}
+
+/*******************************************************************************
+ * @fn              void Udma_TaskSet(Udma_Task* Task, const volatile void* SrcEnd,
+ *                                    volatile void* DstEnd, uint32 Control)
+ * @brief           Function to fill one task of a scatter-gather list
+ * @param (in):     SrcEnd  - Address of the LAST source item (or register address)
+ *                  DstEnd  - Address of the LAST destination item (or register address)
+ *                  Control - Control word built from UDMA_xxx defines
+ * @param (out):    Task    - Task to be filled
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+void Udma_TaskSet(Udma_Task* Task, const volatile void* SrcEnd, volatile void* DstEnd, uint32 Control)
+{
+    Task->SrcEnd   = (uint32)SrcEnd;
+    Task->DstEnd   = (uint32)DstEnd;
+    Task->Control  = Control;
+    Task->Reserved = 0;
+}
+
+/*******************************************************************************
+ * @fn              uint8 Udma_ChannelScatterGatherSet(uint8 Channel, const Udma_Task* TaskList,
+ *                                                     uint32 TaskCount, uint8 Peripheral)
+ * @brief           Function to program the primary control structure of a channel
+ *                  to copy a list of tasks, one by one, into its Alternate structure
+ *                  The task list is read by uDMA, so it MUST stay valid until the
+ *                  channel is done
+ * @param (in):     Channel    - uDMA channel number (0 -> 31)
+ *                  TaskList   - Tasks to be executed in order
+ *                  TaskCount  - Number of tasks (1 -> UDMA_MAX_TASKS)
+ *                  Peripheral - TRUE: each task waits for peripheral requests
+ *                               FALSE: memory scatter-gather (software request)
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Return Status (RET_OK if everything is ok)
+ *******************************************************************************/
+uint8 Udma_ChannelScatterGatherSet(uint8 Channel, const Udma_Task* TaskList, uint32 TaskCount, uint8 Peripheral)
+{
+    /* Pointer to the primary control structure of the channel */
+    volatile uint32* Struct_Ptr = NULL_PTR;
+
+    /* Check if the channel number and the task list are valid */
+    if( (Channel >= UDMA_NUMBER_OF_CHANNELS) || (NULL_PTR == TaskList) ||
+        (0 == TaskCount) || (TaskCount > UDMA_MAX_TASKS) )
+    {
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    Struct_Ptr = &g_udmaControlTable[Channel * UDMA_CHANNEL_STRUCT_WORDS];
+
+    /* Source is the task list, destination is the Alternate structure of the channel
+     * (both end pointers point to the last word, as uDMA counts down from them)      */
+    Struct_Ptr[UDMA_SRC_END_WORD] = (uint32)&TaskList[TaskCount - 1U].Reserved;
+    Struct_Ptr[UDMA_DST_END_WORD] = (uint32)&g_udmaControlTable[UDMA_ALTERNATE_TABLE_WORDS +
+                                                                (Channel * UDMA_CHANNEL_STRUCT_WORDS) + UDMA_UNUSED_WORD];
+
+    /* Each task is 4 words copied as one burst of 4 (arbitration size MUST be 4) */
+    Struct_Ptr[UDMA_CONTROL_WORD] = (UDMA_SIZE_32 | UDMA_SRC_INC_32 | UDMA_DST_INC_32 | UDMA_ARB_4 |
+                                     UDMA_XFER_SIZE(TaskCount * UDMA_TASK_WORDS) |
+                                     ((Peripheral == TRUE) ? UDMA_MODE_PER_SCATTER_GATHER : UDMA_MODE_MEM_SCATTER_GATHER));
+
+    /* Scatter-gather always starts from the primary structure */
+    *(volatile uint32*)(UDMA_BASE_ADDRESS + UDMA_ALTCLR_REG_OFFSET) = (1UL << Channel);
+
+    return RET_OK;
+}
@@ -0,0 +1,54 @@
+/********************************************************************************
+ * @headerfile    UDMA_Reg.h
+ * @brief         Header file for uDMA Registers on TM4C123GH6PM Microcontroller
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ * @note          This driver still under development, so it doesn't support:
+ *                - Software Requests
+ *******************************************************************************/
+
+#ifndef DRIVERS_UDMA_UDMA_REG_H_
+#define DRIVERS_UDMA_UDMA_REG_H_
+
+
+/*******************************************************************************
+ *                         uDMA Registers Base Address                         *
+ *******************************************************************************/
+#define UDMA_BASE_ADDRESS           0x400FF000  /* uDMA Base Address */
+/*******************************************************************************/
+
+/*******************************************************************************
+ *                        uDMA Registers Offset Address                        *
+ *******************************************************************************/
+
+#define UDMA_STAT_REG_OFFSET            0x000    /* DMA Status                               */
+#define UDMA_CFG_REG_OFFSET             0x004    /* DMA Configuration                        */
+#define UDMA_CTLBASE_REG_OFFSET         0x008    /* DMA Channel Control Base Pointer         */
+#define UDMA_ALTBASE_REG_OFFSET         0x00C    /* DMA Alternate Channel Control Base Ptr   */
+#define UDMA_WAITSTAT_REG_OFFSET        0x010    /* DMA Channel Wait-on-Request Status       */
+#define UDMA_SWREQ_REG_OFFSET           0x014    /* DMA Channel Software Request             */
+#define UDMA_USEBURSTSET_REG_OFFSET     0x018    /* DMA Channel Useburst Set                 */
+#define UDMA_USEBURSTCLR_REG_OFFSET     0x01C    /* DMA Channel Useburst Clear               */
+#define UDMA_REQMASKSET_REG_OFFSET      0x020    /* DMA Channel Request Mask Set             */
+#define UDMA_REQMASKCLR_REG_OFFSET      0x024    /* DMA Channel Request Mask Clear           */
+#define UDMA_ENASET_REG_OFFSET          0x028    /* DMA Channel Enable Set                   */
+#define UDMA_ENACLR_REG_OFFSET          0x02C    /* DMA Channel Enable Clear                 */
+#define UDMA_ALTSET_REG_OFFSET          0x030    /* DMA Channel Primary Alternate Set        */
+#define UDMA_ALTCLR_REG_OFFSET          0x034    /* DMA Channel Primary Alternate Clear      */
+#define UDMA_PRIOSET_REG_OFFSET         0x038    /* DMA Channel Priority Set                 */
+#define UDMA_PRIOCLR_REG_OFFSET         0x03C    /* DMA Channel Priority Clear               */
+#define UDMA_ERRCLR_REG_OFFSET          0x04C    /* DMA Bus Error Clear                      */
+#define UDMA_CHASGN_REG_OFFSET          0x500    /* DMA Channel Assignment                   */
+#define UDMA_CHIS_REG_OFFSET            0x504    /* DMA Channel Interrupt Status             */
+#define UDMA_CHMAP0_REG_OFFSET          0x510    /* DMA Channel Map Select 0                 */
+#define UDMA_CHMAP1_REG_OFFSET          0x514    /* DMA Channel Map Select 1                 */
+#define UDMA_CHMAP2_REG_OFFSET          0x518    /* DMA Channel Map Select 2                 */
+#define UDMA_CHMAP3_REG_OFFSET          0x51C    /* DMA Channel Map Select 3                 */
+
+/**********************************************************************************/
+
+#define SYSCTL_RCGCDMA_REG         (*((volatile unsigned long *)0x400FE60C))
+
+
+#endif /* DRIVERS_UDMA_UDMA_REG_H_ */
@@ -0,0 +1,27 @@
+/********************************************************************************
+ * @headerfile    Test_Critical.h
+ * @brief         Header file for the host implementation of the drivers
+ *                critical sections (xxx_ENTER_CRITICAL/xxx_EXIT_CRITICAL)
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ * @note          Included by the drivers private headers when HOST_TEST is
+ *                defined. There are no IRQs on the host, so the nesting depth
+ *                is recorded instead and a register model can check that a
+ *                shared register is updated with IRQs masked
+ *******************************************************************************/
+
+#ifndef TESTS_HARNESS_TEST_CRITICAL_H_
+#define TESTS_HARNESS_TEST_CRITICAL_H_
+
+#include "std_types.h"
+
+
+/*******************************************************************************
+ *                              Functions Prototypes                           *
+ *******************************************************************************/
+uint32 Test_EnterCritical(void);
+void Test_ExitCritical(uint32 Key);
+uint32 Test_CriticalDepth(void);
+
+#endif /* TESTS_HARNESS_TEST_CRITICAL_H_ */
@@ -0,0 +1,399 @@
+/********************************************************************************
+ * @file          Test_Harness.c
+ * @brief         Source file for the host test harness of TM4C123GH6PM drivers
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ * @note          Register hooks work per 4 KB page:
+ *                - A page holding a hooked register is mapped without access
+ *                - Any access to it faults (SIGSEGV): the page is opened, the
+ *                  read hook gives the value of a read, and the faulting
+ *                  instruction is single stepped (trap flag)
+ *                - After the step (SIGTRAP) the write hook gets the written
+ *                  value, then the page is closed again
+ *                Linux x86-64 only (page fault error code and trap flag)
+ *******************************************************************************/
+
+#define _GNU_SOURCE
+
+/********************************************************************************
+ *                                Includes Needed                               *
+ *******************************************************************************/
+#include <signal.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ucontext.h>
+#include <sys/mman.h>
+#include "Test_Harness.h"
+#include "Test_Critical.h"
+
+
+/*******************************************************************************
+ *                                  Defines                                    *
+ *******************************************************************************/
+#define TEST_PAGE_SIZE              (0x1000U)
+#define TEST_MAX_HOOKS              (64U)
+
+/* x86-64 EFLAGS Trap Flag and page fault error code Write bit */
+#define TEST_EFLAGS_TRAP            (0x100U)
+#define TEST_FAULT_WRITE            (0x2U)
+
+
+/*******************************************************************************
+ *                              User Defined Data Types                        *
+ *******************************************************************************/
+typedef struct{
+    uint32  Base;           /* First address of the region  */
+    uint32  Size;           /* Size of the region in bytes  */
+}Test_Region;
+
+typedef struct{
+    uint32  Address;                                /* Hooked register address   */
+    uint32  (*Read)(uint32 Address, uint32 Value);  /* Value returned by a read  */
+    void    (*Write)(uint32 Address, uint32 Value); /* Called after a write      */
+}Test_Hook;
+
+typedef struct{
+    uint8           Active;     /* An access is being single stepped    */
+    uint8           Write;      /* The access writes the register       */
+    uint32          Address;    /* Register address (word aligned)      */
+    const Test_Hook* Hook;      /* Hook of the register (or NULL_PTR)   */
+}Test_Access;
+
+
+/*******************************************************************************
+ *                              Global Variables                               *
+ *******************************************************************************/
+unsigned int g_testChecks   = 0;
+unsigned int g_testFailures = 0;
+
+/* Peripherals (APB/AHB, System Control, uDMA) and core (DWT, NVIC, SCB) */
+static const Test_Region g_testRegions[] = {
+    {0x40000000U, 0x00100000U},
+    {0xE0000000U, 0x00010000U}
+};
+
+static Test_Hook g_testHooks[TEST_MAX_HOOKS];
+static uint32 g_testHookCount = 0;
+
+/* Pages closed because they hold a hooked register (index: page address / page size) */
+static uint8 g_testPageClosed[0x100000U];
+
+static Test_Access g_testAccess;
+
+/* Instruction counting (every instruction of the test thread traps while it is on) */
+static volatile uint8 g_testCounting = FALSE;
+static volatile uint32 g_testSteps = 0;
+
+/* Nesting depth of the drivers critical sections (0: IRQs enabled) */
+static uint32 g_testCriticalDepth = 0;
+
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+static uint8 Test_IsMapped(uint32 Address)
+{
+    uint32 iteration = 0;
+
+    for(iteration = 0; iteration < (sizeof(g_testRegions) / sizeof(g_testRegions[0])); iteration++)
+    {
+        if( (Address >= g_testRegions[iteration].Base) &&
+            (Address - g_testRegions[iteration].Base < g_testRegions[iteration].Size) )
+        {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+static void Test_PageSet(uint32 Address, uint8 Closed)
+{
+    uint32 Page = Address & ~(TEST_PAGE_SIZE - 1U);
+
+    (void)mprotect((void*)(uintptr_t)Page, TEST_PAGE_SIZE, (Closed == TRUE) ? PROT_NONE : (PROT_READ | PROT_WRITE));
+    g_testPageClosed[Page / TEST_PAGE_SIZE] = Closed;
+}
+
+static const Test_Hook* Test_HookFind(uint32 Address)
+{
+    uint32 iteration = 0;
+
+    for(iteration = 0; iteration < g_testHookCount; iteration++)
+    {
+        if(g_testHooks[iteration].Address == Address)
+        {
+            return &g_testHooks[iteration];
+        }
+    }
+    return NULL_PTR;
+}
+
+static void Test_FaultHandler(int Signal, siginfo_t* Info, void* Context)
+{
+    ucontext_t* Frame   = (ucontext_t*)Context;
+    uintptr_t   Address = (uintptr_t)Info->si_addr;
+
+    (void)Signal;
+
+    if( (Address > 0xFFFFFFFFU) || (Test_IsMapped((uint32)Address) == FALSE) ||
+        (g_testPageClosed[(uint32)Address / TEST_PAGE_SIZE] == FALSE) )
+    {
+        /* Real crash: fault again with the default action */
+        (void)signal(SIGSEGV, SIG_DFL);
+        return;
+    }
+
+    g_testAccess.Active  = TRUE;
+    g_testAccess.Address = (uint32)Address & ~3U;
+    g_testAccess.Write   = ((Frame->uc_mcontext.gregs[REG_ERR] & TEST_FAULT_WRITE) != 0) ? TRUE : FALSE;
+    g_testAccess.Hook    = Test_HookFind(g_testAccess.Address);
+
+    Test_PageSet(g_testAccess.Address, FALSE);
+
+    if( (g_testAccess.Write == FALSE) && (g_testAccess.Hook != NULL_PTR) && (g_testAccess.Hook->Read != NULL_PTR) )
+    {
+        *(volatile uint32*)(uintptr_t)g_testAccess.Address =
+                (*g_testAccess.Hook->Read)(g_testAccess.Address, *(volatile uint32*)(uintptr_t)g_testAccess.Address);
+    }
+
+    /* Run the faulting instruction alone */
+    Frame->uc_mcontext.gregs[REG_EFL] |= TEST_EFLAGS_TRAP;
+}
+
+static void Test_StepHandler(int Signal, siginfo_t* Info, void* Context)
+{
+    ucontext_t* Frame = (ucontext_t*)Context;
+
+    (void)Signal;
+    (void)Info;
+
+    if(g_testCounting == TRUE)
+    {
+        g_testSteps++;
+    }
+
+    if(g_testAccess.Active == FALSE)
+    {
+        if(g_testCounting == FALSE)
+        {
+            (void)signal(SIGTRAP, SIG_DFL);
+        }
+        return;
+    }
+
+    if(g_testCounting == FALSE)
+    {
+        Frame->uc_mcontext.gregs[REG_EFL] &= ~(greg_t)TEST_EFLAGS_TRAP;
+    }
+    g_testAccess.Active = FALSE;
+
+    if( (g_testAccess.Write == TRUE) && (g_testAccess.Hook != NULL_PTR) && (g_testAccess.Hook->Write != NULL_PTR) )
+    {
+        (*g_testAccess.Hook->Write)(g_testAccess.Address, *(volatile uint32*)(uintptr_t)g_testAccess.Address);
+    }
+
+    Test_PageSet(g_testAccess.Address, TRUE);
+}
+
+
+/*******************************************************************************
+ *                      Public Functions Definitions                           *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * @fn              void Test_RegsInit(void)
+ * @brief           Function to map the register address spaces and install
+ *                  the access trap handlers (once per test program)
+ *******************************************************************************/
+void Test_RegsInit(void)
+{
+    struct sigaction Action;
+    uint32 iteration = 0;
+
+    for(iteration = 0; iteration < (sizeof(g_testRegions) / sizeof(g_testRegions[0])); iteration++)
+    {
+        if(mmap((void*)(uintptr_t)g_testRegions[iteration].Base, g_testRegions[iteration].Size,
+                PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0) !=
+           (void*)(uintptr_t)g_testRegions[iteration].Base)
+        {
+            printf("Can't map registers at 0x%08X\n", g_testRegions[iteration].Base);
+            exit(2);
+        }
+    }
+
+    memset(&Action, 0, sizeof(Action));
+    Action.sa_flags = SA_SIGINFO;
+
+    Action.sa_sigaction = Test_FaultHandler;
+    (void)sigaction(SIGSEGV, &Action, NULL);
+
+    Action.sa_sigaction = Test_StepHandler;
+    (void)sigaction(SIGTRAP, &Action, NULL);
+}
+
+/*******************************************************************************
+ * @fn              void Test_RegsReset(void)
+ * @brief           Function to remove all hooks and clear all registers
+ *******************************************************************************/
+void Test_RegsReset(void)
+{
+    uint32 iteration = 0;
+
+    for(iteration = 0; iteration < g_testHookCount; iteration++)
+    {
+        Test_PageSet(g_testHooks[iteration].Address, FALSE);
+    }
+    g_testHookCount     = 0;
+    g_testCriticalDepth = 0;
+
+    for(iteration = 0; iteration < (sizeof(g_testRegions) / sizeof(g_testRegions[0])); iteration++)
+    {
+        memset((void*)(uintptr_t)g_testRegions[iteration].Base, 0, g_testRegions[iteration].Size);
+    }
+}
+
+/*******************************************************************************
+ * @fn              void Test_RegHook(uint32 Address, uint32 (*Read)(uint32 Address, uint32 Value),
+ *                                    void (*Write)(uint32 Address, uint32 Value))
+ * @brief           Function to attach a model to a register
+ * @param (in):     Address - Register address
+ *                  Read    - Returns the value read by the driver, Value is the
+ *                            stored one (can be NULL_PTR)
+ *                  Write   - Called after the driver wrote Value (can be NULL_PTR)
+ *                  Hooks are called from the trap handlers, they MUST access
+ *                  registers only using Test_RegGet()/Test_RegSet()
+ *******************************************************************************/
+void Test_RegHook(uint32 Address, uint32 (*Read)(uint32 Address, uint32 Value),
+                  void (*Write)(uint32 Address, uint32 Value))
+{
+    if( (g_testHookCount >= TEST_MAX_HOOKS) || (Test_IsMapped(Address) == FALSE) )
+    {
+        printf("Can't hook register 0x%08X\n", Address);
+        exit(2);
+    }
+
+    g_testHooks[g_testHookCount].Address = Address & ~3U;
+    g_testHooks[g_testHookCount].Read    = Read;
+    g_testHooks[g_testHookCount].Write   = Write;
+    g_testHookCount++;
+
+    Test_PageSet(Address, TRUE);
+}
+
+/*******************************************************************************
+ * @fn              uint32 Test_RegGet(uint32 Address)
+ * @brief           Function to read a register without calling its hook
+ *******************************************************************************/
+uint32 Test_RegGet(uint32 Address)
+{
+    uint8 Closed = g_testPageClosed[Address / TEST_PAGE_SIZE];
+    uint32 Value = 0;
+
+    if(Closed == TRUE)
+    {
+        Test_PageSet(Address, FALSE);
+    }
+    Value = *(volatile uint32*)(uintptr_t)Address;
+    if(Closed == TRUE)
+    {
+        Test_PageSet(Address, TRUE);
+    }
+    return Value;
+}
+
+/*******************************************************************************
+ * @fn              void Test_RegSet(uint32 Address, uint32 Value)
+ * @brief           Function to write a register without calling its hook
+ *******************************************************************************/
+void Test_RegSet(uint32 Address, uint32 Value)
+{
+    uint8 Closed = g_testPageClosed[Address / TEST_PAGE_SIZE];
+
+    if(Closed == TRUE)
+    {
+        Test_PageSet(Address, FALSE);
+    }
+    *(volatile uint32*)(uintptr_t)Address = Value;
+    if(Closed == TRUE)
+    {
+        Test_PageSet(Address, TRUE);
+    }
+}
+
+/*******************************************************************************
+ * @fn              void Test_CountStart(void)
+ * @brief           Function to start counting the executed (host) instructions
+ *                  by single stepping the test thread
+ *******************************************************************************/
+void Test_CountStart(void)
+{
+    g_testSteps    = 0;
+    g_testCounting = TRUE;
+    __asm__ volatile ("pushfq\n\torq $0x100, (%%rsp)\n\tpopfq" : : : "memory", "cc");
+}
+
+/*******************************************************************************
+ * @fn              uint32 Test_CountStop(void)
+ * @brief           Function to stop counting the executed instructions
+ * @return          Instructions executed since Test_CountStart(), including a
+ *                  constant overhead of both calls (see Test_CountOverhead())
+ *******************************************************************************/
+uint32 Test_CountStop(void)
+{
+    __asm__ volatile ("pushfq\n\tandq $~0x100, (%%rsp)\n\tpopfq" : : : "memory", "cc");
+    g_testCounting = FALSE;
+    return g_testSteps;
+}
+
+/*******************************************************************************
+ * @fn              uint32 Test_CountOverhead(void)
+ * @brief           Function to measure the count of an empty interval
+ *******************************************************************************/
+uint32 Test_CountOverhead(void)
+{
+    Test_CountStart();
+    return Test_CountStop();
+}
+
+/*******************************************************************************
+ * @fn              uint32 Test_EnterCritical(void)
+ * @brief           Function to mask the (simulated) IRQs, like the PRIMASK save
+ *                  and "cpsid i" of the target
+ * @return          Key to give back to Test_ExitCritical()
+ *******************************************************************************/
+uint32 Test_EnterCritical(void)
+{
+    return g_testCriticalDepth++;
+}
+
+/*******************************************************************************
+ * @fn              void Test_ExitCritical(uint32 Key)
+ * @brief           Function to restore the IRQs state saved by Test_EnterCritical()
+ *******************************************************************************/
+void Test_ExitCritical(uint32 Key)
+{
+    g_testCriticalDepth = Key;
+}
+
+/*******************************************************************************
+ * @fn              uint32 Test_CriticalDepth(void)
+ * @brief           Function to get the nesting depth of the critical sections
+ * @return          0 if the (simulated) IRQs are enabled
+ *******************************************************************************/
+uint32 Test_CriticalDepth(void)
+{
+    return g_testCriticalDepth;
+}
+
+/*******************************************************************************
+ * @fn              int Test_Summary(const char* Name)
+ * @brief           Function to print the result of a test program
+ * @return          Exit code of the test program (0 if all checks passed)
+ *******************************************************************************/
+int Test_Summary(const char* Name)
+{
+    printf("%s: %u checks, %u failures\n", Name, g_testChecks, g_testFailures);
+    return (g_testFailures == 0) ? 0 : 1;
+}
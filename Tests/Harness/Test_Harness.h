@@ -0,0 +1,87 @@
+/********************************************************************************
+ * @headerfile    Test_Harness.h
+ * @brief         Header file for the host test harness of TM4C123GH6PM drivers
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ * @note          Each test includes the driver source file (so private functions
+ *                and state can be checked) and runs it on a Linux x86-64 host:
+ *                - Peripheral (0x40000000) and core (0xE0000000) address spaces
+ *                  are mapped as plain memory at their real addresses
+ *                - A register can get read/write hooks (a peripheral model), then
+ *                  every access of its page traps to the model, so FIFOs, flags
+ *                  and write-1-to-clear registers behave like the hardware
+ *                - Host instructions of a code section can be counted (single
+ *                  step), to compare the cost of two implementations
+ *******************************************************************************/
+
+#ifndef TESTS_HARNESS_TEST_HARNESS_H_
+#define TESTS_HARNESS_TEST_HARNESS_H_
+
+#include <stdio.h>
+#include <string.h>
+#include "std_types.h"
+
+
+/*******************************************************************************
+ *                                  Defines                                    *
+ *******************************************************************************/
+/* Check a condition, the test goes on if it fails */
+#define TEST_ASSERT(COND)                                                           \
+    do{                                                                             \
+        g_testChecks++;                                                             \
+        if(!(COND))                                                                 \
+        {                                                                           \
+            g_testFailures++;                                                       \
+            printf("    FAIL %s:%d: %s\n", __FILE__, __LINE__, #COND);              \
+        }                                                                           \
+    }while(0)
+
+/* Check that two integer values are equal, both are printed if they are not */
+#define TEST_ASSERT_EQ(EXPECTED, ACTUAL)                                            \
+    do{                                                                             \
+        long long Expected_ = (long long)(EXPECTED);                                \
+        long long Actual_   = (long long)(ACTUAL);                                  \
+        g_testChecks++;                                                             \
+        if(Expected_ != Actual_)                                                    \
+        {                                                                           \
+            g_testFailures++;                                                       \
+            printf("    FAIL %s:%d: %s == %s (expected %lld, got %lld)\n",          \
+                   __FILE__, __LINE__, #EXPECTED, #ACTUAL, Expected_, Actual_);     \
+        }                                                                           \
+    }while(0)
+
+/* Run one test case on zeroed registers without hooks */
+#define TEST_RUN(FUNC)                                                              \
+    do{                                                                             \
+        Test_RegsReset();                                                           \
+        printf("  %s\n", #FUNC);                                                    \
+        FUNC();                                                                     \
+    }while(0)
+
+/* Access to a register from the test itself (hooks are not called) */
+#define TEST_REG(ADDRESS)               Test_RegGet((uint32)(ADDRESS))
+
+
+/*******************************************************************************
+ *                              Global Variables                               *
+ *******************************************************************************/
+extern unsigned int g_testChecks;
+extern unsigned int g_testFailures;
+
+
+/*******************************************************************************
+ *                              Functions Prototypes                           *
+ *******************************************************************************/
+void Test_RegsInit(void);
+void Test_RegsReset(void);
+void Test_RegHook(uint32 Address, uint32 (*Read)(uint32 Address, uint32 Value),
+                  void (*Write)(uint32 Address, uint32 Value));
+uint32 Test_RegGet(uint32 Address);
+void Test_RegSet(uint32 Address, uint32 Value);
+void Test_CountStart(void);
+uint32 Test_CountStop(void);
+uint32 Test_CountOverhead(void);
+int Test_Summary(const char* Name);
+
+#endif /* TESTS_HARNESS_TEST_HARNESS_H_ */
@@ -0,0 +1,178 @@
+/********************************************************************************
+ * @file          Udma_Fake.c
+ * @brief         Source file for the uDMA driver fake of the host tests
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ *******************************************************************************/
+
+/********************************************************************************
+ *                                Includes Needed                               *
+ *******************************************************************************/
+#include <string.h>
+#include "Udma_Fake.h"
+#include "UDMA_Reg.h"
+#include "UDMA_Priv.h"
+#include "Test_Harness.h"
+
+
+/*******************************************************************************
+ *                              Global Variables                               *
+ *******************************************************************************/
+Fake_UdmaChannel g_fakeUdma[UDMA_NUMBER_OF_CHANNELS];
+
+
+/*******************************************************************************
+ *                      Fake Functions (UDMA_Init.h API)                       *
+ *******************************************************************************/
+void Udma_Init(void)
+{
+    Fake_UdmaReset();
+}
+
+uint8 Udma_ChannelAssign(uint8 Channel, uint8 Encoding)
+{
+    uint32 Map   = 0;
+    uint8 Shift  = 0;
+
+    if(Channel >= UDMA_NUMBER_OF_CHANNELS)
+    {
+        return RET_NOT_OK;
+    }
+    g_fakeUdma[Channel].Encoding = Encoding;
+    g_fakeUdma[Channel].Assigned = TRUE;
+
+    /* DMACHMAPn field of the channel, as the driver writes it */
+    Map   = UDMA_BASE_ADDRESS + UDMA_CHMAP0_REG_OFFSET + ((Channel / CHMAP_CHANNELS_PER_REG) * 4U);
+    Shift = (Channel % CHMAP_CHANNELS_PER_REG) * CHMAP_BITS_PER_CHANNEL;
+    Test_RegSet(Map, (Test_RegGet(Map) & ~(CHMAP_CHANNEL_MASK << Shift)) | (((uint32)Encoding & CHMAP_CHANNEL_MASK) << Shift));
+    return RET_OK;
+}
+
+uint8 Udma_ChannelTransferSet(uint8 Channel, const volatile void* SrcEnd, volatile void* DstEnd, uint32 Control)
+{
+    if(Channel >= UDMA_NUMBER_OF_CHANNELS)
+    {
+        return RET_NOT_OK;
+    }
+    g_fakeUdma[Channel].Primary.SrcEnd  = SrcEnd;
+    g_fakeUdma[Channel].Primary.DstEnd  = DstEnd;
+    g_fakeUdma[Channel].Primary.Control = Control;
+    g_fakeUdma[Channel].Sets++;
+    return RET_OK;
+}
+
+void Udma_ChannelEnable(uint8 Channel)
+{
+    g_fakeUdma[Channel].Enabled = TRUE;
+}
+
+void Udma_ChannelDisable(uint8 Channel)
+{
+    g_fakeUdma[Channel].Enabled = FALSE;
+}
+
+uint8 Udma_ChannelIsEnabled(uint8 Channel)
+{
+    return g_fakeUdma[Channel].Enabled;
+}
+
+#if defined(UDMA_MODE_PER_SCATTER_GATHER)
+/* uDMA driver with Alternate structures and scatter-gather (Ssi_Task) */
+uint8 Udma_ChannelAlternateTransferSet(uint8 Channel, const volatile void* SrcEnd, volatile void* DstEnd, uint32 Control)
+{
+    if(Channel >= UDMA_NUMBER_OF_CHANNELS)
+    {
+        return RET_NOT_OK;
+    }
+    g_fakeUdma[Channel].Alternate.SrcEnd  = SrcEnd;
+    g_fakeUdma[Channel].Alternate.DstEnd  = DstEnd;
+    g_fakeUdma[Channel].Alternate.Control = Control;
+    g_fakeUdma[Channel].Sets++;
+    return RET_OK;
+}
+
+uint32 Udma_ChannelModeGet(uint8 Channel, uint8 Alternate)
+{
+    if(Channel >= UDMA_NUMBER_OF_CHANNELS)
+    {
+        return UDMA_MODE_STOP;
+    }
+    return ((Alternate == TRUE) ? g_fakeUdma[Channel].Alternate.Control : g_fakeUdma[Channel].Primary.Control) & 0x7U;
+}
+
+void Udma_TaskSet(Udma_Task* Task, const volatile void* SrcEnd, volatile void* DstEnd, uint32 Control)
+{
+    /* Host pointers don't fit the 32 bits task words, the tests check the control words */
+    Task->SrcEnd   = (uint32)(unsigned long)SrcEnd;
+    Task->DstEnd   = (uint32)(unsigned long)DstEnd;
+    Task->Control  = Control;
+    Task->Reserved = 0;
+}
+
+uint8 Udma_ChannelScatterGatherSet(uint8 Channel, const Udma_Task* TaskList, uint32 TaskCount, uint8 Peripheral)
+{
+    if( (Channel >= UDMA_NUMBER_OF_CHANNELS) || (NULL_PTR == TaskList) ||
+        (0 == TaskCount) || (TaskCount > UDMA_MAX_TASKS) )
+    {
+        return RET_NOT_OK;
+    }
+    g_fakeUdma[Channel].Tasks      = TaskList;
+    g_fakeUdma[Channel].TaskCount  = TaskCount;
+    g_fakeUdma[Channel].Peripheral = Peripheral;
+    g_fakeUdma[Channel].Primary.Control = (Peripheral == TRUE) ? UDMA_MODE_PER_SCATTER_GATHER : UDMA_MODE_MEM_SCATTER_GATHER;
+    g_fakeUdma[Channel].Sets++;
+    return RET_OK;
+}
+#endif
+
+uint8 Udma_ChannelDone(uint8 Channel)
+{
+    if(g_fakeUdma[Channel].Done == TRUE)
+    {
+        g_fakeUdma[Channel].Done = FALSE;
+        return TRUE;
+    }
+    return FALSE;
+}
+
+
+/*******************************************************************************
+ *                              Test Functions                                 *
+ *******************************************************************************/
+
+/* Forget all channels */
+void Fake_UdmaReset(void)
+{
+    memset(g_fakeUdma, 0, sizeof(g_fakeUdma));
+}
+
+/* The running transfer of a channel is done (channel disabled, completion raised) */
+void Fake_UdmaComplete(uint8 Channel)
+{
+    g_fakeUdma[Channel].Primary.Control &= ~(uint32)0x7U;
+    g_fakeUdma[Channel].Enabled = FALSE;
+    g_fakeUdma[Channel].Done    = TRUE;
+}
+
+#if defined(UDMA_MODE_PER_SCATTER_GATHER)
+/* One ping-pong structure is done, the channel stops when the other one isn't armed */
+void Fake_UdmaHalfComplete(uint8 Channel, uint8 Alternate)
+{
+    Fake_UdmaStruct* Done  = (Alternate == TRUE) ? &g_fakeUdma[Channel].Alternate : &g_fakeUdma[Channel].Primary;
+    Fake_UdmaStruct* Other = (Alternate == TRUE) ? &g_fakeUdma[Channel].Primary : &g_fakeUdma[Channel].Alternate;
+
+    Done->Control &= ~(uint32)0x7U;
+    if( (Other->Control & 0x7U) == UDMA_MODE_STOP )
+    {
+        g_fakeUdma[Channel].Enabled = FALSE;
+    }
+    g_fakeUdma[Channel].Done = TRUE;
+}
+#endif
+
+/* Number of items of a control word */
+uint32 Fake_UdmaItems(uint32 Control)
+{
+    return ((Control >> 4) & 0x3FFU) + 1U;
+}
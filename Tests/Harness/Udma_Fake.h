@@ -0,0 +1,60 @@
+/********************************************************************************
+ * @headerfile    Udma_Fake.h
+ * @brief         Header file for the uDMA driver fake of the host tests
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ * @note          It implements UDMA_Init.h API without hardware: the channel
+ *                control structures are recorded (with full host pointers),
+ *                channel encodings are written to DMACHMAPn and the test ends
+ *                a transfer by Fake_UdmaComplete()
+ *******************************************************************************/
+
+#ifndef TESTS_HARNESS_UDMA_FAKE_H_
+#define TESTS_HARNESS_UDMA_FAKE_H_
+
+#include "UDMA_Init.h"
+
+
+/*******************************************************************************
+ *                              User Defined Data Types                        *
+ *******************************************************************************/
+typedef struct{
+    const volatile void*    SrcEnd;         /* Last source item of the structure        */
+    volatile void*          DstEnd;         /* Last destination item of the structure   */
+    uint32                  Control;        /* Control word                             */
+}Fake_UdmaStruct;
+
+typedef struct{
+    Fake_UdmaStruct Primary;
+    Fake_UdmaStruct Alternate;
+    uint8           Encoding;       /* Encoding given by Udma_ChannelAssign()   */
+    uint8           Assigned;       /* Udma_ChannelAssign() was called          */
+    uint8           Enabled;        /* Channel is transferring                  */
+    uint8           Done;           /* Completion not read by Udma_ChannelDone  */
+    uint32          Sets;           /* Number of structure updates              */
+#if defined(UDMA_MODE_PER_SCATTER_GATHER)
+    const Udma_Task* Tasks;         /* Scatter-gather task list                 */
+    uint32          TaskCount;
+    uint8           Peripheral;     /* Peripheral scatter-gather                */
+#endif
+}Fake_UdmaChannel;
+
+
+/*******************************************************************************
+ *                              Global Variables                               *
+ *******************************************************************************/
+extern Fake_UdmaChannel g_fakeUdma[UDMA_NUMBER_OF_CHANNELS];
+
+
+/*******************************************************************************
+ *                              Functions Prototypes                           *
+ *******************************************************************************/
+void Fake_UdmaReset(void);
+void Fake_UdmaComplete(uint8 Channel);
+#if defined(UDMA_MODE_PER_SCATTER_GATHER)
+void Fake_UdmaHalfComplete(uint8 Channel, uint8 Alternate);
+#endif
+uint32 Fake_UdmaItems(uint32 Control);
+
+#endif /* TESTS_HARNESS_UDMA_FAKE_H_ */
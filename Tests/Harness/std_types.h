@@ -0,0 +1,50 @@
+ /******************************************************************************
+ *
+ * Module: Common - Platform Types Abstraction (Host tests)
+ *
+ * File Name: std_types.h
+ *
+ * Description: Same types as Drivers/STD_and_Math/std_types.h, but with 32 bits
+ *              uint32/sint32 on 64 bits hosts ("long" is 64 bits there), so the
+ *              drivers access 32 bits registers and keep their structures layout
+ *              It is found first by the host tests include path
+ *
+ * Author: Islam Ehab
+ *
+ *******************************************************************************/
+
+#ifndef STD_TYPES_H_
+#define STD_TYPES_H_
+
+/* Boolean Data Type */
+typedef unsigned char bool;
+
+/* Boolean Values */
+#ifndef FALSE
+#define FALSE       (0u)
+#endif
+#ifndef TRUE
+#define TRUE        (1u)
+#endif
+
+#define HIGH        (1u)
+#define LOW         (0u)
+
+
+#define NULL_PTR    ((void*)0)
+
+typedef unsigned char         uint8;          /*           0 .. 255             */
+typedef signed char           sint8;          /*        -128 .. +127            */
+typedef unsigned short        uint16;         /*           0 .. 65535           */
+typedef signed short          sint16;         /*      -32768 .. +32767          */
+typedef unsigned int          uint32;         /*           0 .. 4294967295      */
+typedef signed int            sint32;         /* -2147483648 .. +2147483647     */
+typedef unsigned long long    uint64;         /*       0..18446744073709551615  */
+typedef signed long long      sint64;
+typedef float                 float32;
+typedef double                float64;
+
+#define RET_OK                ((uint8) 0x0U)
+#define RET_NOT_OK            ((uint8) 0x1U)
+
+#endif /* STD_TYPE_H_ */
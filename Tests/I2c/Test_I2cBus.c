@@ -0,0 +1,321 @@
+/********************************************************************************
+ * @file          Test_I2cBus.c
+ * @brief         Host tests of I2C bus manager: priority order of queued
+ *                transactions (submit order within a priority), transaction
+ *                kept queued while another master owns the bus, and queue held
+ *                after a clock timeout until I2cBus_Service() clears the bus
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ *******************************************************************************/
+
+#include "I2C_Prog.c"
+#include "I2CBUS_Prog.c"
+#include "Test_Harness.h"
+
+
+/* Registers of the I2C instance under test (I2C1, pins PA6 SCL and PA7 SDA) */
+#define TEST_I2C_MCS                (I2C_1_BASE_ADDRESS + I2C_MCS_REG_OFFSET)
+#define TEST_I2C_MSA                (I2C_1_BASE_ADDRESS + I2C_MSA_REG_OFFSET)
+#define TEST_I2C_MMIS               (I2C_1_BASE_ADDRESS + I2C_MMIS_REG_OFFSET)
+#define TEST_I2C_MBMON              (I2C_1_BASE_ADDRESS + I2C_MBMON_REG_OFFSET)
+#define TEST_GPIO_AFSEL             (I2C_1_GPIO_BASE_ADDRESS + I2C_GPIO_AFSEL_REG_OFFSET)
+#define TEST_I2C_PINS               ( (1U << 6) | (1U << 7) )
+
+/* MCS commands kept by the model */
+#define TEST_MAX_COMMANDS           (16U)
+
+/* Devices and transactions used by the tests */
+#define TEST_DEVICES                (4U)
+#define TEST_TRANSACTIONS           (I2CBUS_QUEUE_DEPTH + 2U)
+
+/* Slave address of device x, and its MSA value in a write */
+#define TEST_DEVICE_ADDRESS(x)      ( (uint8)(0x50U + (x)) )
+#define TEST_DEVICE_MSA(x)          ( (uint32)TEST_DEVICE_ADDRESS(x) << 1 )
+
+static I2c_Config g_config;
+
+static uint8 g_devices[TEST_DEVICES];
+static I2cBus_Transaction g_transactions[TEST_TRANSACTIONS];
+static const uint8 g_tx[1] = {0x5A};
+
+/* MCS model: status read by the driver, commands written by it with MSA and
+ * critical section depth at that time */
+static uint32 g_mcsStatus;
+static uint32 g_mcsAddress[TEST_MAX_COMMANDS];
+static uint32 g_mcsDepth[TEST_MAX_COMMANDS];
+static uint32 g_mcsCommandCount;
+
+/* Transaction call back results */
+static uint8 g_doneStatus;
+static uint32 g_doneCount;
+
+static uint32 Test_McsRead(uint32 Address, uint32 Value)
+{
+    return g_mcsStatus;
+}
+
+static void Test_McsWrite(uint32 Address, uint32 Value)
+{
+    if(g_mcsCommandCount < TEST_MAX_COMMANDS)
+    {
+        g_mcsAddress[g_mcsCommandCount] = TEST_REG(TEST_I2C_MSA);
+        g_mcsDepth[g_mcsCommandCount]   = Test_CriticalDepth();
+    }
+    g_mcsCommandCount++;
+}
+
+static void Test_Done(uint8 Status)
+{
+    g_doneStatus = Status;
+    g_doneCount++;
+}
+
+static void Test_BusSetUp(void)
+{
+    uint8 Device = 0;
+
+    memset(&g_config, 0, sizeof(g_config));
+    g_config.I2cNum   = I2c1;
+    g_config.I2cMode  = I2C_MODE_MASTER;
+    g_config.ClkValue = 80000000U;
+    g_config.I2cFreq  = I2C_FREQ_STANDARD;
+
+    memset(g_i2cItTransfer, 0, sizeof(g_i2cItTransfer));
+    memset(g_i2cBuses, 0, sizeof(g_i2cBuses));
+    memset(g_transactions, 0, sizeof(g_transactions));
+    g_i2cBusDeviceCount = 0;
+    g_mcsStatus         = 0;
+    g_mcsCommandCount   = 0;
+    g_doneStatus        = I2C_STATUS_PENDING;
+    g_doneCount         = 0;
+
+    TEST_ASSERT_EQ(RET_OK, I2cBus_Init(&g_config));
+    Test_RegHook(TEST_I2C_MCS, Test_McsRead, Test_McsWrite);
+
+    for(Device = 0; Device < TEST_DEVICES; Device++)
+    {
+        g_devices[Device] = I2cBus_AddDevice(I2c1, TEST_DEVICE_ADDRESS(Device));
+        TEST_ASSERT_EQ(Device, g_devices[Device]);
+    }
+}
+
+/* Transaction Index: one byte written to Device with Priority */
+static uint8 Test_Submit(uint8 Index, uint8 Device, uint8 Priority)
+{
+    g_transactions[Index].Device   = g_devices[Device];
+    g_transactions[Index].Priority = Priority;
+    g_transactions[Index].TxBuffer = g_tx;
+    g_transactions[Index].TxLength = sizeof(g_tx);
+    g_transactions[Index].CallBack = Test_Done;
+
+    return I2cBus_Submit(&g_transactions[Index]);
+}
+
+/* Master interrupt (MMIS bits) with the given MCS status */
+static void Test_RunIsr(uint32 Mmis, uint32 Mcs)
+{
+    g_mcsStatus = Mcs;
+    Test_RegSet(TEST_I2C_MMIS, Mmis);
+    I2C1_ISR();
+    Test_RegSet(TEST_I2C_MMIS, 0);
+    g_mcsStatus = 0;
+}
+
+/* Only byte (sent with STOP) of the running transaction is done */
+static void Test_CompleteCurrent(void)
+{
+    Test_RunIsr((1U << MMIS_REG_MIS_POS), (1U << MCR_REG_IDLE_POS));
+}
+
+/* Transfers started so far went to Devices, in this order */
+static void Test_AssertStartOrder(const uint8* Devices, uint32 Count)
+{
+    uint32 iteration = 0;
+
+    TEST_ASSERT_EQ(Count, g_mcsCommandCount);
+    for(iteration = 0; (iteration < Count) && (iteration < TEST_MAX_COMMANDS); iteration++)
+    {
+        TEST_ASSERT_EQ(TEST_DEVICE_MSA(Devices[iteration]), g_mcsAddress[iteration]);
+    }
+}
+
+static void Test_HigherPriorityRunsFirst(void)
+{
+    const uint8 Order[4] = {0, 2, 3, 1};
+    uint8 iteration = 0;
+
+    Test_BusSetUp();
+
+    /* Idle bus: the first transaction starts at once, with IRQs enabled */
+    TEST_ASSERT_EQ(RET_OK, Test_Submit(0, 0, I2CBUS_PRIORITY_LOW));
+    TEST_ASSERT_EQ(1, g_mcsCommandCount);
+    TEST_ASSERT_EQ(0, g_mcsDepth[0]);
+    TEST_ASSERT_EQ(0, Test_CriticalDepth());
+
+    /* Queued behind the running one, by priority */
+    TEST_ASSERT_EQ(RET_OK, Test_Submit(1, 1, I2CBUS_PRIORITY_LOW));
+    TEST_ASSERT_EQ(RET_OK, Test_Submit(2, 2, I2CBUS_PRIORITY_HIGH));
+    TEST_ASSERT_EQ(RET_OK, Test_Submit(3, 3, I2CBUS_PRIORITY_NORMAL));
+    TEST_ASSERT_EQ(1, g_mcsCommandCount);
+
+    for(iteration = 0; iteration < 4U; iteration++)
+    {
+        TEST_ASSERT_EQ(I2C_STATUS_PENDING, g_transactions[Order[iteration]].Status);
+        Test_CompleteCurrent();
+        TEST_ASSERT_EQ(I2C_STATUS_OK, g_transactions[Order[iteration]].Status);
+    }
+
+    Test_AssertStartOrder(Order, 4);
+    TEST_ASSERT_EQ(4, g_doneCount);
+    TEST_ASSERT_EQ(NULL_PTR, g_i2cBuses[I2c1].Current);
+}
+
+static void Test_SamePriorityRunsInSubmitOrder(void)
+{
+    const uint8 Order[5] = {0, 3, 1, 2, 0};
+    uint8 iteration = 0;
+
+    Test_BusSetUp();
+
+    TEST_ASSERT_EQ(RET_OK, Test_Submit(0, 0, I2CBUS_PRIORITY_NORMAL));
+    TEST_ASSERT_EQ(RET_OK, Test_Submit(1, 1, I2CBUS_PRIORITY_NORMAL));
+    TEST_ASSERT_EQ(RET_OK, Test_Submit(2, 2, I2CBUS_PRIORITY_NORMAL));
+    TEST_ASSERT_EQ(RET_OK, Test_Submit(3, 3, I2CBUS_PRIORITY_HIGH));
+    TEST_ASSERT_EQ(RET_OK, Test_Submit(4, 0, I2CBUS_PRIORITY_NORMAL));
+
+    /* Queued (not done) transaction can't be submitted again */
+    TEST_ASSERT_EQ(RET_NOT_OK, I2cBus_Submit(&g_transactions[1]));
+
+    for(iteration = 0; iteration < 5U; iteration++)
+    {
+        Test_CompleteCurrent();
+    }
+
+    Test_AssertStartOrder(Order, 5);
+    TEST_ASSERT_EQ(5, g_doneCount);
+}
+
+static void Test_FullQueueRefusesSubmit(void)
+{
+    uint8 iteration = 0;
+
+    Test_BusSetUp();
+
+    /* One transaction running, the queue full behind it */
+    for(iteration = 0; iteration <= I2CBUS_QUEUE_DEPTH; iteration++)
+    {
+        TEST_ASSERT_EQ(RET_OK, Test_Submit(iteration, 0, I2CBUS_PRIORITY_NORMAL));
+    }
+    TEST_ASSERT_EQ(RET_NOT_OK, Test_Submit(iteration, 0, I2CBUS_PRIORITY_HIGH));
+    TEST_ASSERT_EQ(I2CBUS_QUEUE_DEPTH, g_i2cBuses[I2c1].Count);
+
+    /* Room again once the running one is done */
+    Test_CompleteCurrent();
+    TEST_ASSERT_EQ(RET_OK, Test_Submit(iteration, 0, I2CBUS_PRIORITY_HIGH));
+}
+
+static void Test_BusyBusKeepsTransactionQueued(void)
+{
+    const uint8 Order[3] = {2, 0, 1};
+    uint8 iteration = 0;
+
+    Test_BusSetUp();
+
+    /* Another master owns the bus: nothing is started, the transaction waits */
+    g_mcsStatus = (1U << MCR_REG_BUSBSY_POS);
+    TEST_ASSERT_EQ(RET_OK, Test_Submit(0, 0, I2CBUS_PRIORITY_NORMAL));
+    TEST_ASSERT_EQ(0, g_mcsCommandCount);
+    TEST_ASSERT_EQ(I2C_STATUS_PENDING, g_transactions[0].Status);
+    TEST_ASSERT_EQ(NULL_PTR, g_i2cBuses[I2c1].Current);
+    TEST_ASSERT_EQ(1, g_i2cBuses[I2c1].Count);
+
+    /* Each submit tries the head again, a failed one stays ahead of the same priority */
+    TEST_ASSERT_EQ(RET_OK, Test_Submit(1, 1, I2CBUS_PRIORITY_NORMAL));
+    TEST_ASSERT_EQ(RET_OK, Test_Submit(2, 2, I2CBUS_PRIORITY_HIGH));
+    TEST_ASSERT_EQ(0, g_mcsCommandCount);
+    TEST_ASSERT_EQ(3, g_i2cBuses[I2c1].Count);
+    TEST_ASSERT_EQ(&g_transactions[2], g_i2cBuses[I2c1].Queue[0]);
+    TEST_ASSERT_EQ(&g_transactions[0], g_i2cBuses[I2c1].Queue[1]);
+    TEST_ASSERT_EQ(&g_transactions[1], g_i2cBuses[I2c1].Queue[2]);
+
+    TEST_ASSERT_EQ(RET_OK, I2cBus_Service(I2c1));
+    TEST_ASSERT_EQ(0, g_mcsCommandCount);
+    TEST_ASSERT_EQ(0, g_doneCount);
+
+    /* Bus is free: I2cBus_Service() restarts the queue, with IRQs enabled */
+    g_mcsStatus = 0;
+    TEST_ASSERT_EQ(RET_OK, I2cBus_Service(I2c1));
+    TEST_ASSERT_EQ(1, g_mcsCommandCount);
+    TEST_ASSERT_EQ(0, g_mcsDepth[0]);
+
+    for(iteration = 0; iteration < 3U; iteration++)
+    {
+        Test_CompleteCurrent();
+    }
+
+    Test_AssertStartOrder(Order, 3);
+    TEST_ASSERT_EQ(3, g_doneCount);
+    TEST_ASSERT_EQ(I2C_STATUS_OK, g_doneStatus);
+}
+
+static void Test_ClockTimeoutHoldsQueueUntilRecovered(void)
+{
+    const uint8 Order[3] = {0, 1, 2};
+
+    Test_BusSetUp();
+
+    /* SCL held low by a slave, pins driven by the I2C module */
+    Test_RegSet(TEST_I2C_MBMON, 0);
+    Test_RegSet(TEST_GPIO_AFSEL, TEST_I2C_PINS);
+
+    TEST_ASSERT_EQ(RET_OK, Test_Submit(0, 0, I2CBUS_PRIORITY_NORMAL));
+    TEST_ASSERT_EQ(RET_OK, Test_Submit(1, 1, I2CBUS_PRIORITY_NORMAL));
+
+    /* Clock timeout: the transaction fails, the next one is held */
+    Test_RunIsr((1U << MMIS_REG_CLKMIS_POS), 0);
+    TEST_ASSERT_EQ(I2C_STATUS_CLOCK_TIMEOUT, g_transactions[0].Status);
+    TEST_ASSERT_EQ(I2C_STATUS_CLOCK_TIMEOUT, g_doneStatus);
+    TEST_ASSERT_EQ(I2C_STATUS_PENDING, g_transactions[1].Status);
+    TEST_ASSERT_EQ(TRUE, g_i2cBuses[I2c1].RecoverPending);
+    TEST_ASSERT_EQ(NULL_PTR, g_i2cBuses[I2c1].Current);
+    TEST_ASSERT_EQ(1, g_mcsCommandCount);
+
+    /* New submits are queued but not started either */
+    TEST_ASSERT_EQ(RET_OK, Test_Submit(2, 2, I2CBUS_PRIORITY_NORMAL));
+    TEST_ASSERT_EQ(1, g_mcsCommandCount);
+    TEST_ASSERT_EQ(2, g_i2cBuses[I2c1].Count);
+
+    /* Lines still low after the bus clear: held, tried again on the next call */
+    TEST_ASSERT_EQ(RET_NOT_OK, I2cBus_Service(I2c1));
+    TEST_ASSERT_EQ(TRUE, g_i2cBuses[I2c1].RecoverPending);
+    TEST_ASSERT_EQ(1, g_mcsCommandCount);
+
+    /* Slave released the bus: the queue goes on */
+    Test_RegSet(TEST_I2C_MBMON, (1U << MBMON_REG_SCL_POS) | (1U << MBMON_REG_SDA_POS));
+    TEST_ASSERT_EQ(RET_OK, I2cBus_Service(I2c1));
+    TEST_ASSERT_EQ(FALSE, g_i2cBuses[I2c1].RecoverPending);
+    TEST_ASSERT_EQ(2, g_mcsCommandCount);
+    TEST_ASSERT_EQ(0, g_mcsDepth[1]);
+
+    Test_CompleteCurrent();
+    Test_CompleteCurrent();
+
+    Test_AssertStartOrder(Order, 3);
+    TEST_ASSERT_EQ(I2C_STATUS_OK, g_transactions[1].Status);
+    TEST_ASSERT_EQ(I2C_STATUS_OK, g_transactions[2].Status);
+    TEST_ASSERT_EQ(3, g_doneCount);
+}
+
+int main(void)
+{
+    Test_RegsInit();
+
+    TEST_RUN(Test_HigherPriorityRunsFirst);
+    TEST_RUN(Test_SamePriorityRunsInSubmitOrder);
+    TEST_RUN(Test_FullQueueRefusesSubmit);
+    TEST_RUN(Test_BusyBusKeepsTransactionQueued);
+    TEST_RUN(Test_ClockTimeoutHoldsQueueUntilRecovered);
+
+    return Test_Summary("Test_I2cBus");
+}
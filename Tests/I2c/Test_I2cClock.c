@@ -0,0 +1,198 @@
+/********************************************************************************
+ * @file          Test_I2cClock.c
+ * @brief         Host tests of I2C timer period solver (brute force sweep of
+ *                every TPR value in Standard, Fast, Fast-mode plus and
+ *                High-speed modes) and of the MTPR value written by I2c_Init
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ *******************************************************************************/
+
+#include "I2C_Prog.c"
+#include "Test_Harness.h"
+
+
+/* System Clocks in one SCL period for (1 + TPR) = 1 */
+#define TEST_UNIT_NORMAL            (2U * (SCL_LP_NORMAL + SCL_HP_NORMAL))
+#define TEST_UNIT_HIGH_SPEED        (2U * (SCL_LP_HIGH_SPEED + SCL_HP_HIGH_SPEED))
+
+/* System Clocks of the sweep (PIOSC, crystals and PLL outputs) */
+static const uint32 g_clocks[] = {
+    1000000U, 3686400U, 16000000U, 20000000U, 25000000U, 40000000U, 50000000U, 66666666U, 80000000U
+};
+
+/* Upper limit of each speed mode, the sweep covers each range */
+static const uint32 g_modes[] = {
+    I2C_FREQ_STANDARD, I2C_FREQ_FAST, I2C_FREQ_FAST_PLUS, I2C_FREQ_HIGH_SPEED
+};
+
+/* Mismatches printed so far (the first ones are enough) */
+static uint32 g_reported;
+
+/* Brute force result: achieved clock of the smallest (1 + TPR) not exceeding I2cFreq */
+static uint32 Test_ReferenceClock(uint32 ClkValue, uint32 I2cFreq, uint32* TprPlusOne)
+{
+    uint32 Unit = (I2cFreq > I2C_FREQ_FAST_PLUS) ? TEST_UNIT_HIGH_SPEED : TEST_UNIT_NORMAL;
+
+    if( (0 == I2cFreq) || (I2cFreq > I2C_FREQ_HIGH_SPEED) )
+    {
+        return 0;
+    }
+
+    for(*TprPlusOne = MTPR_REG_TPR_MIN + 1U; *TprPlusOne <= (MTPR_REG_TPR_MAX + 1U); (*TprPlusOne)++)
+    {
+        /* Exact SCL clock ClkValue / (Unit * (1 + TPR)) is not above I2cFreq */
+        if( (uint64)ClkValue <= ( (uint64)I2cFreq * Unit * (*TprPlusOne) ) )
+        {
+            return ClkValue / (Unit * (*TprPlusOne));
+        }
+    }
+
+    return 0;
+}
+
+/* Solver result MUST be the brute force one with a valid TPR */
+static uint8 Test_SolveMatches(uint32 ClkValue, uint32 I2cFreq)
+{
+    uint32 Tpr          = 0xFFFFU;
+    uint32 TprPlusOne   = 0;
+    uint32 Expected     = Test_ReferenceClock(ClkValue, I2cFreq, &TprPlusOne);
+    uint32 Achieved     = I2c_SolveClock(ClkValue, I2cFreq, &Tpr);
+
+    if( (Achieved != Expected) || ( (Achieved != 0) && ( (Tpr + 1U) != TprPlusOne ) ) )
+    {
+        if(g_reported++ < 5U)
+        {
+            printf("    %u Hz / %u Hz: got %u Hz (TPR %u), expected %u Hz (TPR %u)\n",
+                   ClkValue, I2cFreq, Achieved, Tpr, Expected, TprPlusOne - 1U);
+        }
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+static void Test_SolverMatchesBruteForce(void)
+{
+    uint32 Clock      = 0;
+    uint32 Mode       = 0;
+    uint32 Unit       = 0;
+    uint32 TprPlusOne = 0;
+    uint32 Freq       = 0;
+    uint32 Failures   = 0;
+
+    for(Clock = 0; Clock < (sizeof(g_clocks) / sizeof(g_clocks[0])); Clock++)
+    {
+        for(Mode = 0; Mode < (sizeof(g_modes) / sizeof(g_modes[0])); Mode++)
+        {
+            Failures = 0;
+            Unit = (g_modes[Mode] > I2C_FREQ_FAST_PLUS) ? TEST_UNIT_HIGH_SPEED : TEST_UNIT_NORMAL;
+
+            /* Every achievable clock of the mode, and just above/below it */
+            for(TprPlusOne = 1U; TprPlusOne <= (MTPR_REG_TPR_MAX + 2U); TprPlusOne++)
+            {
+                Freq = g_clocks[Clock] / (Unit * TprPlusOne);
+                if( (Freq == 0) || (Freq > g_modes[Mode]) )
+                {
+                    continue;
+                }
+                Failures += (Test_SolveMatches(g_clocks[Clock], Freq) == FALSE) ? 1U : 0U;
+                Failures += (Test_SolveMatches(g_clocks[Clock], Freq - 1U) == FALSE) ? 1U : 0U;
+                Failures += (Test_SolveMatches(g_clocks[Clock], Freq + 1U) == FALSE) ? 1U : 0U;
+            }
+
+            /* Requests spread over the mode range, its limit and just above it */
+            for(Freq = 1000U; Freq <= g_modes[Mode]; Freq += (Freq / 7U) + 1U)
+            {
+                Failures += (Test_SolveMatches(g_clocks[Clock], Freq) == FALSE) ? 1U : 0U;
+            }
+            Failures += (Test_SolveMatches(g_clocks[Clock], g_modes[Mode]) == FALSE) ? 1U : 0U;
+            Failures += (Test_SolveMatches(g_clocks[Clock], g_modes[Mode] + 1U) == FALSE) ? 1U : 0U;
+
+            TEST_ASSERT_EQ(0, Failures);
+        }
+    }
+}
+
+static void Test_SolverLimits(void)
+{
+    uint32 Tpr = 0;
+
+    /* 80 MHz: Standard 100 kHz is TPR 39, Fast 400 kHz TPR 9, Fast-mode plus 1 MHz TPR 3 */
+    TEST_ASSERT_EQ(100000U, I2c_SolveClock(80000000U, I2C_FREQ_STANDARD, &Tpr));
+    TEST_ASSERT_EQ(39, Tpr);
+    TEST_ASSERT_EQ(400000U, I2c_SolveClock(80000000U, I2C_FREQ_FAST, &Tpr));
+    TEST_ASSERT_EQ(9, Tpr);
+    TEST_ASSERT_EQ(1000000U, I2c_SolveClock(80000000U, I2C_FREQ_FAST_PLUS, &Tpr));
+    TEST_ASSERT_EQ(3, Tpr);
+
+    /* High-speed 3.4 MHz needs 80 MHz / (6 * 3.4 MHz) = 3.92 -> (1 + TPR) = 4, 3.33 MHz */
+    TEST_ASSERT_EQ(80000000U / (TEST_UNIT_HIGH_SPEED * 4U), I2c_SolveClock(80000000U, I2C_FREQ_HIGH_SPEED, &Tpr));
+    TEST_ASSERT_EQ(3, Tpr);
+
+    /* Just above Fast-mode plus is High-speed (faster period unit) */
+    TEST_ASSERT_EQ(80000000U / (TEST_UNIT_HIGH_SPEED * 14U), I2c_SolveClock(80000000U, I2C_FREQ_FAST_PLUS + 1U, &Tpr));
+    TEST_ASSERT_EQ(13, Tpr);
+
+    /* TPR can't be below 1: slow System Clock gives a slower SCL than requested */
+    TEST_ASSERT_EQ(1000000U / (TEST_UNIT_NORMAL * 2U), I2c_SolveClock(1000000U, I2C_FREQ_FAST_PLUS, &Tpr));
+    TEST_ASSERT_EQ(MTPR_REG_TPR_MIN, Tpr);
+
+    /* Slowest clock is ClkValue / (20 * 128) */
+    TEST_ASSERT_EQ(31250U, I2c_SolveClock(80000000U, 31250U, &Tpr));
+    TEST_ASSERT_EQ(MTPR_REG_TPR_MAX, Tpr);
+    TEST_ASSERT_EQ(0, I2c_SolveClock(80000000U, 31249U, &Tpr));
+
+    TEST_ASSERT_EQ(0, I2c_SolveClock(80000000U, 0, &Tpr));
+    TEST_ASSERT_EQ(0, I2c_SolveClock(80000000U, I2C_FREQ_HIGH_SPEED + 1U, &Tpr));
+    TEST_ASSERT_EQ(0, I2c_SolveClock(0, I2C_FREQ_STANDARD, &Tpr));
+    TEST_ASSERT_EQ(0, I2c_SolveClock(80000000U, I2C_FREQ_STANDARD, NULL_PTR));
+}
+
+static void Test_InitWritesSolvedPeriod(void)
+{
+    I2c_Config Config;
+    volatile uint32* I2c_Ptr = (volatile uint32*)I2C_1_BASE_ADDRESS;
+
+    memset(&Config, 0, sizeof(Config));
+    Config.I2cNum   = I2c1;
+    Config.I2cMode  = I2C_MODE_MASTER;
+    Config.ClkValue = 80000000U;
+
+    /* Fast mode: TPR without HS bit */
+    Config.I2cFreq = I2C_FREQ_FAST;
+    TEST_ASSERT_EQ(RET_OK, I2c_Init(&Config));
+    TEST_ASSERT_EQ(9, TEST_REG((uint8*)I2c_Ptr + I2C_MTPR_REG_OFFSET));
+    TEST_ASSERT_EQ(I2C_FREQ_FAST, I2c_GetFrequency(I2c1));
+
+    /* High-speed mode is refused by a module without HS capability, before the module is touched */
+    Config.I2cFreq = I2C_FREQ_HIGH_SPEED;
+    Test_RegSet((uint32)I2c_Ptr + I2C_MCR_REG_OFFSET, 0);
+    TEST_ASSERT_EQ(RET_NOT_OK, I2c_Init(&Config));
+    TEST_ASSERT_EQ(0, TEST_REG((uint8*)I2c_Ptr + I2C_MCR_REG_OFFSET));
+    TEST_ASSERT_EQ(9, TEST_REG((uint8*)I2c_Ptr + I2C_MTPR_REG_OFFSET));
+
+    *(volatile uint32*)((volatile uint8*)I2c_Ptr + I2C_PP_REG_OFFSET) = (1U << PP_REG_HS_POS);
+    TEST_ASSERT_EQ(RET_OK, I2c_Init(&Config));
+    TEST_ASSERT_EQ( (MTPR_REG_HS_ENABLE << MTPR_REG_HS_POS) | 3U, TEST_REG((uint8*)I2c_Ptr + I2C_MTPR_REG_OFFSET) );
+    TEST_ASSERT_EQ(80000000U / (TEST_UNIT_HIGH_SPEED * 4U), I2c_GetFrequency(I2c1));
+
+    /* Too slow for the System Clock: the enabled module keeps running with its previous settings */
+    Config.I2cFreq = 1000U;
+    Config.I2cMode = I2C_MODE_SLAVE;
+    TEST_ASSERT_EQ(RET_NOT_OK, I2c_Init(&Config));
+    TEST_ASSERT_EQ(I2C_MODE_MASTER, TEST_REG((uint8*)I2c_Ptr + I2C_MCR_REG_OFFSET));
+    TEST_ASSERT_EQ(0, TEST_REG((uint8*)I2c_Ptr + I2C_SCSR_REG_OFFSET));
+    TEST_ASSERT_EQ( (MTPR_REG_HS_ENABLE << MTPR_REG_HS_POS) | 3U, TEST_REG((uint8*)I2c_Ptr + I2C_MTPR_REG_OFFSET) );
+}
+
+int main(void)
+{
+    Test_RegsInit();
+
+    TEST_RUN(Test_SolverMatchesBruteForce);
+    TEST_RUN(Test_SolverLimits);
+    TEST_RUN(Test_InitWritesSolvedPeriod);
+
+    return Test_Summary("Test_I2cClock");
+}
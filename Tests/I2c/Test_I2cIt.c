@@ -0,0 +1,227 @@
+/********************************************************************************
+ * @file          Test_I2cIt.c
+ * @brief         Host tests of I2C interrupt driven master error paths (clock
+ *                timeout, address and data NACK with or without STOP already
+ *                sent) and of I2C0_ISR..I2C3_ISR each serving its own instance
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ *******************************************************************************/
+
+#include "I2C_Prog.c"
+#include "Test_Harness.h"
+
+
+/* START and RUN of the first byte of a write phase */
+#define TEST_START_COMMAND          ( (MCR_REG_START_ENABLE << MCR_REG_START_POS) | (MCR_REG_RUN_ENABLE << MCR_REG_RUN_POS) )
+
+/* STOP alone (bus released after an error) */
+#define TEST_STOP_COMMAND           (MCR_REG_STOP_ENABLE << MCR_REG_STOP_POS)
+
+/* Master interrupts enabled while a transfer runs */
+#define TEST_TRANSFER_MASK          ( (1U << MIMR_REG_IM_POS) | (1U << MIMR_REG_CLKIM_POS) )
+
+/* Master interrupts configured by the application before the transfer */
+#define TEST_SAVED_MASK             (1U << MIMR_REG_IM_POS)
+
+/* Interrupt Service Routine of each instance, as installed in the vector table */
+static void (* const g_i2cIsrs[I2C_NUMBER_OF_INSTANCES])(void) = {
+    I2C0_ISR, I2C1_ISR, I2C2_ISR, I2C3_ISR
+};
+
+static I2c_Config g_config[I2C_NUMBER_OF_INSTANCES];
+
+/* MCS model of each instance: status read by the driver and commands written by it */
+static uint32 g_mcsStatus[I2C_NUMBER_OF_INSTANCES];
+static uint32 g_mcsLast[I2C_NUMBER_OF_INSTANCES];
+static uint32 g_mcsCommandCount[I2C_NUMBER_OF_INSTANCES];
+
+/* Transfer call back results */
+static uint8 g_doneStatus;
+static uint32 g_doneCount;
+
+static uint8 Test_Instance(uint32 Address)
+{
+    return (uint8)( (Address - I2C_0_BASE_ADDRESS) / (I2C_1_BASE_ADDRESS - I2C_0_BASE_ADDRESS) );
+}
+
+static uint32 Test_McsRead(uint32 Address, uint32 Value)
+{
+    return g_mcsStatus[Test_Instance(Address)];
+}
+
+static void Test_McsWrite(uint32 Address, uint32 Value)
+{
+    g_mcsLast[Test_Instance(Address)] = Value;
+    g_mcsCommandCount[Test_Instance(Address)]++;
+}
+
+static void Test_Done(uint8 Status)
+{
+    g_doneStatus = Status;
+    g_doneCount++;
+}
+
+static void Test_I2cSetUp(I2c_Instance I2cNum)
+{
+    memset(&g_config[I2cNum], 0, sizeof(I2c_Config));
+    g_config[I2cNum].I2cNum   = I2cNum;
+    g_config[I2cNum].I2cMode  = I2C_MODE_MASTER;
+    g_config[I2cNum].ClkValue = 80000000U;
+    g_config[I2cNum].I2cFreq  = I2C_FREQ_STANDARD;
+
+    memset(&g_i2cItTransfer[I2cNum], 0, sizeof(I2c_ItTransfer));
+    g_mcsStatus[I2cNum]       = 0;
+    g_mcsLast[I2cNum]         = 0;
+    g_mcsCommandCount[I2cNum] = 0;
+    g_doneStatus = I2C_STATUS_PENDING;
+    g_doneCount  = 0;
+
+    TEST_ASSERT_EQ(RET_OK, I2c_Init(&g_config[I2cNum]));
+    Test_RegSet(g_i2cBaseAddress[I2cNum] + I2C_MIMR_REG_OFFSET, TEST_SAVED_MASK);
+    Test_RegHook(g_i2cBaseAddress[I2cNum] + I2C_MCS_REG_OFFSET, Test_McsRead, Test_McsWrite);
+}
+
+/* Master interrupt (MMIS bits) with the given MCS status, served by the instance ISR */
+static void Test_RunIsr(I2c_Instance I2cNum, uint32 Mmis, uint32 Mcs)
+{
+    g_mcsStatus[I2cNum] = Mcs;
+    Test_RegSet(g_i2cBaseAddress[I2cNum] + I2C_MMIS_REG_OFFSET, Mmis);
+    (*g_i2cIsrs[I2cNum])();
+    Test_RegSet(g_i2cBaseAddress[I2cNum] + I2C_MMIS_REG_OFFSET, 0);
+}
+
+/* Transfer ended with Status, configured master interrupts are back */
+static void Test_AssertFinished(I2c_Instance I2cNum, uint8 Status)
+{
+    TEST_ASSERT_EQ(1, g_doneCount);
+    TEST_ASSERT_EQ(Status, g_doneStatus);
+    TEST_ASSERT_EQ(FALSE, g_i2cItTransfer[I2cNum].Busy);
+    TEST_ASSERT_EQ(Status, g_i2cItSingle[I2cNum].Status);
+    TEST_ASSERT_EQ(TEST_SAVED_MASK, TEST_REG(g_i2cBaseAddress[I2cNum] + I2C_MIMR_REG_OFFSET));
+}
+
+static void Test_ClockTimeoutEndsTransfer(void)
+{
+    const uint8 Tx[3] = {0x01, 0x02, 0x03};
+
+    /* Clock timeout interrupt (CLKMIS) */
+    Test_I2cSetUp(I2c1);
+    TEST_ASSERT_EQ(RET_OK, I2c_WriteReadIT(&g_config[I2c1], 0x50, Tx, 3, NULL_PTR, 0, Test_Done));
+    TEST_ASSERT_EQ(TEST_TRANSFER_MASK, TEST_REG(I2C_1_BASE_ADDRESS + I2C_MIMR_REG_OFFSET));
+    Test_RunIsr(I2c1, (1U << MMIS_REG_MIS_POS), 0);
+    TEST_ASSERT_EQ(2, g_mcsCommandCount[I2c1]);
+
+    Test_RunIsr(I2c1, (1U << MMIS_REG_CLKMIS_POS), 0);
+    Test_AssertFinished(I2c1, I2C_STATUS_CLOCK_TIMEOUT);
+
+    /* SCL is held low: no STOP is tried */
+    TEST_ASSERT_EQ(2, g_mcsCommandCount[I2c1]);
+
+    /* CLKTO reported in MCS with the byte done interrupt */
+    Test_I2cSetUp(I2c1);
+    TEST_ASSERT_EQ(RET_OK, I2c_WriteReadIT(&g_config[I2c1], 0x50, Tx, 3, NULL_PTR, 0, Test_Done));
+    Test_RunIsr(I2c1, (1U << MMIS_REG_MIS_POS), (1U << MCR_REG_CLKTO_POS) | (1U << MCR_REG_ERROR_POS));
+    Test_AssertFinished(I2c1, I2C_STATUS_CLOCK_TIMEOUT);
+    TEST_ASSERT_EQ(1, g_mcsCommandCount[I2c1]);
+}
+
+static void Test_AddressNackSendsStop(void)
+{
+    const uint8 Tx[2] = {0x10, 0x20};
+
+    Test_I2cSetUp(I2c1);
+    TEST_ASSERT_EQ(RET_OK, I2c_WriteReadIT(&g_config[I2c1], 0x50, Tx, 2, NULL_PTR, 0, Test_Done));
+    TEST_ASSERT_EQ(TEST_START_COMMAND, g_mcsLast[I2c1]);
+
+    /* No slave answered the address: STOP wasn't sent with it, the bus is released */
+    Test_RunIsr(I2c1, (1U << MMIS_REG_MIS_POS), (1U << MCR_REG_ERROR_POS) | (1U << MCR_REG_ADRACK_POS));
+    TEST_ASSERT_EQ(0, g_doneCount);
+    TEST_ASSERT_EQ(TEST_STOP_COMMAND, g_mcsLast[I2c1]);
+    TEST_ASSERT_EQ(TRUE, g_i2cItTransfer[I2c1].Stopping);
+
+    /* STOP done: the result is the address NACK */
+    Test_RunIsr(I2c1, (1U << MMIS_REG_MIS_POS), (1U << MCR_REG_IDLE_POS));
+    Test_AssertFinished(I2c1, I2C_STATUS_ADDRESS_NACK);
+    TEST_ASSERT_EQ(2, g_mcsCommandCount[I2c1]);
+}
+
+static void Test_DataNackSendsStop(void)
+{
+    const uint8 Tx[3] = {0x10, 0x20, 0x30};
+
+    Test_I2cSetUp(I2c1);
+    TEST_ASSERT_EQ(RET_OK, I2c_WriteReadIT(&g_config[I2c1], 0x50, Tx, 3, NULL_PTR, 0, Test_Done));
+
+    /* Second byte is not acknowledged */
+    Test_RunIsr(I2c1, (1U << MMIS_REG_MIS_POS), 0);
+    TEST_ASSERT_EQ(0x20, TEST_REG(I2C_1_BASE_ADDRESS + I2C_MDR_REG_OFFSET));
+    Test_RunIsr(I2c1, (1U << MMIS_REG_MIS_POS), (1U << MCR_REG_ERROR_POS) | (1U << MCR_REG_DATACK_POS));
+    TEST_ASSERT_EQ(0, g_doneCount);
+    TEST_ASSERT_EQ(TEST_STOP_COMMAND, g_mcsLast[I2c1]);
+
+    Test_RunIsr(I2c1, (1U << MMIS_REG_MIS_POS), (1U << MCR_REG_IDLE_POS));
+    Test_AssertFinished(I2c1, I2C_STATUS_DATA_NACK);
+    TEST_ASSERT_EQ(3, g_mcsCommandCount[I2c1]);
+}
+
+static void Test_NackOfLastByteDoesNotStopTwice(void)
+{
+    const uint8 Tx[1] = {0x10};
+
+    Test_I2cSetUp(I2c1);
+
+    /* Only byte goes with STOP, the controller sends it even if the byte is not acknowledged */
+    TEST_ASSERT_EQ(RET_OK, I2c_WriteReadIT(&g_config[I2c1], 0x50, Tx, 1, NULL_PTR, 0, Test_Done));
+    TEST_ASSERT_EQ(TEST_START_COMMAND | TEST_STOP_COMMAND, g_mcsLast[I2c1]);
+
+    Test_RunIsr(I2c1, (1U << MMIS_REG_MIS_POS), (1U << MCR_REG_ERROR_POS) | (1U << MCR_REG_DATACK_POS) | (1U << MCR_REG_IDLE_POS));
+    Test_AssertFinished(I2c1, I2C_STATUS_DATA_NACK);
+    TEST_ASSERT_EQ(1, g_mcsCommandCount[I2c1]);
+}
+
+static void Test_EachIsrServesItsInstance(void)
+{
+    const uint8 Tx[2] = {0xA0, 0xA1};
+    uint8 Instance = 0;
+    uint8 Other = 0;
+
+    for(Instance = 0; Instance < I2C_NUMBER_OF_INSTANCES; Instance++)
+    {
+        /* Zeroed registers without hooks, then all instances initialized */
+        Test_RegsReset();
+        for(Other = 0; Other < I2C_NUMBER_OF_INSTANCES; Other++)
+        {
+            Test_I2cSetUp((I2c_Instance)Other);
+        }
+        TEST_ASSERT_EQ(RET_OK, I2c_WriteReadIT(&g_config[Instance], 0x50, Tx, 2, NULL_PTR, 0, Test_Done));
+
+        /* Byte done interrupt raised on every instance, only the running one moves on */
+        for(Other = 0; Other < I2C_NUMBER_OF_INSTANCES; Other++)
+        {
+            Test_RunIsr((I2c_Instance)Other, (1U << MMIS_REG_MIS_POS), 0);
+        }
+        for(Other = 0; Other < I2C_NUMBER_OF_INSTANCES; Other++)
+        {
+            TEST_ASSERT_EQ( (Other == Instance) ? 2U : 0U, g_mcsCommandCount[Other] );
+        }
+        TEST_ASSERT_EQ(0xA1, TEST_REG(g_i2cBaseAddress[Instance] + I2C_MDR_REG_OFFSET));
+
+        /* Last byte went with STOP: done */
+        Test_RunIsr((I2c_Instance)Instance, (1U << MMIS_REG_MIS_POS), (1U << MCR_REG_IDLE_POS));
+        Test_AssertFinished((I2c_Instance)Instance, I2C_STATUS_OK);
+    }
+}
+
+int main(void)
+{
+    Test_RegsInit();
+
+    TEST_RUN(Test_ClockTimeoutEndsTransfer);
+    TEST_RUN(Test_AddressNackSendsStop);
+    TEST_RUN(Test_DataNackSendsStop);
+    TEST_RUN(Test_NackOfLastByteDoesNotStopTwice);
+    TEST_RUN(Test_EachIsrServesItsInstance);
+
+    return Test_Summary("Test_I2cIt");
+}
@@ -0,0 +1,336 @@
+/********************************************************************************
+ * @file          Test_I2cRetry.c
+ * @brief         Host tests of I2C master error handling: arbitration loss retry
+ *                deferred from I2C ISR to I2c_Service(), bus recovery only when
+ *                the master is idle, blocking wait bounded by MCLKOCNT and
+ *                blocking write-read retried after an arbitration loss
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ *******************************************************************************/
+
+#include "I2C_Prog.c"
+#include "Test_Harness.h"
+
+
+/* Registers of the I2C instance under test (I2C1, pins PA6 SCL and PA7 SDA) */
+#define TEST_I2C_MCS                (I2C_1_BASE_ADDRESS + I2C_MCS_REG_OFFSET)
+#define TEST_I2C_MMIS               (I2C_1_BASE_ADDRESS + I2C_MMIS_REG_OFFSET)
+#define TEST_I2C_MICR               (I2C_1_BASE_ADDRESS + I2C_MICR_REG_OFFSET)
+#define TEST_I2C_MSA                (I2C_1_BASE_ADDRESS + I2C_MSA_REG_OFFSET)
+#define TEST_I2C_MDR                (I2C_1_BASE_ADDRESS + I2C_MDR_REG_OFFSET)
+#define TEST_I2C_MCR                (I2C_1_BASE_ADDRESS + I2C_MCR_REG_OFFSET)
+#define TEST_I2C_MCLKOCNT           (I2C_1_BASE_ADDRESS + I2C_MCLKOCNT_REG_OFFSET)
+#define TEST_I2C_MBMON              (I2C_1_BASE_ADDRESS + I2C_MBMON_REG_OFFSET)
+#define TEST_GPIO_DATA              (I2C_1_GPIO_BASE_ADDRESS + I2C_GPIO_DATA_REG_OFFSET)
+#define TEST_GPIO_AFSEL             (I2C_1_GPIO_BASE_ADDRESS + I2C_GPIO_AFSEL_REG_OFFSET)
+#define TEST_I2C_PINS               ( (1U << 6) | (1U << 7) )
+
+/* MCS commands kept by the model */
+#define TEST_MAX_COMMANDS           (16U)
+
+/* MMIS polls without a command to end before the controller model reports a clock timeout */
+#define TEST_MAX_IDLE_POLLS         (1000U)
+
+/* START and RUN of the first byte of a write phase */
+#define TEST_START_COMMAND          ( (MCR_REG_START_ENABLE << MCR_REG_START_POS) | (MCR_REG_RUN_ENABLE << MCR_REG_RUN_POS) )
+
+static I2c_Config g_config;
+
+/* MCS model: status read by the driver and commands written by it */
+static uint32 g_mcsStatus;
+static uint32 g_mcsReads;
+static uint32 g_mcsCommands[TEST_MAX_COMMANDS];
+static uint32 g_mcsCommandCount;
+
+/* Controller model (blocking transfers): each command ends with the next status
+ * of the script, a received byte is taken from MDR */
+static const uint32* g_script;
+static uint32 g_scriptLength;
+static uint32 g_served;
+static uint32 g_idlePolls;
+static uint8 g_slaveByte;
+
+/* Transfer call back results */
+static uint8 g_doneStatus;
+static uint32 g_doneCount;
+
+static uint32 Test_McsRead(uint32 Address, uint32 Value)
+{
+    g_mcsReads++;
+    return g_mcsStatus;
+}
+
+static void Test_McsWrite(uint32 Address, uint32 Value)
+{
+    if(g_mcsCommandCount < TEST_MAX_COMMANDS)
+    {
+        g_mcsCommands[g_mcsCommandCount] = Value;
+    }
+    g_mcsCommandCount++;
+}
+
+/* Master interrupt of the last command, clock timeout if the bus stays idle too long */
+static uint32 Test_MmisRead(uint32 Address, uint32 Value)
+{
+    if(g_served < g_mcsCommandCount)
+    {
+        return (1U << MMIS_REG_MIS_POS);
+    }
+
+    return (++g_idlePolls > TEST_MAX_IDLE_POLLS) ? (1U << MMIS_REG_CLKMIS_POS) : 0;
+}
+
+/* Interrupt cleared: the last command ends with its scripted status */
+static void Test_MicrWrite(uint32 Address, uint32 Value)
+{
+    if(g_served >= g_mcsCommandCount)
+    {
+        return;
+    }
+
+    g_mcsStatus = (g_served < g_scriptLength) ? g_script[g_served] : 0;
+    if( (Test_RegGet(TEST_I2C_MSA) & MSA_REG_RECEIVE) != 0 )
+    {
+        Test_RegSet(TEST_I2C_MDR, g_slaveByte++);
+    }
+    g_served++;
+    g_idlePolls = 0;
+}
+
+static void Test_Done(uint8 Status)
+{
+    g_doneStatus = Status;
+    g_doneCount++;
+}
+
+static void Test_I2cSetUp(uint32 ClkValue, uint32 I2cFreq)
+{
+    memset(&g_config, 0, sizeof(g_config));
+    g_config.I2cNum          = I2c1;
+    g_config.I2cMode         = I2C_MODE_MASTER;
+    g_config.ClkValue        = ClkValue;
+    g_config.I2cFreq         = I2cFreq;
+    g_config.I2cSlaveAddress = 0x50;
+    g_config.I2cTransmitMode = I2C_TRANSMIT_MODE_SINGLE;
+
+    memset(g_i2cItTransfer, 0, sizeof(g_i2cItTransfer));
+    g_mcsStatus       = 0;
+    g_mcsReads        = 0;
+    g_mcsCommandCount = 0;
+    g_doneStatus      = I2C_STATUS_PENDING;
+    g_doneCount       = 0;
+
+    TEST_ASSERT_EQ(RET_OK, I2c_Init(&g_config));
+    Test_RegHook(TEST_I2C_MCS, Test_McsRead, Test_McsWrite);
+}
+
+/* Master interrupt with the given MCS status */
+static void Test_RunIsr(uint32 Mcs)
+{
+    g_mcsStatus = Mcs;
+    Test_RegSet(TEST_I2C_MMIS, (1U << MMIS_REG_MIS_POS));
+    I2C1_ISR();
+    Test_RegSet(TEST_I2C_MMIS, 0);
+}
+
+/* Call I2c_Service() until it sends a command, returns the calls done */
+static uint32 Test_ServiceUntilCommand(uint32 MaxCalls)
+{
+    uint32 Commands = g_mcsCommandCount;
+    uint32 Calls = 0;
+
+    while( (g_mcsCommandCount == Commands) && (Calls < MaxCalls) )
+    {
+        TEST_ASSERT_EQ(RET_OK, I2c_Service(I2c1));
+        Calls++;
+    }
+
+    return Calls;
+}
+
+static void Test_ArbitrationLossIsRetriedFromService(void)
+{
+    const uint8 Tx[2] = {0x12, 0x34};
+    uint32 Calls = 0;
+
+    Test_I2cSetUp(80000000U, I2C_FREQ_STANDARD);
+
+    TEST_ASSERT_EQ(RET_OK, I2c_WriteReadIT(&g_config, 0x50, Tx, 2, NULL_PTR, 0, Test_Done));
+    TEST_ASSERT_EQ(1, g_mcsCommandCount);
+
+    /* Nothing is waited nor sent from I2C ISR, the transfer stays busy */
+    Test_RunIsr(1U << MCR_REG_ARBLST_POS);
+    TEST_ASSERT_EQ(1, g_mcsCommandCount);
+    TEST_ASSERT_EQ(0, g_doneCount);
+    TEST_ASSERT_EQ(TRUE, g_i2cItTransfer[I2c1].Busy);
+    TEST_ASSERT_EQ(RET_NOT_OK, I2c_WriteReadIT(&g_config, 0x50, Tx, 2, NULL_PTR, 0, Test_Done));
+
+    /* Backoff calls, then the transaction restarts from its first byte */
+    g_mcsStatus = 0;
+    Calls = Test_ServiceUntilCommand(10U);
+    TEST_ASSERT_EQ(I2C_RETRY_BACKOFF_CALLS + 1U, Calls);
+    TEST_ASSERT_EQ(2, g_mcsCommandCount);
+    TEST_ASSERT_EQ(TEST_START_COMMAND, g_mcsCommands[1]);
+    TEST_ASSERT_EQ(0x12, TEST_REG(TEST_I2C_MDR));
+
+    /* Lost again: the backoff is doubled, then the other master keeps the bus */
+    Test_RunIsr(1U << MCR_REG_ARBLST_POS);
+    g_mcsStatus = (1U << MCR_REG_BUSBSY_POS);
+    Calls = Test_ServiceUntilCommand( (I2C_RETRY_BACKOFF_CALLS << 1) + I2C_RETRY_BUSY_CALLS );
+    TEST_ASSERT_EQ(2, g_mcsCommandCount);
+    TEST_ASSERT_EQ(0, g_doneCount);
+    TEST_ASSERT_EQ(RET_OK, I2c_Service(I2c1));
+    TEST_ASSERT_EQ(1, g_doneCount);
+    TEST_ASSERT_EQ(I2C_STATUS_ARBITRATION_LOST, g_doneStatus);
+    TEST_ASSERT_EQ(FALSE, g_i2cItTransfer[I2c1].Busy);
+
+    /* Nothing left to serve */
+    TEST_ASSERT_EQ(RET_OK, I2c_Service(I2c1));
+    TEST_ASSERT_EQ(1, g_doneCount);
+    TEST_ASSERT_EQ(RET_NOT_OK, I2c_Service((I2c_Instance)I2C_NUMBER_OF_INSTANCES));
+}
+
+static void Test_RetriesExhaustedEndTransfer(void)
+{
+    const uint8 Tx[1] = {0x56};
+    uint8 Retry = 0;
+
+    Test_I2cSetUp(80000000U, I2C_FREQ_STANDARD);
+
+    TEST_ASSERT_EQ(RET_OK, I2c_WriteReadIT(&g_config, 0x50, Tx, 1, NULL_PTR, 0, Test_Done));
+
+    for(Retry = 0; Retry < I2C_ARBITRATION_RETRIES; Retry++)
+    {
+        Test_RunIsr(1U << MCR_REG_ARBLST_POS);
+        g_mcsStatus = 0;
+        TEST_ASSERT_EQ( (I2C_RETRY_BACKOFF_CALLS << Retry) + 1U, Test_ServiceUntilCommand(100U) );
+    }
+    TEST_ASSERT_EQ(1U + I2C_ARBITRATION_RETRIES, g_mcsCommandCount);
+    TEST_ASSERT_EQ(0, g_doneCount);
+
+    Test_RunIsr(1U << MCR_REG_ARBLST_POS);
+    TEST_ASSERT_EQ(1, g_doneCount);
+    TEST_ASSERT_EQ(I2C_STATUS_ARBITRATION_LOST, g_doneStatus);
+    TEST_ASSERT_EQ(FALSE, g_i2cItTransfer[I2c1].Busy);
+}
+
+static void Test_RecoverOnlyWhenMasterIdle(void)
+{
+    const uint8 Tx[2] = {0x9A, 0xBC};
+
+    Test_I2cSetUp(80000000U, I2C_FREQ_STANDARD);
+
+    /* SCL and SDA held low, pins driven by the I2C module (GPIO data is only written by the bus clear) */
+    Test_RegSet(TEST_I2C_MBMON, 0);
+    Test_RegSet(TEST_GPIO_AFSEL, TEST_I2C_PINS);
+
+    /* Interrupt driven transfer running: pins are not taken */
+    TEST_ASSERT_EQ(RET_OK, I2c_WriteReadIT(&g_config, 0x50, Tx, 2, NULL_PTR, 0, Test_Done));
+    TEST_ASSERT_EQ(RET_NOT_OK, I2c_BusRecover(&g_config));
+    TEST_ASSERT_EQ(0, TEST_REG(TEST_GPIO_DATA));
+
+    /* Waiting for its retry is still running */
+    Test_RunIsr(1U << MCR_REG_ARBLST_POS);
+    TEST_ASSERT_EQ(RET_NOT_OK, I2c_BusRecover(&g_config));
+    TEST_ASSERT_EQ(0, TEST_REG(TEST_GPIO_DATA));
+
+    g_mcsStatus = 0;
+    (void)Test_ServiceUntilCommand(10U);
+    Test_RunIsr(0);
+    Test_RunIsr(0);
+    TEST_ASSERT_EQ(I2C_STATUS_OK, g_doneStatus);
+
+    /* Blocking master operation running */
+    g_mcsStatus = (1U << MCR_REG_BUSY_POS);
+    TEST_ASSERT_EQ(RET_NOT_OK, I2c_BusRecover(&g_config));
+    TEST_ASSERT_EQ(0, TEST_REG(TEST_GPIO_DATA));
+
+    /* Disabled master: the bus is clocked (lines stay low in this model) and pins are given back */
+    Test_RegSet(TEST_I2C_MCR, 0);
+    TEST_ASSERT_EQ(RET_NOT_OK, I2c_BusRecover(&g_config));
+    TEST_ASSERT_EQ(TEST_I2C_PINS, TEST_REG(TEST_GPIO_DATA));
+    TEST_ASSERT_EQ(TEST_I2C_PINS, TEST_REG(TEST_GPIO_AFSEL));
+
+    /* Idle master */
+    Test_RegSet(TEST_I2C_MCR, I2C_MODE_MASTER);
+    Test_RegSet(TEST_GPIO_DATA, 0);
+    g_mcsStatus = 0;
+    TEST_ASSERT_EQ(RET_NOT_OK, I2c_BusRecover(&g_config));
+    TEST_ASSERT_EQ(TEST_I2C_PINS, TEST_REG(TEST_GPIO_DATA));
+    TEST_ASSERT_EQ(TEST_I2C_PINS, TEST_REG(TEST_GPIO_AFSEL));
+
+    Test_RegSet(TEST_I2C_MBMON, (1U << MBMON_REG_SCL_POS) | (1U << MBMON_REG_SDA_POS));
+    TEST_ASSERT_EQ(RET_OK, I2c_BusRecover(&g_config));
+}
+
+static void Test_WaitMasterBoundFollowsClockTimeout(void)
+{
+    const uint8 Data = 0x77;
+    uint32 Count = 0;
+    uint32 Polls = 0;
+
+    /* 4 MHz / 100 kHz: 40 System Clocks per SCL period */
+    for(Count = MCLKOCNT_REG_CNTL_MIN; Count <= 10U; Count += 8U)
+    {
+        Test_I2cSetUp(4000000U, I2C_FREQ_STANDARD);
+        Test_RegSet(TEST_I2C_MCLKOCNT, Count);
+        Test_RegSet(TEST_I2C_MBMON, 0);
+
+        /* SCL held low, the controller never ends the operation */
+        g_mcsStatus = (1U << MCR_REG_BUSY_POS);
+        Polls = (I2C_OPERATION_SCL_PERIODS + (Count * MCLKOCNT_REG_CNTL_SCALE)) * 40U;
+
+        TEST_ASSERT_EQ(RET_NOT_OK, I2c_Transmit(&g_config, &Data, 1));
+        TEST_ASSERT_EQ(I2C_STATUS_CLOCK_TIMEOUT, I2c_GetLastError(I2c1));
+        TEST_ASSERT( (g_mcsReads > Polls) && (g_mcsReads <= (Polls + 4U)) );
+
+        /* Still BUSY: the pins of the running master are not taken */
+        TEST_ASSERT_EQ(0, TEST_REG(TEST_GPIO_DATA));
+    }
+}
+
+static void Test_BlockingWriteReadRetriesArbitrationLoss(void)
+{
+    const uint8 Tx[2] = {0x12, 0x34};
+    const uint32 Script[1] = {1U << MCR_REG_ARBLST_POS};
+    uint8 Rx[2] = {0};
+
+    Test_I2cSetUp(80000000U, I2C_FREQ_STANDARD);
+    g_script       = Script;
+    g_scriptLength = 1;
+    g_served       = 0;
+    g_idlePolls    = 0;
+    g_slaveByte    = 0x70;
+    Test_RegHook(TEST_I2C_MMIS, Test_MmisRead, NULL_PTR);
+    Test_RegHook(TEST_I2C_MICR, NULL_PTR, Test_MicrWrite);
+
+    /* First START lost, the same wait restarts the transaction after the backoff and completes it */
+    TEST_ASSERT_EQ(RET_OK, I2c_WriteRead(&g_config, 0x50, Tx, 2, Rx, 2));
+    TEST_ASSERT_EQ(I2C_STATUS_OK, g_i2cItSingle[I2c1].Status);
+    TEST_ASSERT_EQ(FALSE, g_i2cItTransfer[I2c1].Busy);
+    TEST_ASSERT_EQ(1, g_i2cItTransfer[I2c1].Retries);
+
+    /* Lost START, START again, second byte, repeated START (ACK), last byte (STOP) */
+    TEST_ASSERT_EQ(5, g_mcsCommandCount);
+    TEST_ASSERT_EQ(TEST_START_COMMAND, g_mcsCommands[0]);
+    TEST_ASSERT_EQ(TEST_START_COMMAND, g_mcsCommands[1]);
+    TEST_ASSERT_EQ(MCR_REG_RUN_ENABLE << MCR_REG_RUN_POS, g_mcsCommands[2]);
+    TEST_ASSERT_EQ(TEST_START_COMMAND | (MCR_REG_ACK_ENABLE << MCR_REG_ACK_POS), g_mcsCommands[3]);
+    TEST_ASSERT_EQ( (MCR_REG_RUN_ENABLE << MCR_REG_RUN_POS) | (MCR_REG_STOP_ENABLE << MCR_REG_STOP_POS), g_mcsCommands[4] );
+    TEST_ASSERT_EQ(0x70, Rx[0]);
+    TEST_ASSERT_EQ(0x71, Rx[1]);
+}
+
+int main(void)
+{
+    Test_RegsInit();
+
+    TEST_RUN(Test_ArbitrationLossIsRetriedFromService);
+    TEST_RUN(Test_RetriesExhaustedEndTransfer);
+    TEST_RUN(Test_RecoverOnlyWhenMasterIdle);
+    TEST_RUN(Test_WaitMasterBoundFollowsClockTimeout);
+    TEST_RUN(Test_BlockingWriteReadRetriesArbitrationLoss);
+
+    return Test_Summary("Test_I2cRetry");
+}
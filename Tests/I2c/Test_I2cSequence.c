@@ -0,0 +1,299 @@
+/********************************************************************************
+ * @file          Test_I2cSequence.c
+ * @brief         Host tests of I2C interrupt driven master command sequencing:
+ *                repeated START between the write and read phases of
+ *                I2c_WriteReadIT(), NACK of the last read byte and STOP only
+ *                after the last transaction of an I2c_BatchIT() list
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ *******************************************************************************/
+
+#include "I2C_Prog.c"
+#include "Test_Harness.h"
+
+
+/* Registers of the I2C instance under test */
+#define TEST_I2C_MCS                (I2C_1_BASE_ADDRESS + I2C_MCS_REG_OFFSET)
+#define TEST_I2C_MSA                (I2C_1_BASE_ADDRESS + I2C_MSA_REG_OFFSET)
+#define TEST_I2C_MMIS               (I2C_1_BASE_ADDRESS + I2C_MMIS_REG_OFFSET)
+#define TEST_I2C_MDR                (I2C_1_BASE_ADDRESS + I2C_MDR_REG_OFFSET)
+
+/* MCS commands kept by the model */
+#define TEST_MAX_COMMANDS           (16U)
+
+/* MCS command bits */
+#define TEST_MCS_RUN                (MCR_REG_RUN_ENABLE   << MCR_REG_RUN_POS)
+#define TEST_MCS_START              (MCR_REG_START_ENABLE << MCR_REG_START_POS)
+#define TEST_MCS_STOP               (MCR_REG_STOP_ENABLE  << MCR_REG_STOP_POS)
+#define TEST_MCS_ACK                (MCR_REG_ACK_ENABLE   << MCR_REG_ACK_POS)
+
+/* MSA value of a slave address in each direction */
+#define TEST_WRITE_ADDRESS(x)       ( (uint32)(x) << 1 )
+#define TEST_READ_ADDRESS(x)        ( ( (uint32)(x) << 1 ) | MSA_REG_RECEIVE )
+
+static I2c_Config g_config;
+
+/* MCS model: commands written by the driver, with MSA and MDR at that time */
+static uint32 g_mcsCommands[TEST_MAX_COMMANDS];
+static uint32 g_mcsAddress[TEST_MAX_COMMANDS];
+static uint32 g_mcsData[TEST_MAX_COMMANDS];
+static uint32 g_mcsCommandCount;
+static uint32 g_mcsStatus;
+
+/* Transfer call back results */
+static uint8 g_doneStatus;
+static uint32 g_doneCount;
+
+static uint32 Test_McsRead(uint32 Address, uint32 Value)
+{
+    return g_mcsStatus;
+}
+
+static void Test_McsWrite(uint32 Address, uint32 Value)
+{
+    if(g_mcsCommandCount < TEST_MAX_COMMANDS)
+    {
+        g_mcsCommands[g_mcsCommandCount] = Value;
+        g_mcsAddress[g_mcsCommandCount]  = TEST_REG(TEST_I2C_MSA);
+        g_mcsData[g_mcsCommandCount]     = TEST_REG(TEST_I2C_MDR);
+    }
+    g_mcsCommandCount++;
+}
+
+static void Test_Done(uint8 Status)
+{
+    g_doneStatus = Status;
+    g_doneCount++;
+}
+
+static void Test_I2cSetUp(void)
+{
+    memset(&g_config, 0, sizeof(g_config));
+    g_config.I2cNum   = I2c1;
+    g_config.I2cMode  = I2C_MODE_MASTER;
+    g_config.ClkValue = 80000000U;
+    g_config.I2cFreq  = I2C_FREQ_STANDARD;
+
+    memset(g_i2cItTransfer, 0, sizeof(g_i2cItTransfer));
+    g_mcsCommandCount = 0;
+    g_mcsStatus       = 0;
+    g_doneStatus      = I2C_STATUS_PENDING;
+    g_doneCount       = 0;
+
+    TEST_ASSERT_EQ(RET_OK, I2c_Init(&g_config));
+    Test_RegHook(TEST_I2C_MCS, Test_McsRead, Test_McsWrite);
+}
+
+/* Byte done interrupt, MDR holds the byte received (if any) */
+static void Test_RunIsr(uint32 Mcs, uint8 Received)
+{
+    g_mcsStatus = Mcs;
+    Test_RegSet(TEST_I2C_MDR, Received);
+    Test_RegSet(TEST_I2C_MMIS, (1U << MMIS_REG_MIS_POS));
+    I2C1_ISR();
+    Test_RegSet(TEST_I2C_MMIS, 0);
+}
+
+/* Command number Index, sent with the given MSA */
+static void Test_AssertCommand(uint32 Index, uint32 Command, uint32 Msa)
+{
+    TEST_ASSERT_EQ(Command, g_mcsCommands[Index]);
+    TEST_ASSERT_EQ(Msa, g_mcsAddress[Index]);
+}
+
+/* Commands (sent so far) with STOP */
+static uint32 Test_StopCount(void)
+{
+    uint32 Stops = 0;
+    uint32 iteration = 0;
+
+    for(iteration = 0; (iteration < g_mcsCommandCount) && (iteration < TEST_MAX_COMMANDS); iteration++)
+    {
+        Stops += ( (g_mcsCommands[iteration] & TEST_MCS_STOP) != 0 ) ? 1U : 0U;
+    }
+
+    return Stops;
+}
+
+static void Test_WriteReadUsesRepeatedStart(void)
+{
+    const uint8 Tx[2] = {0x01, 0x02};
+    uint8 Rx[3] = {0};
+
+    Test_I2cSetUp();
+
+    /* Write phase: START with the first byte, no STOP (read phase follows) */
+    TEST_ASSERT_EQ(RET_OK, I2c_WriteReadIT(&g_config, 0x50, Tx, 2, Rx, 3, Test_Done));
+    Test_AssertCommand(0, TEST_MCS_START | TEST_MCS_RUN, TEST_WRITE_ADDRESS(0x50));
+    TEST_ASSERT_EQ(0x01, g_mcsData[0]);
+
+    Test_RunIsr(0, 0);
+    Test_AssertCommand(1, TEST_MCS_RUN, TEST_WRITE_ADDRESS(0x50));
+    TEST_ASSERT_EQ(0x02, g_mcsData[1]);
+
+    /* Repeated START in receive direction, the bus is never released in between */
+    Test_RunIsr(0, 0);
+    Test_AssertCommand(2, TEST_MCS_START | TEST_MCS_RUN | TEST_MCS_ACK, TEST_READ_ADDRESS(0x50));
+    TEST_ASSERT_EQ(0, Test_StopCount());
+
+    /* Bytes acknowledged but the last one, which goes with NACK and STOP */
+    Test_RunIsr(0, 0x11);
+    Test_AssertCommand(3, TEST_MCS_RUN | TEST_MCS_ACK, TEST_READ_ADDRESS(0x50));
+    Test_RunIsr(0, 0x22);
+    Test_AssertCommand(4, TEST_MCS_RUN | TEST_MCS_STOP, TEST_READ_ADDRESS(0x50));
+    TEST_ASSERT_EQ(0, g_doneCount);
+
+    Test_RunIsr((1U << MCR_REG_IDLE_POS), 0x33);
+    TEST_ASSERT_EQ(5, g_mcsCommandCount);
+    TEST_ASSERT_EQ(1, Test_StopCount());
+    TEST_ASSERT_EQ(1, g_doneCount);
+    TEST_ASSERT_EQ(I2C_STATUS_OK, g_doneStatus);
+    TEST_ASSERT_EQ(0x11, Rx[0]);
+    TEST_ASSERT_EQ(0x22, Rx[1]);
+    TEST_ASSERT_EQ(0x33, Rx[2]);
+}
+
+static void Test_SingleReadByteIsNacked(void)
+{
+    const uint8 Tx[1] = {0x07};
+    uint8 Rx[1] = {0};
+
+    /* Read only: START, NACK and STOP in one command */
+    Test_I2cSetUp();
+    TEST_ASSERT_EQ(RET_OK, I2c_WriteReadIT(&g_config, 0x50, NULL_PTR, 0, Rx, 1, Test_Done));
+    TEST_ASSERT_EQ(1, g_mcsCommandCount);
+    Test_AssertCommand(0, TEST_MCS_START | TEST_MCS_RUN | TEST_MCS_STOP, TEST_READ_ADDRESS(0x50));
+
+    Test_RunIsr((1U << MCR_REG_IDLE_POS), 0x5A);
+    TEST_ASSERT_EQ(I2C_STATUS_OK, g_doneStatus);
+    TEST_ASSERT_EQ(0x5A, Rx[0]);
+
+    /* Register address then one byte: repeated START with NACK and STOP */
+    Test_I2cSetUp();
+    TEST_ASSERT_EQ(RET_OK, I2c_WriteReadIT(&g_config, 0x50, Tx, 1, Rx, 1, Test_Done));
+    Test_AssertCommand(0, TEST_MCS_START | TEST_MCS_RUN, TEST_WRITE_ADDRESS(0x50));
+
+    Test_RunIsr(0, 0);
+    Test_AssertCommand(1, TEST_MCS_START | TEST_MCS_RUN | TEST_MCS_STOP, TEST_READ_ADDRESS(0x50));
+
+    Test_RunIsr((1U << MCR_REG_IDLE_POS), 0xA5);
+    TEST_ASSERT_EQ(2, g_mcsCommandCount);
+    TEST_ASSERT_EQ(1, g_doneCount);
+    TEST_ASSERT_EQ(I2C_STATUS_OK, g_doneStatus);
+    TEST_ASSERT_EQ(0xA5, Rx[0]);
+}
+
+static void Test_BatchStopsAfterLastTransaction(void)
+{
+    const uint8 Register[1] = {0x10};
+    const uint8 Tx[2] = {0x20, 0x21};
+    uint8 RxFirst[2] = {0};
+    uint8 RxSecond[1] = {0};
+    I2c_Transaction List[3];
+
+    Test_I2cSetUp();
+
+    /* Register read from 0x50, one byte read from 0x51, two bytes written to 0x52 */
+    memset(List, 0, sizeof(List));
+    List[0].Address  = 0x50;
+    List[0].TxBuffer = Register;
+    List[0].TxLength = 1;
+    List[0].RxBuffer = RxFirst;
+    List[0].RxLength = 2;
+    List[1].Address  = 0x51;
+    List[1].RxBuffer = RxSecond;
+    List[1].RxLength = 1;
+    List[2].Address  = 0x52;
+    List[2].TxBuffer = Tx;
+    List[2].TxLength = 2;
+
+    TEST_ASSERT_EQ(RET_OK, I2c_BatchIT(&g_config, List, 3, Test_Done));
+    Test_AssertCommand(0, TEST_MCS_START | TEST_MCS_RUN, TEST_WRITE_ADDRESS(0x50));
+
+    Test_RunIsr(0, 0);
+    Test_AssertCommand(1, TEST_MCS_START | TEST_MCS_RUN | TEST_MCS_ACK, TEST_READ_ADDRESS(0x50));
+
+    /* Last byte of the first transaction: NACK, but no STOP (more transactions follow) */
+    Test_RunIsr(0, 0x31);
+    Test_AssertCommand(2, TEST_MCS_RUN, TEST_READ_ADDRESS(0x50));
+    TEST_ASSERT_EQ(I2C_STATUS_PENDING, List[0].Status);
+
+    /* Second transaction right after with repeated START, its only byte NACK without STOP */
+    Test_RunIsr(0, 0x32);
+    Test_AssertCommand(3, TEST_MCS_START | TEST_MCS_RUN, TEST_READ_ADDRESS(0x51));
+    TEST_ASSERT_EQ(I2C_STATUS_OK, List[0].Status);
+    TEST_ASSERT_EQ(I2C_STATUS_PENDING, List[1].Status);
+
+    /* Last transaction: STOP goes with its last byte only */
+    Test_RunIsr(0, 0x41);
+    Test_AssertCommand(4, TEST_MCS_START | TEST_MCS_RUN, TEST_WRITE_ADDRESS(0x52));
+    TEST_ASSERT_EQ(0x20, g_mcsData[4]);
+    TEST_ASSERT_EQ(I2C_STATUS_OK, List[1].Status);
+    TEST_ASSERT_EQ(0, Test_StopCount());
+
+    Test_RunIsr(0, 0);
+    Test_AssertCommand(5, TEST_MCS_RUN | TEST_MCS_STOP, TEST_WRITE_ADDRESS(0x52));
+    TEST_ASSERT_EQ(0x21, g_mcsData[5]);
+    TEST_ASSERT_EQ(0, g_doneCount);
+    TEST_ASSERT_EQ(I2C_STATUS_PENDING, List[2].Status);
+
+    Test_RunIsr((1U << MCR_REG_IDLE_POS), 0);
+    TEST_ASSERT_EQ(6, g_mcsCommandCount);
+    TEST_ASSERT_EQ(1, Test_StopCount());
+    TEST_ASSERT_EQ(1, g_doneCount);
+    TEST_ASSERT_EQ(I2C_STATUS_OK, g_doneStatus);
+    TEST_ASSERT_EQ(I2C_STATUS_OK, List[2].Status);
+    TEST_ASSERT_EQ(0x31, RxFirst[0]);
+    TEST_ASSERT_EQ(0x32, RxFirst[1]);
+    TEST_ASSERT_EQ(0x41, RxSecond[0]);
+}
+
+static void Test_BatchEndingWithReadStopsOnLastByte(void)
+{
+    const uint8 Tx[1] = {0x10};
+    uint8 Rx[2] = {0};
+    I2c_Transaction List[2];
+
+    Test_I2cSetUp();
+
+    /* Write to 0x50, then two bytes read from 0x51 */
+    memset(List, 0, sizeof(List));
+    List[0].Address  = 0x50;
+    List[0].TxBuffer = Tx;
+    List[0].TxLength = 1;
+    List[1].Address  = 0x51;
+    List[1].RxBuffer = Rx;
+    List[1].RxLength = 2;
+
+    /* Only byte of the first transaction goes without STOP */
+    TEST_ASSERT_EQ(RET_OK, I2c_BatchIT(&g_config, List, 2, Test_Done));
+    Test_AssertCommand(0, TEST_MCS_START | TEST_MCS_RUN, TEST_WRITE_ADDRESS(0x50));
+
+    Test_RunIsr(0, 0);
+    Test_AssertCommand(1, TEST_MCS_START | TEST_MCS_RUN | TEST_MCS_ACK, TEST_READ_ADDRESS(0x51));
+
+    Test_RunIsr(0, 0x61);
+    Test_AssertCommand(2, TEST_MCS_RUN | TEST_MCS_STOP, TEST_READ_ADDRESS(0x51));
+
+    Test_RunIsr((1U << MCR_REG_IDLE_POS), 0x62);
+    TEST_ASSERT_EQ(3, g_mcsCommandCount);
+    TEST_ASSERT_EQ(1, Test_StopCount());
+    TEST_ASSERT_EQ(1, g_doneCount);
+    TEST_ASSERT_EQ(I2C_STATUS_OK, List[0].Status);
+    TEST_ASSERT_EQ(I2C_STATUS_OK, List[1].Status);
+    TEST_ASSERT_EQ(0x61, Rx[0]);
+    TEST_ASSERT_EQ(0x62, Rx[1]);
+}
+
+int main(void)
+{
+    Test_RegsInit();
+
+    TEST_RUN(Test_WriteReadUsesRepeatedStart);
+    TEST_RUN(Test_SingleReadByteIsNacked);
+    TEST_RUN(Test_BatchStopsAfterLastTransaction);
+    TEST_RUN(Test_BatchEndingWithReadStopsOnLastByte);
+
+    return Test_Summary("Test_I2cSequence");
+}
@@ -0,0 +1,10 @@
+/********************************************************************************
+ * @headerfile    Ssi_Init.h
+ * @brief         Forwarding header of the host tests: the SSI driver includes
+ *                "Ssi_Init.h" while the file is SSI_Init.h (case sensitive host)
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ *******************************************************************************/
+
+#include "SSI_Init.h"
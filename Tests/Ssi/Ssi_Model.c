@@ -0,0 +1,237 @@
+/********************************************************************************
+ * @file          Ssi_Model.c
+ * @brief         Source file for the SSI peripheral model of the host tests
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ *******************************************************************************/
+
+/********************************************************************************
+ *                                Includes Needed                               *
+ *******************************************************************************/
+#include <string.h>
+#include "Ssi_Model.h"
+
+
+/*******************************************************************************
+ *                                  Defines                                    *
+ *******************************************************************************/
+#define MODEL_SSI_BASE(NUM)         (0x40008000U + ((uint32)(NUM) * 0x1000U))
+#define MODEL_SSI_NUM(ADDRESS)      ((uint8)(((ADDRESS) - 0x40008000U) / 0x1000U))
+
+#define MODEL_SSI_CR1               (0x004U)
+#define MODEL_SSI_DR                (0x008U)
+#define MODEL_SSI_SR                (0x00CU)
+#define MODEL_SSI_IM                (0x014U)
+#define MODEL_SSI_RIS               (0x018U)
+#define MODEL_SSI_MIS               (0x01CU)
+#define MODEL_SSI_ICR               (0x020U)
+
+#define MODEL_SSI_SR_TFE            (1U << 0)
+#define MODEL_SSI_SR_TNF            (1U << 1)
+#define MODEL_SSI_SR_RNE            (1U << 2)
+#define MODEL_SSI_SR_RFF            (1U << 3)
+#define MODEL_SSI_SR_BSY            (1U << 4)
+
+#define MODEL_SSI_RIS_ROR           (1U << 0)
+#define MODEL_SSI_RIS_RT            (1U << 1)
+#define MODEL_SSI_RIS_RX            (1U << 2)
+#define MODEL_SSI_RIS_TX            (1U << 3)
+
+#define MODEL_SSI_CR1_EOT           (1U << 4)
+
+
+/*******************************************************************************
+ *                              Global Variables                               *
+ *******************************************************************************/
+Model_Ssi g_modelSsi[4];
+
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+static uint32 Model_SsiRis(uint8 SsiNum)
+{
+    Model_Ssi* Ssi = &g_modelSsi[SsiNum];
+    uint32 Ris     = Ssi->Latched;
+
+    if(Ssi->RxCount >= (MODEL_SSI_FIFO_SIZE / 2U))
+    {
+        Ris |= MODEL_SSI_RIS_RX;
+    }
+
+    /* End of Transmission: FIFO empty and the last bit sent, otherwise FIFO half empty */
+    if( (Test_RegGet(MODEL_SSI_BASE(SsiNum) + MODEL_SSI_CR1) & MODEL_SSI_CR1_EOT) != 0 )
+    {
+        Ris |= (Ssi->TxCount == 0) ? MODEL_SSI_RIS_TX : 0U;
+    }
+    else
+    {
+        Ris |= (Ssi->TxCount <= (MODEL_SSI_FIFO_SIZE / 2U)) ? MODEL_SSI_RIS_TX : 0U;
+    }
+
+    return Ris;
+}
+
+static uint32 Model_SsiRead(uint32 Address, uint32 Value)
+{
+    Model_Ssi* Ssi = &g_modelSsi[MODEL_SSI_NUM(Address)];
+    uint8 SsiNum   = MODEL_SSI_NUM(Address);
+    uint32 Result  = 0;
+
+    switch(Address - MODEL_SSI_BASE(SsiNum))
+    {
+    case MODEL_SSI_DR:
+        if(Ssi->RxCount == 0)
+        {
+            return 0;
+        }
+        Result = Ssi->RxFifo[Ssi->RxFirst];
+        Ssi->RxFirst = (Ssi->RxFirst + 1U) % MODEL_SSI_FIFO_SIZE;
+        Ssi->RxCount--;
+        return Result;
+
+    case MODEL_SSI_SR:
+        if( (Ssi->AutoClock == TRUE) && (Ssi->TxCount != 0) )
+        {
+            Model_SsiClock(SsiNum, 1U);
+        }
+        Result  = (Ssi->TxCount == 0) ? MODEL_SSI_SR_TFE : MODEL_SSI_SR_BSY;
+        Result |= (Ssi->TxCount < MODEL_SSI_FIFO_SIZE) ? MODEL_SSI_SR_TNF : 0U;
+        Result |= (Ssi->RxCount != 0) ? MODEL_SSI_SR_RNE : 0U;
+        Result |= (Ssi->RxCount >= MODEL_SSI_FIFO_SIZE) ? MODEL_SSI_SR_RFF : 0U;
+        return Result;
+
+    case MODEL_SSI_RIS:
+        return Model_SsiRis(SsiNum);
+
+    case MODEL_SSI_MIS:
+        return Model_SsiPending(SsiNum);
+
+    default:
+        return Value;
+    }
+}
+
+static void Model_SsiWrite(uint32 Address, uint32 Value)
+{
+    Model_Ssi* Ssi = &g_modelSsi[MODEL_SSI_NUM(Address)];
+    uint8 SsiNum   = MODEL_SSI_NUM(Address);
+
+    switch(Address - MODEL_SSI_BASE(SsiNum))
+    {
+    case MODEL_SSI_DR:
+        if(Ssi->TxCount < MODEL_SSI_FIFO_SIZE)
+        {
+            Ssi->TxFifo[Ssi->TxCount] = (uint16)Value;
+            Ssi->TxCount++;
+        }
+        break;
+
+    case MODEL_SSI_ICR:
+        Ssi->Latched &= ~(Value & (MODEL_SSI_RIS_ROR | MODEL_SSI_RIS_RT));
+        break;
+
+    default:
+        break;
+    }
+}
+
+
+/*******************************************************************************
+ *                      Public Functions Definitions                           *
+ *******************************************************************************/
+
+/* Reset the model of an SSI and hook its registers */
+void Model_SsiAttach(uint8 SsiNum)
+{
+    memset(&g_modelSsi[SsiNum], 0, sizeof(Model_Ssi));
+
+    Test_RegHook(MODEL_SSI_BASE(SsiNum) + MODEL_SSI_DR,  Model_SsiRead, Model_SsiWrite);
+    Test_RegHook(MODEL_SSI_BASE(SsiNum) + MODEL_SSI_SR,  Model_SsiRead, NULL_PTR);
+    Test_RegHook(MODEL_SSI_BASE(SsiNum) + MODEL_SSI_RIS, Model_SsiRead, NULL_PTR);
+    Test_RegHook(MODEL_SSI_BASE(SsiNum) + MODEL_SSI_MIS, Model_SsiRead, NULL_PTR);
+    Test_RegHook(MODEL_SSI_BASE(SsiNum) + MODEL_SSI_ICR, NULL_PTR, Model_SsiWrite);
+}
+
+/* Frames the other side sends back, one for each clocked frame */
+void Model_SsiAnswer(uint8 SsiNum, const uint16* Frames, uint32 Length)
+{
+    Model_Ssi* Ssi = &g_modelSsi[SsiNum];
+
+    if(Length > MODEL_SSI_WIRE_SIZE)
+    {
+        Length = MODEL_SSI_WIRE_SIZE;
+    }
+    memcpy(Ssi->Miso, Frames, Length * sizeof(uint16));
+    Ssi->MisoCount = Length;
+    Ssi->MisoNext  = 0;
+}
+
+/* Clock Count frames of the Tx FIFO out, the answered frames go to the Rx FIFO */
+void Model_SsiClock(uint8 SsiNum, uint32 Count)
+{
+    Model_Ssi* Ssi = &g_modelSsi[SsiNum];
+    uint16 Frame   = MODEL_SSI_IDLE_FRAME;
+    uint16 Mosi    = 0;
+
+    while( (Count != 0) && (Ssi->TxCount != 0) )
+    {
+        Mosi = Ssi->TxFifo[0];
+        if(Ssi->MosiCount < MODEL_SSI_WIRE_SIZE)
+        {
+            Ssi->Mosi[Ssi->MosiCount] = Mosi;
+            Ssi->MosiCount++;
+        }
+        memmove(&Ssi->TxFifo[0], &Ssi->TxFifo[1], (Ssi->TxCount - 1U) * sizeof(uint16));
+        Ssi->TxCount--;
+        Count--;
+
+        Frame = MODEL_SSI_IDLE_FRAME;
+        if(Ssi->Device != NULL_PTR)
+        {
+            Frame = (*Ssi->Device)(Mosi);
+        }
+        else if(Ssi->MisoNext < Ssi->MisoCount)
+        {
+            Frame = Ssi->Miso[Ssi->MisoNext];
+            Ssi->MisoNext++;
+        }
+
+        if(Ssi->RxCount >= MODEL_SSI_FIFO_SIZE)
+        {
+            /* Frame is lost */
+            Ssi->Latched |= MODEL_SSI_RIS_ROR;
+            continue;
+        }
+        Ssi->RxFifo[(Ssi->RxFirst + Ssi->RxCount) % MODEL_SSI_FIFO_SIZE] = Frame;
+        Ssi->RxCount++;
+    }
+}
+
+/* Bus stays idle for 32 clocks with frames left in the Rx FIFO */
+void Model_SsiRxTimeOut(uint8 SsiNum)
+{
+    if(g_modelSsi[SsiNum].RxCount != 0)
+    {
+        g_modelSsi[SsiNum].Latched |= MODEL_SSI_RIS_RT;
+    }
+}
+
+/* Masked interrupt status (the SSI interrupt line is asserted if not 0) */
+uint32 Model_SsiPending(uint8 SsiNum)
+{
+    return Model_SsiRis(SsiNum) & Test_RegGet(MODEL_SSI_BASE(SsiNum) + MODEL_SSI_IM);
+}
+
+/* Call the ISR while the SSI interrupt line is asserted */
+void Model_SsiRunIsr(uint8 SsiNum, void (*Isr)(void))
+{
+    uint32 Entries = 0;
+
+    while( (Model_SsiPending(SsiNum) != 0) && (Entries < 1000U) )
+    {
+        (*Isr)();
+        Entries++;
+    }
+}
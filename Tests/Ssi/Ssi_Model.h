@@ -0,0 +1,69 @@
+/********************************************************************************
+ * @headerfile    Ssi_Model.h
+ * @brief         Header file for the SSI peripheral model of the host tests
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ * @note          The model hooks SSIDR, SSISR, SSIRIS, SSIMIS and SSIICR:
+ *                - Tx FIFO (8 frames) is filled by SSIDR writes and clocked out
+ *                  by Model_SsiClock(), which also receives one MISO frame for
+ *                  each sent frame (Rx FIFO of 8 frames, overrun when full)
+ *                  from the MISO script, or from Device when it is set
+ *                - Raw interrupts are computed from the FIFO levels (Transmit
+ *                  follows SSICR1 EOT), Receive Time-Out and Overrun are
+ *                  latched until cleared by SSIICR
+ *******************************************************************************/
+
+#ifndef TESTS_SSI_SSI_MODEL_H_
+#define TESTS_SSI_SSI_MODEL_H_
+
+#include "Test_Harness.h"
+
+
+/*******************************************************************************
+ *                                  Defines                                    *
+ *******************************************************************************/
+#define MODEL_SSI_FIFO_SIZE         (8U)
+#define MODEL_SSI_WIRE_SIZE         (4096U)
+
+/* Frame received when the MISO script is over (line pulled high) */
+#define MODEL_SSI_IDLE_FRAME        (0xFFFFU)
+
+
+/*******************************************************************************
+ *                              User Defined Data Types                        *
+ *******************************************************************************/
+typedef struct{
+    uint16  TxFifo[MODEL_SSI_FIFO_SIZE];    /* Frames written to SSIDR, not sent yet    */
+    uint32  TxCount;
+    uint16  Mosi[MODEL_SSI_WIRE_SIZE];      /* Frames sent, in order                    */
+    uint32  MosiCount;
+    uint16  Miso[MODEL_SSI_WIRE_SIZE];      /* Frames the other side answers, in order  */
+    uint32  MisoCount;
+    uint32  MisoNext;
+    uint16  RxFifo[MODEL_SSI_FIFO_SIZE];    /* Received frames                          */
+    uint32  RxFirst;
+    uint32  RxCount;
+    uint32  Latched;                        /* Receive Time-Out and Overrun raw status  */
+    uint8   AutoClock;                      /* Each SSISR read clocks one frame         */
+    uint16  (*Device)(uint16 Mosi);         /* Device answering each frame (or NULL_PTR)*/
+}Model_Ssi;
+
+
+/*******************************************************************************
+ *                              Global Variables                               *
+ *******************************************************************************/
+extern Model_Ssi g_modelSsi[4];
+
+
+/*******************************************************************************
+ *                              Functions Prototypes                           *
+ *******************************************************************************/
+void Model_SsiAttach(uint8 SsiNum);
+void Model_SsiAnswer(uint8 SsiNum, const uint16* Frames, uint32 Length);
+void Model_SsiClock(uint8 SsiNum, uint32 Count);
+void Model_SsiRxTimeOut(uint8 SsiNum);
+uint32 Model_SsiPending(uint8 SsiNum);
+void Model_SsiRunIsr(uint8 SsiNum, void (*Isr)(void));
+
+#endif /* TESTS_SSI_SSI_MODEL_H_ */
@@ -0,0 +1,10 @@
+/********************************************************************************
+ * @headerfile    Ssi_Priv.h
+ * @brief         Forwarding header of the host tests: the SSI driver includes
+ *                "Ssi_Priv.h" while the file is SSI_Priv.h (case sensitive host)
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ *******************************************************************************/
+
+#include "SSI_Priv.h"
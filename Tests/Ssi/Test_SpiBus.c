@@ -0,0 +1,245 @@
+/********************************************************************************
+ * @file          Test_SpiBus.c
+ * @brief         Host tests of the SPI bus manager with two devices of other
+ *                clock rate and mode (CR0/CPSR rewritten only when the device
+ *                changes) and of transactions failing on a busy SSI module
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ *******************************************************************************/
+
+#include "SSI_Prog.c"
+#include "SPIBUS_Prog.c"
+#include "Udma_Fake.h"
+#include "Ssi_Model.h"
+
+
+/* Chip-selects: GPIO Port A pins 3 and 4 */
+#define TEST_CS_A_ADDRESS           SPIBUS_CS_PIN_ADDRESS(0x40004000U, 3)
+#define TEST_CS_B_ADDRESS           SPIBUS_CS_PIN_ADDRESS(0x40004000U, 4)
+
+/* Chip-select cycles recorded */
+#define TEST_LOG_SIZE               (16U)
+
+static Ssi_Config g_busConfig;
+static Ssi_Config g_deviceA;
+static Ssi_Config g_deviceB;
+static uint8 g_indexA;
+static uint8 g_indexB;
+
+/* CR0 and CPSR writes of the driver */
+static uint32 g_cr0Writes;
+static uint32 g_cpsrWrites;
+
+/* CR0/CPSR values in the module when each chip-select was asserted */
+static uint32 g_logCr0[TEST_LOG_SIZE];
+static uint32 g_logCpsr[TEST_LOG_SIZE];
+static uint32 g_logCount;
+
+/* Transaction callbacks: count, IRQs nesting depth and status seen by the last one */
+static uint32 g_doneCount;
+static uint32 g_doneDepth;
+static SpiBus_Transaction* g_doneWatch;
+static uint8 g_doneStatus;
+
+static void Test_CountCr0(uint32 Address, uint32 Value)
+{
+    (void)Address;
+    (void)Value;
+    g_cr0Writes++;
+}
+
+static void Test_CountCpsr(uint32 Address, uint32 Value)
+{
+    (void)Address;
+    (void)Value;
+    g_cpsrWrites++;
+}
+
+static void Test_ChipSelect(uint32 Address, uint32 Value)
+{
+    (void)Address;
+
+    if( (Value == SPIBUS_CS_ASSERT) && (g_logCount < TEST_LOG_SIZE) )
+    {
+        g_logCr0[g_logCount]  = Test_RegGet(SSI_0_BASE_ADDRESS + SSI_CR0_REG_OFFSET);
+        g_logCpsr[g_logCount] = Test_RegGet(SSI_0_BASE_ADDRESS + SSI_CPSR_REG_OFFSET);
+        g_logCount++;
+    }
+}
+
+static void Test_TransactionDone(void)
+{
+    g_doneCount++;
+    g_doneDepth = Test_CriticalDepth();
+    if(g_doneWatch != NULL_PTR)
+    {
+        g_doneStatus = g_doneWatch->Status;
+    }
+}
+
+static void Test_BusSetUp(void)
+{
+    memset(&g_busConfig, 0, sizeof(g_busConfig));
+    g_busConfig.SsiNum         = Ssi0;
+    g_busConfig.WordLength     = SsiEightBits;
+    g_busConfig.SsiInterrupts  = SsiInterruptsDisabled;
+    g_busConfig.SsiFreq        = 1000000U;
+    g_busConfig.ClkValue       = 80000000U;
+    g_busConfig.SsiMode        = SSI_MODE_MASTER;
+    g_busConfig.ClkSrc         = SSI_CLOCK_SRC_SYSTEM;
+    g_busConfig.SsiFrameFormat = SSI_FRAME_FORMAT_FREESCALE_SSI;
+
+    /* Device A: mode 0 at 1 MHz (bus settings), device B: mode 3 at 100 kHz (other prescaler) */
+    g_deviceA = g_busConfig;
+    g_deviceB = g_busConfig;
+    g_deviceB.SsiFreq        = 100000U;
+    g_deviceB.SsiClkPolarity = SSI_CLOCK_POLARITY_HIGH;
+    g_deviceB.SsiClkPhase    = SSI_CLOCK_PHASE_FALLING;
+
+    memset(g_ssiItTransfer, 0, sizeof(g_ssiItTransfer));
+    memset(g_ssiDmaTransfer, 0, sizeof(g_ssiDmaTransfer));
+    memset(g_spiBuses, 0, sizeof(g_spiBuses));
+    g_spiBusDeviceCount = 0;
+    g_logCount  = 0;
+    g_doneCount = 0;
+    g_doneDepth = 0;
+    g_doneWatch = NULL_PTR;
+
+    Fake_UdmaReset();
+    Model_SsiAttach(Ssi0);
+    g_modelSsi[Ssi0].AutoClock = TRUE;
+
+    TEST_ASSERT_EQ(RET_OK, SpiBus_Init(&g_busConfig));
+    g_indexA = SpiBus_AddDevice(&g_deviceA, TEST_CS_A_ADDRESS);
+    g_indexB = SpiBus_AddDevice(&g_deviceB, TEST_CS_B_ADDRESS);
+    TEST_ASSERT_EQ(0, g_indexA);
+    TEST_ASSERT_EQ(1, g_indexB);
+
+    /* Only writes done by the transactions are counted */
+    g_cr0Writes  = 0;
+    g_cpsrWrites = 0;
+    Test_RegHook(SSI_0_BASE_ADDRESS + SSI_CR0_REG_OFFSET, NULL_PTR, Test_CountCr0);
+    Test_RegHook(SSI_0_BASE_ADDRESS + SSI_CPSR_REG_OFFSET, NULL_PTR, Test_CountCpsr);
+    Test_RegHook(TEST_CS_A_ADDRESS, NULL_PTR, Test_ChipSelect);
+    Test_RegHook(TEST_CS_B_ADDRESS, NULL_PTR, Test_ChipSelect);
+}
+
+/* Clock the queued transactions out (SSI ISR served after each FIFO) until the bus is idle */
+static void Test_BusRun(void)
+{
+    uint32 Rounds = 0;
+
+    while( (g_spiBuses[Ssi0].Current != NULL_PTR) && (Rounds < 1000U) )
+    {
+        Model_SsiClock(Ssi0, MODEL_SSI_FIFO_SIZE);
+        Model_SsiRunIsr(Ssi0, SSI0_ISR);
+        Rounds++;
+    }
+}
+
+static void Test_SettingsRewrittenOnlyWhenDeviceChanges(void)
+{
+    /* A, A, B, B, A: the module is switched twice */
+    static const uint8 Order[5] = {0, 0, 1, 1, 0};
+    static SpiBus_Transaction Transactions[5];
+    static uint8 Tx[5][3];
+    Ssi_FrameSettings SettingsA;
+    Ssi_FrameSettings SettingsB;
+    uint32 Index = 0;
+
+    Test_BusSetUp();
+    TEST_ASSERT_EQ(RET_OK, Ssi_GetFrameSettings(&g_deviceA, &SettingsA));
+    TEST_ASSERT_EQ(RET_OK, Ssi_GetFrameSettings(&g_deviceB, &SettingsB));
+    TEST_ASSERT(SettingsA.Cr0 != SettingsB.Cr0);
+    TEST_ASSERT(SettingsA.Cpsr != SettingsB.Cpsr);
+
+    memset(Transactions, 0, sizeof(Transactions));
+    for(Index = 0; Index < 5U; Index++)
+    {
+        Transactions[Index].Device   = (Order[Index] == 0) ? g_indexA : g_indexB;
+        Transactions[Index].TxBuffer = Tx[Index];
+        Transactions[Index].Length   = 3;
+        Transactions[Index].CallBack = Test_TransactionDone;
+        TEST_ASSERT_EQ(RET_OK, SpiBus_Submit(&Transactions[Index]));
+    }
+    Test_BusRun();
+
+    TEST_ASSERT_EQ(5, g_doneCount);
+    TEST_ASSERT_EQ(15, g_modelSsi[Ssi0].MosiCount);
+    TEST_ASSERT_EQ(2, g_cr0Writes);
+    TEST_ASSERT_EQ(2, g_cpsrWrites);
+
+    /* Every device was selected with its own settings in the module */
+    TEST_ASSERT_EQ(5, g_logCount);
+    for(Index = 0; Index < 5U; Index++)
+    {
+        TEST_ASSERT_EQ( (Order[Index] == 0) ? SettingsA.Cr0 : SettingsB.Cr0, g_logCr0[Index]);
+        TEST_ASSERT_EQ( (Order[Index] == 0) ? SettingsA.Cpsr : SettingsB.Cpsr, g_logCpsr[Index]);
+        TEST_ASSERT_EQ(SPIBUS_TRANSACTION_IDLE, Transactions[Index].Status);
+    }
+    TEST_ASSERT_EQ(SPIBUS_CS_RELEASE, TEST_REG(TEST_CS_A_ADDRESS));
+    TEST_ASSERT_EQ(SPIBUS_CS_RELEASE, TEST_REG(TEST_CS_B_ADDRESS));
+
+    /* Same device again later: nothing to rewrite */
+    TEST_ASSERT_EQ(RET_OK, SpiBus_Submit(&Transactions[0]));
+    Test_BusRun();
+    TEST_ASSERT_EQ(2, g_cr0Writes);
+    TEST_ASSERT_EQ(2, g_cpsrWrites);
+}
+
+static void Test_FailedStartIsReportedWithIrqsEnabled(void)
+{
+    static SpiBus_Transaction Failing;
+    static SpiBus_Transaction Next;
+    static const uint8 Tx[2] = {0x9F, 0x00};
+
+    Test_BusSetUp();
+
+    /* SSI module is used directly by an interrupt driven transfer */
+    TEST_ASSERT_EQ(RET_OK, Ssi_TransferIT(&g_busConfig, Tx, NULL_PTR, sizeof(Tx), NULL_PTR));
+
+    memset(&Failing, 0, sizeof(Failing));
+    Failing.Device   = g_indexB;
+    Failing.TxBuffer = Tx;
+    Failing.Length   = sizeof(Tx);
+    Failing.CallBack = Test_TransactionDone;
+    g_doneWatch      = &Failing;
+
+    /* Queued, then reported as failed from SpiBus_Submit() outside its critical section */
+    g_doneDepth = 0xFFU;
+    TEST_ASSERT_EQ(RET_OK, SpiBus_Submit(&Failing));
+    TEST_ASSERT_EQ(1, g_doneCount);
+    TEST_ASSERT_EQ(0, g_doneDepth);
+    TEST_ASSERT_EQ(SPIBUS_TRANSACTION_FAILED, g_doneStatus);
+    TEST_ASSERT_EQ(SPIBUS_CS_RELEASE, TEST_REG(TEST_CS_B_ADDRESS));
+    TEST_ASSERT(g_spiBuses[Ssi0].Current == NULL_PTR);
+    TEST_ASSERT_EQ(0, Test_CriticalDepth());
+
+    /* Direct transfer ends, the bus works again */
+    Model_SsiClock(Ssi0, MODEL_SSI_FIFO_SIZE);
+    Model_SsiRunIsr(Ssi0, SSI0_ISR);
+    TEST_ASSERT_EQ(FALSE, g_ssiItTransfer[Ssi0].Busy);
+
+    memset(&Next, 0, sizeof(Next));
+    Next.Device   = g_indexA;
+    Next.TxBuffer = Tx;
+    Next.Length   = sizeof(Tx);
+    Next.CallBack = Test_TransactionDone;
+    g_doneWatch   = &Next;
+    TEST_ASSERT_EQ(RET_OK, SpiBus_Submit(&Next));
+    TEST_ASSERT_EQ(SPIBUS_TRANSACTION_RUNNING, Next.Status);
+    Test_BusRun();
+    TEST_ASSERT_EQ(2, g_doneCount);
+    TEST_ASSERT_EQ(SPIBUS_TRANSACTION_IDLE, g_doneStatus);
+}
+
+int main(void)
+{
+    Test_RegsInit();
+
+    TEST_RUN(Test_SettingsRewrittenOnlyWhenDeviceChanges);
+    TEST_RUN(Test_FailedStartIsReportedWithIrqsEnabled);
+
+    return Test_Summary("Test_SpiBus");
+}
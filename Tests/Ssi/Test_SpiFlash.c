@@ -0,0 +1,391 @@
+/********************************************************************************
+ * @file          Test_SpiFlash.c
+ * @brief         Host tests of SPI NOR flash operations on the SPI bus manager
+ *                against a flash simulator (Program, Erase, Read, JEDEC ID and
+ *                Write In Progress polling)
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ *******************************************************************************/
+
+#include "SSI_Prog.c"
+#include "SPIBUS_Prog.c"
+#include "SPIFLASH_Prog.c"
+#include "Udma_Fake.h"
+#include "Ssi_Model.h"
+
+
+/* Chip-select of the flash: GPIO Port A pin 3 */
+#define TEST_CS_ADDRESS             SPIBUS_CS_PIN_ADDRESS(0x40004000U, 3)
+
+/* Simulated device: 64 KB (capacity code 0x10) */
+#define SIM_FLASH_SIZE              (0x10000U)
+#define SIM_FLASH_JEDEC_ID          (0xEF4010U)
+
+/* Status Register reads which still see WIP after program/erase */
+#define SIM_FLASH_PROGRAM_POLLS     (2U)
+#define SIM_FLASH_ERASE_POLLS       (5U)
+
+/* Commands logged (one per chip-select cycle) */
+#define SIM_FLASH_LOG_SIZE          (32U)
+
+typedef struct{
+    uint8   Memory[SIM_FLASH_SIZE];
+    uint8   Page[SPIFLASH_PAGE_SIZE];       /* Page Program data latched until chip-select release */
+    uint32  PageCount;
+    uint8   Selected;
+    uint8   Command;
+    uint32  Index;                          /* Bytes since chip-select assert */
+    uint32  Address;
+    uint8   WriteEnabled;                   /* WEL */
+    uint32  BusyPolls;                      /* WIP is read as set this many times more */
+    uint8   Log[SIM_FLASH_LOG_SIZE];
+    uint32  LogCount;
+    uint32  Lengths[SIM_FLASH_LOG_SIZE];    /* Bytes of each chip-select cycle */
+    uint32  Addresses[SIM_FLASH_LOG_SIZE];  /* Address of each chip-select cycle */
+}Sim_Flash;
+
+static Sim_Flash g_simFlash;
+static Ssi_Config g_busConfig;
+static Ssi_Config g_flashConfig;
+static SpiFlash_Handle g_flash;
+
+
+/* Flash side of one frame, chip-select is asserted */
+static uint16 Sim_FlashFrame(uint16 Mosi)
+{
+    Sim_Flash* Flash = &g_simFlash;
+    uint8 Byte   = (uint8)Mosi;
+    uint8 Answer = 0xFF;
+
+    if(Flash->Selected != TRUE)
+    {
+        return MODEL_SSI_IDLE_FRAME;
+    }
+
+    if(Flash->Index == 0)
+    {
+        Flash->Command = Byte;
+    }
+    else if( (Flash->Index <= 3U) && (Flash->Command != SPIFLASH_CMD_READ_STATUS) &&
+             (Flash->Command != SPIFLASH_CMD_READ_JEDEC_ID) )
+    {
+        Flash->Address = ( (Flash->Address << 8) | Byte ) & 0xFFFFFFU;
+    }
+    else
+    {
+        switch(Flash->Command)
+        {
+        case SPIFLASH_CMD_READ_STATUS:
+            Answer = (uint8)( ( (Flash->BusyPolls != 0) ? 0x01U : 0U ) | ( (Flash->WriteEnabled == TRUE) ? 0x02U : 0U ) );
+            break;
+
+        case SPIFLASH_CMD_READ_JEDEC_ID:
+            Answer = (Flash->Index <= 3U) ? (uint8)(SIM_FLASH_JEDEC_ID >> (8U * (3U - Flash->Index))) : 0xFF;
+            break;
+
+        case SPIFLASH_CMD_FAST_READ:
+            /* Index 4 is the dummy byte */
+            if( (Flash->Index > 4U) && (Flash->BusyPolls == 0) )
+            {
+                Answer = Flash->Memory[(Flash->Address + Flash->Index - 5U) % SIM_FLASH_SIZE];
+            }
+            break;
+
+        case SPIFLASH_CMD_PAGE_PROGRAM:
+            /* Bytes past the page end wrap inside the latch, as on the device */
+            Flash->Page[(Flash->Address + Flash->PageCount) % SPIFLASH_PAGE_SIZE] = Byte;
+            Flash->PageCount++;
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    Flash->Index++;
+
+    return Answer;
+}
+
+/* Chip-select edges: the operation runs when the flash is deselected */
+static void Sim_FlashSelect(uint32 Address, uint32 Value)
+{
+    Sim_Flash* Flash = &g_simFlash;
+    uint32 Offset = 0;
+
+    if(Value == SPIBUS_CS_ASSERT)
+    {
+        Flash->Selected  = TRUE;
+        Flash->Index     = 0;
+        Flash->Address   = 0;
+        Flash->PageCount = 0;
+        memset(Flash->Page, 0xFF, sizeof(Flash->Page));
+        return;
+    }
+
+    if( (Flash->Selected != TRUE) || (Flash->Index == 0) )
+    {
+        Flash->Selected = FALSE;
+        return;
+    }
+    Flash->Selected = FALSE;
+
+    if(Flash->LogCount < SIM_FLASH_LOG_SIZE)
+    {
+        Flash->Log[Flash->LogCount]       = Flash->Command;
+        Flash->Lengths[Flash->LogCount]   = Flash->Index;
+        Flash->Addresses[Flash->LogCount] = Flash->Address;
+        Flash->LogCount++;
+    }
+
+    /* Only Read Status Register is accepted while writing */
+    if(Flash->BusyPolls != 0)
+    {
+        if(Flash->Command == SPIFLASH_CMD_READ_STATUS)
+        {
+            Flash->BusyPolls--;
+        }
+        return;
+    }
+
+    switch(Flash->Command)
+    {
+    case SPIFLASH_CMD_WRITE_ENABLE:
+        Flash->WriteEnabled = TRUE;
+        break;
+
+    case SPIFLASH_CMD_PAGE_PROGRAM:
+        if( (Flash->WriteEnabled == TRUE) && (Flash->Index >= 4U) )
+        {
+            for(Offset = 0; Offset < SPIFLASH_PAGE_SIZE; Offset++)
+            {
+                Flash->Memory[( (Flash->Address & ~(SPIFLASH_PAGE_SIZE - 1U)) + Offset ) % SIM_FLASH_SIZE] &= Flash->Page[Offset];
+            }
+            Flash->WriteEnabled = FALSE;
+            Flash->BusyPolls    = SIM_FLASH_PROGRAM_POLLS;
+        }
+        break;
+
+    case SPIFLASH_CMD_SECTOR_ERASE:
+        if( (Flash->WriteEnabled == TRUE) && (Flash->Index == 4U) )
+        {
+            memset(&Flash->Memory[(Flash->Address % SIM_FLASH_SIZE) & ~(SPIFLASH_SECTOR_SIZE - 1U)], 0xFF, SPIFLASH_SECTOR_SIZE);
+            Flash->WriteEnabled = FALSE;
+            Flash->BusyPolls    = SIM_FLASH_ERASE_POLLS;
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+static void Test_FlashSetUp(void)
+{
+    uint8 Device = SPIBUS_NO_DEVICE;
+
+    memset(&g_busConfig, 0, sizeof(g_busConfig));
+    g_busConfig.SsiNum         = Ssi0;
+    g_busConfig.WordLength     = SsiEightBits;
+    g_busConfig.SsiInterrupts  = SsiInterruptsDisabled;
+    g_busConfig.SsiFreq        = 1000000U;
+    g_busConfig.ClkValue       = 80000000U;
+    g_busConfig.SsiMode        = SSI_MODE_MASTER;
+    g_busConfig.ClkSrc         = SSI_CLOCK_SRC_SYSTEM;
+    g_busConfig.SsiFrameFormat = SSI_FRAME_FORMAT_FREESCALE_SSI;
+    g_flashConfig = g_busConfig;
+    g_flashConfig.SsiFreq      = 10000000U;
+
+    memset(g_ssiItTransfer, 0, sizeof(g_ssiItTransfer));
+    memset(g_spiBuses, 0, sizeof(g_spiBuses));
+    g_spiBusDeviceCount = 0;
+
+    memset(&g_simFlash, 0, sizeof(g_simFlash));
+    memset(g_simFlash.Memory, 0xFF, sizeof(g_simFlash.Memory));
+
+    Model_SsiAttach(Ssi0);
+    g_modelSsi[Ssi0].AutoClock = TRUE;
+    g_modelSsi[Ssi0].Device    = Sim_FlashFrame;
+    Test_RegHook(TEST_CS_ADDRESS, NULL_PTR, Sim_FlashSelect);
+
+    TEST_ASSERT_EQ(RET_OK, SpiBus_Init(&g_busConfig));
+    Device = SpiBus_AddDevice(&g_flashConfig, TEST_CS_ADDRESS);
+    TEST_ASSERT_EQ(0, Device);
+    TEST_ASSERT_EQ(RET_OK, SpiFlash_Init(&g_flash, Device));
+}
+
+/* Clock the queued transactions out (SSI ISR served after each FIFO) until the bus is idle */
+static void Test_BusRun(void)
+{
+    uint32 Rounds = 0;
+
+    do
+    {
+        Model_SsiClock(Ssi0, MODEL_SSI_FIFO_SIZE);
+        Model_SsiRunIsr(Ssi0, SSI0_ISR);
+        Rounds++;
+    }while( (g_modelSsi[Ssi0].TxCount != 0) && (Rounds < 1000U) );
+}
+
+/* Run the bus and poll the flash until its operation is over, returns the polls */
+static uint32 Test_FlashWait(uint8 ExpectedState)
+{
+    uint32 Polls = 0;
+    uint8 State  = SPIFLASH_STATE_BUSY;
+
+    while( (State == SPIFLASH_STATE_BUSY) && (Polls < 1000U) )
+    {
+        Test_BusRun();
+        State = SpiFlash_Poll(&g_flash);
+        Polls++;
+    }
+    TEST_ASSERT_EQ(ExpectedState, State);
+
+    return Polls;
+}
+
+static void Test_JedecIdIsRead(void)
+{
+    Test_FlashSetUp();
+
+    TEST_ASSERT_EQ(0, SpiFlash_GetCapacity(&g_flash));
+    TEST_ASSERT_EQ(RET_OK, SpiFlash_ReadJedecId(&g_flash));
+    TEST_ASSERT_EQ(SPIFLASH_STATE_BUSY, SpiFlash_Poll(&g_flash));
+    Test_FlashWait(SPIFLASH_STATE_READY);
+
+    TEST_ASSERT_EQ(SIM_FLASH_JEDEC_ID, SpiFlash_GetJedecId(&g_flash));
+    TEST_ASSERT_EQ(SIM_FLASH_SIZE, SpiFlash_GetCapacity(&g_flash));
+    TEST_ASSERT_EQ(1, g_simFlash.LogCount);
+    TEST_ASSERT_EQ(4, g_simFlash.Lengths[0]);
+
+    /* Device clock rate is applied for its transactions */
+    TEST_ASSERT_EQ(g_spiBusDevices[0].Settings.Cpsr, TEST_REG(SSI_0_BASE_ADDRESS + SSI_CPSR_REG_OFFSET));
+    TEST_ASSERT_EQ(SPIBUS_CS_RELEASE, TEST_REG(TEST_CS_ADDRESS));
+}
+
+static void Test_ProgramPollsWriteInProgress(void)
+{
+    uint8 Data[100];
+    uint8 ReadBack[104];
+    uint32 Index = 0;
+    uint32 Polls = 0;
+
+    for(Index = 0; Index < sizeof(Data); Index++)
+    {
+        Data[Index] = (uint8)(0xA0U + Index);
+    }
+
+    Test_FlashSetUp();
+
+    /* 100 bytes at the end of page 0x0100 */
+    TEST_ASSERT_EQ(RET_OK, SpiFlash_ProgramPage(&g_flash, 0x01FFU - 99U, Data, sizeof(Data)));
+    TEST_ASSERT_EQ(RET_NOT_OK, SpiFlash_Read(&g_flash, 0, ReadBack, 1));
+    Polls = Test_FlashWait(SPIFLASH_STATE_READY);
+
+    /* Write Enable, Page Program (header and data in one chip-select cycle), then Read Status until WIP is cleared */
+    TEST_ASSERT_EQ(2U + SIM_FLASH_PROGRAM_POLLS + 1U, g_simFlash.LogCount);
+    TEST_ASSERT_EQ(SPIFLASH_CMD_WRITE_ENABLE, g_simFlash.Log[0]);
+    TEST_ASSERT_EQ(SPIFLASH_CMD_PAGE_PROGRAM, g_simFlash.Log[1]);
+    TEST_ASSERT_EQ(SPIFLASH_ADDRESS_HEADER_LENGTH + sizeof(Data), g_simFlash.Lengths[1]);
+    for(Index = 2; Index < g_simFlash.LogCount; Index++)
+    {
+        TEST_ASSERT_EQ(SPIFLASH_CMD_READ_STATUS, g_simFlash.Log[Index]);
+    }
+    TEST_ASSERT(Polls >= SIM_FLASH_PROGRAM_POLLS + 1U);
+    TEST_ASSERT_EQ(0, g_simFlash.BusyPolls);
+    TEST_ASSERT_EQ(FALSE, g_simFlash.WriteEnabled);
+
+    TEST_ASSERT_EQ(RET_OK, SpiFlash_Read(&g_flash, 0x01FFU - 101U, ReadBack, sizeof(ReadBack)));
+    Test_FlashWait(SPIFLASH_STATE_READY);
+    TEST_ASSERT_EQ(0xFF, ReadBack[0]);
+    TEST_ASSERT_EQ(0xFF, ReadBack[1]);
+    TEST_ASSERT(memcmp(&ReadBack[2], Data, sizeof(Data)) == 0);
+    TEST_ASSERT_EQ(0xFF, ReadBack[102]);
+    TEST_ASSERT_EQ(SPIFLASH_FAST_READ_HEADER_LENGTH + sizeof(ReadBack), g_simFlash.Lengths[g_simFlash.LogCount - 1U]);
+
+    /* Programming only clears bits */
+    Data[0] = 0x0F;
+    TEST_ASSERT_EQ(RET_OK, SpiFlash_ProgramPage(&g_flash, 0x01FFU - 99U, Data, 1));
+    Test_FlashWait(SPIFLASH_STATE_READY);
+    TEST_ASSERT_EQ(0x00, g_simFlash.Memory[0x01FFU - 99U]);
+
+    /* Data crossing a page is rejected */
+    TEST_ASSERT_EQ(RET_NOT_OK, SpiFlash_ProgramPage(&g_flash, 0x01FFU - 98U, Data, sizeof(Data)));
+}
+
+static void Test_EraseClearsTheSector(void)
+{
+    uint8 Data[4] = {0x11, 0x22, 0x33, 0x44};
+    uint32 Before = 0;
+    uint32 Polls  = 0;
+
+    Test_FlashSetUp();
+    g_simFlash.Memory[0x1FFFU] = 0x00;
+    g_simFlash.Memory[0x3000U] = 0x00;
+
+    TEST_ASSERT_EQ(RET_OK, SpiFlash_ProgramPage(&g_flash, 0x2010U, Data, sizeof(Data)));
+    Test_FlashWait(SPIFLASH_STATE_READY);
+    TEST_ASSERT_EQ(0x22, g_simFlash.Memory[0x2011U]);
+
+    /* Any address of the sector, the header carries the sector start */
+    Before = g_simFlash.LogCount;
+    TEST_ASSERT_EQ(RET_OK, SpiFlash_EraseSector(&g_flash, 0x2ABCU));
+    Polls = Test_FlashWait(SPIFLASH_STATE_READY);
+    TEST_ASSERT(Polls >= SIM_FLASH_ERASE_POLLS + 1U);
+    TEST_ASSERT_EQ(2U + SIM_FLASH_ERASE_POLLS + 1U, g_simFlash.LogCount - Before);
+    TEST_ASSERT_EQ(SPIFLASH_CMD_WRITE_ENABLE, g_simFlash.Log[Before]);
+    TEST_ASSERT_EQ(SPIFLASH_CMD_SECTOR_ERASE, g_simFlash.Log[Before + 1U]);
+    TEST_ASSERT_EQ(SPIFLASH_ADDRESS_HEADER_LENGTH, g_simFlash.Lengths[Before + 1U]);
+    TEST_ASSERT_EQ(0x2000U, g_simFlash.Addresses[Before + 1U]);
+    TEST_ASSERT_EQ(0xFF, g_simFlash.Memory[0x2011U]);
+    TEST_ASSERT_EQ(0x00, g_simFlash.Memory[0x1FFFU]);
+    TEST_ASSERT_EQ(0x00, g_simFlash.Memory[0x3000U]);
+}
+
+static void Test_FullQueueIsReported(void)
+{
+    static SpiBus_Transaction Others[SPIBUS_QUEUE_DEPTH];
+    static const uint8 Header = SPIFLASH_CMD_READ_STATUS;
+    uint8 Answer = 0;
+    uint32 Index = 0;
+
+    Test_FlashSetUp();
+    memset(Others, 0, sizeof(Others));
+
+    /* One transaction on the bus, the queue has room for Write Enable only */
+    for(Index = 0; Index < SPIBUS_QUEUE_DEPTH; Index++)
+    {
+        Others[Index].Device       = 0;
+        Others[Index].Header       = &Header;
+        Others[Index].HeaderLength = 1;
+        Others[Index].RxBuffer     = &Answer;
+        Others[Index].Length       = 1;
+        TEST_ASSERT_EQ(RET_OK, SpiBus_Submit(&Others[Index]));
+    }
+
+    /* Write Enable alone is queued: the operation fails and nothing is erased */
+    g_simFlash.Memory[0] = 0x00;
+    TEST_ASSERT_EQ(RET_NOT_OK, SpiFlash_EraseSector(&g_flash, 0));
+    TEST_ASSERT_EQ(SPIFLASH_STATE_ERROR, SpiFlash_Poll(&g_flash));
+    Test_BusRun();
+    TEST_ASSERT_EQ(SPIFLASH_CMD_WRITE_ENABLE, g_simFlash.Log[g_simFlash.LogCount - 1U]);
+    TEST_ASSERT_EQ(0x00, g_simFlash.Memory[0]);
+
+    /* The next operation runs normally */
+    TEST_ASSERT_EQ(RET_OK, SpiFlash_EraseSector(&g_flash, 0));
+    Test_FlashWait(SPIFLASH_STATE_READY);
+    TEST_ASSERT_EQ(0xFF, g_simFlash.Memory[0]);
+}
+
+int main(void)
+{
+    Test_RegsInit();
+
+    TEST_RUN(Test_JedecIdIsRead);
+    TEST_RUN(Test_ProgramPollsWriteInProgress);
+    TEST_RUN(Test_EraseClearsTheSector);
+    TEST_RUN(Test_FullQueueIsReported);
+
+    return Test_Summary("Test_SpiFlash");
+}
@@ -0,0 +1,188 @@
+/********************************************************************************
+ * @file          Test_SsiClock.c
+ * @brief         Host tests of SSI clock dividers solver (brute force sweep of
+ *                every CPSDVSR/SCR pair) and of the frame settings
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ *******************************************************************************/
+
+#include "SSI_Prog.c"
+#include "Udma_Fake.h"
+#include "Test_Harness.h"
+
+
+/* Biggest total divisor (CPSDVSR * (1 + SCR)) */
+#define TEST_DIVISOR_MAX            (SSI_CPSDVSR_MAX * SSI_SCR_PLUS_ONE_MAX)
+
+/* Module clocks of the sweep (PIOSC, crystals and PLL outputs) */
+static const uint32 g_clocks[] = {
+    1000000U, 3686400U, 16000000U, 20000000U, 25000000U, 40000000U, 50000000U, 66666666U, 80000000U
+};
+
+/* Smallest achievable total divisor at or above each divisor (0: none) */
+static uint32 g_nextDivisor[TEST_DIVISOR_MAX + 2U];
+
+/* Mismatches printed so far (the first ones are enough) */
+static uint32 g_reported;
+
+/* Mark every CPSDVSR * (1 + SCR) product, then fill the gaps from the top */
+static void Test_BuildDivisors(void)
+{
+    static uint8 Achievable[TEST_DIVISOR_MAX + 2U];
+    uint32 Cpsdvsr = 0;
+    uint32 ScrPlusOne = 0;
+    uint32 Divisor = 0;
+
+    for(Cpsdvsr = SSI_CPSDVSR_MIN; Cpsdvsr <= SSI_CPSDVSR_MAX; Cpsdvsr += 2U)
+    {
+        for(ScrPlusOne = 1U; ScrPlusOne <= SSI_SCR_PLUS_ONE_MAX; ScrPlusOne++)
+        {
+            Achievable[Cpsdvsr * ScrPlusOne] = TRUE;
+        }
+    }
+
+    g_nextDivisor[TEST_DIVISOR_MAX + 1U] = 0;
+    for(Divisor = TEST_DIVISOR_MAX + 1U; Divisor-- > 0; )
+    {
+        g_nextDivisor[Divisor] = (Achievable[Divisor] == TRUE) ? Divisor : g_nextDivisor[Divisor + 1U];
+    }
+}
+
+/* Brute force result: achieved clock of the smallest divisor not exceeding SsiFreq */
+static uint32 Test_ReferenceClock(uint32 ClkValue, uint32 SsiFreq)
+{
+    uint64 MinDivisor = ((uint64)ClkValue + SsiFreq - 1U) / SsiFreq;
+
+    if(MinDivisor > TEST_DIVISOR_MAX)
+    {
+        return 0;
+    }
+
+    return ClkValue / g_nextDivisor[MinDivisor];
+}
+
+/* Solver result MUST be the brute force one with valid register values */
+static uint8 Test_SolveMatches(uint32 ClkValue, uint32 SsiFreq)
+{
+    uint32 PreScaler = 0xFFFFU;
+    uint32 Scr       = 0xFFFFU;
+    uint32 Expected  = Test_ReferenceClock(ClkValue, SsiFreq);
+    uint32 Achieved  = Ssi_SolveClock(ClkValue, SsiFreq, &PreScaler, &Scr);
+
+    if( (Achieved != Expected) || ( (Achieved != 0) &&
+        ( (PreScaler < SSI_CPSDVSR_MIN) || (PreScaler > SSI_CPSDVSR_MAX) || ((PreScaler & 1U) != 0) ||
+          (Scr >= SSI_SCR_PLUS_ONE_MAX) || ((ClkValue / (PreScaler * (Scr + 1U))) != Achieved) ) ) )
+    {
+        if(g_reported++ < 5U)
+        {
+            printf("    %u Hz / %u Hz: got %u Hz (CPSDVSR %u, SCR %u), expected %u Hz\n",
+                   ClkValue, SsiFreq, Achieved, PreScaler, Scr, Expected);
+        }
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+static void Test_SolverMatchesBruteForce(void)
+{
+    uint32 Clock    = 0;
+    uint32 Divisor  = 0;
+    uint32 Freq     = 0;
+    uint32 Failures = 0;
+
+    Test_BuildDivisors();
+
+    for(Clock = 0; Clock < (sizeof(g_clocks) / sizeof(g_clocks[0])); Clock++)
+    {
+        Failures = 0;
+
+        /* Every exact divisor, and just above/below each achievable clock */
+        for(Divisor = 1U; Divisor <= (TEST_DIVISOR_MAX + 16U); Divisor++)
+        {
+            Freq = g_clocks[Clock] / Divisor;
+            if(Freq == 0)
+            {
+                break;
+            }
+            Failures += (Test_SolveMatches(g_clocks[Clock], Freq) == FALSE) ? 1U : 0U;
+            Failures += (Test_SolveMatches(g_clocks[Clock], Freq + 1U) == FALSE) ? 1U : 0U;
+            if(Freq > 1U)
+            {
+                Failures += (Test_SolveMatches(g_clocks[Clock], Freq - 1U) == FALSE) ? 1U : 0U;
+            }
+        }
+
+        /* Common SPI clocks and requests faster than the module clock */
+        for(Freq = 1000U; Freq <= 100000000U; Freq += (Freq / 7U) + 1U)
+        {
+            Failures += (Test_SolveMatches(g_clocks[Clock], Freq) == FALSE) ? 1U : 0U;
+        }
+        Failures += (Test_SolveMatches(g_clocks[Clock], 0xFFFFFFFFU) == FALSE) ? 1U : 0U;
+
+        TEST_ASSERT_EQ(0, Failures);
+    }
+}
+
+static void Test_SolverLimits(void)
+{
+    uint32 PreScaler = 0;
+    uint32 Scr       = 0;
+
+    /* Fastest clock is half the module clock */
+    TEST_ASSERT_EQ(40000000U, Ssi_SolveClock(80000000U, 80000000U, &PreScaler, &Scr));
+    TEST_ASSERT_EQ(2, PreScaler);
+    TEST_ASSERT_EQ(0, Scr);
+
+    /* Slowest clock is ClkValue / 65024 */
+    TEST_ASSERT_EQ(1000U, Ssi_SolveClock(TEST_DIVISOR_MAX * 1000U, 1000U, &PreScaler, &Scr));
+    TEST_ASSERT_EQ(SSI_CPSDVSR_MAX, PreScaler);
+    TEST_ASSERT_EQ(SSI_SCR_PLUS_ONE_MAX - 1U, Scr);
+    TEST_ASSERT_EQ(0, Ssi_SolveClock(TEST_DIVISOR_MAX * 1000U, 999U, &PreScaler, &Scr));
+
+    /* Prime divisor: 80 MHz / 1 MHz - 1 Hz needs 81, 82 = 2 * 41 is the closest */
+    TEST_ASSERT_EQ(80000000U / 82U, Ssi_SolveClock(80000000U, 999999U, &PreScaler, &Scr));
+    TEST_ASSERT_EQ(82, PreScaler * (Scr + 1U));
+
+    TEST_ASSERT_EQ(0, Ssi_SolveClock(80000000U, 0, &PreScaler, &Scr));
+    TEST_ASSERT_EQ(0, Ssi_SolveClock(0, 1000000U, &PreScaler, &Scr));
+    TEST_ASSERT_EQ(0, Ssi_SolveClock(80000000U, 1000000U, NULL_PTR, &Scr));
+    TEST_ASSERT_EQ(0, Ssi_SolveClock(80000000U, 1000000U, &PreScaler, NULL_PTR));
+}
+
+static void Test_FrameSettingsUseSolver(void)
+{
+    Ssi_Config Config;
+    Ssi_FrameSettings Settings;
+
+    memset(&Config, 0, sizeof(Config));
+    Config.SsiNum         = Ssi1;
+    Config.WordLength     = SsiTwelveBits;
+    Config.SsiFreq        = 3000000U;
+    Config.ClkValue       = 80000000U;
+    Config.SsiFrameFormat = SSI_FRAME_FORMAT_FREESCALE_SSI;
+    Config.SsiClkPolarity = SSI_CLOCK_POLARITY_HIGH;
+    Config.SsiClkPhase    = SSI_CLOCK_PHASE_FALLING;
+
+    /* 80 MHz / 27 is above 3 MHz, 28 = 2 * 14 gives 2.857 MHz */
+    TEST_ASSERT_EQ(RET_OK, Ssi_GetFrameSettings(&Config, &Settings));
+    TEST_ASSERT_EQ(80000000U / 28U, Settings.Frequency);
+    TEST_ASSERT_EQ(2, Settings.Cpsr);
+    TEST_ASSERT_EQ( (13U << CR0_REG_SCR_POS) | (1U << CR0_REG_SPH_POS) | (1U << CR0_REG_SPO_POS) | SsiTwelveBits,
+                    Settings.Cr0 );
+
+    Config.SsiFreq = 1000U;
+    TEST_ASSERT_EQ(RET_NOT_OK, Ssi_GetFrameSettings(&Config, &Settings));
+}
+
+int main(void)
+{
+    Test_RegsInit();
+
+    TEST_RUN(Test_SolverMatchesBruteForce);
+    TEST_RUN(Test_SolverLimits);
+    TEST_RUN(Test_FrameSettingsUseSolver);
+
+    return Test_Summary("Test_SsiClock");
+}
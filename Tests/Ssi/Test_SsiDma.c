@@ -0,0 +1,364 @@
+/********************************************************************************
+ * @file          Test_SsiDma.c
+ * @brief         Host tests of SSI uDMA transfers (scatter-gather Transmit
+ *                finished on End of Transmission interrupt, chunked Receive),
+ *                of the interrupt driven transfer and of the polled transfer
+ *                refused while one runs
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ *******************************************************************************/
+
+#include "SSI_Prog.c"
+#include "Udma_Fake.h"
+#include "Ssi_Model.h"
+
+
+static Ssi_Config g_config;
+static uint32 g_doneCount;
+
+static void Test_TransferDone(void)
+{
+    g_doneCount++;
+}
+
+static void Test_SsiSetUp(Ssi_Interrupts Interrupts)
+{
+    memset(&g_config, 0, sizeof(g_config));
+    g_config.SsiNum         = Ssi0;
+    g_config.WordLength     = SsiEightBits;
+    g_config.SsiInterrupts  = Interrupts;
+    g_config.SsiFreq        = 1000000U;
+    g_config.ClkValue       = 80000000U;
+    g_config.SsiMode        = SSI_MODE_MASTER;
+    g_config.ClkSrc         = SSI_CLOCK_SRC_SYSTEM;
+    g_config.SsiFrameFormat = SSI_FRAME_FORMAT_FREESCALE_SSI;
+
+    memset(g_ssiDmaTransfer, 0, sizeof(g_ssiDmaTransfer));
+    memset(g_ssiItTransfer, 0, sizeof(g_ssiItTransfer));
+    g_doneCount = 0;
+
+    Fake_UdmaReset();
+    Model_SsiAttach(Ssi0);
+    TEST_ASSERT_EQ(RET_OK, Ssi_Init(&g_config));
+}
+
+static uint32 Test_SsiReg(uint32 Offset)
+{
+    return TEST_REG(SSI_0_BASE_ADDRESS + Offset);
+}
+
+/* Last frames written by the Tx channel, then the channel is done */
+static void Test_TxChannelDone(uint32 FramesInFifo)
+{
+    uint32 Index = 0;
+
+    for(Index = 0; Index < FramesInFifo; Index++)
+    {
+        *(volatile uint32*)(SSI_0_BASE_ADDRESS + SSI_DR_REG_OFFSET) = Index;
+    }
+    Fake_UdmaComplete(SSI0_DMA_TX_CHANNEL);
+}
+
+static void Test_SegmentsAreChainedAsTasks(void)
+{
+    static const uint8 Header[3] = {0x02, 0x00, 0x10};
+    static uint8 Payload[2000];
+    static const uint8 Trailer[2] = {0xA5, 0x5A};
+    const Ssi_DmaSegment Segments[3] = { {Header, 3}, {Payload, 2000}, {Trailer, 2} };
+    const Udma_Task* Tasks = g_ssiDmaTransfer[Ssi0].Tasks;
+
+    Test_SsiSetUp(SsiInterruptMaskReceiveTimeOut);
+
+    TEST_ASSERT_EQ(RET_OK, Ssi_TransmitDMA(&g_config, Segments, 3, Test_TransferDone));
+    TEST_ASSERT(g_fakeUdma[SSI0_DMA_TX_CHANNEL].Tasks == Tasks);
+    TEST_ASSERT_EQ(4, g_fakeUdma[SSI0_DMA_TX_CHANNEL].TaskCount);
+    TEST_ASSERT_EQ(TRUE, g_fakeUdma[SSI0_DMA_TX_CHANNEL].Peripheral);
+    TEST_ASSERT_EQ(TRUE, g_fakeUdma[SSI0_DMA_TX_CHANNEL].Enabled);
+
+    /* Payload is cut at 1024 frames, every task but the last one hands over */
+    TEST_ASSERT_EQ(3,    Fake_UdmaItems(Tasks[0].Control));
+    TEST_ASSERT_EQ(1024, Fake_UdmaItems(Tasks[1].Control));
+    TEST_ASSERT_EQ(976,  Fake_UdmaItems(Tasks[2].Control));
+    TEST_ASSERT_EQ(2,    Fake_UdmaItems(Tasks[3].Control));
+    TEST_ASSERT_EQ(UDMA_MODE_PER_SCATTER_GATHER | UDMA_MODE_ALT_SELECT, Tasks[0].Control & 0x7U);
+    TEST_ASSERT_EQ(UDMA_MODE_PER_SCATTER_GATHER | UDMA_MODE_ALT_SELECT, Tasks[2].Control & 0x7U);
+    TEST_ASSERT_EQ(UDMA_MODE_BASIC, Tasks[3].Control & 0x7U);
+
+    /* Receive interrupts are masked, Tx uDMA requests are enabled */
+    TEST_ASSERT_EQ(0, Test_SsiReg(SSI_IM_REG_OFFSET) & SSI_DMA_RX_INTERRUPTS_MASK);
+    TEST_ASSERT(BIT_IS_SET(Test_SsiReg(SSI_DMACTL_REG_OFFSET), DMACTL_REG_TXDMAE_POS));
+    TEST_ASSERT_EQ(RET_NOT_OK, Ssi_TransmitDMA(&g_config, Segments, 3, Test_TransferDone));
+}
+
+static void Test_TransmitEndsOnEndOfTransmission(void)
+{
+    static const uint8 Payload[40] = {0};
+    const Ssi_DmaSegment Segment = {Payload, sizeof(Payload)};
+
+    Test_SsiSetUp(SsiInterruptMaskReceiveTimeOut);
+    TEST_ASSERT_EQ(RET_OK, Ssi_TransmitDMA(&g_config, &Segment, 1, Test_TransferDone));
+
+    /* Channel done with 5 frames still in Transmit FIFO: the ISR doesn't wait for them */
+    Test_TxChannelDone(5);
+    SSI0_ISR();
+    TEST_ASSERT_EQ(0, g_doneCount);
+    TEST_ASSERT_EQ(5, g_modelSsi[Ssi0].TxCount);
+    TEST_ASSERT_EQ(TRUE, g_ssiDmaTransfer[Ssi0].Busy);
+    TEST_ASSERT(!BIT_IS_SET(Test_SsiReg(SSI_DMACTL_REG_OFFSET), DMACTL_REG_TXDMAE_POS));
+    TEST_ASSERT(BIT_IS_SET(Test_SsiReg(SSI_CR1_REG_OFFSET), CR1_REG_EOT_POS));
+    TEST_ASSERT(BIT_IS_SET(Test_SsiReg(SSI_IM_REG_OFFSET), IM_REG_TXIM_POS));
+    TEST_ASSERT_EQ(0, Model_SsiPending(Ssi0));
+
+    /* Spurious entry while frames are on the bus */
+    Model_SsiClock(Ssi0, 4);
+    SSI0_ISR();
+    TEST_ASSERT_EQ(0, g_doneCount);
+    TEST_ASSERT_EQ(0, Model_SsiPending(Ssi0));
+
+    /* Last bit sent: End of Transmission interrupt finishes the transfer */
+    Model_SsiClock(Ssi0, 1);
+    TEST_ASSERT(Model_SsiPending(Ssi0) != 0);
+    Model_SsiRunIsr(Ssi0, SSI0_ISR);
+    TEST_ASSERT_EQ(1, g_doneCount);
+    TEST_ASSERT_EQ(FALSE, g_ssiDmaTransfer[Ssi0].Busy);
+    TEST_ASSERT_EQ(FALSE, g_ssiDmaTransfer[Ssi0].Draining);
+    TEST_ASSERT(!BIT_IS_SET(Test_SsiReg(SSI_CR1_REG_OFFSET), CR1_REG_EOT_POS));
+    TEST_ASSERT_EQ(SsiInterruptMaskReceiveTimeOut, Test_SsiReg(SSI_IM_REG_OFFSET));
+
+    /* Next transfer is accepted */
+    TEST_ASSERT_EQ(RET_OK, Ssi_TransmitDMA(&g_config, &Segment, 1, NULL_PTR));
+}
+
+static void Test_TransmitRestoresConfiguredTransmitInterrupt(void)
+{
+    static const uint8 Payload[16] = {0};
+    const Ssi_DmaSegment Segment = {Payload, sizeof(Payload)};
+
+    /* Application uses End of Transmission interrupt itself */
+    Test_SsiSetUp(SsiInterruptMaskEndofTransmission | SsiInterruptMaskTransmitFIFO);
+    TEST_ASSERT(BIT_IS_SET(Test_SsiReg(SSI_CR1_REG_OFFSET), CR1_REG_EOT_POS));
+    TEST_ASSERT_EQ(RET_OK, Ssi_TransmitDMA(&g_config, &Segment, 1, Test_TransferDone));
+
+    /* Transmit FIFO already empty when the channel is done */
+    Test_TxChannelDone(0);
+    Model_SsiRunIsr(Ssi0, SSI0_ISR);
+    TEST_ASSERT_EQ(1, g_doneCount);
+    TEST_ASSERT(BIT_IS_SET(Test_SsiReg(SSI_CR1_REG_OFFSET), CR1_REG_EOT_POS));
+    TEST_ASSERT(BIT_IS_SET(Test_SsiReg(SSI_IM_REG_OFFSET), IM_REG_TXIM_POS));
+}
+
+static void Test_TransferBufferRefusedWhileBusy(void)
+{
+    static const uint8 Payload[16] = {0};
+    const Ssi_DmaSegment Segment = {Payload, sizeof(Payload)};
+    const uint8 Tx[4] = {0x11, 0x22, 0x33, 0x44};
+    uint8 Rx[4] = {0};
+
+    Test_SsiSetUp(SsiInterruptMaskReceiveTimeOut);
+    TEST_ASSERT_EQ(RET_OK, Ssi_TransmitDMA(&g_config, &Segment, 1, Test_TransferDone));
+
+    /* Frames still on the bus: polled transfer neither flushes the Receive FIFO nor writes SSIDR */
+    Test_TxChannelDone(3);
+    SSI0_ISR();
+    g_modelSsi[Ssi0].AutoClock = TRUE;
+    TEST_ASSERT_EQ(RET_NOT_OK, Ssi_TransferBuffer(&g_config, Tx, Rx, sizeof(Tx)));
+    TEST_ASSERT_EQ(0, g_modelSsi[Ssi0].MosiCount);
+    TEST_ASSERT_EQ(TRUE, g_ssiDmaTransfer[Ssi0].Busy);
+
+    /* uDMA transfer ends, the polled one runs */
+    g_modelSsi[Ssi0].AutoClock = FALSE;
+    Model_SsiClock(Ssi0, 3);
+    Model_SsiRunIsr(Ssi0, SSI0_ISR);
+    TEST_ASSERT_EQ(1, g_doneCount);
+    g_modelSsi[Ssi0].AutoClock = TRUE;
+    TEST_ASSERT_EQ(RET_OK, Ssi_TransferBuffer(&g_config, Tx, Rx, sizeof(Tx)));
+    TEST_ASSERT_EQ(3U + sizeof(Tx), g_modelSsi[Ssi0].MosiCount);
+    TEST_ASSERT_EQ(0x44, g_modelSsi[Ssi0].Mosi[g_modelSsi[Ssi0].MosiCount - 1U]);
+}
+
+/* Both channels of the current Rx chunk are done, the SSI interrupt is served */
+static void Test_RxChunkDone(void)
+{
+    Fake_UdmaComplete(SSI0_DMA_TX_CHANNEL);
+    Fake_UdmaComplete(SSI0_DMA_RX_CHANNEL);
+    SSI0_ISR();
+}
+
+static void Test_ReceiveDmaIsReArmedPerChunk(void)
+{
+    static uint8 Buffer[2500];
+    const Ssi_DmaSegment Segment = {Buffer, 4};
+
+    Test_SsiSetUp(SsiInterruptMaskReceiveTimeOut | SsiInterruptMaskReceiveFIFO);
+    TEST_ASSERT_EQ(RET_OK, Ssi_ReceiveDMA(&g_config, Buffer, sizeof(Buffer), Test_TransferDone));
+
+    /* Rx interrupts masked, Rx and Tx uDMA requests enabled */
+    TEST_ASSERT_EQ(0, Test_SsiReg(SSI_IM_REG_OFFSET) & SSI_DMA_RX_INTERRUPTS_MASK);
+    TEST_ASSERT(BIT_IS_SET(Test_SsiReg(SSI_DMACTL_REG_OFFSET), DMACTL_REG_RXDMAE_POS));
+    TEST_ASSERT(BIT_IS_SET(Test_SsiReg(SSI_DMACTL_REG_OFFSET), DMACTL_REG_TXDMAE_POS));
+    TEST_ASSERT_EQ(TRUE, g_fakeUdma[SSI0_DMA_RX_CHANNEL].Assigned);
+    TEST_ASSERT_EQ(TRUE, g_fakeUdma[SSI0_DMA_TX_CHANNEL].Assigned);
+
+    /* First chunk: 1024 frames to the start of the buffer, Tx channel clocks the dummy frame */
+    TEST_ASSERT_EQ(1024, Fake_UdmaItems(g_fakeUdma[SSI0_DMA_RX_CHANNEL].Primary.Control));
+    TEST_ASSERT(g_fakeUdma[SSI0_DMA_RX_CHANNEL].Primary.DstEnd == &Buffer[1023]);
+    TEST_ASSERT_EQ(1024, Fake_UdmaItems(g_fakeUdma[SSI0_DMA_TX_CHANNEL].Primary.Control));
+    TEST_ASSERT(g_fakeUdma[SSI0_DMA_TX_CHANNEL].Primary.SrcEnd == &g_ssiDmaDummyFrame);
+    TEST_ASSERT_EQ(TRUE, g_fakeUdma[SSI0_DMA_RX_CHANNEL].Enabled);
+    TEST_ASSERT_EQ(TRUE, g_fakeUdma[SSI0_DMA_TX_CHANNEL].Enabled);
+
+    /* Engines are exclusive while it runs */
+    TEST_ASSERT_EQ(RET_NOT_OK, Ssi_ReceiveDMA(&g_config, Buffer, sizeof(Buffer), NULL_PTR));
+    TEST_ASSERT_EQ(RET_NOT_OK, Ssi_TransmitDMA(&g_config, &Segment, 1, NULL_PTR));
+    TEST_ASSERT_EQ(RET_NOT_OK, Ssi_TransferIT(&g_config, NULL_PTR, Buffer, 4, NULL_PTR));
+
+    /* Each chunk end re-arms the next one from the SSI interrupt */
+    Test_RxChunkDone();
+    TEST_ASSERT_EQ(0, g_doneCount);
+    TEST_ASSERT_EQ(1024, Fake_UdmaItems(g_fakeUdma[SSI0_DMA_RX_CHANNEL].Primary.Control));
+    TEST_ASSERT(g_fakeUdma[SSI0_DMA_RX_CHANNEL].Primary.DstEnd == &Buffer[2047]);
+
+    Test_RxChunkDone();
+    TEST_ASSERT_EQ(0, g_doneCount);
+    TEST_ASSERT_EQ(452, Fake_UdmaItems(g_fakeUdma[SSI0_DMA_RX_CHANNEL].Primary.Control));
+    TEST_ASSERT_EQ(452, Fake_UdmaItems(g_fakeUdma[SSI0_DMA_TX_CHANNEL].Primary.Control));
+    TEST_ASSERT(g_fakeUdma[SSI0_DMA_RX_CHANNEL].Primary.DstEnd == &Buffer[2499]);
+
+    /* Last chunk: uDMA requests stop, Rx interrupts come back, callback runs once */
+    Test_RxChunkDone();
+    TEST_ASSERT_EQ(1, g_doneCount);
+    TEST_ASSERT_EQ(FALSE, g_ssiDmaTransfer[Ssi0].Busy);
+    TEST_ASSERT_EQ(0, Test_SsiReg(SSI_DMACTL_REG_OFFSET));
+    TEST_ASSERT_EQ(SsiInterruptMaskReceiveTimeOut | SsiInterruptMaskReceiveFIFO, Test_SsiReg(SSI_IM_REG_OFFSET));
+
+    SSI0_ISR();
+    TEST_ASSERT_EQ(1, g_doneCount);
+}
+
+static void Test_ReceiveDmaUsesHalfWordsForWideFrames(void)
+{
+    static uint16 Buffer[10];
+
+    Test_SsiSetUp(SsiInterruptMaskReceiveTimeOut);
+    g_config.WordLength = SsiTwelveBits;
+    TEST_ASSERT_EQ(RET_OK, Ssi_ReceiveDMA(&g_config, Buffer, 10, NULL_PTR));
+    TEST_ASSERT_EQ(10, Fake_UdmaItems(g_fakeUdma[SSI0_DMA_RX_CHANNEL].Primary.Control));
+    TEST_ASSERT(g_fakeUdma[SSI0_DMA_RX_CHANNEL].Primary.DstEnd == &Buffer[9]);
+    TEST_ASSERT_EQ(UDMA_SIZE_16 | UDMA_DST_INC_16, g_fakeUdma[SSI0_DMA_RX_CHANNEL].Primary.Control & (UDMA_SIZE_16 | UDMA_DST_INC_16));
+
+    Test_RxChunkDone();
+    TEST_ASSERT_EQ(FALSE, g_ssiDmaTransfer[Ssi0].Busy);
+
+    TEST_ASSERT_EQ(RET_NOT_OK, Ssi_ReceiveDMA(NULL_PTR, Buffer, 10, NULL_PTR));
+    TEST_ASSERT_EQ(RET_NOT_OK, Ssi_ReceiveDMA(&g_config, NULL_PTR, 10, NULL_PTR));
+    TEST_ASSERT_EQ(RET_NOT_OK, Ssi_ReceiveDMA(&g_config, Buffer, 0, NULL_PTR));
+}
+
+/* Bus clocks every written frame, SSI interrupt is served until its line drops */
+static void Test_RunBus(uint32 Rounds)
+{
+    uint32 Round = 0;
+
+    for(Round = 0; (Round < Rounds) && (g_ssiItTransfer[Ssi0].Busy == TRUE); Round++)
+    {
+        Model_SsiClock(Ssi0, MODEL_SSI_FIFO_SIZE);
+        Model_SsiRunIsr(Ssi0, SSI0_ISR);
+    }
+}
+
+static void Test_TransferItExchangesFrames(void)
+{
+    uint8 Tx[21];
+    uint8 Rx[21];
+    uint16 Answer[21];
+    uint32 Index = 0;
+
+    for(Index = 0; Index < sizeof(Tx); Index++)
+    {
+        Tx[Index]     = (uint8)(0x40U + Index);
+        Answer[Index] = (uint16)(0x80U + Index);
+    }
+    memset(Rx, 0, sizeof(Rx));
+
+    Test_SsiSetUp(SsiInterruptMaskReceiveTimeOut);
+    Model_SsiAnswer(Ssi0, Answer, sizeof(Tx));
+
+    /* Transmit FIFO is filled, Receive FIFO interrupt is awaited */
+    TEST_ASSERT_EQ(RET_OK, Ssi_TransferIT(&g_config, Tx, Rx, sizeof(Tx), Test_TransferDone));
+    TEST_ASSERT_EQ(SSI_FIFO_DEPTH, g_modelSsi[Ssi0].TxCount);
+    TEST_ASSERT_EQ(IM_REG_RXIM_ENABLE << IM_REG_RXIM_POS, Test_SsiReg(SSI_IM_REG_OFFSET));
+    TEST_ASSERT(BIT_IS_SET(Test_SsiReg(SSI_CR1_REG_OFFSET), CR1_REG_EOT_POS));
+
+    /* Engines are exclusive while it runs */
+    TEST_ASSERT_EQ(RET_NOT_OK, Ssi_TransferIT(&g_config, Tx, Rx, sizeof(Tx), NULL_PTR));
+    TEST_ASSERT_EQ(RET_NOT_OK, Ssi_ReceiveDMA(&g_config, Rx, sizeof(Rx), NULL_PTR));
+
+    /* Never more than FIFO depth frames in flight, so the Receive FIFO can't overrun */
+    for(Index = 0; (Index < 20U) && (g_ssiItTransfer[Ssi0].Busy == TRUE); Index++)
+    {
+        Model_SsiClock(Ssi0, MODEL_SSI_FIFO_SIZE);
+        TEST_ASSERT(g_modelSsi[Ssi0].RxCount <= MODEL_SSI_FIFO_SIZE);
+        Model_SsiRunIsr(Ssi0, SSI0_ISR);
+    }
+    TEST_ASSERT_EQ(0, g_modelSsi[Ssi0].Latched & (1U << MIS_REG_RORMIS_POS));
+
+    /* Every frame exchanged in order, configured interrupts and EOT mode restored */
+    TEST_ASSERT_EQ(1, g_doneCount);
+    TEST_ASSERT_EQ(FALSE, g_ssiItTransfer[Ssi0].Busy);
+    TEST_ASSERT_EQ(sizeof(Tx), g_modelSsi[Ssi0].MosiCount);
+    for(Index = 0; Index < sizeof(Tx); Index++)
+    {
+        TEST_ASSERT_EQ(Tx[Index], g_modelSsi[Ssi0].Mosi[Index]);
+        TEST_ASSERT_EQ((uint8)Answer[Index], Rx[Index]);
+    }
+    TEST_ASSERT_EQ(SsiInterruptMaskReceiveTimeOut, Test_SsiReg(SSI_IM_REG_OFFSET));
+    TEST_ASSERT(!BIT_IS_SET(Test_SsiReg(SSI_CR1_REG_OFFSET), CR1_REG_EOT_POS));
+}
+
+static void Test_TransferItSendsDummyFramesAndDiscards(void)
+{
+    uint16 Rx[5];
+    const uint16 Answer[5] = {0x0123, 0x0456, 0x0789, 0x0ABC, 0x0DEF};
+    uint32 Index = 0;
+
+    Test_SsiSetUp(SsiInterruptMaskReceiveTimeOut);
+    g_config.WordLength = SsiTwelveBits;
+    Model_SsiAnswer(Ssi0, Answer, 5);
+
+    /* Fewer frames than the FIFO depth: End of Transmission interrupt ends the transfer */
+    TEST_ASSERT_EQ(RET_OK, Ssi_TransferIT(&g_config, NULL_PTR, Rx, 5, Test_TransferDone));
+    TEST_ASSERT_EQ(IM_REG_TXIM_ENABLE << IM_REG_TXIM_POS, Test_SsiReg(SSI_IM_REG_OFFSET));
+    Test_RunBus(4U);
+    TEST_ASSERT_EQ(1, g_doneCount);
+    for(Index = 0; Index < 5U; Index++)
+    {
+        TEST_ASSERT_EQ(SSI_DUMMY_FRAME, g_modelSsi[Ssi0].Mosi[Index]);
+        TEST_ASSERT_EQ(Answer[Index], Rx[Index]);
+    }
+
+    /* Write only transfer discards the received frames */
+    TEST_ASSERT_EQ(RET_OK, Ssi_TransferIT(&g_config, Answer, NULL_PTR, 5, NULL_PTR));
+    Test_RunBus(4U);
+    TEST_ASSERT_EQ(FALSE, g_ssiItTransfer[Ssi0].Busy);
+    TEST_ASSERT_EQ(Answer[4], g_modelSsi[Ssi0].Mosi[9]);
+
+    TEST_ASSERT_EQ(RET_NOT_OK, Ssi_TransferIT(NULL_PTR, Answer, Rx, 5, NULL_PTR));
+    TEST_ASSERT_EQ(RET_NOT_OK, Ssi_TransferIT(&g_config, Answer, Rx, 0, NULL_PTR));
+}
+
+int main(void)
+{
+    Test_RegsInit();
+
+    TEST_RUN(Test_SegmentsAreChainedAsTasks);
+    TEST_RUN(Test_TransmitEndsOnEndOfTransmission);
+    TEST_RUN(Test_TransmitRestoresConfiguredTransmitInterrupt);
+    TEST_RUN(Test_ReceiveDmaIsReArmedPerChunk);
+    TEST_RUN(Test_ReceiveDmaUsesHalfWordsForWideFrames);
+    TEST_RUN(Test_TransferItExchangesFrames);
+    TEST_RUN(Test_TransferItSendsDummyFramesAndDiscards);
+    TEST_RUN(Test_TransferBufferRefusedWhileBusy);
+
+    return Test_Summary("Test_SsiDma");
+}
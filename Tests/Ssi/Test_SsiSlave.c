@@ -0,0 +1,140 @@
+/********************************************************************************
+ * @file          Test_SsiSlave.c
+ * @brief         Host tests of SSI interrupt driven slave engine (Rx/Tx rings,
+ *                overruns and configuration restored by Ssi_SlaveStop)
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ *******************************************************************************/
+
+#include "SSI_Prog.c"
+#include "Udma_Fake.h"
+#include "Ssi_Model.h"
+
+
+static Ssi_Config g_config;
+static uint32 g_receivedCount;
+
+static void Test_FramesReceived(void)
+{
+    g_receivedCount++;
+}
+
+static void Test_SlaveSetUp(Ssi_Interrupts Interrupts)
+{
+    memset(&g_config, 0, sizeof(g_config));
+    g_config.SsiNum         = Ssi2;
+    g_config.WordLength     = SsiSixteenBits;
+    g_config.SsiInterrupts  = Interrupts;
+    g_config.SsiFreq        = 1000000U;
+    g_config.ClkValue       = 80000000U;
+    g_config.SsiMode        = SSI_MODE_SLAVE_OUTPUT_ENABLED;
+    g_config.ClkSrc         = SSI_CLOCK_SRC_SYSTEM;
+    g_config.SsiFrameFormat = SSI_FRAME_FORMAT_FREESCALE_SSI;
+
+    memset(g_ssiSlave, 0, sizeof(g_ssiSlave));
+    g_receivedCount = 0;
+
+    Model_SsiAttach(Ssi2);
+    TEST_ASSERT_EQ(RET_OK, Ssi_Init(&g_config));
+}
+
+static uint32 Test_SsiReg(uint32 Offset)
+{
+    return TEST_REG(SSI_2_BASE_ADDRESS + Offset);
+}
+
+static void Test_FramesAreExchanged(void)
+{
+    uint16 FromMaster[20];
+    uint16 ToMaster[20];
+    uint16 Received[20];
+    uint32 Index = 0;
+
+    for(Index = 0; Index < 20U; Index++)
+    {
+        FromMaster[Index] = (uint16)(0x1000U + Index);
+        ToMaster[Index]   = (uint16)(0xA000U + Index);
+    }
+
+    Test_SlaveSetUp(SsiInterruptsDisabled);
+    TEST_ASSERT_EQ(RET_OK, Ssi_SlaveStart(&g_config, Test_FramesReceived));
+    TEST_ASSERT_EQ(20, Ssi_SlaveWrite(&g_config, ToMaster, 20));
+    TEST_ASSERT_EQ(MODEL_SSI_FIFO_SIZE, g_modelSsi[Ssi2].TxCount);
+    TEST_ASSERT(BIT_IS_SET(Test_SsiReg(SSI_IM_REG_OFFSET), IM_REG_TXIM_POS));
+
+    /* Master clocks 4 frames at a time, the ISR keeps both FIFOs going */
+    Model_SsiAnswer(Ssi2, FromMaster, 20);
+    for(Index = 0; Index < 5U; Index++)
+    {
+        Model_SsiClock(Ssi2, 4);
+        Model_SsiRxTimeOut(Ssi2);
+        Model_SsiRunIsr(Ssi2, SSI2_ISR);
+    }
+
+    TEST_ASSERT_EQ(20, g_modelSsi[Ssi2].MosiCount);
+    TEST_ASSERT(memcmp(g_modelSsi[Ssi2].Mosi, ToMaster, sizeof(ToMaster)) == 0);
+    TEST_ASSERT(!BIT_IS_SET(Test_SsiReg(SSI_IM_REG_OFFSET), IM_REG_TXIM_POS));
+    TEST_ASSERT_EQ(20, Ssi_SlaveRead(&g_config, Received, 20));
+    TEST_ASSERT(memcmp(Received, FromMaster, sizeof(FromMaster)) == 0);
+    TEST_ASSERT_EQ(5, g_receivedCount);
+    TEST_ASSERT_EQ(0, Ssi_SlaveGetOverrunCount(Ssi2));
+}
+
+static void Test_OverrunsAreCounted(void)
+{
+    static const uint16 Frames[MODEL_SSI_FIFO_SIZE] = {0};
+    uint16 Received[MODEL_SSI_FIFO_SIZE + 1U];
+
+    Test_SlaveSetUp(SsiInterruptsDisabled);
+    TEST_ASSERT_EQ(RET_OK, Ssi_SlaveStart(&g_config, NULL_PTR));
+    TEST_ASSERT_EQ(MODEL_SSI_FIFO_SIZE, Ssi_SlaveWrite(&g_config, Frames, MODEL_SSI_FIFO_SIZE));
+
+    /* The ISR is late: Receive FIFO is full when the master clocks one more frame */
+    Model_SsiClock(Ssi2, MODEL_SSI_FIFO_SIZE);
+    *(volatile uint32*)(SSI_2_BASE_ADDRESS + SSI_DR_REG_OFFSET) = 0;
+    Model_SsiClock(Ssi2, 1);
+    Model_SsiRunIsr(Ssi2, SSI2_ISR);
+    TEST_ASSERT_EQ(1, Ssi_SlaveGetOverrunCount(Ssi2));
+    TEST_ASSERT_EQ(MODEL_SSI_FIFO_SIZE, Ssi_SlaveRead(&g_config, Received, MODEL_SSI_FIFO_SIZE + 1U));
+}
+
+static void Test_StopRestoresConfiguration(void)
+{
+    const Ssi_Interrupts Configured = SsiInterruptMaskEndofTransmission | SsiInterruptMaskTransmitFIFO |
+                                      SsiInterruptMaskReceiveOverRun;
+    uint16 Frame = 0x1234U;
+
+    /* Application runs End of Transmission interrupt before and after the engine */
+    Test_SlaveSetUp(Configured);
+    TEST_ASSERT(BIT_IS_SET(Test_SsiReg(SSI_CR1_REG_OFFSET), CR1_REG_EOT_POS));
+
+    TEST_ASSERT_EQ(RET_OK, Ssi_SlaveStart(&g_config, NULL_PTR));
+    TEST_ASSERT(!BIT_IS_SET(Test_SsiReg(SSI_CR1_REG_OFFSET), CR1_REG_EOT_POS));
+    TEST_ASSERT_EQ(SSI_SLAVE_RX_INTERRUPTS_MASK, Test_SsiReg(SSI_IM_REG_OFFSET));
+    TEST_ASSERT_EQ(1, Ssi_SlaveWrite(&g_config, &Frame, 1));
+
+    Ssi_SlaveStop(&g_config);
+    TEST_ASSERT(BIT_IS_SET(Test_SsiReg(SSI_CR1_REG_OFFSET), CR1_REG_EOT_POS));
+    TEST_ASSERT(BIT_IS_SET(Test_SsiReg(SSI_CR1_REG_OFFSET), CR1_REG_SSE_POS));
+    TEST_ASSERT_EQ(Configured, Test_SsiReg(SSI_IM_REG_OFFSET));
+    TEST_ASSERT_EQ(0, Ssi_SlaveWrite(&g_config, &Frame, 1));
+
+    /* Without End of Transmission it stays cleared */
+    Test_SlaveSetUp(SsiInterruptMaskReceiveTimeOut);
+    TEST_ASSERT_EQ(RET_OK, Ssi_SlaveStart(&g_config, NULL_PTR));
+    Ssi_SlaveStop(&g_config);
+    TEST_ASSERT(!BIT_IS_SET(Test_SsiReg(SSI_CR1_REG_OFFSET), CR1_REG_EOT_POS));
+    TEST_ASSERT_EQ(SsiInterruptMaskReceiveTimeOut, Test_SsiReg(SSI_IM_REG_OFFSET));
+}
+
+int main(void)
+{
+    Test_RegsInit();
+
+    TEST_RUN(Test_FramesAreExchanged);
+    TEST_RUN(Test_OverrunsAreCounted);
+    TEST_RUN(Test_StopRestoresConfiguration);
+
+    return Test_Summary("Test_SsiSlave");
+}
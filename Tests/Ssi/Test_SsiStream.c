@@ -0,0 +1,277 @@
+/********************************************************************************
+ * @file          Test_SsiStream.c
+ * @brief         Host tests of SSI gapless streaming (uDMA ping-pong halves
+ *                re-armed in order, channel restarted after a gap, underrun
+ *                and overrun accounting)
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ *******************************************************************************/
+
+#include "SSI_Prog.c"
+#include "Udma_Fake.h"
+#include "Ssi_Model.h"
+
+
+/* Frames in each buffer */
+#define TEST_STREAM_FRAMES          (4U)
+
+static Ssi_Config g_config;
+static Ssi_StreamConfig g_stream;
+static uint16 g_txBuffers[2][TEST_STREAM_FRAMES];
+static uint16 g_rxBuffers[2][TEST_STREAM_FRAMES];
+static uint8 g_halves[16];
+static uint32 g_halfCount;
+
+static void Test_HalfDone(uint8 Half)
+{
+    if(g_halfCount < sizeof(g_halves))
+    {
+        g_halves[g_halfCount] = Half;
+    }
+    g_halfCount++;
+}
+
+static void Test_StreamSetUp(uint8 Receive)
+{
+    memset(&g_config, 0, sizeof(g_config));
+    g_config.SsiNum         = Ssi0;
+    g_config.WordLength     = SsiSixteenBits;
+    g_config.SsiInterrupts  = SsiInterruptMaskReceiveTimeOut;
+    g_config.SsiFreq        = 1000000U;
+    g_config.ClkValue       = 80000000U;
+    g_config.SsiMode        = SSI_MODE_MASTER;
+    g_config.ClkSrc         = SSI_CLOCK_SRC_SYSTEM;
+    g_config.SsiFrameFormat = SSI_FRAME_FORMAT_FREESCALE_SSI;
+
+    memset(&g_stream, 0, sizeof(g_stream));
+    g_stream.TxBuffers[0] = g_txBuffers[0];
+    g_stream.TxBuffers[1] = g_txBuffers[1];
+    if(Receive == TRUE)
+    {
+        g_stream.RxBuffers[0] = g_rxBuffers[0];
+        g_stream.RxBuffers[1] = g_rxBuffers[1];
+    }
+    g_stream.Frames   = TEST_STREAM_FRAMES;
+    g_stream.CallBack = Test_HalfDone;
+
+    memset(g_ssiStream, 0, sizeof(g_ssiStream));
+    memset(g_halves, 0xFF, sizeof(g_halves));
+    g_halfCount = 0;
+
+    Fake_UdmaReset();
+    Model_SsiAttach(Ssi0);
+    TEST_ASSERT_EQ(RET_OK, Ssi_Init(&g_config));
+    TEST_ASSERT_EQ(RET_OK, Ssi_StreamStart(&g_config, &g_stream));
+}
+
+static uint32 Test_SsiReg(uint32 Offset)
+{
+    return TEST_REG(SSI_0_BASE_ADDRESS + Offset);
+}
+
+/* Both structures of a channel point to their buffers again, the channel runs */
+static void Test_ChannelArmed(uint8 Channel)
+{
+    TEST_ASSERT_EQ(UDMA_MODE_PINGPONG, Udma_ChannelModeGet(Channel, FALSE));
+    TEST_ASSERT_EQ(UDMA_MODE_PINGPONG, Udma_ChannelModeGet(Channel, TRUE));
+    TEST_ASSERT_EQ(TEST_STREAM_FRAMES, Fake_UdmaItems(g_fakeUdma[Channel].Primary.Control));
+    TEST_ASSERT_EQ(TEST_STREAM_FRAMES, Fake_UdmaItems(g_fakeUdma[Channel].Alternate.Control));
+    TEST_ASSERT_EQ(TRUE, Udma_ChannelIsEnabled(Channel));
+}
+
+static void Test_HalvesAreServedInOrder(void)
+{
+    uint32 Underruns = 0;
+    uint32 Overruns  = 0;
+
+    Test_StreamSetUp(FALSE);
+    Test_ChannelArmed(SSI0_DMA_TX_CHANNEL);
+    TEST_ASSERT(g_fakeUdma[SSI0_DMA_TX_CHANNEL].Primary.SrcEnd   == &g_txBuffers[0][TEST_STREAM_FRAMES - 1U]);
+    TEST_ASSERT(g_fakeUdma[SSI0_DMA_TX_CHANNEL].Alternate.SrcEnd == &g_txBuffers[1][TEST_STREAM_FRAMES - 1U]);
+    TEST_ASSERT(BIT_IS_SET(Test_SsiReg(SSI_DMACTL_REG_OFFSET), DMACTL_REG_TXDMAE_POS));
+    TEST_ASSERT(!BIT_IS_SET(Test_SsiReg(SSI_DMACTL_REG_OFFSET), DMACTL_REG_RXDMAE_POS));
+
+    /* Each half is re-armed while the other one is on the bus */
+    Fake_UdmaHalfComplete(SSI0_DMA_TX_CHANNEL, FALSE);
+    SSI0_ISR();
+    Fake_UdmaHalfComplete(SSI0_DMA_TX_CHANNEL, TRUE);
+    SSI0_ISR();
+    Fake_UdmaHalfComplete(SSI0_DMA_TX_CHANNEL, FALSE);
+    SSI0_ISR();
+
+    TEST_ASSERT_EQ(3, g_halfCount);
+    TEST_ASSERT_EQ(0, g_halves[0]);
+    TEST_ASSERT_EQ(1, g_halves[1]);
+    TEST_ASSERT_EQ(0, g_halves[2]);
+    Test_ChannelArmed(SSI0_DMA_TX_CHANNEL);
+
+    /* A spurious ISR entry serves nothing */
+    SSI0_ISR();
+    TEST_ASSERT_EQ(3, g_halfCount);
+
+    Ssi_StreamGetErrors(Ssi0, &Underruns, &Overruns);
+    TEST_ASSERT_EQ(0, Underruns);
+    TEST_ASSERT_EQ(0, Overruns);
+}
+
+static void Test_LateIsrRestartsTheChannel(void)
+{
+    uint32 Underruns = 0;
+    uint32 Overruns  = 0;
+
+    Test_StreamSetUp(FALSE);
+
+    /* Half 1 is served first, then the ISR is late for two halves */
+    Fake_UdmaHalfComplete(SSI0_DMA_TX_CHANNEL, FALSE);
+    SSI0_ISR();
+    Fake_UdmaHalfComplete(SSI0_DMA_TX_CHANNEL, TRUE);
+    Fake_UdmaHalfComplete(SSI0_DMA_TX_CHANNEL, FALSE);
+    TEST_ASSERT_EQ(FALSE, Udma_ChannelIsEnabled(SSI0_DMA_TX_CHANNEL));
+
+    /* Both halves are re-armed in completion order and the serial clock runs again */
+    SSI0_ISR();
+    TEST_ASSERT_EQ(3, g_halfCount);
+    TEST_ASSERT_EQ(0, g_halves[0]);
+    TEST_ASSERT_EQ(1, g_halves[1]);
+    TEST_ASSERT_EQ(0, g_halves[2]);
+    Test_ChannelArmed(SSI0_DMA_TX_CHANNEL);
+
+    Ssi_StreamGetErrors(Ssi0, &Underruns, &Overruns);
+    TEST_ASSERT_EQ(1, Underruns);
+    TEST_ASSERT_EQ(0, Overruns);
+
+    /* The next half is the Alternate one again */
+    Fake_UdmaHalfComplete(SSI0_DMA_TX_CHANNEL, TRUE);
+    SSI0_ISR();
+    TEST_ASSERT_EQ(4, g_halfCount);
+    TEST_ASSERT_EQ(1, g_halves[3]);
+    Ssi_StreamGetErrors(Ssi0, &Underruns, &Overruns);
+    TEST_ASSERT_EQ(1, Underruns);
+}
+
+static void Test_RxChannelLeadsAndCountsOverruns(void)
+{
+    uint32 Underruns = 0;
+    uint32 Overruns  = 0;
+    uint32 Index = 0;
+
+    Test_StreamSetUp(TRUE);
+    Test_ChannelArmed(SSI0_DMA_RX_CHANNEL);
+    Test_ChannelArmed(SSI0_DMA_TX_CHANNEL);
+    TEST_ASSERT(g_fakeUdma[SSI0_DMA_RX_CHANNEL].Alternate.DstEnd == &g_rxBuffers[1][TEST_STREAM_FRAMES - 1U]);
+    TEST_ASSERT(BIT_IS_SET(Test_SsiReg(SSI_DMACTL_REG_OFFSET), DMACTL_REG_RXDMAE_POS));
+
+    /* Rx interrupts are masked while streaming */
+    TEST_ASSERT_EQ(0, Test_SsiReg(SSI_IM_REG_OFFSET) & SSI_DMA_RX_INTERRUPTS_MASK);
+
+    /* Tx half is done first, the application is called for Rx halves only */
+    Fake_UdmaHalfComplete(SSI0_DMA_TX_CHANNEL, FALSE);
+    SSI0_ISR();
+    TEST_ASSERT_EQ(0, g_halfCount);
+    Fake_UdmaHalfComplete(SSI0_DMA_RX_CHANNEL, FALSE);
+    SSI0_ISR();
+    TEST_ASSERT_EQ(1, g_halfCount);
+    TEST_ASSERT_EQ(0, g_halves[0]);
+
+    /* Rx channel runs out of armed halves */
+    Fake_UdmaHalfComplete(SSI0_DMA_RX_CHANNEL, TRUE);
+    Fake_UdmaHalfComplete(SSI0_DMA_RX_CHANNEL, FALSE);
+    SSI0_ISR();
+    TEST_ASSERT_EQ(3, g_halfCount);
+    TEST_ASSERT_EQ(1, g_halves[1]);
+    TEST_ASSERT_EQ(0, g_halves[2]);
+    Test_ChannelArmed(SSI0_DMA_RX_CHANNEL);
+    Ssi_StreamGetErrors(Ssi0, &Underruns, &Overruns);
+    TEST_ASSERT_EQ(0, Underruns);
+    TEST_ASSERT_EQ(1, Overruns);
+
+    /* Receive FIFO overruns (uDMA too slow): counted once, status cleared (RIS is read through the model) */
+    for(Index = 0; Index <= MODEL_SSI_FIFO_SIZE; Index++)
+    {
+        *(volatile uint32*)(SSI_0_BASE_ADDRESS + SSI_DR_REG_OFFSET) = Index;
+        Model_SsiClock(Ssi0, 1);
+    }
+    TEST_ASSERT(BIT_IS_SET(*(volatile uint32*)(SSI_0_BASE_ADDRESS + SSI_RIS_REG_OFFSET), MIS_REG_RORMIS_POS));
+    SSI0_ISR();
+    SSI0_ISR();
+    TEST_ASSERT(!BIT_IS_SET(*(volatile uint32*)(SSI_0_BASE_ADDRESS + SSI_RIS_REG_OFFSET), MIS_REG_RORMIS_POS));
+    Ssi_StreamGetErrors(Ssi0, &Underruns, &Overruns);
+    TEST_ASSERT_EQ(2, Overruns);
+    TEST_ASSERT_EQ(3, g_halfCount);
+}
+
+static void Test_StopAndStartAgain(void)
+{
+    uint32 Underruns = 0;
+    uint32 Overruns  = 0;
+
+    Test_StreamSetUp(TRUE);
+    Fake_UdmaHalfComplete(SSI0_DMA_TX_CHANNEL, FALSE);
+    Fake_UdmaHalfComplete(SSI0_DMA_TX_CHANNEL, TRUE);
+    SSI0_ISR();
+    Ssi_StreamGetErrors(Ssi0, &Underruns, &Overruns);
+    TEST_ASSERT_EQ(1, Underruns);
+
+    /* Only one engine per SSI */
+    TEST_ASSERT_EQ(RET_NOT_OK, Ssi_StreamStart(&g_config, &g_stream));
+
+    Ssi_StreamStop(&g_config);
+    TEST_ASSERT_EQ(FALSE, Udma_ChannelIsEnabled(SSI0_DMA_TX_CHANNEL));
+    TEST_ASSERT_EQ(FALSE, Udma_ChannelIsEnabled(SSI0_DMA_RX_CHANNEL));
+    TEST_ASSERT_EQ(0, Test_SsiReg(SSI_DMACTL_REG_OFFSET) &
+                      ( (1U << DMACTL_REG_RXDMAE_POS) | (1U << DMACTL_REG_TXDMAE_POS) ));
+    TEST_ASSERT_EQ(1U << IM_REG_RTIM_POS, Test_SsiReg(SSI_IM_REG_OFFSET) & SSI_DMA_RX_INTERRUPTS_MASK);
+
+    /* Completions after stop are ignored, a new stream starts from half 0 without errors */
+    Fake_UdmaHalfComplete(SSI0_DMA_RX_CHANNEL, FALSE);
+    SSI0_ISR();
+    TEST_ASSERT_EQ(0, g_halfCount);
+
+    TEST_ASSERT_EQ(RET_OK, Ssi_StreamStart(&g_config, &g_stream));
+    Ssi_StreamGetErrors(Ssi0, &Underruns, &Overruns);
+    TEST_ASSERT_EQ(0, Underruns);
+    TEST_ASSERT_EQ(0, Overruns);
+    Fake_UdmaHalfComplete(SSI0_DMA_RX_CHANNEL, FALSE);
+    SSI0_ISR();
+    TEST_ASSERT_EQ(1, g_halfCount);
+    TEST_ASSERT_EQ(0, g_halves[0]);
+    Ssi_StreamStop(&g_config);
+}
+
+static void Test_InvalidStreamsAreRejected(void)
+{
+    Ssi_StreamConfig Stream;
+
+    Test_StreamSetUp(FALSE);
+    Ssi_StreamStop(&g_config);
+
+    Stream = g_stream;
+    Stream.Frames = 0;
+    TEST_ASSERT_EQ(RET_NOT_OK, Ssi_StreamStart(&g_config, &Stream));
+    Stream.Frames = UDMA_MAX_TRANSFER_SIZE + 1U;
+    TEST_ASSERT_EQ(RET_NOT_OK, Ssi_StreamStart(&g_config, &Stream));
+
+    /* Both buffers of a direction, or none */
+    Stream = g_stream;
+    Stream.TxBuffers[1] = NULL_PTR;
+    TEST_ASSERT_EQ(RET_NOT_OK, Ssi_StreamStart(&g_config, &Stream));
+    Stream = g_stream;
+    Stream.RxBuffers[0] = g_rxBuffers[0];
+    TEST_ASSERT_EQ(RET_NOT_OK, Ssi_StreamStart(&g_config, &Stream));
+    TEST_ASSERT_EQ(RET_NOT_OK, Ssi_StreamStart(NULL_PTR, &g_stream));
+    TEST_ASSERT_EQ(RET_NOT_OK, Ssi_StreamStart(&g_config, NULL_PTR));
+}
+
+int main(void)
+{
+    Test_RegsInit();
+
+    TEST_RUN(Test_HalvesAreServedInOrder);
+    TEST_RUN(Test_LateIsrRestartsTheChannel);
+    TEST_RUN(Test_RxChannelLeadsAndCountsOverruns);
+    TEST_RUN(Test_StopAndStartAgain);
+    TEST_RUN(Test_InvalidStreamsAreRejected);
+
+    return Test_Summary("Test_SsiStream");
+}
@@ -0,0 +1,70 @@
+#!/usr/bin/env python3
+"""Host check of the I2C Task vector table (I2c_Task/tm4c123gh6pm_startup_ccs.c).
+
+I2C0_ISR..I2C3_ISR MUST sit at the vectors of their NVIC interrupt numbers,
+otherwise an I2C interrupt runs IntDefaultHandler (endless loop).
+
+Usage:
+    python3 -m unittest discover -s Tests/Tools
+"""
+
+import os
+import re
+import unittest
+
+STARTUP = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                       "..", "..", "I2c_Task", "tm4c123gh6pm_startup_ccs.c")
+
+# Cortex-M4 exceptions before the first peripheral interrupt
+FIRST_IRQ_VECTOR = 16
+
+# NVIC interrupt number of each I2C module (TM4C123GH6PM datasheet, Table 2-9)
+I2C_IRQS = {"I2C0_ISR": 8, "I2C1_ISR": 37, "I2C2_ISR": 68, "I2C3_ISR": 69}
+
+
+def read_vectors(path):
+    """Return the entries of g_pfnVectors, in order, without comments."""
+    with open(path) as source:
+        text = source.read()
+    body = re.search(r"g_pfnVectors\[\]\)\(void\)\s*=\s*\{(.*?)\};", text, re.S).group(1)
+    body = re.sub(r"//[^\n]*", "", body)
+
+    entries = []
+    depth = 0
+    current = ""
+    for char in body:
+        if char == "(":
+            depth += 1
+        elif char == ")":
+            depth -= 1
+        if char == "," and depth == 0:
+            entries.append(current.strip())
+            current = ""
+        else:
+            current += char
+    if current.strip():
+        entries.append(current.strip())
+    return entries, text
+
+
+class I2cVectorsTest(unittest.TestCase):
+
+    def setUp(self):
+        self.vectors, self.text = read_vectors(STARTUP)
+
+    def test_table_covers_all_interrupts(self):
+        # 16 exceptions and 139 interrupts (last one: PWM1 Fault)
+        self.assertEqual(len(self.vectors), FIRST_IRQ_VECTOR + 139)
+
+    def test_isrs_are_at_their_interrupt_numbers(self):
+        for isr, irq in I2C_IRQS.items():
+            self.assertEqual(self.vectors[FIRST_IRQ_VECTOR + irq], isr)
+            self.assertEqual(self.vectors.count(isr), 1)
+
+    def test_isrs_are_declared(self):
+        for isr in I2C_IRQS:
+            self.assertIn("extern void %s(void);" % isr, self.text)
+
+
+if __name__ == "__main__":
+    unittest.main()
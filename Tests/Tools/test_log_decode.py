@@ -0,0 +1,88 @@
+#!/usr/bin/env python3
+"""Host tests of the deferred UART log decoder (Uart_Task/Tools/log_decode.py).
+
+Usage:
+    python3 -m unittest discover -s Tests/Tools
+"""
+
+import os
+import struct
+import sys
+import unittest
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                                "..", "..", "Uart_Task", "Tools"))
+
+import log_decode  # noqa: E402
+
+
+def cobs_encode(data):
+    """Reference COBS encoder (without the 0x00 delimiter)."""
+    out = bytearray([0])
+    code_index = 0
+    for byte in data:
+        if byte == 0:
+            out[code_index] = len(out) - code_index
+            code_index = len(out)
+            out.append(0)
+        else:
+            out.append(byte)
+            if len(out) - code_index == 0xFF:
+                out[code_index] = 0xFF
+                code_index = len(out)
+                out.append(0)
+    out[code_index] = len(out) - code_index
+    return bytes(out)
+
+
+class FakeImage:
+    """Flash image holding format strings at given addresses."""
+
+    def __init__(self, strings):
+        self.strings = strings
+
+    def string(self, address):
+        return self.strings.get(address)
+
+
+class CobsDecodeTest(unittest.TestCase):
+
+    def test_round_trip(self):
+        samples = [b"", b"\x00", b"\x00\x00", b"\x11\x22\x00\x33", bytes(range(256)),
+                   b"\x01" * 253, b"\x01" * 254, b"\x01" * 255, b"\x01" * 600]
+        for data in samples:
+            self.assertEqual(data, log_decode.cobs_decode(cobs_encode(data)), data.hex())
+
+    def test_truncated_frame_is_rejected(self):
+        # Last block announces more bytes than the frame holds
+        self.assertIsNone(log_decode.cobs_decode(b"\x04\x11\x22"))
+        self.assertIsNone(log_decode.cobs_decode(b"\x05\x11\x22"))
+        # Record without zero byte: one block, every shorter capture is cut inside it
+        frame = cobs_encode(struct.pack("<II", 0x11223344, 0x55667788))
+        for length in range(1, len(frame)):
+            self.assertIsNone(log_decode.cobs_decode(frame[:length]), frame[:length].hex())
+
+    def test_zero_code_is_rejected(self):
+        self.assertIsNone(log_decode.cobs_decode(b"\x02\x11\x00\x11"))
+
+
+class FormatRecordTest(unittest.TestCase):
+
+    def setUp(self):
+        self.image = FakeImage({0x1000: "x=%d y=%u h=%04X %c %s%%", 0x2000: "name"})
+
+    def test_arguments(self):
+        record = struct.pack("<6I", 0x1000, 0xFFFFFFFE, 5, 0xAB, ord("k"), 0x2000)
+        self.assertEqual("x=-2 y=5 h=00AB k name%", log_decode.format_record(self.image, record))
+
+    def test_missing_argument(self):
+        record = struct.pack("<2I", 0x1000, 1)
+        self.assertTrue(log_decode.format_record(self.image, record).startswith("x=1 y=<missing>"))
+
+    def test_bad_records(self):
+        self.assertTrue(log_decode.format_record(self.image, b"\x00\x10").startswith("<malformed"))
+        self.assertTrue(log_decode.format_record(self.image, struct.pack("<I", 0x3000)).startswith("<unknown"))
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,284 @@
+/********************************************************************************
+ * @file          Test_Bridge.c
+ * @brief         Host tests of UART bridge (shared blocks pool, slow ports,
+ *                upstream traffic resumed when the pool was empty and per port
+ *                delivered / dropped bytes of a full eight UARTs bridge)
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ *******************************************************************************/
+
+#include "UART_Prog.c"
+#include "BRIDGE_Prog.c"
+#include "Uart_Model.h"
+
+
+/* Bytes received by one upstream Rx interrupt */
+#define TEST_CHUNK_SIZE             (16U)
+
+/* Upstream bytes a downstream wire sends while one chunk is received (same baud rate) */
+#define TEST_WIRE_PER_CHUNK         (TEST_CHUNK_SIZE)
+
+static Uart_Config g_upstream;
+static Uart_Config g_downstream[BRIDGE_MAX_PORTS];
+static const Uart_Config* const g_downstreamPtrs[BRIDGE_MAX_PORTS] = {
+    &g_downstream[0], &g_downstream[1], &g_downstream[2], &g_downstream[3],
+    &g_downstream[4], &g_downstream[5], &g_downstream[6]
+};
+
+/* Interrupt handler of each UART instance */
+static void (* const g_uartIsrs[BRIDGE_NUMBER_OF_UARTS])(void) = {
+    UART0_ISR, UART1_ISR, UART2_ISR, UART3_ISR, UART4_ISR, UART5_ISR, UART6_ISR, UART7_ISR
+};
+
+/* Bytes sent upstream (byte i is (i * 7) + (i >> 8)) */
+static uint32 g_sent;
+
+static void Test_UartConfig(Uart_Config* Config, Uart_Instance UartNum, uint32 Interrupts)
+{
+    memset(Config, 0, sizeof(Uart_Config));
+    Config->UartNum        = UartNum;
+    Config->WordLength     = EightBits;
+    Config->UartInterrupts = Interrupts;
+    Config->ClkValue       = 80000000U;
+    Config->BaudRate       = 1000000U;
+    Config->StopBits       = STOP_BITS_1_BIT;
+    Config->ParityMode     = PARITY_MODE_DISABLE;
+    Config->FifoMode       = FIFO_MODE_ENABLE;
+    Config->RxFifoLevel    = FIFO_LEVEL_1_2;
+    Config->TxFifoLevel    = FIFO_LEVEL_1_2;
+    Config->ClkSrc         = CLOCK_SRC_SYSTEM;
+
+    Model_UartAttach(UartNum);
+    TEST_ASSERT_EQ(RET_OK, Uart_Init(Config));
+}
+
+/* Upstream is UART0, downstream ports are UART1 -> UART(PortCount) */
+static void Test_BridgeSetUp(uint8 PortCount)
+{
+    uint8 Port = 0;
+
+    memset(g_uartRxRing, 0, sizeof(g_uartRxRing));
+    memset(g_uartTxRing, 0, sizeof(g_uartTxRing));
+    memset((void*)g_callBackPtrUartInterrupt, 0, sizeof(g_callBackPtrUartInterrupt));
+    g_sent = 0;
+
+    Test_UartConfig(&g_upstream, Uart0, InterruptMaskReceive | InterruptMaskReceiveTimeOut);
+    for(Port = 0; Port < PortCount; Port++)
+    {
+        Test_UartConfig(&g_downstream[Port], (Uart_Instance)(Uart1 + Port), 0);
+    }
+
+    TEST_ASSERT_EQ(RET_OK, Bridge_Init(&g_upstream, g_downstreamPtrs, PortCount));
+}
+
+static uint8 Test_Byte(uint32 Index)
+{
+    return (uint8)((Index * 7U) + (Index >> 8));
+}
+
+/* Next upstream bytes arrive, Rx interrupt is served */
+static void Test_Upstream(void)
+{
+    uint8 Chunk[TEST_CHUNK_SIZE];
+    uint32 Index = 0;
+
+    for(Index = 0; Index < TEST_CHUNK_SIZE; Index++)
+    {
+        Chunk[Index] = Test_Byte(g_sent + Index);
+    }
+    g_sent += TEST_CHUNK_SIZE;
+
+    Model_UartReceive(Uart0, Chunk, TEST_CHUNK_SIZE);
+    Model_UartRxTimeOut(Uart0);
+    Model_UartRunIsr(Uart0, UART0_ISR);
+}
+
+static uint8 Test_QueueLevel(uint8 Port)
+{
+    return (uint8)(g_bridgePorts[Port].Head - g_bridgePorts[Port].Tail);
+}
+
+/* Downstream port sends everything queued (only its own Tx interrupt runs) */
+static void Test_DrainPort(Uart_Instance UartNum, void (*Isr)(void))
+{
+    uint32 Rounds = 0;
+
+    while( ( (g_modelUart[UartNum].TxCount != 0) || (Test_QueueLevel(g_bridgePortOfUart[UartNum]) != 0) ) &&
+           (Rounds < 1000U) )
+    {
+        Model_UartShift(UartNum, MODEL_UART_FIFO_SIZE);
+        Model_UartRunIsr(UartNum, Isr);
+        Rounds++;
+    }
+}
+
+static void Test_TrafficResumesAfterEmptyPool(void)
+{
+    uint32 Rounds = 0;
+    uint32 Index  = 0;
+    uint16 Waiting = 0;
+
+    Test_BridgeSetUp(2);
+
+    /* Both ports stalled: their queues fill up with the same blocks */
+    while( (Test_QueueLevel(1) < BRIDGE_PORT_QUEUE_DEPTH) && (Rounds < 100U) )
+    {
+        Test_Upstream();
+        Rounds++;
+    }
+    TEST_ASSERT_EQ(BRIDGE_PORT_QUEUE_DEPTH, Test_QueueLevel(0));
+    TEST_ASSERT_EQ(BRIDGE_PORT_QUEUE_DEPTH, Test_QueueLevel(1));
+    TEST_ASSERT_EQ(0, Bridge_GetDroppedBytes(Uart1));
+
+    /* UART1 catches up, UART2 keeps its blocks */
+    Test_DrainPort(Uart1, UART1_ISR);
+    TEST_ASSERT_EQ(0, Test_QueueLevel(0));
+
+    /* UART1 stalls too: blocks only UART1 gets take the rest of the pool */
+    Rounds = 0;
+    while( ( (g_bridgeFreeCount != 0) || (g_bridgeOpenBlock != BRIDGE_NO_BLOCK) ) && (Rounds < 100U) )
+    {
+        Test_Upstream();
+        Rounds++;
+    }
+    TEST_ASSERT_EQ(0, g_bridgeFreeCount);
+    TEST_ASSERT_EQ(BRIDGE_PORT_QUEUE_DEPTH, Test_QueueLevel(0));
+    TEST_ASSERT(Bridge_GetDroppedBytes(Uart2) != 0);
+
+    /* Upstream bytes wait in the Rx ring buffer, their Rx interrupts are over */
+    for(Index = 0; Index < 4U; Index++)
+    {
+        Test_Upstream();
+    }
+    Waiting = (uint16)(g_uartRxRing[Uart0].Head - g_uartRxRing[Uart0].Tail);
+    TEST_ASSERT(Waiting >= (4U * TEST_CHUNK_SIZE));
+    TEST_ASSERT_EQ(0, Model_UartPending(Uart0));
+
+    /* Blocks given back by UART1 Tx interrupt drain the Rx ring buffer */
+    Test_DrainPort(Uart1, UART1_ISR);
+    TEST_ASSERT_EQ(0, (uint16)(g_uartRxRing[Uart0].Head - g_uartRxRing[Uart0].Tail));
+    TEST_ASSERT_EQ(0, g_modelUart[Uart1].TxCount);
+
+    /* UART1 never skipped a byte */
+    TEST_ASSERT_EQ(0, Bridge_GetDroppedBytes(Uart1));
+    TEST_ASSERT_EQ(g_sent, g_modelUart[Uart1].WireCount);
+    for(Index = 0; Index < g_modelUart[Uart1].WireCount; Index++)
+    {
+        if(g_modelUart[Uart1].Wire[Index] != Test_Byte(Index))
+        {
+            break;
+        }
+    }
+    TEST_ASSERT_EQ(g_sent, Index);
+
+    /* Upstream goes on normally */
+    Test_Upstream();
+    Test_DrainPort(Uart1, UART1_ISR);
+    TEST_ASSERT_EQ(g_sent, g_modelUart[Uart1].WireCount);
+    TEST_ASSERT_EQ(Test_Byte(g_sent - 1U), g_modelUart[Uart1].Wire[g_sent - 1U]);
+}
+
+/* Bytes of a port still waiting in its queue of blocks */
+static uint32 Test_QueuedBytes(uint8 Port)
+{
+    uint32 Bytes = 0;
+    uint8 Index  = 0;
+
+    for(Index = g_bridgePorts[Port].Tail; Index != g_bridgePorts[Port].Head; Index++)
+    {
+        Bytes += g_bridgeBlocks[g_bridgePorts[Port].Queue[Index & BRIDGE_PORT_QUEUE_MASK]].Length;
+    }
+
+    return Bytes - ( (Bytes != 0) ? g_bridgePorts[Port].Offset : 0U );
+}
+
+/* Number of leading wire bytes which are the upstream stream in order */
+static uint32 Test_InOrderBytes(Uart_Instance UartNum)
+{
+    uint32 Index = 0;
+
+    while( (Index < g_modelUart[UartNum].WireCount) && (g_modelUart[UartNum].Wire[Index] == Test_Byte(Index)) )
+    {
+        Index++;
+    }
+
+    return Index;
+}
+
+static void Test_EightUartsWithOneStalledPort(void)
+{
+    /* UART3 never sends (CTS held by the far end) */
+    const Uart_Instance Stalled = Uart3;
+    uint32 Round = 0;
+    uint8 Port   = 0;
+    Uart_Instance UartNum = Uart1;
+    uint32 Accounted = 0;
+
+    Test_BridgeSetUp(BRIDGE_MAX_PORTS);
+
+    /* Upstream at full rate: every downstream wire sends as fast as upstream receives */
+    for(Round = 0; Round < 200U; Round++)
+    {
+        Test_Upstream();
+
+        for(Port = 0; Port < BRIDGE_MAX_PORTS; Port++)
+        {
+            UartNum = (Uart_Instance)(Uart1 + Port);
+            if(UartNum != Stalled)
+            {
+                Model_UartShift(UartNum, TEST_WIRE_PER_CHUNK);
+                Model_UartRunIsr(UartNum, g_uartIsrs[UartNum]);
+            }
+        }
+
+        /* Stalled port never holds the upstream back */
+        if( ((uint16)(g_uartRxRing[Uart0].Head - g_uartRxRing[Uart0].Tail) != 0) ||
+            (Model_UartPending(Uart0) != 0) )
+        {
+            break;
+        }
+    }
+    TEST_ASSERT_EQ(200U, Round);
+
+    for(Port = 0; Port < BRIDGE_MAX_PORTS; Port++)
+    {
+        UartNum = (Uart_Instance)(Uart1 + Port);
+        if(UartNum != Stalled)
+        {
+            Test_DrainPort(UartNum, g_uartIsrs[UartNum]);
+
+            /* Every byte delivered in order, none dropped */
+            TEST_ASSERT_EQ(0, Bridge_GetDroppedBytes(UartNum));
+            TEST_ASSERT_EQ(g_sent, g_modelUart[UartNum].WireCount);
+            TEST_ASSERT_EQ(g_sent, Test_InOrderBytes(UartNum));
+        }
+    }
+
+    /* Stalled port: its Tx FIFO and queue are full, the rest was dropped */
+    Port = g_bridgePortOfUart[Stalled];
+    TEST_ASSERT_EQ(0, g_modelUart[Stalled].WireCount);
+    TEST_ASSERT_EQ(BRIDGE_PORT_QUEUE_DEPTH, Test_QueueLevel(Port));
+    Accounted = g_modelUart[Stalled].TxCount + Test_QueuedBytes(Port) + Bridge_GetDroppedBytes(Stalled);
+    TEST_ASSERT_EQ(g_sent, Accounted);
+    TEST_ASSERT(Bridge_GetDroppedBytes(Stalled) > (g_sent / 2U));
+
+    /* Only the stalled port holds blocks (plus none open) */
+    TEST_ASSERT_EQ(BRIDGE_BLOCK_COUNT - BRIDGE_PORT_QUEUE_DEPTH, g_bridgeFreeCount);
+
+    /* Stalled port resumes: what it kept is the head of the stream, nothing else is lost */
+    Test_DrainPort(Stalled, g_uartIsrs[Stalled]);
+    TEST_ASSERT_EQ(g_sent, g_modelUart[Stalled].WireCount + Bridge_GetDroppedBytes(Stalled));
+    TEST_ASSERT_EQ(g_modelUart[Stalled].WireCount, Test_InOrderBytes(Stalled));
+    TEST_ASSERT_EQ(BRIDGE_BLOCK_COUNT, g_bridgeFreeCount);
+}
+
+int main(void)
+{
+    Test_RegsInit();
+
+    TEST_RUN(Test_TrafficResumesAfterEmptyPool);
+    TEST_RUN(Test_EightUartsWithOneStalledPort);
+
+    return Test_Summary("Test_Bridge");
+}
@@ -0,0 +1,307 @@
+/********************************************************************************
+ * @file          Test_Frame.c
+ * @brief         Host tests of UART Rx framing layer (COBS / SLIP decoding in
+ *                UART Rx interrupt, frame pool and dropped frames)
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ *******************************************************************************/
+
+#include "UART_Prog.c"
+#include "FRAME_Prog.c"
+#include "Uart_Model.h"
+
+
+static Uart_Config g_config;
+static Frame_Receiver g_receiver;
+static uint32 g_framesReady;
+
+static void Test_FrameReady(void)
+{
+    g_framesReady++;
+}
+
+static void Test_FrameSetUp(uint8 Encoding)
+{
+    memset(&g_config, 0, sizeof(g_config));
+    g_config.UartNum        = Uart0;
+    g_config.WordLength     = EightBits;
+    g_config.UartInterrupts = InterruptMaskReceive;
+    g_config.ClkValue       = 80000000U;
+    g_config.BaudRate       = 1000000U;
+    g_config.StopBits       = STOP_BITS_1_BIT;
+    g_config.ParityMode     = PARITY_MODE_DISABLE;
+    g_config.FifoMode       = FIFO_MODE_ENABLE;
+    g_config.RxFifoLevel    = FIFO_LEVEL_1_2;
+    g_config.TxFifoLevel    = FIFO_LEVEL_1_2;
+    g_config.ClkSrc         = CLOCK_SRC_SYSTEM;
+
+    memset(g_uartRxRing, 0, sizeof(g_uartRxRing));
+    memset((void*)g_callBackPtrUartInterrupt, 0, sizeof(g_callBackPtrUartInterrupt));
+    g_framesReady = 0;
+
+    Model_UartAttach(Uart0);
+    TEST_ASSERT_EQ(RET_OK, Uart_Init(&g_config));
+    TEST_ASSERT_EQ(RET_OK, Frame_Init(&g_receiver, &g_config, Encoding, Test_FrameReady));
+}
+
+/* Reference COBS encoder (delimiter included) */
+static uint32 Test_CobsEncode(const uint8* Data, uint32 Length, uint8* Encoded)
+{
+    uint32 Code  = 0;
+    uint32 Out   = 1;
+    uint32 Index = 0;
+
+    for(Index = 0; Index < Length; Index++)
+    {
+        if(Data[Index] == 0)
+        {
+            Encoded[Code] = (uint8)(Out - Code);
+            Code = Out++;
+        }
+        else
+        {
+            Encoded[Out++] = Data[Index];
+            if((Out - Code) == 0xFFU)
+            {
+                Encoded[Code] = 0xFFU;
+                Code = Out++;
+            }
+        }
+    }
+    Encoded[Code]  = (uint8)(Out - Code);
+    Encoded[Out++] = 0x00;
+
+    return Out;
+}
+
+/* Reference SLIP encoder (delimiter included) */
+static uint32 Test_SlipEncode(const uint8* Data, uint32 Length, uint8* Encoded)
+{
+    uint32 Out   = 0;
+    uint32 Index = 0;
+
+    for(Index = 0; Index < Length; Index++)
+    {
+        if(Data[Index] == SLIP_END)
+        {
+            Encoded[Out++] = SLIP_ESC;
+            Encoded[Out++] = SLIP_ESC_END;
+        }
+        else if(Data[Index] == SLIP_ESC)
+        {
+            Encoded[Out++] = SLIP_ESC;
+            Encoded[Out++] = SLIP_ESC_ESC;
+        }
+        else
+        {
+            Encoded[Out++] = Data[Index];
+        }
+    }
+    Encoded[Out++] = SLIP_END;
+
+    return Out;
+}
+
+/* Bytes arrive on the wire in bursts below the Rx FIFO size */
+static void Test_Feed(const uint8* Data, uint32 Length)
+{
+    uint32 Chunk = 0;
+
+    while(Length > 0)
+    {
+        Chunk = (Length > 12U) ? 12U : Length;
+        Model_UartReceive(Uart0, Data, Chunk);
+        Model_UartRxTimeOut(Uart0);
+        Model_UartRunIsr(Uart0, UART0_ISR);
+        Data   += Chunk;
+        Length -= Chunk;
+    }
+}
+
+/* Payload with zeros, delimiters and escape bytes */
+static void Test_Payload(uint8* Data, uint32 Length, uint32 Seed)
+{
+    uint32 Index = 0;
+
+    for(Index = 0; Index < Length; Index++)
+    {
+        Seed = (Seed * 1103515245U) + 12345U;
+        Data[Index] = (uint8)(Seed >> 16);
+        if((Seed & 0x700U) == 0)
+        {
+            Data[Index] = 0x00;
+        }
+        else if((Seed & 0x700U) == 0x100U)
+        {
+            Data[Index] = SLIP_END;
+        }
+        else if((Seed & 0x700U) == 0x200U)
+        {
+            Data[Index] = SLIP_ESC;
+        }
+    }
+}
+
+static void Test_ExpectFrame(const uint8* Data, uint32 Length)
+{
+    const uint8* Frame = NULL_PTR;
+    uint16 FrameLength = 0;
+
+    Frame = Frame_Get(&g_receiver, &FrameLength);
+    TEST_ASSERT(Frame != NULL_PTR);
+    if(Frame == NULL_PTR)
+    {
+        return;
+    }
+
+    /* Zero copy: the frame is handed inside the pool */
+    TEST_ASSERT( (Frame >= &g_receiver.Pool[0][0]) && (Frame < &g_receiver.Pool[FRAME_POOL_SIZE][0]) );
+    TEST_ASSERT_EQ(Length, FrameLength);
+    TEST_ASSERT(memcmp(Frame, Data, Length) == 0);
+    Frame_Release(&g_receiver);
+}
+
+static void Test_CobsFramesRoundTrip(void)
+{
+    static uint8 Data[FRAME_MAX_LENGTH];
+    static uint8 Encoded[FRAME_MAX_LENGTH + 8];
+    uint32 Length  = 0;
+    uint32 Frames  = 0;
+    uint32 EncodedLength = 0;
+    uint16 FrameLength   = 0;
+
+    Test_FrameSetUp(FRAME_ENCODING_COBS);
+
+    /* All lengths, across the 254 bytes block boundary */
+    for(Length = 0; Length <= FRAME_MAX_LENGTH; Length++)
+    {
+        Test_Payload(Data, Length, Length);
+        EncodedLength = Test_CobsEncode(Data, Length, Encoded);
+        Test_Feed(Encoded, EncodedLength);
+        Frames++;
+        TEST_ASSERT_EQ(Frames, g_framesReady);
+        Test_ExpectFrame(Data, Length);
+    }
+
+    /* Block of 254 non zero bytes (code 0xFF, no implicit zero) */
+    memset(Data, 0x55, 254);
+    EncodedLength = Test_CobsEncode(Data, 254, Encoded);
+    TEST_ASSERT_EQ(0xFF, Encoded[0]);
+    Test_Feed(Encoded, EncodedLength);
+    Test_ExpectFrame(Data, 254);
+
+    TEST_ASSERT_EQ(0, Frame_GetDroppedCount(&g_receiver));
+    TEST_ASSERT(Frame_Get(&g_receiver, &FrameLength) == NULL_PTR);
+}
+
+static void Test_CobsBadFramesAreDropped(void)
+{
+    static uint8 Data[FRAME_MAX_LENGTH + 1];
+    static uint8 Encoded[FRAME_MAX_LENGTH + 8];
+    const uint8 Truncated[] = {0x05, 'a', 'b', 0x00};
+    const uint8 Good[]      = {0x03, 'o', 'k', 0x00};
+    uint32 EncodedLength    = 0;
+
+    Test_FrameSetUp(FRAME_ENCODING_COBS);
+
+    /* Block shorter than its code */
+    Test_Feed(Truncated, sizeof(Truncated));
+    TEST_ASSERT_EQ(1, Frame_GetDroppedCount(&g_receiver));
+
+    /* Longer than a frame buffer */
+    memset(Data, 0x11, sizeof(Data));
+    EncodedLength = Test_CobsEncode(Data, sizeof(Data), Encoded);
+    Test_Feed(Encoded, EncodedLength);
+    TEST_ASSERT_EQ(2, Frame_GetDroppedCount(&g_receiver));
+
+    /* Receiver resynchronizes on the delimiter */
+    Test_Feed(Good, sizeof(Good));
+    TEST_ASSERT_EQ(1, g_framesReady);
+    Test_ExpectFrame((const uint8*)"ok", 2);
+}
+
+static void Test_FullPoolDropsFrames(void)
+{
+    const uint8 Frame[]  = {0x02, 'x', 0x00};
+    const uint8 Empty[]  = {0x01, 0x00};
+    uint32 Index = 0;
+
+    Test_FrameSetUp(FRAME_ENCODING_COBS);
+
+    for(Index = 0; Index < FRAME_POOL_SIZE + 1U; Index++)
+    {
+        Test_Feed(Frame, sizeof(Frame));
+    }
+    TEST_ASSERT_EQ(FRAME_POOL_SIZE, g_framesReady);
+    TEST_ASSERT_EQ(1, Frame_GetDroppedCount(&g_receiver));
+
+    /* Empty frame has no byte to store but still needs a buffer */
+    Test_Feed(Empty, sizeof(Empty));
+    TEST_ASSERT_EQ(FRAME_POOL_SIZE, g_framesReady);
+    TEST_ASSERT_EQ(2, Frame_GetDroppedCount(&g_receiver));
+
+    for(Index = 0; Index < FRAME_POOL_SIZE; Index++)
+    {
+        Test_ExpectFrame((const uint8*)"x", 1);
+    }
+
+    /* Buffers are free again */
+    Test_Feed(Frame, sizeof(Frame));
+    Test_ExpectFrame((const uint8*)"x", 1);
+    TEST_ASSERT_EQ(2, Frame_GetDroppedCount(&g_receiver));
+}
+
+static void Test_SlipFramesRoundTrip(void)
+{
+    static uint8 Data[FRAME_MAX_LENGTH];
+    static uint8 Encoded[(2 * FRAME_MAX_LENGTH) + 2];
+    uint32 Length = 0;
+    uint32 EncodedLength  = 0;
+
+    Test_FrameSetUp(FRAME_ENCODING_SLIP);
+
+    for(Length = 1; Length <= FRAME_MAX_LENGTH; Length++)
+    {
+        Test_Payload(Data, Length, Length * 7U);
+        EncodedLength = Test_SlipEncode(Data, Length, Encoded);
+        Test_Feed(Encoded, EncodedLength);
+        Test_ExpectFrame(Data, Length);
+    }
+    TEST_ASSERT_EQ(FRAME_MAX_LENGTH, g_framesReady);
+
+    /* Empty frames (back to back END bytes) are ignored */
+    Test_Feed((const uint8*)"\xC0\xC0\xC0", 3);
+    TEST_ASSERT_EQ(FRAME_MAX_LENGTH, g_framesReady);
+    TEST_ASSERT_EQ(0, Frame_GetDroppedCount(&g_receiver));
+}
+
+static void Test_SlipBadEscapesAreDropped(void)
+{
+    const uint8 BadEscape[]   = {'a', SLIP_ESC, 'b', 'c', SLIP_END};
+    const uint8 EscapeAtEnd[] = {'a', SLIP_ESC, SLIP_END};
+    const uint8 Good[]        = {'o', 'k', SLIP_END};
+
+    Test_FrameSetUp(FRAME_ENCODING_SLIP);
+
+    Test_Feed(BadEscape, sizeof(BadEscape));
+    Test_Feed(EscapeAtEnd, sizeof(EscapeAtEnd));
+    TEST_ASSERT_EQ(2, Frame_GetDroppedCount(&g_receiver));
+    TEST_ASSERT_EQ(0, g_framesReady);
+
+    Test_Feed(Good, sizeof(Good));
+    Test_ExpectFrame((const uint8*)"ok", 2);
+}
+
+int main(void)
+{
+    Test_RegsInit();
+
+    TEST_RUN(Test_CobsFramesRoundTrip);
+    TEST_RUN(Test_CobsBadFramesAreDropped);
+    TEST_RUN(Test_FullPoolDropsFrames);
+    TEST_RUN(Test_SlipFramesRoundTrip);
+    TEST_RUN(Test_SlipBadEscapesAreDropped);
+
+    return Test_Summary("Test_Frame");
+}
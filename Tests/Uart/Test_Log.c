@@ -0,0 +1,172 @@
+/********************************************************************************
+ * @file          Test_Log.c
+ * @brief         Host tests of deferred binary logging (records ring buffer,
+ *                COBS encoding and streaming with Uart_Write)
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ *******************************************************************************/
+
+#include <stdint.h>
+#include "UART_Prog.c"
+#include "LOG_Prog.c"
+#include "Uart_Model.h"
+
+
+/* Format strings are only recorded by address, the target ones live in flash */
+#define TEST_FORMAT(ADDRESS)        ((const char*)(uintptr_t)(ADDRESS))
+
+static Uart_Config g_config;
+
+static void Test_LogSetUp(void)
+{
+    memset(&g_config, 0, sizeof(g_config));
+    g_config.UartNum        = Uart0;
+    g_config.WordLength     = EightBits;
+    g_config.ClkValue       = 80000000U;
+    g_config.BaudRate       = 921600U;
+    g_config.StopBits       = STOP_BITS_1_BIT;
+    g_config.ParityMode     = PARITY_MODE_DISABLE;
+    g_config.FifoMode       = FIFO_MODE_ENABLE;
+    g_config.TxFifoLevel    = FIFO_LEVEL_1_2;
+    g_config.ClkSrc         = CLOCK_SRC_SYSTEM;
+
+    memset(g_uartTxRing, 0, sizeof(g_uartTxRing));
+
+    Model_UartAttach(Uart0);
+    TEST_ASSERT_EQ(RET_OK, Uart_Init(&g_config));
+    TEST_ASSERT_EQ(RET_OK, Log_Init(&g_config));
+}
+
+/* Send everything queued to the wire (Tx FIFO shifted, Tx interrupt served) */
+static void Test_Drain(void)
+{
+    while( (g_modelUart[Uart0].TxCount != 0) || (g_uartTxRing[Uart0].Head != g_uartTxRing[Uart0].Tail) )
+    {
+        Model_UartShift(Uart0, MODEL_UART_FIFO_SIZE);
+        Model_UartRunIsr(Uart0, UART0_ISR);
+    }
+}
+
+/* Decode the wire records (COBS, 0x00 delimited) into words, returns the record count */
+static uint32 Test_DecodeWire(uint32 Words[][1U + LOG_MAX_ARGS], uint32 WordCounts[], uint32 MaxRecords)
+{
+    const uint8* Wire = g_modelUart[Uart0].Wire;
+    uint32 Length  = g_modelUart[Uart0].WireCount;
+    uint32 Records = 0;
+    uint32 Start   = 0;
+    uint32 End     = 0;
+    uint32 Index   = 0;
+    uint32 Code    = 0;
+    uint8  Raw[LOG_RECORD_MAX_BYTES + 1U];
+    uint32 RawLength = 0;
+
+    while( (Start < Length) && (Records < MaxRecords) )
+    {
+        for(End = Start; (End < Length) && (Wire[End] != 0); End++);
+
+        RawLength = 0;
+        for(Index = Start; Index < End; Index += Code)
+        {
+            Code = Wire[Index];
+            TEST_ASSERT( (Code != 0) && (Index + Code <= End) );
+            memcpy(&Raw[RawLength], &Wire[Index + 1U], Code - 1U);
+            RawLength += Code - 1U;
+            if( (Code < 0xFFU) && (Index + Code < End) )
+            {
+                Raw[RawLength++] = 0;
+            }
+        }
+
+        TEST_ASSERT_EQ(0, RawLength % 4U);
+        WordCounts[Records] = RawLength / 4U;
+        for(Index = 0; Index < WordCounts[Records]; Index++)
+        {
+            Words[Records][Index] = (uint32)Raw[4U * Index] | ((uint32)Raw[(4U * Index) + 1U] << 8) |
+                                    ((uint32)Raw[(4U * Index) + 2U] << 16) | ((uint32)Raw[(4U * Index) + 3U] << 24);
+        }
+        Records++;
+        Start = End + 1U;
+    }
+
+    return Records;
+}
+
+static void Test_RecordsAreStreamedInOrder(void)
+{
+    uint32 Words[8][1U + LOG_MAX_ARGS];
+    uint32 WordCounts[8];
+
+    Test_LogSetUp();
+
+    LOG0(TEST_FORMAT(0x00001000U));
+    LOG1(TEST_FORMAT(0x00001010U), 0);
+    LOG2(TEST_FORMAT(0x00001020U), -1, 0x00AB00CDU);
+    LOG4(TEST_FORMAT(0x00001030U), 1, 2, 3, 0x04000000U);
+    Log_Write(TEST_FORMAT(0x00001040U), 9U, 5, 6, 7, 8);
+
+    /* Nothing is formatted or sent at call time */
+    TEST_ASSERT_EQ(0, g_modelUart[Uart0].TxCount);
+
+    Log_Process();
+    Test_Drain();
+
+    TEST_ASSERT_EQ(5, Test_DecodeWire(Words, WordCounts, 8));
+    TEST_ASSERT_EQ(1, WordCounts[0]);
+    TEST_ASSERT_EQ(0x00001000U, Words[0][0]);
+    TEST_ASSERT_EQ(2, WordCounts[1]);
+    TEST_ASSERT_EQ(0, Words[1][1]);
+    TEST_ASSERT_EQ(3, WordCounts[2]);
+    TEST_ASSERT_EQ(0xFFFFFFFFU, Words[2][1]);
+    TEST_ASSERT_EQ(0x00AB00CDU, Words[2][2]);
+    TEST_ASSERT_EQ(5, WordCounts[3]);
+    TEST_ASSERT_EQ(0x04000000U, Words[3][4]);
+
+    /* Extra arguments are cut to LOG_MAX_ARGS */
+    TEST_ASSERT_EQ(1U + LOG_MAX_ARGS, WordCounts[4]);
+    TEST_ASSERT_EQ(0x00001040U, Words[4][0]);
+    TEST_ASSERT_EQ(8, Words[4][4]);
+    TEST_ASSERT_EQ(0, Log_GetDroppedCount());
+}
+
+static void Test_FullRingDropsRecords(void)
+{
+    static uint32 Words[100][1U + LOG_MAX_ARGS];
+    static uint32 WordCounts[100];
+    uint32 Written = 0;
+    uint32 Records = 0;
+
+    Test_LogSetUp();
+
+    /* A record of 3 words is accepted only while a full one (6 words) fits */
+    for(Written = 0; Written < 100U; Written++)
+    {
+        LOG1(TEST_FORMAT(0x00002000U), Written);
+    }
+    TEST_ASSERT_EQ(100U - ((LOG_RING_WORDS - (LOG_RECORD_HEADER_WORDS + LOG_MAX_ARGS)) / 3U + 1U), Log_GetDroppedCount());
+
+    /* Tx ring buffer fills up: Log_Process() returns and goes on later */
+    Log_Process();
+    TEST_ASSERT(g_uartTxRing[Uart0].Head != g_uartTxRing[Uart0].Tail);
+    while(g_logRing.Head != g_logRing.Tail)
+    {
+        Test_Drain();
+        Log_Process();
+    }
+    Test_Drain();
+
+    Records = Test_DecodeWire(Words, WordCounts, 100);
+    TEST_ASSERT_EQ(100U - Log_GetDroppedCount(), Records);
+    TEST_ASSERT_EQ(0, Words[0][1]);
+    TEST_ASSERT_EQ(Records - 1U, Words[Records - 1U][1]);
+}
+
+int main(void)
+{
+    Test_RegsInit();
+
+    TEST_RUN(Test_RecordsAreStreamedInOrder);
+    TEST_RUN(Test_FullRingDropsRecords);
+
+    return Test_Summary("Test_Log");
+}
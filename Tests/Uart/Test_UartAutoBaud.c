@@ -0,0 +1,142 @@
+/********************************************************************************
+ * @file          Test_UartAutoBaud.c
+ * @brief         Host tests of UART baud rate detection (sync character edges
+ *                measured in the edge ISR, rate applied out of the ISR)
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ *******************************************************************************/
+
+#include "UART_Prog.c"
+#include "Uart_Model.h"
+
+
+/* Edge timestamps clock (DWT cycle counter at 80 MHz) */
+#define TEST_TIMESTAMP_CLOCK        (80000000U)
+
+static Uart_Config g_config;
+
+static void Test_UartSetUp(uint32 ClkValue)
+{
+    memset(&g_config, 0, sizeof(g_config));
+    g_config.UartNum    = Uart0;
+    g_config.WordLength = EightBits;
+    g_config.ClkValue   = ClkValue;
+    g_config.BaudRate   = 115200U;
+    g_config.StopBits   = STOP_BITS_1_BIT;
+    g_config.ParityMode = PARITY_MODE_DISABLE;
+    g_config.FifoMode   = FIFO_MODE_ENABLE;
+    g_config.ClkSrc     = CLOCK_SRC_SYSTEM;
+
+    memset(g_uartAutoBaud, 0, sizeof(g_uartAutoBaud));
+
+    Model_UartAttach(Uart0);
+    TEST_ASSERT_EQ(RET_OK, Uart_Init(&g_config));
+}
+
+static uint32 Test_UartReg(uint32 Offset)
+{
+    return TEST_REG(UART_0_BASE_ADDRESS + Offset);
+}
+
+/* Edges of the sync character 0x55 (start bit, 8 alternating data bits, stop bit) */
+static uint8 Test_SendSync(uint32 BaudRate, uint32 Start)
+{
+    uint8  Status = UART_AUTOBAUD_IDLE;
+    uint32 Edge   = 0;
+
+    for(Edge = 0; Edge < UART_AUTOBAUD_SYNC_EDGES; Edge++)
+    {
+        Status = Uart_AutoBaudEdge(Uart0, Start + (uint32)(((uint64)Edge * TEST_TIMESTAMP_CLOCK) / BaudRate),
+                                   (uint8)(Edge & 1U));
+    }
+
+    return Status;
+}
+
+static void Test_RateIsAppliedOutOfTheEdgeIsr(void)
+{
+    const uint8 Pending[4] = {'a', 'b', 'c', 'd'};
+    uint32 Ibrd = 0;
+
+    Test_UartSetUp(80000000U);
+    Ibrd = Test_UartReg(UART_IBRD_REG_OFFSET);
+
+    TEST_ASSERT_EQ(RET_OK, Uart_AutoBaudStart(&g_config, TEST_TIMESTAMP_CLOCK));
+    TEST_ASSERT(!BIT_IS_SET(Test_UartReg(UART_CTL_REG_OFFSET), CTL_REG_RXE_POS));
+
+    /* Transmitter stays busy: the edge ISR MUST NOT wait for it */
+    TEST_ASSERT_EQ(sizeof(Pending), Uart_Write(&g_config, Pending, sizeof(Pending)));
+    TEST_ASSERT_EQ(UART_AUTOBAUD_MEASURED, Test_SendSync(9600U, 0xFFFFF000U));
+    TEST_ASSERT_EQ(Ibrd, Test_UartReg(UART_IBRD_REG_OFFSET));
+    TEST_ASSERT(!BIT_IS_SET(Test_UartReg(UART_CTL_REG_OFFSET), CTL_REG_RXE_POS));
+    TEST_ASSERT_EQ(0, Uart_AutoBaudGetRate(Uart0));
+
+    /* More edges are ignored until the rate is applied */
+    TEST_ASSERT_EQ(UART_AUTOBAUD_MEASURED, Uart_AutoBaudEdge(Uart0, 0, 0));
+
+    /* Thread mode: waits for the last character, then reprograms UART */
+    g_modelUart[Uart0].AutoShift = TRUE;
+    TEST_ASSERT_EQ(UART_AUTOBAUD_DONE, Uart_AutoBaudApply(Uart0));
+    TEST_ASSERT_EQ(0, g_modelUart[Uart0].TxCount);
+    TEST_ASSERT_EQ(9600U, Uart_AutoBaudGetRate(Uart0));
+    TEST_ASSERT_EQ(520, Test_UartReg(UART_IBRD_REG_OFFSET));
+    TEST_ASSERT_EQ(53, Test_UartReg(UART_FBRD_REG_OFFSET));
+    TEST_ASSERT(BIT_IS_SET(Test_UartReg(UART_CTL_REG_OFFSET), CTL_REG_RXE_POS));
+    TEST_ASSERT(BIT_IS_SET(Test_UartReg(UART_CTL_REG_OFFSET), CTL_REG_UARTEN_POS));
+
+    /* Applied once */
+    TEST_ASSERT_EQ(UART_AUTOBAUD_DONE, Uart_AutoBaudApply(Uart0));
+}
+
+static void Test_ApplyIsPolledUntilMeasured(void)
+{
+    uint32 Ibrd = 0;
+
+    Test_UartSetUp(16000000U);
+    Ibrd = Test_UartReg(UART_IBRD_REG_OFFSET);
+
+    TEST_ASSERT_EQ(UART_AUTOBAUD_IDLE, Uart_AutoBaudApply(Uart0));
+    TEST_ASSERT_EQ(RET_OK, Uart_AutoBaudStart(&g_config, TEST_TIMESTAMP_CLOCK));
+    TEST_ASSERT_EQ(UART_AUTOBAUD_RUNNING, Uart_AutoBaudApply(Uart0));
+
+    /* A glitch restarts the measurement */
+    TEST_ASSERT_EQ(UART_AUTOBAUD_RUNNING, Uart_AutoBaudEdge(Uart0, 1000U, 0));
+    TEST_ASSERT_EQ(UART_AUTOBAUD_RUNNING, Uart_AutoBaudEdge(Uart0, 1100U, 1));
+    TEST_ASSERT_EQ(UART_AUTOBAUD_RUNNING, Uart_AutoBaudEdge(Uart0, 1500U, 0));
+    TEST_ASSERT_EQ(UART_AUTOBAUD_RUNNING, Uart_AutoBaudApply(Uart0));
+    TEST_ASSERT_EQ(Ibrd, Test_UartReg(UART_IBRD_REG_OFFSET));
+
+    /* 57000 Bd is snapped to 57600 Bd */
+    TEST_ASSERT_EQ(UART_AUTOBAUD_MEASURED, Test_SendSync(57000U, 5000U));
+    TEST_ASSERT_EQ(UART_AUTOBAUD_DONE, Uart_AutoBaudApply(Uart0));
+    TEST_ASSERT_EQ(57600U, Uart_AutoBaudGetRate(Uart0));
+    TEST_ASSERT_EQ(UART_AUTOBAUD_FAILED, Uart_AutoBaudApply((Uart_Instance)8));
+}
+
+static void Test_RateOutOfRangeFails(void)
+{
+    uint32 Ibrd = 0;
+
+    Test_UartSetUp(16000000U);
+    Ibrd = Test_UartReg(UART_IBRD_REG_OFFSET);
+
+    /* 16 MHz can't generate 3 MBd: old rate is kept, receiver enabled again */
+    TEST_ASSERT_EQ(RET_OK, Uart_AutoBaudStart(&g_config, TEST_TIMESTAMP_CLOCK));
+    TEST_ASSERT_EQ(UART_AUTOBAUD_MEASURED, Test_SendSync(3000000U, 0));
+    TEST_ASSERT_EQ(UART_AUTOBAUD_FAILED, Uart_AutoBaudApply(Uart0));
+    TEST_ASSERT_EQ(0, Uart_AutoBaudGetRate(Uart0));
+    TEST_ASSERT_EQ(Ibrd, Test_UartReg(UART_IBRD_REG_OFFSET));
+    TEST_ASSERT(BIT_IS_SET(Test_UartReg(UART_CTL_REG_OFFSET), CTL_REG_RXE_POS));
+}
+
+int main(void)
+{
+    Test_RegsInit();
+
+    TEST_RUN(Test_RateIsAppliedOutOfTheEdgeIsr);
+    TEST_RUN(Test_ApplyIsPolledUntilMeasured);
+    TEST_RUN(Test_RateOutOfRangeFails);
+
+    return Test_Summary("Test_UartAutoBaud");
+}
@@ -0,0 +1,233 @@
+/********************************************************************************
+ * @file          Test_UartBaud.c
+ * @brief         Host tests of UART baud rate divisor solver (precomputed table,
+ *                HSE /8 or /16 runtime fallback and error reporting)
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ *******************************************************************************/
+
+#include "UART_Prog.c"
+#include "Uart_Model.h"
+#include "Udma_Fake.h"
+
+
+/* Baud clocks of the sweep (table clocks and other common crystals/PLL outputs) */
+static const uint32 g_clocks[] = {
+    1843200U, 7372800U, 12000000U, 16000000U, 20000000U, 25000000U,
+    40000000U, 50000000U, 66666666U, 80000000U
+};
+
+/* Baud rates of the sweep (table rates and others) */
+static const uint32 g_baudRates[] = {
+    50U, 110U, 300U, 1200U, 2400U, 4800U, 9600U, 14400U, 19200U, 28800U, 38400U,
+    57600U, 76800U, 115200U, 128000U, 230400U, 250000U, 256000U, 460800U, 500000U,
+    921600U, 1000000U, 1500000U, 2000000U, 3000000U, 5000000U, 10000000U
+};
+
+static uint32 Test_AbsPpm(sint32 Ppm)
+{
+    return (Ppm < 0) ? (uint32)-Ppm : (uint32)Ppm;
+}
+
+static uint32 Test_Min(uint32 A, uint32 B)
+{
+    return (A < B) ? A : B;
+}
+
+/* Error of a divisor given in 1/64 units */
+static uint32 Test_DivisorError(uint32 ClkValue, uint32 BaudRate, uint32 Div64, uint8 Hse)
+{
+    Uart_BaudDivisor Divisor;
+
+    Divisor.ClkValue = ClkValue;
+    Divisor.BaudRate = BaudRate;
+    Divisor.Ibrd     = (uint16)(Div64 >> FBRD_REG_DIVFRAC_BITS);
+    Divisor.Fbrd     = (uint8) (Div64 &  FBRD_REG_DIVFRAC_MASK);
+    Divisor.Hse      = Hse;
+
+    return Test_AbsPpm(Uart_BaudRateErrorPpm(&Divisor));
+}
+
+/* Lowest error of all valid divisors of one ClkDiv. The error only grows away
+ * from the ideal divisor, so a window around it gives the brute force result
+ * (the whole range is searched when FullRange is TRUE)                        */
+static uint32 Test_BestError(uint32 ClkValue, uint32 BaudRate, uint8 Hse, uint8 FullRange)
+{
+    uint32 ClkDiv = (Hse == TRUE) ? UART_CLKDIV_HIGH_SPEED : UART_CLKDIV_NORMAL;
+    uint64 Ideal  = ((uint64)ClkValue * 64U) / ((uint64)ClkDiv * BaudRate);
+    uint32 First  = UART_BRD_DIV64_MIN;
+    uint32 Last   = UART_BRD_DIV64_MAX;
+    uint32 Best   = 0xFFFFFFFFU;
+    uint32 Div64  = 0;
+    uint32 Error  = 0;
+
+    if(FullRange == FALSE)
+    {
+        First = (Ideal > First + 256U) ? (uint32)Test_Min(Ideal - 256U, Last) : First;
+        Last  = (Ideal + 256U < Last)  ? (uint32)(Ideal + 256U) : Last;
+    }
+
+    for(Div64 = First; Div64 <= Last; Div64++)
+    {
+        Error = Test_DivisorError(ClkValue, BaudRate, Div64, Hse);
+        if(Error < Best)
+        {
+            Best = Error;
+        }
+    }
+
+    return Best;
+}
+
+static void Test_TableEntriesAreBestNormalDivisors(void)
+{
+    uint32 Index = 0;
+    const Uart_BaudDivisor* Entry = NULL_PTR;
+
+    for(Index = 0; Index < (sizeof(g_uartBaudTable) / sizeof(g_uartBaudTable[0])); Index++)
+    {
+        Entry = &g_uartBaudTable[Index];
+
+        /* Table is ClkDiv = 16 only, it MUST hold the best divisor of the whole range */
+        TEST_ASSERT_EQ(FALSE, Entry->Hse);
+        TEST_ASSERT_EQ(Test_BestError(Entry->ClkValue, Entry->BaudRate, FALSE, TRUE),
+                       Test_AbsPpm(Uart_BaudRateErrorPpm(Entry)));
+        TEST_ASSERT(Test_AbsPpm(Uart_BaudRateErrorPpm(Entry)) <= UART_BAUD_RATE_MAX_ERROR_PPM);
+    }
+}
+
+static void Test_FallbackChoosesLowerErrorClockDivider(void)
+{
+    uint32 ClkIndex  = 0;
+    uint32 BaudIndex = 0;
+    uint32 ClkValue  = 0;
+    uint32 BaudRate  = 0;
+    uint32 Best      = 0;
+    uint32 Index     = 0;
+    uint8  InTable   = FALSE;
+    Uart_BaudDivisor Divisor;
+
+    for(ClkIndex = 0; ClkIndex < (sizeof(g_clocks) / sizeof(g_clocks[0])); ClkIndex++)
+    {
+        for(BaudIndex = 0; BaudIndex < (sizeof(g_baudRates) / sizeof(g_baudRates[0])); BaudIndex++)
+        {
+            ClkValue = g_clocks[ClkIndex];
+            BaudRate = g_baudRates[BaudIndex];
+
+            /* Baud clock MUST be at least 8 times faster */
+            if((uint64)BaudRate * UART_CLKDIV_HIGH_SPEED > ClkValue)
+            {
+                TEST_ASSERT_EQ(RET_NOT_OK, Uart_BaudRateSolve(ClkValue, BaudRate, &Divisor));
+                continue;
+            }
+
+            TEST_ASSERT_EQ(RET_OK, Uart_BaudRateSolve(ClkValue, BaudRate, &Divisor));
+            TEST_ASSERT_EQ(ClkValue, Divisor.ClkValue);
+            TEST_ASSERT_EQ(BaudRate, Divisor.BaudRate);
+
+            InTable = FALSE;
+            for(Index = 0; Index < (sizeof(g_uartBaudTable) / sizeof(g_uartBaudTable[0])); Index++)
+            {
+                if( (g_uartBaudTable[Index].ClkValue == ClkValue) && (g_uartBaudTable[Index].BaudRate == BaudRate) )
+                {
+                    InTable = TRUE;
+                }
+            }
+
+            /* Table pairs keep ClkDiv = 16, others take the best of both dividers */
+            Best = Test_BestError(ClkValue, BaudRate, FALSE, FALSE);
+            if(InTable == FALSE)
+            {
+                Best = Test_Min(Best, Test_BestError(ClkValue, BaudRate, TRUE, FALSE));
+            }
+            TEST_ASSERT_EQ(Best, Test_AbsPpm(Uart_BaudRateErrorPpm(&Divisor)));
+
+            /* ClkDiv = 16 is kept on a tie */
+            if( (Divisor.Hse == TRUE) && ((uint64)BaudRate * UART_CLKDIV_NORMAL <= ClkValue) )
+            {
+                TEST_ASSERT(Test_BestError(ClkValue, BaudRate, FALSE, FALSE) > Best);
+            }
+        }
+    }
+}
+
+static void Test_GetBaudRateReportsAchievedAndError(void)
+{
+    Uart_Config Config;
+    uint32 Achieved = 0;
+    sint32 ErrorPpm = 0;
+
+    memset(&Config, 0, sizeof(Config));
+    Config.UartNum  = Uart0;
+    Config.ClkValue = 16000000U;
+
+    /* 16 MHz / (16 * 8.6806) -> IBRD 8, FBRD 44: 115108 Bd */
+    Config.BaudRate = 115200U;
+    TEST_ASSERT_EQ(RET_OK, Uart_GetBaudRate(&Config, &Achieved, &ErrorPpm));
+    TEST_ASSERT_EQ(115108U, Achieved);
+    TEST_ASSERT_EQ(-798, ErrorPpm);
+
+    /* 16 MHz / (8 * 1.0) -> HSE: 2 MBd exactly */
+    Config.BaudRate = 2000000U;
+    TEST_ASSERT_EQ(RET_OK, Uart_GetBaudRate(&Config, &Achieved, &ErrorPpm));
+    TEST_ASSERT_EQ(2000000U, Achieved);
+    TEST_ASSERT_EQ(0, ErrorPpm);
+
+    Config.BaudRate = 2000001U;
+    TEST_ASSERT_EQ(RET_NOT_OK, Uart_GetBaudRate(&Config, &Achieved, &ErrorPpm));
+    TEST_ASSERT_EQ(RET_NOT_OK, Uart_GetBaudRate(&Config, NULL_PTR, &ErrorPpm));
+    TEST_ASSERT_EQ(RET_NOT_OK, Uart_GetBaudRate(&Config, &Achieved, NULL_PTR));
+}
+
+static void Test_InitProgramsDivisorOrRejectsIt(void)
+{
+    Uart_Config Config;
+
+    memset(&Config, 0, sizeof(Config));
+    Config.UartNum    = Uart0;
+    Config.WordLength = EightBits;
+    Config.ClkValue   = 16000000U;
+    Config.BaudRate   = 1500000U;
+    Config.StopBits   = STOP_BITS_1_BIT;
+    Config.ParityMode = PARITY_MODE_DISABLE;
+    Config.FifoMode   = FIFO_MODE_ENABLE;
+    Config.ClkSrc     = CLOCK_SRC_SYSTEM;
+
+    Model_UartAttach(Uart0);
+
+    /* 16 MHz / (8 * 1.3281) -> HSE, IBRD 1, FBRD 21 */
+    TEST_ASSERT_EQ(RET_OK, Uart_Init(&Config));
+    TEST_ASSERT_EQ(1, TEST_REG(UART_0_BASE_ADDRESS + UART_IBRD_REG_OFFSET));
+    TEST_ASSERT_EQ(21, TEST_REG(UART_0_BASE_ADDRESS + UART_FBRD_REG_OFFSET));
+    TEST_ASSERT(BIT_IS_SET(TEST_REG(UART_0_BASE_ADDRESS + UART_CTL_REG_OFFSET), CTL_REG_HSE_POS));
+
+    /* Table pair: ClkDiv = 16, IBRD 8, FBRD 44 */
+    Config.BaudRate = 115200U;
+    TEST_ASSERT_EQ(RET_OK, Uart_Init(&Config));
+    TEST_ASSERT_EQ(8, TEST_REG(UART_0_BASE_ADDRESS + UART_IBRD_REG_OFFSET));
+    TEST_ASSERT_EQ(44, TEST_REG(UART_0_BASE_ADDRESS + UART_FBRD_REG_OFFSET));
+    TEST_ASSERT(!BIT_IS_SET(TEST_REG(UART_0_BASE_ADDRESS + UART_CTL_REG_OFFSET), CTL_REG_HSE_POS));
+
+    /* Divisor saturated at IBRD 65535: far above UART tolerance */
+    Config.ClkValue = 80000000U;
+    Config.BaudRate = 50U;
+    TEST_ASSERT_EQ(RET_NOT_OK, Uart_Init(&Config));
+
+    /* Baud clock below 8 * BaudRate */
+    Config.ClkValue = 16000000U;
+    Config.BaudRate = 3000000U;
+    TEST_ASSERT_EQ(RET_NOT_OK, Uart_Init(&Config));
+}
+
+int main(void)
+{
+    Test_RegsInit();
+
+    TEST_RUN(Test_TableEntriesAreBestNormalDivisors);
+    TEST_RUN(Test_FallbackChoosesLowerErrorClockDivider);
+    TEST_RUN(Test_GetBaudRateReportsAchievedAndError);
+    TEST_RUN(Test_InitProgramsDivisorOrRejectsIt);
+
+    return Test_Summary("Test_UartBaud");
+}
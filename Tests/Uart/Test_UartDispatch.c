@@ -0,0 +1,288 @@
+/********************************************************************************
+ * @file          Test_UartDispatch.c
+ * @brief         Host tests of UART interrupt dispatcher (cause handlers and
+ *                application call backs per cause) and micro-benchmark of the
+ *                handlers table against the if-ladder it replaced
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ *******************************************************************************/
+
+#include "UART_Prog.c"
+#include "Uart_Model.h"
+#include "Udma_Fake.h"
+
+
+/* Causes raised by each benchmark run: every single cause alone, then an error burst */
+static const uint32 g_benchCauses[] = {
+    (1U << 4), (1U << 6), (1U << 7), (1U << 8), (1U << 9), (1U << 10), (1U << 12),
+    (1U << 4) | (1U << 7) | (1U << 8) | (1U << 10) | (1U << 12)
+};
+
+static Uart_Config g_config;
+
+/* Call backs in call order: 'R' Receive, 'T' Receive Time-Out, 'F' Framing Error */
+static char g_calls[16];
+static uint32 g_callCount;
+
+static void Test_OnReceive(void)        { g_calls[g_callCount++ & 0xF] = 'R'; }
+static void Test_OnReceiveTimeOut(void) { g_calls[g_callCount++ & 0xF] = 'T'; }
+static void Test_OnFramingError(void)   { g_calls[g_callCount++ & 0xF] = 'F'; }
+
+static void Test_UartSetUp(void)
+{
+    memset(&g_config, 0, sizeof(g_config));
+    g_config.UartNum        = Uart0;
+    g_config.WordLength     = EightBits;
+    g_config.UartInterrupts = (Uart_Interrupts)(InterruptMaskReceive | InterruptMaskFramingError);
+    g_config.ClkValue       = 16000000U;
+    g_config.BaudRate       = 115200U;
+    g_config.StopBits       = STOP_BITS_1_BIT;
+    g_config.ParityMode     = PARITY_MODE_DISABLE;
+    g_config.FifoMode       = FIFO_MODE_ENABLE;
+    g_config.RxFifoLevel    = FIFO_LEVEL_1_2;
+    g_config.TxFifoLevel    = FIFO_LEVEL_1_2;
+    g_config.ClkSrc         = CLOCK_SRC_SYSTEM;
+
+    memset(g_uartRxRing, 0, sizeof(g_uartRxRing));
+    memset((void*)g_callBackPtrUartInterrupt, 0, sizeof(g_callBackPtrUartInterrupt));
+    memset(g_calls, 0, sizeof(g_calls));
+    g_callCount = 0;
+
+    Fake_UdmaReset();
+    Model_UartAttach(Uart0);
+    TEST_ASSERT_EQ(RET_OK, Uart_Init(&g_config));
+
+    TEST_ASSERT_EQ(RET_OK, Uart_SetCallBack(Uart0, InterruptMaskReceive, Test_OnReceive));
+    TEST_ASSERT_EQ(RET_OK, Uart_SetCallBack(Uart0, InterruptMaskReceiveTimeOut, Test_OnReceiveTimeOut));
+    TEST_ASSERT_EQ(RET_OK, Uart_SetCallBack(Uart0, InterruptMaskFramingError, Test_OnFramingError));
+}
+
+/* One cause served as the ISR before the handlers table did: clear it, driver work, call back */
+static void Bench_Serve(Uart_Instance UartNum, volatile uint32* Uart_Ptr, uint8 Bit,
+                        void (*Handler)(Uart_Instance UartNum, volatile uint32* Uart_Ptr))
+{
+    *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_ICR_REG_OFFSET) = (1UL << Bit);
+
+    if(Handler != NULL_PTR)
+    {
+        (*Handler)(UartNum, Uart_Ptr);
+    }
+
+    if(g_callBackPtrUartInterrupt[UartNum][Bit] != NULL_PTR)
+    {
+        (*g_callBackPtrUartInterrupt[UartNum][Bit])();
+    }
+}
+
+/* Dispatcher before the handlers table: an if-ladder reading the status again for every
+ * test and serving one cause per ISR entry (shared by the UART ISRs like the table one) */
+static __attribute__((noinline)) void Bench_IsrLadder(Uart_Instance UartNum)
+{
+    volatile uint32* Uart_Ptr = g_uartHandles[UartNum].Base;
+    volatile uint32* Mis_Ptr  = (volatile uint32*)((volatile uint8*)Uart_Ptr + UART_MIS_REG_OFFSET);
+    uint32 EntryCycles = UART_CYCLE_COUNTER();
+
+    Uart_DmaIsrHandler(UartNum, Uart_Ptr);
+
+    if(BIT_IS_SET(*Mis_Ptr, MIS_REG_TXMIS_POS) )
+    {
+        Bench_Serve(UartNum, Uart_Ptr, RIS_REG_TXRIS_POS, Uart_TxIsrHandler);
+    }
+    else if(BIT_IS_SET(*Mis_Ptr, MIS_REG_RXMIS_POS) )
+    {
+        Bench_Serve(UartNum, Uart_Ptr, RIS_REG_RXRIS_POS, Uart_RxIsrHandler);
+    }
+    else if(BIT_IS_SET(*Mis_Ptr, MIS_REG_RTMIS_POS) )
+    {
+        Bench_Serve(UartNum, Uart_Ptr, RIS_REG_RTRIS_POS, Uart_RxIsrHandler);
+    }
+    else if(BIT_IS_SET(*Mis_Ptr, RIS_REG_FERIS_POS) )
+    {
+        Bench_Serve(UartNum, Uart_Ptr, RIS_REG_FERIS_POS, NULL_PTR);
+    }
+    else if(BIT_IS_SET(*Mis_Ptr, RIS_REG_PERIS_POS) )
+    {
+        Bench_Serve(UartNum, Uart_Ptr, RIS_REG_PERIS_POS, NULL_PTR);
+    }
+    else if(BIT_IS_SET(*Mis_Ptr, RIS_REG_BERIS_POS) )
+    {
+        Bench_Serve(UartNum, Uart_Ptr, RIS_REG_BERIS_POS, NULL_PTR);
+    }
+    else if(BIT_IS_SET(*Mis_Ptr, RIS_REG_OERIS_POS) )
+    {
+        Bench_Serve(UartNum, Uart_Ptr, RIS_REG_OERIS_POS, NULL_PTR);
+    }
+    else if(BIT_IS_SET(*Mis_Ptr, RIS_REG_9BITRIS_POS) )
+    {
+        Bench_Serve(UartNum, Uart_Ptr, RIS_REG_9BITRIS_POS, NULL_PTR);
+    }
+
+    /* Same ISR statistics as the table dispatcher */
+    g_uartStats[UartNum].IsrCount++;
+    g_uartStats[UartNum].IsrCycles += (uint32)(UART_CYCLE_COUNTER() - EntryCycles);
+}
+
+static void Bench_Uart0IsrLadder(void)
+{
+    Bench_IsrLadder(Uart0);
+}
+
+/* Instructions to serve Causes with Isr until the UART interrupt line is released */
+static uint32 Bench_Run(void (*Isr)(void), uint32 Causes)
+{
+    uint32 Overhead = Test_CountOverhead();
+
+    g_modelUart[Uart0].Ris = Causes;
+
+    Test_CountStart();
+    while(Model_UartPending(Uart0) != 0)
+    {
+        (*Isr)();
+    }
+    return Test_CountStop() - Overhead;
+}
+
+static uint16 Test_RxRingCount(void)
+{
+    return (uint16)(g_uartRxRing[Uart0].Head - g_uartRxRing[Uart0].Tail);
+}
+
+static void Test_TimeOutHasItsOwnCallBack(void)
+{
+    const uint8 Sent[3] = {'a', 'b', 'c'};
+
+    Test_UartSetUp();
+
+    /* Below the trigger level: only Receive Time-Out fires */
+    Model_UartReceive(Uart0, Sent, sizeof(Sent));
+    Model_UartRxTimeOut(Uart0);
+    UART0_ISR();
+
+    TEST_ASSERT_EQ(1, g_callCount);
+    TEST_ASSERT_EQ('T', g_calls[0]);
+    TEST_ASSERT_EQ(3, Test_RxRingCount());
+    TEST_ASSERT_EQ(0, Model_UartPending(Uart0));
+}
+
+static void Test_ReceiveHasItsOwnCallBack(void)
+{
+    const uint8 Sent[8] = {0};
+
+    Test_UartSetUp();
+
+    Model_UartReceive(Uart0, Sent, sizeof(Sent));
+    UART0_ISR();
+
+    TEST_ASSERT_EQ(1, g_callCount);
+    TEST_ASSERT_EQ('R', g_calls[0]);
+    TEST_ASSERT_EQ(8, Test_RxRingCount());
+}
+
+static void Test_BothCausesDrainTheFifoOnce(void)
+{
+    const uint8 Sent[10] = {0};
+
+    Test_UartSetUp();
+
+    Model_UartReceive(Uart0, Sent, sizeof(Sent));
+    Model_UartRxTimeOut(Uart0);
+    UART0_ISR();
+
+    /* Highest cause first, each call back once */
+    TEST_ASSERT_EQ(2, g_callCount);
+    TEST_ASSERT_EQ('T', g_calls[0]);
+    TEST_ASSERT_EQ('R', g_calls[1]);
+    TEST_ASSERT_EQ(10, Test_RxRingCount());
+    TEST_ASSERT_EQ(10, g_uartStats[Uart0].RxBytes);
+    TEST_ASSERT_EQ(10, g_uartStats[Uart0].RxFifoHighWater);
+    TEST_ASSERT_EQ(1, g_uartStats[Uart0].IsrCount);
+}
+
+static void Test_OnlyServedCausesAreCleared(void)
+{
+    Test_UartSetUp();
+
+    /* Framing error raised while it is served, but masked Tx stays raw */
+    g_modelUart[Uart0].Ris = (1U << 7) | (1U << 5);
+    UART0_ISR();
+
+    TEST_ASSERT_EQ(1, g_callCount);
+    TEST_ASSERT_EQ('F', g_calls[0]);
+    TEST_ASSERT_EQ(1U << 5, g_modelUart[Uart0].Ris);
+}
+
+static void Test_LegacyCallBackGetsBothCauses(void)
+{
+    const uint8 Sent[1] = {'x'};
+
+    Test_UartSetUp();
+    Uart0_SetCallBack(Test_OnReceive);
+
+    Model_UartReceive(Uart0, Sent, sizeof(Sent));
+    Model_UartRxTimeOut(Uart0);
+    UART0_ISR();
+
+    TEST_ASSERT_EQ(1, g_callCount);
+    TEST_ASSERT_EQ('R', g_calls[0]);
+}
+
+static void Test_SetCallBackNeedsOneCause(void)
+{
+    Test_UartSetUp();
+
+    TEST_ASSERT_EQ(RET_NOT_OK, Uart_SetCallBack(Uart0, InterruptsDisbaled, Test_OnReceive));
+    TEST_ASSERT_EQ(RET_NOT_OK, Uart_SetCallBack(Uart0, (Uart_Interrupts)(InterruptMaskReceive | InterruptMaskReceiveTimeOut), Test_OnReceive));
+    TEST_ASSERT_EQ(RET_NOT_OK, Uart_SetCallBack((Uart_Instance)8, InterruptMaskReceive, Test_OnReceive));
+}
+
+static void Test_TableIsNotSlowerThanLadder(void)
+{
+    uint32 Ladder    = 0;
+    uint32 Table     = 0;
+    uint32 Calls     = 0;
+    uint32 iteration = 0;
+
+    Test_UartSetUp();
+
+    /* Every cause enabled, with a call back on each of them */
+    Test_RegSet(UART_0_BASE_ADDRESS + UART_IM_REG_OFFSET, 0x17F0U);
+    for(iteration = 8; iteration <= 12; iteration++)
+    {
+        g_callBackPtrUartInterrupt[Uart0][iteration] = Test_OnFramingError;
+    }
+
+    for(iteration = 0; iteration < (sizeof(g_benchCauses) / sizeof(g_benchCauses[0])); iteration++)
+    {
+        g_callCount = 0;
+        Ladder = Bench_Run(Bench_Uart0IsrLadder, g_benchCauses[iteration]);
+        Calls  = g_callCount;
+
+        g_callCount = 0;
+        Table = Bench_Run(UART0_ISR, g_benchCauses[iteration]);
+
+        printf("    causes 0x%04X: host instructions if-ladder %u, table %u\n", g_benchCauses[iteration], Ladder, Table);
+
+        /* Same call backs, so the same work, and never slower */
+        TEST_ASSERT_EQ(Calls, g_callCount);
+        TEST_ASSERT(Table <= Ladder);
+    }
+
+    /* Error burst: one ISR entry and one status read instead of one entry per cause */
+    TEST_ASSERT( (2U * Table) < Ladder );
+}
+
+int main(void)
+{
+    Test_RegsInit();
+
+    TEST_RUN(Test_TimeOutHasItsOwnCallBack);
+    TEST_RUN(Test_ReceiveHasItsOwnCallBack);
+    TEST_RUN(Test_BothCausesDrainTheFifoOnce);
+    TEST_RUN(Test_OnlyServedCausesAreCleared);
+    TEST_RUN(Test_LegacyCallBackGetsBothCauses);
+    TEST_RUN(Test_SetCallBackNeedsOneCause);
+    TEST_RUN(Test_TableIsNotSlowerThanLadder);
+
+    return Test_Summary("Test_UartDispatch");
+}
@@ -0,0 +1,232 @@
+/********************************************************************************
+ * @file          Test_UartDma.c
+ * @brief         Host tests of UART uDMA transfers (Uart_TransmitDMA,
+ *                Uart_ReceiveDMA and their completion in UART ISR)
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ *******************************************************************************/
+
+#include "UART_Prog.c"
+#include "Uart_Model.h"
+#include "Udma_Fake.h"
+#include "UDMA_Reg.h"
+#include "Test_Critical.h"
+
+
+static Uart_Config g_config;
+static uint32 g_doneCount;
+
+/* UARTIM writes done with IRQs enabled */
+static uint32 g_imWritesUnmasked;
+
+static void Test_ImWrite(uint32 Address, uint32 Value)
+{
+    if(Test_CriticalDepth() == 0)
+    {
+        g_imWritesUnmasked++;
+    }
+}
+
+static void Test_DmaDone(void)
+{
+    g_doneCount++;
+}
+
+static void Test_UartSetUp(void)
+{
+    memset(&g_config, 0, sizeof(g_config));
+    g_config.UartNum        = Uart0;
+    g_config.WordLength     = EightBits;
+    g_config.UartInterrupts = InterruptMaskReceive;
+    g_config.ClkValue       = 80000000U;
+    g_config.BaudRate       = 921600U;
+    g_config.StopBits       = STOP_BITS_1_BIT;
+    g_config.ParityMode     = PARITY_MODE_DISABLE;
+    g_config.FifoMode       = FIFO_MODE_ENABLE;
+    g_config.RxFifoLevel    = FIFO_LEVEL_1_2;
+    g_config.TxFifoLevel    = FIFO_LEVEL_1_2;
+    g_config.ClkSrc         = CLOCK_SRC_SYSTEM;
+
+    memset(g_uartDmaTx, 0, sizeof(g_uartDmaTx));
+    memset(g_uartDmaRx, 0, sizeof(g_uartDmaRx));
+    memset(g_uartRxRing, 0, sizeof(g_uartRxRing));
+    g_doneCount = 0;
+
+    Fake_UdmaReset();
+    Model_UartAttach(Uart0);
+    TEST_ASSERT_EQ(RET_OK, Uart_Init(&g_config));
+}
+
+static uint32 Test_UartReg(uint32 Offset)
+{
+    return TEST_REG(UART_0_BASE_ADDRESS + Offset);
+}
+
+static void Test_TransmitDmaIsSplitInChunks(void)
+{
+    static uint8 Buffer[2500];
+    Fake_UdmaChannel* Channel = &g_fakeUdma[UART0_DMA_TX_CHANNEL];
+
+    Test_UartSetUp();
+
+    TEST_ASSERT_EQ(RET_OK, Uart_TransmitDMA(&g_config, Buffer, sizeof(Buffer), Test_DmaDone));
+    TEST_ASSERT_EQ(TRUE, Channel->Assigned);
+    TEST_ASSERT_EQ(UART0_DMA_ENCODING, Channel->Encoding);
+    TEST_ASSERT(Channel->Primary.SrcEnd == &Buffer[1023]);
+    TEST_ASSERT(Channel->Primary.DstEnd == (void*)(UART_0_BASE_ADDRESS + UART_DATA_REG_OFFSET));
+    TEST_ASSERT_EQ(UDMA_MAX_TRANSFER_SIZE, Fake_UdmaItems(Channel->Primary.Control));
+    TEST_ASSERT_EQ(TRUE, Channel->Enabled);
+    TEST_ASSERT(BIT_IS_SET(Test_UartReg(UART_DMACTL_REG_OFFSET), DMACTL_REG_TXDMAE_POS));
+
+    /* One Tx transfer at a time */
+    TEST_ASSERT_EQ(RET_NOT_OK, Uart_TransmitDMA(&g_config, Buffer, sizeof(Buffer), Test_DmaDone));
+
+    /* Second chunk */
+    Fake_UdmaComplete(UART0_DMA_TX_CHANNEL);
+    UART0_ISR();
+    TEST_ASSERT(Channel->Primary.SrcEnd == &Buffer[2047]);
+    TEST_ASSERT_EQ(UDMA_MAX_TRANSFER_SIZE, Fake_UdmaItems(Channel->Primary.Control));
+
+    /* Last chunk */
+    Fake_UdmaComplete(UART0_DMA_TX_CHANNEL);
+    UART0_ISR();
+    TEST_ASSERT(Channel->Primary.SrcEnd == &Buffer[2499]);
+    TEST_ASSERT_EQ(2500 - (2 * UDMA_MAX_TRANSFER_SIZE), Fake_UdmaItems(Channel->Primary.Control));
+    TEST_ASSERT_EQ(0, g_doneCount);
+
+    /* Done: Tx requests stopped, callback called once */
+    Fake_UdmaComplete(UART0_DMA_TX_CHANNEL);
+    UART0_ISR();
+    UART0_ISR();
+    TEST_ASSERT_EQ(1, g_doneCount);
+    TEST_ASSERT(!BIT_IS_SET(Test_UartReg(UART_DMACTL_REG_OFFSET), DMACTL_REG_TXDMAE_POS));
+    TEST_ASSERT_EQ(sizeof(Buffer), g_uartStats[Uart0].TxBytes);
+    TEST_ASSERT_EQ(RET_OK, Uart_TransmitDMA(&g_config, Buffer, 10U, NULL_PTR));
+}
+
+static void Test_TransmitDmaEndsWhenTheWireDrains(void)
+{
+    static uint8 Buffer[40];
+    uint32 iteration = 0;
+
+    Test_UartSetUp();
+
+    TEST_ASSERT_EQ(RET_OK, Uart_TransmitDMA(&g_config, Buffer, sizeof(Buffer), Test_DmaDone));
+
+    /* uDMA is done once the last bytes are written to Tx FIFO, not sent yet */
+    for(iteration = 0; iteration < MODEL_UART_FIFO_SIZE; iteration++)
+    {
+        *(volatile uint32*)(UART_0_BASE_ADDRESS + UART_DATA_REG_OFFSET) = iteration;
+    }
+    Fake_UdmaComplete(UART0_DMA_TX_CHANNEL);
+    UART0_ISR();
+    TEST_ASSERT_EQ(0, g_doneCount);
+    TEST_ASSERT(!BIT_IS_SET(Test_UartReg(UART_DMACTL_REG_OFFSET), DMACTL_REG_TXDMAE_POS));
+    TEST_ASSERT(BIT_IS_SET(Test_UartReg(UART_CTL_REG_OFFSET), CTL_REG_EOT_POS));
+    TEST_ASSERT(BIT_IS_SET(Test_UartReg(UART_IM_REG_OFFSET), IM_REG_TXIM_POS));
+
+    /* Crossing the Tx FIFO trigger level isn't the end of the transfer */
+    Model_UartShift(Uart0, MODEL_UART_FIFO_SIZE - 1U);
+    Model_UartRunIsr(Uart0, UART0_ISR);
+    UART0_ISR();
+    TEST_ASSERT_EQ(0, g_doneCount);
+    TEST_ASSERT_EQ(RET_NOT_OK, Uart_TransmitDMA(&g_config, Buffer, sizeof(Buffer), Test_DmaDone));
+
+    /* Last stop bit left the wire */
+    Model_UartShift(Uart0, 1U);
+    Model_UartRunIsr(Uart0, UART0_ISR);
+    TEST_ASSERT_EQ(1, g_doneCount);
+    TEST_ASSERT_EQ(MODEL_UART_FIFO_SIZE, g_modelUart[Uart0].WireCount);
+    TEST_ASSERT(!BIT_IS_SET(Test_UartReg(UART_CTL_REG_OFFSET), CTL_REG_EOT_POS));
+    TEST_ASSERT(!BIT_IS_SET(Test_UartReg(UART_IM_REG_OFFSET), IM_REG_TXIM_POS));
+    TEST_ASSERT_EQ(0, Model_UartPending(Uart0));
+    TEST_ASSERT_EQ(RET_OK, Uart_TransmitDMA(&g_config, Buffer, sizeof(Buffer), NULL_PTR));
+}
+
+static void Test_Uart2DmaChannelsUseEncodingOne(void)
+{
+    uint8 Buffer[8];
+
+    Test_UartSetUp();
+    g_config.UartNum = Uart2;
+    Model_UartAttach(Uart2);
+    TEST_ASSERT_EQ(RET_OK, Uart_Init(&g_config));
+
+    TEST_ASSERT_EQ(RET_OK, Uart_TransmitDMA(&g_config, Buffer, sizeof(Buffer), NULL_PTR));
+    TEST_ASSERT_EQ(RET_OK, Uart_ReceiveDMA(&g_config, Buffer, sizeof(Buffer), NULL_PTR));
+
+    /* DMACHMAP1 CH12SEL and CH13SEL (bits 16 -> 23): encoding 1 is UART2 Rx/Tx */
+    TEST_ASSERT_EQ(12, UART2_DMA_RX_CHANNEL);
+    TEST_ASSERT_EQ(13, UART2_DMA_TX_CHANNEL);
+    TEST_ASSERT_EQ(0x11U, (TEST_REG(UDMA_BASE_ADDRESS + UDMA_CHMAP1_REG_OFFSET) >> 16) & 0xFFU);
+}
+
+static void Test_ReceiveDmaMasksRxInterruptsUntilDone(void)
+{
+    uint8 Buffer[100];
+    const uint8 Sent[10] = {0};
+    Fake_UdmaChannel* Channel = &g_fakeUdma[UART0_DMA_RX_CHANNEL];
+
+    Test_UartSetUp();
+
+    /* Receive and Receive Time-Out interrupts are enabled by Uart_Init() */
+    TEST_ASSERT_EQ((1U << IM_REG_RXIM_POS) | (1U << IM_REG_RTIM_POS), Test_UartReg(UART_IM_REG_OFFSET));
+
+    g_imWritesUnmasked = 0;
+    Test_RegHook(UART_0_BASE_ADDRESS + UART_IM_REG_OFFSET, NULL_PTR, Test_ImWrite);
+    TEST_ASSERT_EQ(RET_OK, Uart_ReceiveDMA(&g_config, Buffer, sizeof(Buffer), Test_DmaDone));
+    TEST_ASSERT_EQ(0, g_imWritesUnmasked);
+    TEST_ASSERT_EQ(RET_NOT_OK, Uart_ReceiveDMA(&g_config, Buffer, sizeof(Buffer), Test_DmaDone));
+    TEST_ASSERT(Channel->Primary.SrcEnd == (void*)(UART_0_BASE_ADDRESS + UART_DATA_REG_OFFSET));
+    TEST_ASSERT(Channel->Primary.DstEnd == &Buffer[99]);
+    TEST_ASSERT_EQ(sizeof(Buffer), Fake_UdmaItems(Channel->Primary.Control));
+    TEST_ASSERT_EQ(0, Test_UartReg(UART_IM_REG_OFFSET));
+    TEST_ASSERT(BIT_IS_SET(Test_UartReg(UART_DMACTL_REG_OFFSET), DMACTL_REG_RXDMAE_POS));
+
+    /* Rx ISR doesn't steal the bytes of the transfer */
+    Model_UartReceive(Uart0, Sent, sizeof(Sent));
+    TEST_ASSERT_EQ(0, Model_UartPending(Uart0));
+
+    /* uDMA took them */
+    g_modelUart[Uart0].RxCount = 0;
+    g_modelUart[Uart0].Ris     = 0;
+
+    Fake_UdmaComplete(UART0_DMA_RX_CHANNEL);
+    UART0_ISR();
+    TEST_ASSERT_EQ(1, g_doneCount);
+    TEST_ASSERT_EQ((1U << IM_REG_RXIM_POS) | (1U << IM_REG_RTIM_POS), Test_UartReg(UART_IM_REG_OFFSET));
+    TEST_ASSERT(!BIT_IS_SET(Test_UartReg(UART_DMACTL_REG_OFFSET), DMACTL_REG_RXDMAE_POS));
+    TEST_ASSERT_EQ(sizeof(Buffer), g_uartStats[Uart0].RxBytes);
+}
+
+static void Test_DmaRejectsBadArguments(void)
+{
+    uint8 Buffer[4];
+    Uart_Config Config;
+
+    Test_UartSetUp();
+
+    TEST_ASSERT_EQ(RET_NOT_OK, Uart_TransmitDMA(NULL_PTR, Buffer, sizeof(Buffer), NULL_PTR));
+    TEST_ASSERT_EQ(RET_NOT_OK, Uart_TransmitDMA(&g_config, NULL_PTR, sizeof(Buffer), NULL_PTR));
+    TEST_ASSERT_EQ(RET_NOT_OK, Uart_ReceiveDMA(&g_config, Buffer, 0, NULL_PTR));
+
+    /* Out of range instance would index past the transfer and handle tables */
+    Config = g_config;
+    Config.UartNum = (Uart_Instance)(Uart7 + 1);
+    TEST_ASSERT_EQ(RET_NOT_OK, Uart_TransmitDMA(&Config, Buffer, sizeof(Buffer), NULL_PTR));
+    TEST_ASSERT_EQ(RET_NOT_OK, Uart_ReceiveDMA(&Config, Buffer, sizeof(Buffer), NULL_PTR));
+}
+
+int main(void)
+{
+    Test_RegsInit();
+
+    TEST_RUN(Test_TransmitDmaIsSplitInChunks);
+    TEST_RUN(Test_TransmitDmaEndsWhenTheWireDrains);
+    TEST_RUN(Test_Uart2DmaChannelsUseEncodingOne);
+    TEST_RUN(Test_ReceiveDmaMasksRxInterruptsUntilDone);
+    TEST_RUN(Test_DmaRejectsBadArguments);
+
+    return Test_Summary("Test_UartDma");
+}
@@ -0,0 +1,180 @@
+/********************************************************************************
+ * @file          Test_UartHandle.c
+ * @brief         Host tests of UART instance handles (Uart_Open and the per
+ *                byte functions) and micro-benchmark of the Tx hot path
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ *******************************************************************************/
+
+#include "UART_Prog.c"
+#include "Uart_Model.h"
+
+
+/* Bytes sent by each benchmark run */
+#define TEST_BENCH_LENGTH           (64U)
+
+static Uart_Config g_config;
+
+static void Test_UartSetUp(Uart_Instance UartNum)
+{
+    memset(&g_config, 0, sizeof(g_config));
+    g_config.UartNum    = UartNum;
+    g_config.WordLength = EightBits;
+    g_config.ClkValue   = 80000000U;
+    g_config.BaudRate   = 115200U;
+    g_config.StopBits   = STOP_BITS_1_BIT;
+    g_config.ParityMode = PARITY_MODE_DISABLE;
+    g_config.FifoMode   = FIFO_MODE_ENABLE;
+    g_config.ClkSrc     = CLOCK_SRC_SYSTEM;
+
+    memset((void*)g_uartStats, 0, sizeof(g_uartStats));
+    Model_UartAttach(UartNum);
+    g_modelUart[UartNum].AutoShift = TRUE;
+}
+
+/* Uart_Transmit() before instance handles: base address switch on every byte */
+static __attribute__((noinline)) uint8 Bench_TransmitSwitch(const Uart_Config* ConfigPtr, const uint8 Data)
+{
+    volatile uint32* Uart_Ptr = NULL_PTR;
+
+    if(NULL_PTR == ConfigPtr)
+    {
+        return RET_NOT_OK;
+    }
+
+    switch (ConfigPtr->UartNum) {
+    case Uart0: Uart_Ptr = (volatile uint32*)UART_0_BASE_ADDRESS; break;
+    case Uart1: Uart_Ptr = (volatile uint32*)UART_1_BASE_ADDRESS; break;
+    case Uart2: Uart_Ptr = (volatile uint32*)UART_2_BASE_ADDRESS; break;
+    case Uart3: Uart_Ptr = (volatile uint32*)UART_3_BASE_ADDRESS; break;
+    case Uart4: Uart_Ptr = (volatile uint32*)UART_4_BASE_ADDRESS; break;
+    case Uart5: Uart_Ptr = (volatile uint32*)UART_5_BASE_ADDRESS; break;
+    case Uart6: Uart_Ptr = (volatile uint32*)UART_6_BASE_ADDRESS; break;
+    case Uart7: Uart_Ptr = (volatile uint32*)UART_7_BASE_ADDRESS; break;
+    }
+    while( ( *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_FR_REG_OFFSET) & (1 << 5) ) != 0 );
+
+    (*(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_DATA_REG_OFFSET) ) = Data;
+
+    return RET_OK;
+}
+
+/* Uart_SendString() before instance handles */
+static __attribute__((noinline)) void Bench_SendStringSwitch(const Uart_Config* ConfigPtr, const uint8* String)
+{
+    while(*String != '\0')
+    {
+        Bench_TransmitSwitch(ConfigPtr, *String);
+        String++;
+    }
+}
+
+static void Test_OpenReturnsCachedHandle(void)
+{
+    const Uart_Handle* Handle = NULL_PTR;
+    uint8 UartNum = 0;
+
+    for(UartNum = Uart0; UartNum <= Uart7; UartNum++)
+    {
+        Test_UartSetUp((Uart_Instance)UartNum);
+        Handle = Uart_Open(&g_config);
+        TEST_ASSERT(Handle == &g_uartHandles[UartNum]);
+        TEST_ASSERT_EQ(UartNum, Handle->UartNum);
+        TEST_ASSERT(Handle->Base    == (volatile uint32*)(UART_0_BASE_ADDRESS + (UartNum * 0x1000U)));
+        TEST_ASSERT(Handle->DataReg == (volatile uint32*)((volatile uint8*)Handle->Base + UART_DATA_REG_OFFSET));
+        TEST_ASSERT(Handle->FlagReg == (volatile uint32*)((volatile uint8*)Handle->Base + UART_FR_REG_OFFSET));
+        TEST_ASSERT(Handle->Stats   == &g_uartStats[UartNum]);
+    }
+
+    TEST_ASSERT(Uart_Open(NULL_PTR) == NULL_PTR);
+    g_config.UartNum = (Uart_Instance)8;
+    TEST_ASSERT(Uart_Open(&g_config) == NULL_PTR);
+}
+
+static void Test_HandleFunctionsMoveBytes(void)
+{
+    const uint8 String[] = "Handle of UART2, longer than its Tx FIFO";
+    const Uart_Handle* Handle = NULL_PTR;
+
+    Test_UartSetUp(Uart2);
+    Handle = Uart_Open(&g_config);
+
+    Uart_PutString(Handle, String);
+    Uart_PutChar(Handle, '!');
+    TEST_ASSERT_EQ(sizeof(String), g_modelUart[Uart2].WireCount + g_modelUart[Uart2].TxCount);
+    Model_UartShift(Uart2, MODEL_UART_FIFO_SIZE);
+    TEST_ASSERT(memcmp(g_modelUart[Uart2].Wire, String, sizeof(String) - 1U) == 0);
+    TEST_ASSERT_EQ('!', g_modelUart[Uart2].Wire[sizeof(String) - 1U]);
+    TEST_ASSERT_EQ(sizeof(String), g_uartStats[Uart2].TxBytes);
+
+    Model_UartReceive(Uart2, (const uint8*)"ok", 2);
+    TEST_ASSERT_EQ('o', Uart_GetChar(Handle));
+    TEST_ASSERT_EQ('k', Uart_Receive(&g_config));
+    TEST_ASSERT_EQ(2, g_uartStats[Uart2].RxBytes);
+}
+
+static void Test_HotPathCostPerByte(void)
+{
+    uint8 String[TEST_BENCH_LENGTH + 1];
+    const Uart_Handle* Handle = NULL_PTR;
+    uint32 Overhead = 0;
+    uint32 Before = 0;
+    uint32 SendString = 0;
+    uint32 PutString = 0;
+    uint32 PutChar = 0;
+    uint32 iteration = 0;
+
+    memset(String, 'a', TEST_BENCH_LENGTH);
+    String[TEST_BENCH_LENGTH] = '\0';
+
+    /* UART7: last case of the old switch */
+    Test_UartSetUp(Uart7);
+    Handle = Uart_Open(&g_config);
+    Overhead = Test_CountOverhead();
+
+    Test_CountStart();
+    Bench_SendStringSwitch(&g_config, String);
+    Before = Test_CountStop() - Overhead;
+
+    Test_CountStart();
+    Uart_SendString(&g_config, String);
+    SendString = Test_CountStop() - Overhead;
+
+    Test_CountStart();
+    Uart_PutString(Handle, String);
+    PutString = Test_CountStop() - Overhead;
+
+    Test_CountStart();
+    for(iteration = 0; iteration < TEST_BENCH_LENGTH; iteration++)
+    {
+        Uart_PutChar(Handle, String[iteration]);
+    }
+    PutChar = Test_CountStop() - Overhead;
+
+    printf("    host instructions per byte: switch %u.%02u, Uart_SendString %u.%02u, "
+           "Uart_PutString %u.%02u, Uart_PutChar %u.%02u\n",
+           Before / TEST_BENCH_LENGTH, ((Before % TEST_BENCH_LENGTH) * 100U) / TEST_BENCH_LENGTH,
+           SendString / TEST_BENCH_LENGTH, ((SendString % TEST_BENCH_LENGTH) * 100U) / TEST_BENCH_LENGTH,
+           PutString / TEST_BENCH_LENGTH, ((PutString % TEST_BENCH_LENGTH) * 100U) / TEST_BENCH_LENGTH,
+           PutChar / TEST_BENCH_LENGTH, ((PutChar % TEST_BENCH_LENGTH) * 100U) / TEST_BENCH_LENGTH);
+
+    /* Every byte was sent by all of them */
+    TEST_ASSERT_EQ(4U * TEST_BENCH_LENGTH, g_modelUart[Uart7].WireCount + g_modelUart[Uart7].TxCount);
+
+    /* Handle paths don't resolve the instance per byte */
+    TEST_ASSERT(SendString < Before);
+    TEST_ASSERT(PutString < Before);
+    TEST_ASSERT(PutChar < Before);
+}
+
+int main(void)
+{
+    Test_RegsInit();
+
+    TEST_RUN(Test_OpenReturnsCachedHandle);
+    TEST_RUN(Test_HandleFunctionsMoveBytes);
+    TEST_RUN(Test_HotPathCostPerByte);
+
+    return Test_Summary("Test_UartHandle");
+}
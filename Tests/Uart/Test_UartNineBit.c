@@ -0,0 +1,131 @@
+/********************************************************************************
+ * @file          Test_UartNineBit.c
+ * @brief         Host tests of 9-bit multidrop transmission (Uart_SendAddressed)
+ *                and of its bounded waits on a stalled line
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ *******************************************************************************/
+
+#include "UART_Prog.c"
+#include "Uart_Model.h"
+
+
+static Uart_Config g_config;
+
+static void Test_UartSetUp(void)
+{
+    memset(&g_config, 0, sizeof(g_config));
+    g_config.UartNum    = Uart1;
+    g_config.WordLength = NineBits;
+    g_config.ClkValue   = 16000000U;
+    g_config.BaudRate   = 115200U;
+    g_config.StopBits   = STOP_BITS_1_BIT;
+    g_config.ParityMode = PARITY_MODE_DISABLE;
+    g_config.FifoMode   = FIFO_MODE_ENABLE;
+    g_config.ClkSrc     = CLOCK_SRC_SYSTEM;
+
+    memset(g_uartTxRing, 0, sizeof(g_uartTxRing));
+
+    Model_UartAttach(Uart1);
+    TEST_ASSERT_EQ(RET_OK, Uart_Init(&g_config));
+}
+
+/* 9th bit of the bytes shifted out now: Stick parity 1 (EPS = 0) marks an address */
+static uint8 Test_DataMode(void)
+{
+    return BIT_IS_SET(TEST_REG(UART_1_BASE_ADDRESS + UART_LCRH_REG_OFFSET), LCRH_REG_EPS_POS) ? TRUE : FALSE;
+}
+
+static void Test_AddressIsSentBeforeData(void)
+{
+    const uint8 Data[3] = {0x10, 0x20, 0x30};
+
+    Test_UartSetUp();
+
+    /* Each UARTFR read shifts one byte, the line is moving */
+    g_modelUart[Uart1].AutoShift = TRUE;
+
+    TEST_ASSERT_EQ(sizeof(Data), Uart_SendAddressed(&g_config, 0x42, Data, sizeof(Data)));
+    TEST_ASSERT_EQ(0x42, g_modelUart[Uart1].Wire[0]);
+    TEST_ASSERT_EQ(TRUE, Test_DataMode());
+    TEST_ASSERT_EQ(sizeof(Data), (uint16)(g_uartTxRing[Uart1].Head - g_uartTxRing[Uart1].Tail) +
+                                 g_modelUart[Uart1].TxCount + g_modelUart[Uart1].WireCount - 1U);
+}
+
+static void Test_StalledFifoTimesOut(void)
+{
+    const uint8 Data[3] = {0};
+
+    Test_UartSetUp();
+
+    /* Previous bytes never leave Tx FIFO (CTS deasserted) */
+    *(volatile uint32*)(UART_1_BASE_ADDRESS + UART_DATA_REG_OFFSET) = 0x55;
+
+    TEST_ASSERT_EQ(0, Uart_SendAddressed(&g_config, 0x42, Data, sizeof(Data)));
+    TEST_ASSERT_EQ(1, g_modelUart[Uart1].TxCount);
+    TEST_ASSERT_EQ(0, g_uartTxRing[Uart1].Head);
+    TEST_ASSERT_EQ(TRUE, Test_DataMode());
+}
+
+static void Test_UndrainedRingTimesOut(void)
+{
+    const uint8 Data[3] = {0};
+
+    Test_UartSetUp();
+
+    /* Bytes queued while the Tx interrupt doesn't run */
+    g_uartTxRing[Uart1].Head = 5U;
+
+    TEST_ASSERT_EQ(0, Uart_SendAddressed(&g_config, 0x42, Data, sizeof(Data)));
+    TEST_ASSERT_EQ(0, g_modelUart[Uart1].TxCount);
+    TEST_ASSERT_EQ(5U, g_uartTxRing[Uart1].Head);
+}
+
+static void Test_StuckAddressLeavesDataMode(void)
+{
+    const uint8 Data[3] = {0};
+
+    Test_UartSetUp();
+
+    /* Idle line, but the address byte is never shifted out */
+    TEST_ASSERT_EQ(0, Uart_SendAddressed(&g_config, 0x42, Data, sizeof(Data)));
+    TEST_ASSERT_EQ(1, g_modelUart[Uart1].TxCount);
+    TEST_ASSERT_EQ(0x42, g_modelUart[Uart1].TxFifo[0]);
+
+    /* Nothing queued behind it, and later bytes aren't sent as addresses */
+    TEST_ASSERT_EQ(0, g_uartTxRing[Uart1].Head);
+    TEST_ASSERT_EQ(TRUE, Test_DataMode());
+}
+
+static void Test_BadArgumentsQueueNothing(void)
+{
+    const uint8 Data[3] = {0};
+    Uart_Config Config;
+
+    Test_UartSetUp();
+    g_modelUart[Uart1].AutoShift = TRUE;
+
+    Config = g_config;
+    Config.WordLength = EightBits;
+    TEST_ASSERT_EQ(0, Uart_SendAddressed(&Config, 0x42, Data, sizeof(Data)));
+    Config = g_config;
+    Config.UartNum = (Uart_Instance)(Uart7 + 1);
+    TEST_ASSERT_EQ(0, Uart_SendAddressed(&Config, 0x42, Data, sizeof(Data)));
+    TEST_ASSERT_EQ(0, Uart_SendAddressed(NULL_PTR, 0x42, Data, sizeof(Data)));
+    TEST_ASSERT_EQ(0, Uart_SendAddressed(&g_config, 0x42, NULL_PTR, sizeof(Data)));
+    TEST_ASSERT_EQ(0, g_modelUart[Uart1].WireCount);
+}
+
+int main(void)
+{
+    Test_RegsInit();
+
+    TEST_RUN(Test_AddressIsSentBeforeData);
+    TEST_RUN(Test_StalledFifoTimesOut);
+    TEST_RUN(Test_UndrainedRingTimesOut);
+    TEST_RUN(Test_StuckAddressLeavesDataMode);
+    TEST_RUN(Test_BadArgumentsQueueNothing);
+
+    return Test_Summary("Test_UartNineBit");
+}
@@ -0,0 +1,317 @@
+/********************************************************************************
+ * @file          Test_UartRing.c
+ * @brief         Host tests of UART Tx/Rx ring buffers (Uart_Write, Uart_Read,
+ *                Uart_Peek/Uart_Consume and the Tx/Rx interrupt handlers)
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ *******************************************************************************/
+
+#include "UART_Prog.c"
+#include "Uart_Model.h"
+#include "Test_Critical.h"
+
+
+static Uart_Config g_config;
+
+/* UARTIM writes done by the test thread with and without IRQs masked */
+static uint32 g_imWrites;
+static uint32 g_imWritesUnmasked;
+
+static void Test_ImWrite(uint32 Address, uint32 Value)
+{
+    g_imWrites++;
+    if(Test_CriticalDepth() == 0)
+    {
+        g_imWritesUnmasked++;
+    }
+}
+
+static void Test_UartSetUp(void)
+{
+    memset(&g_config, 0, sizeof(g_config));
+    g_config.UartNum        = Uart0;
+    g_config.WordLength     = EightBits;
+    g_config.UartInterrupts = InterruptMaskReceive;
+    g_config.ClkValue       = 16000000U;
+    g_config.BaudRate       = 115200U;
+    g_config.StopBits       = STOP_BITS_1_BIT;
+    g_config.ParityMode     = PARITY_MODE_DISABLE;
+    g_config.FifoMode       = FIFO_MODE_ENABLE;
+    g_config.RxFifoLevel    = FIFO_LEVEL_1_2;
+    g_config.TxFifoLevel    = FIFO_LEVEL_1_2;
+    g_config.ClkSrc         = CLOCK_SRC_SYSTEM;
+
+    memset(g_uartTxRing, 0, sizeof(g_uartTxRing));
+    memset(g_uartRxRing, 0, sizeof(g_uartRxRing));
+
+    Model_UartAttach(Uart0);
+    TEST_ASSERT_EQ(RET_OK, Uart_Init(&g_config));
+}
+
+static uint8 Test_UartTxIm(void)
+{
+    return (TEST_REG(UART_0_BASE_ADDRESS + UART_IM_REG_OFFSET) & (1U << IM_REG_TXIM_POS)) ? TRUE : FALSE;
+}
+
+static void Test_WritePrimesFifoAndQueuesTheRest(void)
+{
+    uint8 Data[100];
+    uint32 iteration = 0;
+
+    Test_UartSetUp();
+    for(iteration = 0; iteration < sizeof(Data); iteration++)
+    {
+        Data[iteration] = (uint8)iteration;
+    }
+
+    TEST_ASSERT_EQ(100, Uart_Write(&g_config, Data, sizeof(Data)));
+
+    /* FIFO is full, the rest waits in the ring for the Tx interrupt */
+    TEST_ASSERT_EQ(MODEL_UART_FIFO_SIZE, g_modelUart[Uart0].TxCount);
+    TEST_ASSERT_EQ(100 - MODEL_UART_FIFO_SIZE, (uint16)(g_uartTxRing[Uart0].Head - g_uartTxRing[Uart0].Tail));
+    TEST_ASSERT_EQ(TRUE, Test_UartTxIm());
+    TEST_ASSERT_EQ(MODEL_UART_FIFO_SIZE, g_uartStats[Uart0].TxBytes);
+    TEST_ASSERT_EQ(100, g_uartStats[Uart0].TxRingHighWater);
+}
+
+static void Test_TxInterruptSendsAllBytesInOrder(void)
+{
+    uint8 Data[300];
+    uint32 Queued = 0;
+    uint32 Loops = 0;
+    uint32 iteration = 0;
+
+    Test_UartSetUp();
+    for(iteration = 0; iteration < sizeof(Data); iteration++)
+    {
+        Data[iteration] = (uint8)(iteration * 7U);
+    }
+
+    /* Ring is smaller than the data, queue more when it has room */
+    while( (g_modelUart[Uart0].WireCount < sizeof(Data)) && (Loops < 1000U) )
+    {
+        if(Queued < sizeof(Data))
+        {
+            Queued += Uart_Write(&g_config, &Data[Queued], (uint16)(sizeof(Data) - Queued));
+        }
+        Model_UartShift(Uart0, 5U);
+        Model_UartRunIsr(Uart0, UART0_ISR);
+        Loops++;
+    }
+
+    TEST_ASSERT_EQ(sizeof(Data), g_modelUart[Uart0].WireCount);
+    TEST_ASSERT(memcmp(Data, g_modelUart[Uart0].Wire, sizeof(Data)) == 0);
+    TEST_ASSERT_EQ(sizeof(Data), g_uartStats[Uart0].TxBytes);
+
+    /* Nothing left: Tx interrupt is masked until the next Uart_Write() */
+    Model_UartShift(Uart0, MODEL_UART_FIFO_SIZE);
+    Model_UartRunIsr(Uart0, UART0_ISR);
+    TEST_ASSERT_EQ(FALSE, Test_UartTxIm());
+}
+
+static void Test_WriteStopsWhenRingIsFull(void)
+{
+    uint8 Data[200] = {0};
+
+    Test_UartSetUp();
+
+    /* Ring takes 128 bytes, 16 of them go to the FIFO at once */
+    TEST_ASSERT_EQ(UART_RING_BUFFER_SIZE, Uart_Write(&g_config, Data, sizeof(Data)));
+    TEST_ASSERT_EQ(MODEL_UART_FIFO_SIZE, Uart_Write(&g_config, Data, sizeof(Data)));
+    TEST_ASSERT_EQ(0, Uart_Write(&g_config, Data, sizeof(Data)));
+    TEST_ASSERT_EQ(0, Uart_Write(NULL_PTR, Data, sizeof(Data)));
+}
+
+static void Test_RxInterruptAndTimeOutFillRing(void)
+{
+    const uint8 Sent[12] = {'h', 'e', 'l', 'l', 'o', ' ', 'w', 'o', 'r', 'l', 'd', '!'};
+    uint8 Received[16] = {0};
+
+    Test_UartSetUp();
+
+    /* 10 bytes: above the Rx trigger level (8) */
+    Model_UartReceive(Uart0, Sent, 10U);
+    Model_UartRunIsr(Uart0, UART0_ISR);
+    TEST_ASSERT_EQ(10, (uint16)(g_uartRxRing[Uart0].Head - g_uartRxRing[Uart0].Tail));
+
+    /* 2 bytes: below the trigger level, flushed by Receive Time-Out */
+    Model_UartReceive(Uart0, &Sent[10], 2U);
+    Model_UartRunIsr(Uart0, UART0_ISR);
+    TEST_ASSERT_EQ(10, (uint16)(g_uartRxRing[Uart0].Head - g_uartRxRing[Uart0].Tail));
+    Model_UartRxTimeOut(Uart0);
+    Model_UartRunIsr(Uart0, UART0_ISR);
+
+    TEST_ASSERT_EQ(12, Uart_Read(&g_config, Received, sizeof(Received)));
+    TEST_ASSERT(memcmp(Sent, Received, sizeof(Sent)) == 0);
+    TEST_ASSERT_EQ(0, Uart_Read(&g_config, Received, sizeof(Received)));
+    TEST_ASSERT_EQ(12, g_uartStats[Uart0].RxBytes);
+    TEST_ASSERT_EQ(10, g_uartStats[Uart0].RxFifoHighWater);
+    TEST_ASSERT_EQ(12, g_uartStats[Uart0].RxRingHighWater);
+}
+
+static void Test_RxRingOverflowIsCounted(void)
+{
+    uint8 Sent[16];
+    uint8 Received[UART_RING_BUFFER_SIZE];
+    uint32 Batch = 0;
+    uint32 iteration = 0;
+
+    Test_UartSetUp();
+
+    /* 160 bytes, the application doesn't read */
+    for(Batch = 0; Batch < 10U; Batch++)
+    {
+        for(iteration = 0; iteration < sizeof(Sent); iteration++)
+        {
+            Sent[iteration] = (uint8)((Batch * sizeof(Sent)) + iteration);
+        }
+        Model_UartReceive(Uart0, Sent, sizeof(Sent));
+        Model_UartRunIsr(Uart0, UART0_ISR);
+    }
+
+    TEST_ASSERT_EQ(160 - UART_RING_BUFFER_SIZE, g_uartStats[Uart0].RxRingOverflows);
+    TEST_ASSERT_EQ(160 - UART_RING_BUFFER_SIZE, Uart_GetOverrunCount(Uart0));
+
+    /* The oldest bytes are kept */
+    TEST_ASSERT_EQ(UART_RING_BUFFER_SIZE, Uart_Read(&g_config, Received, sizeof(Received)));
+    for(iteration = 0; iteration < sizeof(Received); iteration++)
+    {
+        TEST_ASSERT_EQ(iteration, Received[iteration]);
+    }
+}
+
+static void Test_RxErrorsAreCounted(void)
+{
+    uint8 Received[8] = {0};
+    uint32 iteration = 0;
+
+    Test_UartSetUp();
+
+    Model_UartReceiveChar(Uart0, 'a' | MODEL_UART_FRAMING_ERROR);
+    Model_UartReceiveChar(Uart0, 'b' | MODEL_UART_PARITY_ERROR);
+    Model_UartReceiveChar(Uart0, 0x00 | MODEL_UART_BREAK_ERROR | MODEL_UART_FRAMING_ERROR);
+
+    /* Rx FIFO overrun: 16 stored, 1 lost, the next stored character is flagged */
+    for(iteration = 0; iteration < 14U; iteration++)
+    {
+        Model_UartReceiveChar(Uart0, 'x');
+    }
+    Model_UartRunIsr(Uart0, UART0_ISR);
+
+    TEST_ASSERT_EQ(1, g_uartStats[Uart0].FramingErrors);
+    TEST_ASSERT_EQ(1, g_uartStats[Uart0].ParityErrors);
+    TEST_ASSERT_EQ(1, g_uartStats[Uart0].BreakErrors);
+    TEST_ASSERT_EQ(0, g_uartStats[Uart0].OverrunErrors);
+
+    Model_UartReceiveChar(Uart0, 'y');
+    Model_UartRxTimeOut(Uart0);
+    Model_UartRunIsr(Uart0, UART0_ISR);
+    TEST_ASSERT_EQ(1, g_uartStats[Uart0].OverrunErrors);
+    TEST_ASSERT_EQ(1, Uart_GetOverrunCount(Uart0));
+
+    TEST_ASSERT_EQ(8, Uart_Read(&g_config, Received, sizeof(Received)));
+    TEST_ASSERT_EQ('a', Received[0]);
+    TEST_ASSERT_EQ('b', Received[1]);
+    TEST_ASSERT_EQ(0x00, Received[2]);
+}
+
+static void Test_PeekStopsAtRingEnd(void)
+{
+    uint8 Sent[16];
+    const uint8* Data = NULL_PTR;
+    uint32 Batch = 0;
+    uint32 iteration = 0;
+
+    Test_UartSetUp();
+    for(iteration = 0; iteration < sizeof(Sent); iteration++)
+    {
+        Sent[iteration] = (uint8)iteration;
+    }
+
+    /* Move the indices near the end of the ring memory */
+    for(Batch = 0; Batch < 7U; Batch++)
+    {
+        Model_UartReceive(Uart0, Sent, sizeof(Sent));
+        Model_UartRunIsr(Uart0, UART0_ISR);
+        TEST_ASSERT_EQ(sizeof(Sent), Uart_Peek(&g_config, &Data));
+        Uart_Consume(&g_config, sizeof(Sent));
+    }
+
+    /* 32 bytes: 16 before the end of the ring memory, 16 after it */
+    Model_UartReceive(Uart0, Sent, sizeof(Sent));
+    Model_UartRunIsr(Uart0, UART0_ISR);
+    Model_UartReceive(Uart0, Sent, sizeof(Sent));
+    Model_UartRunIsr(Uart0, UART0_ISR);
+
+    TEST_ASSERT_EQ(UART_RING_BUFFER_SIZE - (7U * sizeof(Sent)), Uart_Peek(&g_config, &Data));
+    TEST_ASSERT(Data == &g_uartRxRing[Uart0].Buffer[7U * sizeof(Sent)]);
+    Uart_Consume(&g_config, sizeof(Sent));
+    TEST_ASSERT_EQ(sizeof(Sent), Uart_Peek(&g_config, &Data));
+    TEST_ASSERT(Data == &g_uartRxRing[Uart0].Buffer[0]);
+
+    /* Never more than what was received */
+    Uart_Consume(&g_config, 100U);
+    TEST_ASSERT_EQ(0, Uart_Peek(&g_config, &Data));
+}
+
+static void Test_ImIsUpdatedWithIrqsMasked(void)
+{
+    uint8 Data[40] = {0};
+
+    Test_UartSetUp();
+    g_imWrites         = 0;
+    g_imWritesUnmasked = 0;
+    Test_RegHook(UART_0_BASE_ADDRESS + UART_IM_REG_OFFSET, NULL_PTR, Test_ImWrite);
+
+    /* Tx interrupt read-modify-writes race the UART ISR, IRQs MUST be masked */
+    TEST_ASSERT_EQ(sizeof(Data), Uart_Write(&g_config, Data, sizeof(Data)));
+    Uart_TxKick(Uart0);
+
+    TEST_ASSERT(g_imWrites >= 2);
+    TEST_ASSERT_EQ(0, g_imWritesUnmasked);
+    TEST_ASSERT_EQ(0, Test_CriticalDepth());
+}
+
+static void Test_OutOfRangeInstanceIsRejected(void)
+{
+    Uart_Config Config;
+    const uint8* Peeked = NULL_PTR;
+    uint8 Data[4] = {1, 2, 3, 4};
+
+    Test_UartSetUp();
+    Config         = g_config;
+    Config.UartNum = (Uart_Instance)(Uart7 + 1);
+
+    /* No ring buffer or register out of the instance tables is touched */
+    TEST_ASSERT_EQ(0, Uart_Write(&Config, Data, sizeof(Data)));
+    TEST_ASSERT_EQ(0, Uart_Read(&Config, Data, sizeof(Data)));
+    TEST_ASSERT_EQ(0, Uart_Peek(&Config, &Peeked));
+    TEST_ASSERT(NULL_PTR == Peeked);
+    Uart_Consume(&Config, 1);
+    TEST_ASSERT_EQ(RET_NOT_OK, Uart_ReceiveIT(&Config));
+    TEST_ASSERT_EQ(RET_NOT_OK, Uart_Transmit(&Config, 0x55));
+    TEST_ASSERT_EQ(RET_NOT_OK, Uart_Receive(&Config));
+    Uart_SendString(&Config, (const uint8*)"x");
+
+    TEST_ASSERT_EQ(1, Data[0]);
+    TEST_ASSERT_EQ(0, g_modelUart[Uart0].TxCount);
+    TEST_ASSERT_EQ(0, g_uartTxRing[Uart0].Head);
+}
+
+int main(void)
+{
+    Test_RegsInit();
+
+    TEST_RUN(Test_WritePrimesFifoAndQueuesTheRest);
+    TEST_RUN(Test_TxInterruptSendsAllBytesInOrder);
+    TEST_RUN(Test_WriteStopsWhenRingIsFull);
+    TEST_RUN(Test_RxInterruptAndTimeOutFillRing);
+    TEST_RUN(Test_RxRingOverflowIsCounted);
+    TEST_RUN(Test_RxErrorsAreCounted);
+    TEST_RUN(Test_PeekStopsAtRingEnd);
+    TEST_RUN(Test_ImIsUpdatedWithIrqsMasked);
+    TEST_RUN(Test_OutOfRangeInstanceIsRejected);
+
+    return Test_Summary("Test_UartRing");
+}
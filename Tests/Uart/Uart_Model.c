@@ -0,0 +1,264 @@
+/********************************************************************************
+ * @file          Uart_Model.c
+ * @brief         Source file for the UART peripheral model of the host tests
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ *******************************************************************************/
+
+/********************************************************************************
+ *                                Includes Needed                               *
+ *******************************************************************************/
+#include <string.h>
+#include "Uart_Model.h"
+
+
+/*******************************************************************************
+ *                                  Defines                                    *
+ *******************************************************************************/
+#define MODEL_UART_BASE(NUM)        (0x4000C000U + ((uint32)(NUM) * 0x1000U))
+#define MODEL_UART_NUM(ADDRESS)     ((uint8)(((ADDRESS) - 0x4000C000U) / 0x1000U))
+
+#define MODEL_UART_DR               (0x000U)
+#define MODEL_UART_FR               (0x018U)
+#define MODEL_UART_LCRH             (0x02CU)
+#define MODEL_UART_CTL              (0x030U)
+#define MODEL_UART_IFLS             (0x034U)
+#define MODEL_UART_IM               (0x038U)
+#define MODEL_UART_RIS              (0x03CU)
+#define MODEL_UART_MIS              (0x040U)
+#define MODEL_UART_ICR              (0x044U)
+
+#define MODEL_UART_FR_BUSY          (1U << 3)
+#define MODEL_UART_FR_RXFE          (1U << 4)
+#define MODEL_UART_FR_TXFF          (1U << 5)
+#define MODEL_UART_FR_RXFF          (1U << 6)
+#define MODEL_UART_FR_TXFE          (1U << 7)
+
+#define MODEL_UART_RIS_RX           (1U << 4)
+#define MODEL_UART_RIS_TX           (1U << 5)
+#define MODEL_UART_RIS_RT           (1U << 6)
+
+#define MODEL_UART_LCRH_FEN         (1U << 4)
+
+#define MODEL_UART_CTL_EOT          (1U << 4)
+
+
+/*******************************************************************************
+ *                              Global Variables                               *
+ *******************************************************************************/
+Model_Uart g_modelUart[8];
+
+/* UARTIFLS level select to FIFO bytes */
+static const uint32 g_modelUartLevels[8] = {2U, 4U, 8U, 12U, 14U, 14U, 14U, 14U};
+
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+static uint32 Model_UartRxLevel(uint8 UartNum)
+{
+    if( (Test_RegGet(MODEL_UART_BASE(UartNum) + MODEL_UART_LCRH) & MODEL_UART_LCRH_FEN) == 0 )
+    {
+        return 1U;
+    }
+    return g_modelUartLevels[(Test_RegGet(MODEL_UART_BASE(UartNum) + MODEL_UART_IFLS) >> 3) & 0x7U];
+}
+
+static uint32 Model_UartTxLevel(uint8 UartNum)
+{
+    if( (Test_RegGet(MODEL_UART_BASE(UartNum) + MODEL_UART_LCRH) & MODEL_UART_LCRH_FEN) == 0 )
+    {
+        return 0U;
+    }
+    return g_modelUartLevels[Test_RegGet(MODEL_UART_BASE(UartNum) + MODEL_UART_IFLS) & 0x7U];
+}
+
+static uint32 Model_UartRead(uint32 Address, uint32 Value)
+{
+    Model_Uart* Uart = &g_modelUart[MODEL_UART_NUM(Address)];
+    uint8 UartNum    = MODEL_UART_NUM(Address);
+    uint32 Result    = 0;
+
+    switch(Address - MODEL_UART_BASE(UartNum))
+    {
+    case MODEL_UART_DR:
+        if(Uart->RxCount == 0)
+        {
+            return Value;
+        }
+        Result = Uart->RxFifo[Uart->RxFirst];
+        Uart->RxFirst = (Uart->RxFirst + 1U) % MODEL_UART_FIFO_SIZE;
+        Uart->RxCount--;
+        if(Uart->RxCount < Model_UartRxLevel(UartNum))
+        {
+            Uart->Ris &= ~MODEL_UART_RIS_RX;
+        }
+        if(Uart->RxCount == 0)
+        {
+            Uart->Ris &= ~MODEL_UART_RIS_RT;
+        }
+        return Result;
+
+    case MODEL_UART_FR:
+        if( (Uart->AutoShift == TRUE) && (Uart->TxCount != 0) )
+        {
+            Model_UartShift(UartNum, 1U);
+        }
+        Result  = (Uart->TxCount != 0) ? MODEL_UART_FR_BUSY : MODEL_UART_FR_TXFE;
+        Result |= (Uart->TxCount >= MODEL_UART_FIFO_SIZE) ? MODEL_UART_FR_TXFF : 0U;
+        Result |= (Uart->RxCount == 0) ? MODEL_UART_FR_RXFE : 0U;
+        Result |= (Uart->RxCount >= MODEL_UART_FIFO_SIZE) ? MODEL_UART_FR_RXFF : 0U;
+        return Result;
+
+    case MODEL_UART_RIS:
+        return Uart->Ris;
+
+    case MODEL_UART_MIS:
+        return Uart->Ris & Test_RegGet(MODEL_UART_BASE(UartNum) + MODEL_UART_IM);
+
+    default:
+        return Value;
+    }
+}
+
+static void Model_UartWrite(uint32 Address, uint32 Value)
+{
+    Model_Uart* Uart = &g_modelUart[MODEL_UART_NUM(Address)];
+    uint8 UartNum    = MODEL_UART_NUM(Address);
+
+    switch(Address - MODEL_UART_BASE(UartNum))
+    {
+    case MODEL_UART_DR:
+        if(Uart->TxCount < MODEL_UART_FIFO_SIZE)
+        {
+            Uart->TxFifo[Uart->TxCount] = (uint8)Value;
+            Uart->TxCount++;
+        }
+        if(Uart->TxCount > Model_UartTxLevel(UartNum))
+        {
+            Uart->Ris &= ~MODEL_UART_RIS_TX;
+        }
+        break;
+
+    case MODEL_UART_ICR:
+        Uart->Ris &= ~Value;
+        break;
+
+    default:
+        break;
+    }
+}
+
+
+/*******************************************************************************
+ *                      Public Functions Definitions                           *
+ *******************************************************************************/
+
+/* Reset the model of a UART and hook its registers */
+void Model_UartAttach(uint8 UartNum)
+{
+    memset(&g_modelUart[UartNum], 0, sizeof(Model_Uart));
+
+    Test_RegHook(MODEL_UART_BASE(UartNum) + MODEL_UART_DR,  Model_UartRead, Model_UartWrite);
+    Test_RegHook(MODEL_UART_BASE(UartNum) + MODEL_UART_FR,  Model_UartRead, NULL_PTR);
+    Test_RegHook(MODEL_UART_BASE(UartNum) + MODEL_UART_RIS, Model_UartRead, NULL_PTR);
+    Test_RegHook(MODEL_UART_BASE(UartNum) + MODEL_UART_MIS, Model_UartRead, NULL_PTR);
+    Test_RegHook(MODEL_UART_BASE(UartNum) + MODEL_UART_ICR, NULL_PTR, Model_UartWrite);
+}
+
+/* Send Count bytes of the Tx FIFO (Tx interrupt is raised at the trigger level) */
+void Model_UartShift(uint8 UartNum, uint32 Count)
+{
+    Model_Uart* Uart = &g_modelUart[UartNum];
+
+    while( (Count != 0) && (Uart->TxCount != 0) )
+    {
+        if(Uart->WireCount < MODEL_UART_WIRE_SIZE)
+        {
+            Uart->Wire[Uart->WireCount] = Uart->TxFifo[0];
+            Uart->WireCount++;
+        }
+        memmove(&Uart->TxFifo[0], &Uart->TxFifo[1], Uart->TxCount - 1U);
+        Uart->TxCount--;
+        Count--;
+
+        if(Test_RegGet(MODEL_UART_BASE(UartNum) + MODEL_UART_CTL) & MODEL_UART_CTL_EOT)
+        {
+            /* End of Transmission: only when the last stop bit left the wire */
+            if(Uart->TxCount == 0)
+            {
+                Uart->Ris |= MODEL_UART_RIS_TX;
+            }
+        }
+        else if(Uart->TxCount == Model_UartTxLevel(UartNum))
+        {
+            Uart->Ris |= MODEL_UART_RIS_TX;
+        }
+    }
+}
+
+/* Receive one character (data and UARTDR error flags) */
+void Model_UartReceiveChar(uint8 UartNum, uint32 Character)
+{
+    Model_Uart* Uart = &g_modelUart[UartNum];
+
+    if(Uart->RxCount >= MODEL_UART_FIFO_SIZE)
+    {
+        /* Lost, the next stored character reports it */
+        Uart->RxOverrun = TRUE;
+        return;
+    }
+
+    if(Uart->RxOverrun == TRUE)
+    {
+        Character |= MODEL_UART_OVERRUN_ERROR;
+        Uart->RxOverrun = FALSE;
+    }
+
+    Uart->RxFifo[(Uart->RxFirst + Uart->RxCount) % MODEL_UART_FIFO_SIZE] = Character;
+    Uart->RxCount++;
+
+    if(Uart->RxCount >= Model_UartRxLevel(UartNum))
+    {
+        Uart->Ris |= MODEL_UART_RIS_RX;
+    }
+}
+
+/* Receive bytes without errors */
+void Model_UartReceive(uint8 UartNum, const uint8* Data, uint32 Length)
+{
+    uint32 iteration = 0;
+
+    for(iteration = 0; iteration < Length; iteration++)
+    {
+        Model_UartReceiveChar(UartNum, Data[iteration]);
+    }
+}
+
+/* Line stays idle for 32 bits with characters below the Rx trigger level */
+void Model_UartRxTimeOut(uint8 UartNum)
+{
+    if(g_modelUart[UartNum].RxCount != 0)
+    {
+        g_modelUart[UartNum].Ris |= MODEL_UART_RIS_RT;
+    }
+}
+
+/* Masked interrupt status (the UART interrupt line is asserted if not 0) */
+uint32 Model_UartPending(uint8 UartNum)
+{
+    return g_modelUart[UartNum].Ris & Test_RegGet(MODEL_UART_BASE(UartNum) + MODEL_UART_IM);
+}
+
+/* Call the ISR while the UART interrupt line is asserted */
+void Model_UartRunIsr(uint8 UartNum, void (*Isr)(void))
+{
+    uint32 Entries = 0;
+
+    while( (Model_UartPending(UartNum) != 0) && (Entries < 1000U) )
+    {
+        (*Isr)();
+        Entries++;
+    }
+}
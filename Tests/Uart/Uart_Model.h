@@ -0,0 +1,70 @@
+/********************************************************************************
+ * @headerfile    Uart_Model.h
+ * @brief         Header file for the UART peripheral model of the host tests
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ * @note          The model hooks UARTDR, UARTFR, UARTRIS, UARTMIS and UARTICR:
+ *                - Tx FIFO (16 bytes) is filled by UARTDR writes and shifted to
+ *                  the "wire" by Model_UartShift()
+ *                - Rx FIFO (16 characters) is filled by Model_UartReceive() and
+ *                  emptied by UARTDR reads
+ *                - Raw interrupts follow the UARTIFLS trigger levels (Transmit
+ *                  one follows the empty wire if UARTCTL EOT is set), UARTMIS
+ *                  is UARTRIS & UARTIM and UARTICR clears UARTRIS
+ *******************************************************************************/
+
+#ifndef TESTS_UART_UART_MODEL_H_
+#define TESTS_UART_UART_MODEL_H_
+
+#include "Test_Harness.h"
+
+
+/*******************************************************************************
+ *                                  Defines                                    *
+ *******************************************************************************/
+#define MODEL_UART_FIFO_SIZE        (16U)
+#define MODEL_UART_WIRE_SIZE        (4096U)
+
+/* Rx FIFO entry flags (same bits as UARTDR) */
+#define MODEL_UART_FRAMING_ERROR    (0x100U)
+#define MODEL_UART_PARITY_ERROR     (0x200U)
+#define MODEL_UART_BREAK_ERROR      (0x400U)
+#define MODEL_UART_OVERRUN_ERROR    (0x800U)
+
+
+/*******************************************************************************
+ *                              User Defined Data Types                        *
+ *******************************************************************************/
+typedef struct{
+    uint8   TxFifo[MODEL_UART_FIFO_SIZE];   /* Bytes written to UARTDR, not sent yet    */
+    uint32  TxCount;
+    uint8   Wire[MODEL_UART_WIRE_SIZE];     /* Bytes sent, in order                     */
+    uint32  WireCount;
+    uint32  RxFifo[MODEL_UART_FIFO_SIZE];   /* Received characters with error flags     */
+    uint32  RxFirst;
+    uint32  RxCount;
+    uint8   RxOverrun;                      /* Next character gets the overrun flag     */
+    uint32  Ris;                            /* Raw interrupt status                     */
+    uint8   AutoShift;                      /* Each UARTFR read sends one Tx byte       */
+}Model_Uart;
+
+
+/*******************************************************************************
+ *                              Global Variables                               *
+ *******************************************************************************/
+extern Model_Uart g_modelUart[8];
+
+
+/*******************************************************************************
+ *                              Functions Prototypes                           *
+ *******************************************************************************/
+void Model_UartAttach(uint8 UartNum);
+void Model_UartShift(uint8 UartNum, uint32 Count);
+void Model_UartReceive(uint8 UartNum, const uint8* Data, uint32 Length);
+void Model_UartReceiveChar(uint8 UartNum, uint32 Character);
+void Model_UartRxTimeOut(uint8 UartNum);
+uint32 Model_UartPending(uint8 UartNum);
+void Model_UartRunIsr(uint8 UartNum, void (*Isr)(void));
+
+#endif /* TESTS_UART_UART_MODEL_H_ */
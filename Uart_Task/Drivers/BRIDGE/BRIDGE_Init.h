@@ -0,0 +1,28 @@
+/********************************************************************************
+ * @headerfile    BRIDGE_Init.h
+ * @brief         Header file for UART bridge (one upstream UART copied to
+ *                several downstream UARTs) on TM4C123GH6PM Microcontroller
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ * @note          Received bytes are stored once in a shared reference counted
+ *                block, each downstream port sends it from its own Tx interrupt
+ * @note          Upstream and all downstream UART interrupts MUST have the same
+ *                NVIC priority (blocks are shared between their ISRs without locks)
+ *******************************************************************************/
+
+#ifndef DRIVERS_BRIDGE_BRIDGE_INIT_H_
+#define DRIVERS_BRIDGE_BRIDGE_INIT_H_
+
+#include "std_types.h"
+#include "common_macros.h"
+#include "UART_Init.h"
+
+
+/*******************************************************************************
+ *                              Functions Prototype                            *
+ *******************************************************************************/
+uint8 Bridge_Init(const Uart_Config* Upstream, const Uart_Config* const Downstream[], uint8 DownstreamCount);
+uint32 Bridge_GetDroppedBytes(Uart_Instance Port);
+
+#endif /* DRIVERS_BRIDGE_BRIDGE_INIT_H_ */
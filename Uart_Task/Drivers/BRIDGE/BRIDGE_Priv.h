@@ -0,0 +1,70 @@
+/********************************************************************************
+ * @headerfile    BRIDGE_Priv.h
+ * @brief         Header file for UART bridge defines and private types on
+ *                TM4C123GH6PM Microcontroller
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ *
+ *******************************************************************************/
+
+
+#ifndef DRIVERS_BRIDGE_BRIDGE_PRIV_H_
+#define DRIVERS_BRIDGE_BRIDGE_PRIV_H_
+
+#include "std_types.h"
+#include "UART_Init.h"
+
+
+/************************** Block pool defines *****************************/
+/* Shared blocks (MUST be more than BRIDGE_PORT_QUEUE_DEPTH, so a stalled port
+ * can't hold all of them) */
+#define BRIDGE_BLOCK_COUNT              (16U)
+#define BRIDGE_BLOCK_SIZE               (64U)
+
+/* Blocks waiting per downstream port (MUST be a power of 2), a port with a
+ * full queue skips the next blocks (backpressure without stalling the others) */
+#define BRIDGE_PORT_QUEUE_DEPTH         (8U)
+#define BRIDGE_PORT_QUEUE_MASK          ((uint8) (BRIDGE_PORT_QUEUE_DEPTH - 1U))
+
+/* Maximum downstream ports (all UART instances except the upstream one) */
+#define BRIDGE_MAX_PORTS                (7U)
+
+/* Number of UART instances */
+#define BRIDGE_NUMBER_OF_UARTS          (8U)
+
+/* Port index of UARTs which are not downstream ports */
+#define BRIDGE_NO_PORT                  ((uint8) 0xFF)
+
+/* Block index meaning no block is being filled */
+#define BRIDGE_NO_BLOCK                 ((uint8) 0xFF)
+
+
+/*******************************************************************************
+ * @struct Bridge_Block
+ *
+ * @brief  Structure holds one shared block of upstream bytes
+ ******************************************************************************/
+typedef struct{
+    uint8   Data[BRIDGE_BLOCK_SIZE];    /* Upstream bytes                       */
+    uint16  Length;                     /* Number of valid bytes                */
+    uint8   RefCount;                   /* Ports which didn't send it yet       */
+}Bridge_Block;
+
+
+/*******************************************************************************
+ * @struct Bridge_Port
+ *
+ * @brief  Structure holds one downstream port and its queue of blocks
+ ******************************************************************************/
+typedef struct{
+    Uart_Instance   UartNum;                        /* Downstream UART                  */
+    uint8           Queue[BRIDGE_PORT_QUEUE_DEPTH]; /* Indexes of blocks to send        */
+    uint8           Head;                           /* Producer index (free running)    */
+    uint8           Tail;                           /* Consumer index (free running)    */
+    uint16          Offset;                         /* Bytes of the first block sent    */
+    volatile uint32 DroppedBytes;                   /* Bytes skipped (queue was full)   */
+}Bridge_Port;
+
+
+#endif /* DRIVERS_BRIDGE_BRIDGE_PRIV_H_ */
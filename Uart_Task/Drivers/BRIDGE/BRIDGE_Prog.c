@@ -0,0 +1,433 @@
+/********************************************************************************
+ * @file          BRIDGE_Prog.c
+ * @brief         Source file for UART bridge (one upstream UART copied to
+ *                several downstream UARTs) on TM4C123GH6PM Microcontroller
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ * @note          Upstream bytes are copied once from the UART Rx ring buffer
+ *                to a shared block, downstream Tx interrupts write the block
+ *                directly to their Tx FIFOs (UART external Tx source) and the
+ *                last one gives it back to the pool
+ *******************************************************************************/
+
+
+/*******************************************************************************
+ *                              Includes                                       *
+ *******************************************************************************/
+#include "BRIDGE_Init.h"
+#include "BRIDGE_Priv.h"
+
+
+/*******************************************************************************
+ *                              Global Variables                               *
+ *******************************************************************************/
+/* Shared blocks and stack of free block indexes */
+static Bridge_Block g_bridgeBlocks[BRIDGE_BLOCK_COUNT];
+static uint8 g_bridgeFreeBlocks[BRIDGE_BLOCK_COUNT];
+static uint8 g_bridgeFreeCount = 0;
+
+/* Block being filled from upstream (BRIDGE_NO_BLOCK if none) */
+static uint8 g_bridgeOpenBlock = BRIDGE_NO_BLOCK;
+
+/* Downstream ports */
+static Bridge_Port g_bridgePorts[BRIDGE_MAX_PORTS];
+static uint8 g_bridgePortCount = 0;
+
+/* Port index of each UART instance (BRIDGE_NO_PORT if not downstream) */
+static uint8 g_bridgePortOfUart[BRIDGE_NUMBER_OF_UARTS];
+
+/* Upstream UART */
+static const Uart_Config* g_bridgeUpstream = NULL_PTR;
+
+/* Bridge_Drain() is running (a port kicked by it may give a block back) */
+static uint8 g_bridgeDraining = FALSE;
+
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * @fn              static void Bridge_Release(uint8 Block)
+ * @brief           Function to drop one reference of a block, the block goes
+ *                  back to the pool when no port needs it anymore
+ * @param (in):     Block - Block index
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+static void Bridge_Release(uint8 Block)
+{
+    if(g_bridgeBlocks[Block].RefCount > 1U)
+    {
+        g_bridgeBlocks[Block].RefCount--;
+        return;
+    }
+
+    g_bridgeBlocks[Block].RefCount = 0;
+    g_bridgeFreeBlocks[g_bridgeFreeCount] = Block;
+    g_bridgeFreeCount++;
+}
+
+/*******************************************************************************
+ * @fn              static void Bridge_Publish(uint8 SkipKickPort)
+ * @brief           Function to hand the open block to all ports with a free
+ *                  queue slot, ports with a full queue skip it
+ * @param (in):     SkipKickPort - Port already sending (its Tx interrupt will
+ *                                 peek again), BRIDGE_NO_PORT to kick all ports
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+static void Bridge_Publish(uint8 SkipKickPort)
+{
+    /* Block being published */
+    uint8 Block = g_bridgeOpenBlock;
+
+    /* Ports which accept the block */
+    uint8 Accepted = 0;
+
+    /* Loop counter */
+    uint8 Index = 0;
+
+    g_bridgeOpenBlock = BRIDGE_NO_BLOCK;
+
+    /* References are counted before any port can send (and release) the block */
+    for(Index = 0; Index < g_bridgePortCount; Index++)
+    {
+        if( (uint8)(g_bridgePorts[Index].Head - g_bridgePorts[Index].Tail) < BRIDGE_PORT_QUEUE_DEPTH )
+        {
+            Accepted++;
+        }
+    }
+
+    if(Accepted == 0)
+    {
+        for(Index = 0; Index < g_bridgePortCount; Index++)
+        {
+            g_bridgePorts[Index].DroppedBytes += g_bridgeBlocks[Block].Length;
+        }
+        g_bridgeBlocks[Block].RefCount = 1;
+        Bridge_Release(Block);
+        return;
+    }
+
+    g_bridgeBlocks[Block].RefCount = Accepted;
+
+    for(Index = 0; Index < g_bridgePortCount; Index++)
+    {
+        if( (uint8)(g_bridgePorts[Index].Head - g_bridgePorts[Index].Tail) < BRIDGE_PORT_QUEUE_DEPTH )
+        {
+            g_bridgePorts[Index].Queue[g_bridgePorts[Index].Head & BRIDGE_PORT_QUEUE_MASK] = Block;
+            g_bridgePorts[Index].Head++;
+
+            if(Index != SkipKickPort)
+            {
+                Uart_TxKick(g_bridgePorts[Index].UartNum);
+            }
+        }
+        else
+        {
+            /* Slow port, don't stall the others */
+            g_bridgePorts[Index].DroppedBytes += g_bridgeBlocks[Block].Length;
+        }
+    }
+}
+
+/*******************************************************************************
+ * @fn              static uint8 Bridge_AnyPortIdle(void)
+ * @brief           Function to check if a port has nothing to send
+ * @param (in):     None
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          TRUE if at least one port queue is empty
+ *******************************************************************************/
+static uint8 Bridge_AnyPortIdle(void)
+{
+    /* Loop counter */
+    uint8 Index = 0;
+
+    for(Index = 0; Index < g_bridgePortCount; Index++)
+    {
+        if(g_bridgePorts[Index].Head == g_bridgePorts[Index].Tail)
+        {
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+/*******************************************************************************
+ * @fn              static void Bridge_Drain(uint8 SkipKickPort)
+ * @brief           Function to move the bytes of the upstream UART Rx ring
+ *                  buffer to shared blocks
+ *                  - A block is published when it is full, or earlier if a
+ *                    port is idle (low latency when the ports keep up, full
+ *                    blocks when they don't)
+ *                  - Bytes stay in the UART Rx ring buffer when the pool is
+ *                    empty (upstream flow control applies), the drain goes on
+ *                    when a port gives a block back
+ * @param (in):     SkipKickPort - Port already sending (its Tx interrupt will
+ *                                 peek again), BRIDGE_NO_PORT to kick all ports
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+static void Bridge_Drain(uint8 SkipKickPort)
+{
+    /* Contiguous received bytes inside UART Rx ring buffer */
+    const uint8* Data = NULL_PTR;
+
+    /* Number of contiguous received bytes */
+    uint16 Available = 0;
+
+    /* Bytes copied to the open block */
+    uint16 Count = 0;
+
+    /* Open block */
+    Bridge_Block* Block = NULL_PTR;
+
+    /* The running drain peeks again after each publish and takes the freed blocks */
+    if(g_bridgeDraining == TRUE)
+    {
+        return;
+    }
+    g_bridgeDraining = TRUE;
+
+    while( (Available = Uart_Peek(g_bridgeUpstream, &Data)) != 0 )
+    {
+        if(g_bridgeOpenBlock == BRIDGE_NO_BLOCK)
+        {
+            if(g_bridgeFreeCount == 0)
+            {
+                /* All blocks are in use, wait for the ports */
+                break;
+            }
+            g_bridgeFreeCount--;
+            g_bridgeOpenBlock = g_bridgeFreeBlocks[g_bridgeFreeCount];
+            g_bridgeBlocks[g_bridgeOpenBlock].Length = 0;
+        }
+
+        Block = &g_bridgeBlocks[g_bridgeOpenBlock];
+        if(Available > (BRIDGE_BLOCK_SIZE - Block->Length))
+        {
+            Available = BRIDGE_BLOCK_SIZE - Block->Length;
+        }
+
+        for(Count = 0; Count < Available; Count++)
+        {
+            Block->Data[Block->Length + Count] = Data[Count];
+        }
+        Block->Length += Available;
+        Uart_Consume(g_bridgeUpstream, Available);
+
+        if(Block->Length == BRIDGE_BLOCK_SIZE)
+        {
+            Bridge_Publish(SkipKickPort);
+        }
+    }
+
+    if( (g_bridgeOpenBlock != BRIDGE_NO_BLOCK) && (Bridge_AnyPortIdle() == TRUE) )
+    {
+        Bridge_Publish(SkipKickPort);
+    }
+
+    g_bridgeDraining = FALSE;
+}
+
+/*******************************************************************************
+ * @fn              static void Bridge_RxCallBack(void)
+ * @brief           Function called from upstream UART Rx interrupt to move
+ *                  received bytes to shared blocks
+ * @param (in):     None
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+static void Bridge_RxCallBack(void)
+{
+    Bridge_Drain(BRIDGE_NO_PORT);
+}
+
+/*******************************************************************************
+ * @fn              static uint16 Bridge_TxPeek(Uart_Instance UartNum, const uint8** Data)
+ * @brief           UART Tx source function: unsent bytes of the port first block
+ * @param (in):     UartNum - Downstream UART
+ * @param (out):    Data    - Pointer to the unsent bytes
+ * @param (inout):  None
+ * @return          Number of unsent bytes (0 if the port queue is empty)
+ *******************************************************************************/
+static uint16 Bridge_TxPeek(Uart_Instance UartNum, const uint8** Data)
+{
+    /* Port of this UART */
+    Bridge_Port* Port = &g_bridgePorts[g_bridgePortOfUart[UartNum]];
+
+    /* First block of the port */
+    const Bridge_Block* Block = NULL_PTR;
+
+    if(Port->Head == Port->Tail)
+    {
+        return 0;
+    }
+
+    Block = &g_bridgeBlocks[Port->Queue[Port->Tail & BRIDGE_PORT_QUEUE_MASK]];
+    *Data = &Block->Data[Port->Offset];
+
+    return (uint16)(Block->Length - Port->Offset);
+}
+
+/*******************************************************************************
+ * @fn              static void Bridge_TxConsume(Uart_Instance UartNum, uint16 Length)
+ * @brief           UART Tx source function: release bytes written to Tx FIFO
+ * @param (in):     UartNum - Downstream UART
+ *                  Length  - Number of sent bytes
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+static void Bridge_TxConsume(Uart_Instance UartNum, uint16 Length)
+{
+    /* Index of the port of this UART */
+    uint8 PortIndex = g_bridgePortOfUart[UartNum];
+
+    /* Port of this UART */
+    Bridge_Port* Port = &g_bridgePorts[PortIndex];
+
+    /* First block of the port */
+    uint8 Block = 0;
+
+    /* Bytes waiting in the upstream Rx ring buffer */
+    const uint8* Data = NULL_PTR;
+
+    if(Port->Head == Port->Tail)
+    {
+        return;
+    }
+
+    Block = Port->Queue[Port->Tail & BRIDGE_PORT_QUEUE_MASK];
+    Port->Offset += Length;
+
+    if(Port->Offset < g_bridgeBlocks[Block].Length)
+    {
+        return;
+    }
+
+    /* Whole block sent by this port */
+    Port->Offset = 0;
+    Port->Tail++;
+    Bridge_Release(Block);
+
+    /* Block went back to the pool: bytes left in the Rx ring buffer when the
+     * pool was empty get no new Rx interrupt (ring buffer full, flow control) */
+    if( (g_bridgeBlocks[Block].RefCount == 0) && (Uart_Peek(g_bridgeUpstream, &Data) != 0) )
+    {
+        Bridge_Drain(PortIndex);
+    }
+
+    /* Port became idle, don't let the partially filled block wait */
+    if( (Port->Head == Port->Tail) && (g_bridgeOpenBlock != BRIDGE_NO_BLOCK) )
+    {
+        Bridge_Publish(PortIndex);
+    }
+}
+
+
+/*******************************************************************************
+ *                      Public Functions Definitions                           *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * @fn              uint8 Bridge_Init(const Uart_Config* Upstream,
+ *                                    const Uart_Config* const Downstream[], uint8 DownstreamCount)
+ * @brief           Function to start copying the upstream UART stream to the
+ *                  downstream UARTs
+ * @note            All UARTs MUST be initialized, upstream with Rx interrupt
+ *                  enabled (and flow control if the pool may run out), and
+ *                  their NVIC interrupts enabled with the same priority
+ * @param (in):     Upstream        - Upstream UART configuration
+ *                  Downstream      - Downstream UARTs configurations
+ *                  DownstreamCount - Number of downstream UARTs (1 -> 7)
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Return Status
+ *******************************************************************************/
+uint8 Bridge_Init(const Uart_Config* Upstream, const Uart_Config* const Downstream[], uint8 DownstreamCount)
+{
+    /* Loop counter */
+    uint8 Index = 0;
+
+    /* Check if the input pointers are Not Null Pointers */
+    if( (NULL_PTR == Upstream) || (NULL_PTR == Downstream) || (0 == DownstreamCount) ||
+        (DownstreamCount > BRIDGE_MAX_PORTS) || (Upstream->UartNum >= BRIDGE_NUMBER_OF_UARTS) )
+    {
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    for(Index = 0; Index < BRIDGE_NUMBER_OF_UARTS; Index++)
+    {
+        g_bridgePortOfUart[Index] = BRIDGE_NO_PORT;
+    }
+
+    /* Each downstream UART is used once and isn't the upstream one */
+    for(Index = 0; Index < DownstreamCount; Index++)
+    {
+        if( (NULL_PTR == Downstream[Index]) || (Downstream[Index]->UartNum >= BRIDGE_NUMBER_OF_UARTS) ||
+            (Downstream[Index]->UartNum == Upstream->UartNum) ||
+            (g_bridgePortOfUart[Downstream[Index]->UartNum] != BRIDGE_NO_PORT) )
+        {
+            return RET_NOT_OK;
+        }
+        g_bridgePortOfUart[Downstream[Index]->UartNum] = Index;
+    }
+
+    for(Index = 0; Index < BRIDGE_BLOCK_COUNT; Index++)
+    {
+        g_bridgeBlocks[Index].RefCount = 0;
+        g_bridgeFreeBlocks[Index] = Index;
+    }
+    g_bridgeFreeCount = BRIDGE_BLOCK_COUNT;
+    g_bridgeOpenBlock = BRIDGE_NO_BLOCK;
+    g_bridgeDraining  = FALSE;
+
+    for(Index = 0; Index < DownstreamCount; Index++)
+    {
+        g_bridgePorts[Index].UartNum      = Downstream[Index]->UartNum;
+        g_bridgePorts[Index].Head         = 0;
+        g_bridgePorts[Index].Tail         = 0;
+        g_bridgePorts[Index].Offset       = 0;
+        g_bridgePorts[Index].DroppedBytes = 0;
+        (void)Uart_SetTxSource(Downstream[Index]->UartNum, Bridge_TxPeek, Bridge_TxConsume);
+    }
+    g_bridgePortCount = DownstreamCount;
+    g_bridgeUpstream  = Upstream;
+
+    /* Bytes below the Rx FIFO trigger level are signaled by Receive Time-Out only */
+    if(Uart_SetCallBack(Upstream->UartNum, InterruptMaskReceiveTimeOut, Bridge_RxCallBack) != RET_OK)
+    {
+        return RET_NOT_OK;
+    }
+
+    return Uart_SetCallBack(Upstream->UartNum, InterruptMaskReceive, Bridge_RxCallBack);
+}
+
+/*******************************************************************************
+ * @fn              uint32 Bridge_GetDroppedBytes(Uart_Instance Port)
+ * @brief           Function to get number of upstream bytes a downstream port
+ *                  skipped because it was too slow (its queue was full)
+ * @param (in):     Port - Downstream UART
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Number of skipped bytes
+ *******************************************************************************/
+uint32 Bridge_GetDroppedBytes(Uart_Instance Port)
+{
+    if( (Port >= BRIDGE_NUMBER_OF_UARTS) || (g_bridgePortOfUart[Port] == BRIDGE_NO_PORT) )
+    {
+        return 0;
+    }
+
+    return g_bridgePorts[g_bridgePortOfUart[Port]].DroppedBytes;
+}
@@ -0,0 +1,74 @@
+/********************************************************************************
+ * @headerfile    FRAME_Init.h
+ * @brief         Header file for UART Rx framing layer (COBS / SLIP) on
+ *                TM4C123GH6PM Microcontroller
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ * @note          Frames are decoded in UART Rx interrupt from the UART Rx ring
+ *                buffer (filled by the UART driver from the Rx FIFO) into a pool
+ *                of preallocated buffers, and handed to the application by pointer
+ *******************************************************************************/
+
+#ifndef DRIVERS_FRAME_FRAME_INIT_H_
+#define DRIVERS_FRAME_FRAME_INIT_H_
+
+#include "std_types.h"
+#include "common_macros.h"
+#include "UART_Init.h"
+
+
+/*******************************************************************************
+ *                     Defines used in Frame_Receiver Variables                *
+ *******************************************************************************/
+/* Define used to choose frame encoding             */
+#define FRAME_ENCODING_COBS         (0U)    /* Consistent Overhead Byte Stuffing, 0x00 delimited */
+#define FRAME_ENCODING_SLIP         (1U)    /* RFC 1055 SLIP, 0xC0 delimited                     */
+
+/* Number of frame buffers of each receiver (MUST be a power of 2) */
+#define FRAME_POOL_SIZE             (4U)
+
+/* Maximum decoded frame length (longer frames are dropped) */
+#define FRAME_MAX_LENGTH            (256U)
+
+
+/*******************************************************************************
+ *                              User Defined Data Types                        *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * @struct Frame_Receiver
+ *
+ * @brief  Structure holds one framing receiver (one per UART instance)
+ *         It is allocated by the application and MUST NOT be accessed
+ *         directly, use Frame_xxx APIs instead
+ ******************************************************************************/
+typedef struct{
+    const Uart_Config*  UartConfig;                             /* UART feeding this receiver           */
+    void (*CallBack)(void);                                     /* Called from ISR when a frame is ready */
+    uint8               Encoding;                               /* @ref FRAME_ENCODING                  */
+
+    uint8               Pool[FRAME_POOL_SIZE][FRAME_MAX_LENGTH];/* Preallocated frame buffers           */
+    uint16              Length[FRAME_POOL_SIZE];                /* Decoded length of each ready frame   */
+    volatile uint8      ReadyHead;                              /* Frames completed (written by ISR)    */
+    volatile uint8      ReadyTail;                              /* Frames released (written by app)     */
+
+    uint16              Position;                               /* Bytes decoded in the current frame   */
+    uint8               CobsCode;                               /* Code byte of current COBS block      */
+    uint8               CobsRemaining;                          /* Data bytes left in current block     */
+    uint8               SlipEscape;                             /* TRUE after SLIP ESC byte             */
+    uint8               Dropping;                               /* TRUE until the next delimiter        */
+
+    volatile uint32     DroppedFrames;                          /* Malformed, too long or no buffer     */
+}Frame_Receiver;
+
+
+/*******************************************************************************
+ *                              Functions Prototype                            *
+ *******************************************************************************/
+uint8 Frame_Init(Frame_Receiver* Receiver, const Uart_Config* UartConfig, uint8 Encoding, void (*CallBack)(void));
+const uint8* Frame_Get(Frame_Receiver* Receiver, uint16* Length);
+void Frame_Release(Frame_Receiver* Receiver);
+uint32 Frame_GetDroppedCount(const Frame_Receiver* Receiver);
+
+#endif /* DRIVERS_FRAME_FRAME_INIT_H_ */
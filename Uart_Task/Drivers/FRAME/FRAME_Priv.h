@@ -0,0 +1,33 @@
+/********************************************************************************
+ * @headerfile    FRAME_Priv.h
+ * @brief         Header file for UART Rx framing layer defines on
+ *                TM4C123GH6PM Microcontroller
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ *
+ *******************************************************************************/
+
+
+#ifndef DRIVERS_FRAME_FRAME_PRIV_H_
+#define DRIVERS_FRAME_FRAME_PRIV_H_
+
+
+/************************** COBS defines *****************************/
+#define COBS_DELIMITER                  ((uint8) 0x00)  /* Frame delimiter                          */
+#define COBS_MAX_CODE                   ((uint8) 0xFF)  /* Block of 254 bytes without implicit zero */
+
+/************************** SLIP defines *****************************/
+#define SLIP_END                        ((uint8) 0xC0)  /* Frame delimiter                          */
+#define SLIP_ESC                        ((uint8) 0xDB)  /* Escape byte                              */
+#define SLIP_ESC_END                    ((uint8) 0xDC)  /* Escaped SLIP_END                         */
+#define SLIP_ESC_ESC                    ((uint8) 0xDD)  /* Escaped SLIP_ESC                         */
+
+/************************** Frame pool defines *****************************/
+#define FRAME_POOL_MASK                 ((uint8) (FRAME_POOL_SIZE - 1U))
+
+/* Number of UART instances which can feed a receiver */
+#define FRAME_NUMBER_OF_RECEIVERS       (8U)
+
+
+#endif /* DRIVERS_FRAME_FRAME_PRIV_H_ */
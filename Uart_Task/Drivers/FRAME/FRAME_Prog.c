@@ -0,0 +1,452 @@
+/********************************************************************************
+ * @file          FRAME_Prog.c
+ * @brief         Source file for UART Rx framing layer (COBS / SLIP) on
+ *                TM4C123GH6PM Microcontroller
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ * @note          Each received byte is copied twice: from the Rx FIFO to the
+ *                UART Rx ring buffer by the UART driver, then, decoded in place
+ *                from the ring buffer (Uart_Peek), to a frame buffer of the pool.
+ *                The application reads the frame from the pool (no third copy)
+ *******************************************************************************/
+
+
+/*******************************************************************************
+ *                              Includes                                       *
+ *******************************************************************************/
+#include "FRAME_Init.h"
+#include "FRAME_Priv.h"
+
+
+/*******************************************************************************
+ *                              Global Variables                               *
+ *******************************************************************************/
+/* Receiver attached to each UART instance */
+static Frame_Receiver* g_frameReceivers[FRAME_NUMBER_OF_RECEIVERS] = {NULL_PTR};
+
+
+/*******************************************************************************
+ *                      Private Functions Prototypes                           *
+ *******************************************************************************/
+static void Frame_RxIsrHandler(Uart_Instance UartNum);
+static void Frame_Uart0RxCallBack(void);
+static void Frame_Uart1RxCallBack(void);
+static void Frame_Uart2RxCallBack(void);
+static void Frame_Uart3RxCallBack(void);
+static void Frame_Uart4RxCallBack(void);
+static void Frame_Uart5RxCallBack(void);
+static void Frame_Uart6RxCallBack(void);
+static void Frame_Uart7RxCallBack(void);
+
+/* UART Rx call back of each UART instance */
+static void (* const g_frameRxCallBacks[FRAME_NUMBER_OF_RECEIVERS])(void) =
+{
+    Frame_Uart0RxCallBack, Frame_Uart1RxCallBack, Frame_Uart2RxCallBack, Frame_Uart3RxCallBack,
+    Frame_Uart4RxCallBack, Frame_Uart5RxCallBack, Frame_Uart6RxCallBack, Frame_Uart7RxCallBack
+};
+
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * @fn              static void Frame_Restart(Frame_Receiver* Receiver)
+ * @brief           Function to start decoding a new frame
+ * @param (in):     Receiver - Pointer to frame receiver
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+static void Frame_Restart(Frame_Receiver* Receiver)
+{
+    Receiver->Position      = 0;
+    Receiver->CobsCode      = 0;
+    Receiver->CobsRemaining = 0;
+    Receiver->SlipEscape    = FALSE;
+    Receiver->Dropping      = FALSE;
+}
+
+/*******************************************************************************
+ * @fn              static void Frame_Drop(Frame_Receiver* Receiver)
+ * @brief           Function to discard the current frame till next delimiter
+ * @param (in):     Receiver - Pointer to frame receiver
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+static void Frame_Drop(Frame_Receiver* Receiver)
+{
+    if(FALSE == Receiver->Dropping)
+    {
+        Receiver->Dropping = TRUE;
+        Receiver->DroppedFrames++;
+    }
+}
+
+/*******************************************************************************
+ * @fn              static void Frame_Store(Frame_Receiver* Receiver, uint8 Data)
+ * @brief           Function to append one decoded byte to the current frame
+ * @param (in):     Receiver - Pointer to frame receiver
+ *                  Data     - Decoded byte
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+static void Frame_Store(Frame_Receiver* Receiver, uint8 Data)
+{
+    /* Check that there is a free buffer and the frame still fits in it */
+    if( ((uint8)(Receiver->ReadyHead - Receiver->ReadyTail) >= FRAME_POOL_SIZE) ||
+        (Receiver->Position >= FRAME_MAX_LENGTH) )
+    {
+        Frame_Drop(Receiver);
+        return;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    Receiver->Pool[Receiver->ReadyHead & FRAME_POOL_MASK][Receiver->Position] = Data;
+    Receiver->Position++;
+}
+
+/*******************************************************************************
+ * @fn              static void Frame_Complete(Frame_Receiver* Receiver)
+ * @brief           Function to publish the current frame to the application
+ * @param (in):     Receiver - Pointer to frame receiver
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+static void Frame_Complete(Frame_Receiver* Receiver)
+{
+    /* An empty COBS frame stored no byte, so the free buffer is checked here too */
+    if((uint8)(Receiver->ReadyHead - Receiver->ReadyTail) >= FRAME_POOL_SIZE)
+    {
+        Receiver->DroppedFrames++;
+        return;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    Receiver->Length[Receiver->ReadyHead & FRAME_POOL_MASK] = Receiver->Position;
+
+    /* Frame content and length are written before it is published */
+    Receiver->ReadyHead++;
+
+    if(NULL_PTR != Receiver->CallBack)
+    {
+        (*Receiver->CallBack)();
+    }
+}
+
+/*******************************************************************************
+ * @fn              static void Frame_CobsDecode(Frame_Receiver* Receiver, uint8 Data)
+ * @brief           Function to decode one received COBS byte
+ * @param (in):     Receiver - Pointer to frame receiver
+ *                  Data     - Received byte
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+static void Frame_CobsDecode(Frame_Receiver* Receiver, uint8 Data)
+{
+    if(COBS_DELIMITER == Data)
+    {
+        /* Frame is valid only if its last block is complete */
+        if( (FALSE == Receiver->Dropping) && (0 == Receiver->CobsRemaining) && (0 != Receiver->CobsCode) )
+        {
+            Frame_Complete(Receiver);
+        }
+        else if( (FALSE == Receiver->Dropping) && (0 != Receiver->CobsCode) )
+        {
+            /* Truncated block */
+            Receiver->DroppedFrames++;
+        }
+        else
+        {
+            /* Empty frame or frame already dropped */
+        }
+        Frame_Restart(Receiver);
+    }
+    else if(TRUE == Receiver->Dropping)
+    {
+        /* Wait for next delimiter */
+    }
+    else if(0 == Receiver->CobsRemaining)
+    {
+        /* Code byte, the previous block ends with an implicit zero unless it is a full block */
+        if( (0 != Receiver->CobsCode) && (COBS_MAX_CODE != Receiver->CobsCode) )
+        {
+            Frame_Store(Receiver, COBS_DELIMITER);
+        }
+        Receiver->CobsCode      = Data;
+        Receiver->CobsRemaining = (uint8)(Data - 1U);
+    }
+    else
+    {
+        Frame_Store(Receiver, Data);
+        Receiver->CobsRemaining--;
+    }
+}
+
+/*******************************************************************************
+ * @fn              static void Frame_SlipDecode(Frame_Receiver* Receiver, uint8 Data)
+ * @brief           Function to decode one received SLIP byte
+ * @param (in):     Receiver - Pointer to frame receiver
+ *                  Data     - Received byte
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+static void Frame_SlipDecode(Frame_Receiver* Receiver, uint8 Data)
+{
+    if(SLIP_END == Data)
+    {
+        /* Frame is valid only if it is not empty and not ending with ESC */
+        if( (FALSE == Receiver->Dropping) && (FALSE == Receiver->SlipEscape) && (0 != Receiver->Position) )
+        {
+            Frame_Complete(Receiver);
+        }
+        else if( (FALSE == Receiver->Dropping) && (TRUE == Receiver->SlipEscape) )
+        {
+            Receiver->DroppedFrames++;
+        }
+        else
+        {
+            /* Empty frame or frame already dropped */
+        }
+        Frame_Restart(Receiver);
+    }
+    else if(TRUE == Receiver->Dropping)
+    {
+        /* Wait for next delimiter */
+    }
+    else if(TRUE == Receiver->SlipEscape)
+    {
+        Receiver->SlipEscape = FALSE;
+        if(SLIP_ESC_END == Data)
+        {
+            Frame_Store(Receiver, SLIP_END);
+        }
+        else if(SLIP_ESC_ESC == Data)
+        {
+            Frame_Store(Receiver, SLIP_ESC);
+        }
+        else
+        {
+            /* Invalid escape sequence */
+            Frame_Drop(Receiver);
+        }
+    }
+    else if(SLIP_ESC == Data)
+    {
+        Receiver->SlipEscape = TRUE;
+    }
+    else
+    {
+        Frame_Store(Receiver, Data);
+    }
+}
+
+/*******************************************************************************
+ * @fn              static void Frame_RxIsrHandler(Uart_Instance UartNum)
+ * @brief           Function to decode all bytes waiting in UART Rx ring buffer
+ *                  It is called from UART Rx interrupt after the UART driver
+ *                  drained the Rx FIFO
+ * @param (in):     UartNum - UART instance
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+static void Frame_RxIsrHandler(Uart_Instance UartNum)
+{
+    /* Receiver attached to this UART */
+    Frame_Receiver* Receiver = g_frameReceivers[UartNum];
+
+    /* Contiguous received bytes inside UART Rx ring buffer */
+    const uint8* Data = NULL_PTR;
+
+    /* Number of contiguous received bytes */
+    uint16 Available = 0;
+
+    /* Index of the byte being decoded */
+    uint16 Index = 0;
+
+    if(NULL_PTR == Receiver)
+    {
+        return;
+    }
+
+    while( (Available = Uart_Peek(Receiver->UartConfig, &Data)) != 0 )
+    {
+        if(FRAME_ENCODING_COBS == Receiver->Encoding)
+        {
+            for(Index = 0; Index < Available; Index++)
+            {
+                Frame_CobsDecode(Receiver, Data[Index]);
+            }
+        }
+        else
+        {
+            for(Index = 0; Index < Available; Index++)
+            {
+                Frame_SlipDecode(Receiver, Data[Index]);
+            }
+        }
+        Uart_Consume(Receiver->UartConfig, Available);
+    }
+}
+
+static void Frame_Uart0RxCallBack(void)
+{
+    Frame_RxIsrHandler(Uart0);
+}
+
+static void Frame_Uart1RxCallBack(void)
+{
+    Frame_RxIsrHandler(Uart1);
+}
+
+static void Frame_Uart2RxCallBack(void)
+{
+    Frame_RxIsrHandler(Uart2);
+}
+
+static void Frame_Uart3RxCallBack(void)
+{
+    Frame_RxIsrHandler(Uart3);
+}
+
+static void Frame_Uart4RxCallBack(void)
+{
+    Frame_RxIsrHandler(Uart4);
+}
+
+static void Frame_Uart5RxCallBack(void)
+{
+    Frame_RxIsrHandler(Uart5);
+}
+
+static void Frame_Uart6RxCallBack(void)
+{
+    Frame_RxIsrHandler(Uart6);
+}
+
+static void Frame_Uart7RxCallBack(void)
+{
+    Frame_RxIsrHandler(Uart7);
+}
+
+
+/*******************************************************************************
+ *                      Public Functions Definitions                           *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * @fn              uint8 Frame_Init(Frame_Receiver* Receiver, const Uart_Config* UartConfig,
+ *                                   uint8 Encoding, void (*CallBack)(void))
+ * @brief           Function to attach a frame receiver to an initialized UART
+ *                  Received frames are decoded inside UART Rx interrupt, so the
+ *                  UART MUST be initialized with Rx interrupt enabled
+ * @param (in):     UartConfig - UART feeding the receiver
+ *                  Encoding   - @ref FRAME_ENCODING
+ *                  CallBack   - Called from interrupt each time a frame is ready
+ *                               (may be NULL_PTR to poll with Frame_Get)
+ * @param (out):    None
+ * @param (inout):  Receiver   - Receiver storage owned by the application
+ * @return          RET_OK if receiver attached, RET_NOT_OK otherwise
+ *******************************************************************************/
+uint8 Frame_Init(Frame_Receiver* Receiver, const Uart_Config* UartConfig, uint8 Encoding, void (*CallBack)(void))
+{
+    /* Check if the input pointers are Not Null Pointers */
+    if( (NULL_PTR == Receiver) || (NULL_PTR == UartConfig) ||
+        (UartConfig->UartNum >= FRAME_NUMBER_OF_RECEIVERS) ||
+        ( (FRAME_ENCODING_COBS != Encoding) && (FRAME_ENCODING_SLIP != Encoding) ) )
+    {
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    Receiver->UartConfig    = UartConfig;
+    Receiver->CallBack      = CallBack;
+    Receiver->Encoding      = Encoding;
+    Receiver->ReadyHead     = 0;
+    Receiver->ReadyTail     = 0;
+    Receiver->DroppedFrames = 0;
+    Frame_Restart(Receiver);
+
+    g_frameReceivers[UartConfig->UartNum] = Receiver;
+
+    /* Bytes below the Rx FIFO trigger level are signaled by Receive Time-Out only */
+    if(Uart_SetCallBack(UartConfig->UartNum, InterruptMaskReceiveTimeOut, g_frameRxCallBacks[UartConfig->UartNum]) != RET_OK)
+    {
+        return RET_NOT_OK;
+    }
+
+    return Uart_SetCallBack(UartConfig->UartNum, InterruptMaskReceive, g_frameRxCallBacks[UartConfig->UartNum]);
+}
+
+/*******************************************************************************
+ * @fn              const uint8* Frame_Get(Frame_Receiver* Receiver, uint16* Length)
+ * @brief           Function to get the oldest received frame without copying it
+ *                  The frame stays valid until Frame_Release is called
+ * @param (in):     Receiver - Pointer to frame receiver
+ * @param (out):    Length   - Decoded frame length
+ * @param (inout):  None
+ * @return          Pointer to decoded frame, NULL_PTR if no frame is ready
+ *******************************************************************************/
+const uint8* Frame_Get(Frame_Receiver* Receiver, uint16* Length)
+{
+    /* Index of the oldest ready frame */
+    uint8 Index = 0;
+
+    /* Check if the input pointers are Not Null Pointers */
+    if( (NULL_PTR == Receiver) || (NULL_PTR == Length) ||
+        (Receiver->ReadyHead == Receiver->ReadyTail) )
+    {
+        return NULL_PTR;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    Index   = Receiver->ReadyTail & FRAME_POOL_MASK;
+    *Length = Receiver->Length[Index];
+
+    return Receiver->Pool[Index];
+}
+
+/*******************************************************************************
+ * @fn              void Frame_Release(Frame_Receiver* Receiver)
+ * @brief           Function to give the frame returned by Frame_Get back to
+ *                  the pool
+ * @param (in):     None
+ * @param (out):    None
+ * @param (inout):  Receiver - Pointer to frame receiver
+ * @return          None
+ *******************************************************************************/
+void Frame_Release(Frame_Receiver* Receiver)
+{
+    if( (NULL_PTR == Receiver) || (Receiver->ReadyHead == Receiver->ReadyTail) )
+    {
+        return;
+    }
+
+    Receiver->ReadyTail++;
+}
+
+/*******************************************************************************
+ * @fn              uint32 Frame_GetDroppedCount(const Frame_Receiver* Receiver)
+ * @brief           Function to get number of malformed, too long or dropped
+ *                  frames because no free buffer was available
+ * @param (in):     Receiver - Pointer to frame receiver
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Number of dropped frames
+ *******************************************************************************/
+uint32 Frame_GetDroppedCount(const Frame_Receiver* Receiver)
+{
+    if(NULL_PTR == Receiver)
+    {
+        return 0;
+    }
+
+    return Receiver->DroppedFrames;
+}
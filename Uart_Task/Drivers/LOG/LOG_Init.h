@@ -0,0 +1,42 @@
+/********************************************************************************
+ * @headerfile    LOG_Init.h
+ * @brief         Header file for deferred binary logging over UART on
+ *                TM4C123GH6PM Microcontroller
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ * @note          Only the format string address and the raw 32-bit arguments
+ *                are recorded at call time, the text is rebuilt on the host
+ *                by Tools/log_decode.py from the .out file
+ *******************************************************************************/
+
+#ifndef DRIVERS_LOG_LOG_INIT_H_
+#define DRIVERS_LOG_LOG_INIT_H_
+
+#include "std_types.h"
+#include "common_macros.h"
+#include "UART_Init.h"
+
+
+/*******************************************************************************
+ *                              Logging Macros                                 *
+ *******************************************************************************/
+/* Format MUST be a string literal (it is read from the .out file on the host)
+ * Arguments are recorded as 32-bit values: %d %i %u %x %X %c %p are supported,
+ * %s is supported for strings located in flash                              */
+#define LOG0(FORMAT)                    Log_Write((FORMAT), 0U, 0U, 0U, 0U, 0U)
+#define LOG1(FORMAT, A0)                Log_Write((FORMAT), 1U, (uint32)(A0), 0U, 0U, 0U)
+#define LOG2(FORMAT, A0, A1)            Log_Write((FORMAT), 2U, (uint32)(A0), (uint32)(A1), 0U, 0U)
+#define LOG3(FORMAT, A0, A1, A2)        Log_Write((FORMAT), 3U, (uint32)(A0), (uint32)(A1), (uint32)(A2), 0U)
+#define LOG4(FORMAT, A0, A1, A2, A3)    Log_Write((FORMAT), 4U, (uint32)(A0), (uint32)(A1), (uint32)(A2), (uint32)(A3))
+
+
+/*******************************************************************************
+ *                              Functions Prototype                            *
+ *******************************************************************************/
+uint8 Log_Init(const Uart_Config* UartConfig);
+void Log_Write(const char* Format, uint32 ArgCount, uint32 Arg0, uint32 Arg1, uint32 Arg2, uint32 Arg3);
+void Log_Process(void);
+uint32 Log_GetDroppedCount(void);
+
+#endif /* DRIVERS_LOG_LOG_INIT_H_ */
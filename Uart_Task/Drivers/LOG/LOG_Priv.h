@@ -0,0 +1,71 @@
+/********************************************************************************
+ * @headerfile    LOG_Priv.h
+ * @brief         Header file for deferred binary logging defines on
+ *                TM4C123GH6PM Microcontroller
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ *
+ * Record on the wire (COBS encoded, terminated by 0x00), little endian:
+ *      | Format address (4 bytes) | Arg0 (4 bytes) | ... | ArgN-1 (4 bytes) |
+ *
+ *******************************************************************************/
+
+
+#ifndef DRIVERS_LOG_LOG_PRIV_H_
+#define DRIVERS_LOG_LOG_PRIV_H_
+
+#include "std_types.h"
+
+
+/************************** Ring buffer defines *****************************/
+/* Size of records ring buffer in words (MUST be a power of 2) */
+#define LOG_RING_WORDS                  (256U)
+#define LOG_RING_MASK                   ((uint16) (LOG_RING_WORDS - 1U))
+
+/* Maximum number of arguments of one record */
+#define LOG_MAX_ARGS                    (4U)
+
+/* Words of one record in the ring buffer: Count + Format + Args */
+#define LOG_RECORD_HEADER_WORDS         (2U)
+
+/************************** Encoding defines *****************************/
+/* Raw record bytes: Format + Args */
+#define LOG_RECORD_MAX_BYTES            (4U * (1U + LOG_MAX_ARGS))
+
+/* COBS adds one code byte per 254 bytes, plus the 0x00 delimiter */
+#define LOG_ENCODED_MAX_BYTES           (LOG_RECORD_MAX_BYTES + 2U)
+
+#define LOG_COBS_DELIMITER              ((uint8) 0x00)
+
+/* Mask/restore IRQs (PRIMASK), records may be written from any context */
+#if defined(__TI_ARM__)
+#define LOG_ENTER_CRITICAL()            ((uint32)_disable_interrupts())
+#define LOG_EXIT_CRITICAL(KEY)          ((void)_restore_interrupts(KEY))
+#elif defined(__GNUC__) && defined(__ARM_ARCH)
+#define LOG_ENTER_CRITICAL()            __extension__({ uint32 Key_; __asm volatile ("mrs %0, primask\n\tcpsid i" : "=r" (Key_) : : "memory"); Key_; })
+#define LOG_EXIT_CRITICAL(KEY)          __asm volatile ("msr primask, %0" : : "r" (KEY) : "memory")
+#elif defined(HOST_TEST)
+#include "Test_Critical.h"
+#define LOG_ENTER_CRITICAL()            Test_EnterCritical()
+#define LOG_EXIT_CRITICAL(KEY)          Test_ExitCritical(KEY)
+#else
+#error "LOG: no critical section (PRIMASK) implementation for this toolchain"
+#endif
+
+
+/*******************************************************************************
+ * @struct Log_Ring
+ *
+ * @brief  Structure holds the records ring buffer
+ *         Producers (any context) reserve space with IRQs masked,
+ *         Log_Process() is the only consumer
+ ******************************************************************************/
+typedef struct{
+    uint32          Buffer[LOG_RING_WORDS];     /* Records storage                  */
+    volatile uint16 Head;                       /* Producer index (free running)    */
+    volatile uint16 Tail;                       /* Consumer index (free running)    */
+}Log_Ring;
+
+
+#endif /* DRIVERS_LOG_LOG_PRIV_H_ */
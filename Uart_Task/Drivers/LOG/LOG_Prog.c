@@ -0,0 +1,278 @@
+/********************************************************************************
+ * @file          LOG_Prog.c
+ * @brief         Source file for deferred binary logging over UART on
+ *                TM4C123GH6PM Microcontroller
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ * @note          No formatting is done on the target: Log_Write() copies a
+ *                few words to a ring buffer and Log_Process() streams them
+ *                through the UART Tx ring buffer in the background
+ *******************************************************************************/
+
+
+/*******************************************************************************
+ *                              Includes                                       *
+ *******************************************************************************/
+#include "LOG_Init.h"
+#include "LOG_Priv.h"
+
+
+/*******************************************************************************
+ *                              Global Variables                               *
+ *******************************************************************************/
+/* Records waiting to be sent */
+static Log_Ring g_logRing;
+
+/* UART used to stream the records */
+static const Uart_Config* g_logUartConfig = NULL_PTR;
+
+/* Encoded record being sent and its progress */
+static uint8  g_logEncoded[LOG_ENCODED_MAX_BYTES];
+static uint16 g_logEncodedLength = 0;
+static uint16 g_logEncodedSent   = 0;
+
+/* Records lost because the ring buffer was full */
+static volatile uint32 g_logDroppedCount = 0;
+
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * @fn              static uint16 Log_CobsEncode(const uint8* Source, uint16 Length, uint8* Destination)
+ * @brief           Function to COBS encode one record and terminate it with 0x00
+ * @param (in):     Source      - Raw record
+ *                  Length      - Raw record length (< 254)
+ * @param (out):    Destination - Encoded record (Length + 2 bytes)
+ * @param (inout):  None
+ * @return          Encoded length including the delimiter
+ *******************************************************************************/
+static uint16 Log_CobsEncode(const uint8* Source, uint16 Length, uint8* Destination)
+{
+    /* Position of the current code byte */
+    uint16 CodeIndex = 0;
+
+    /* Next write position */
+    uint16 Write = 1;
+
+    /* Code of the current block */
+    uint8 Code = 1;
+
+    /* Loop counter */
+    uint16 Index = 0;
+
+    for(Index = 0; Index < Length; Index++)
+    {
+        if(LOG_COBS_DELIMITER == Source[Index])
+        {
+            /* Close the block, the zero is implicit */
+            Destination[CodeIndex] = Code;
+            CodeIndex = Write;
+            Write++;
+            Code = 1;
+        }
+        else
+        {
+            Destination[Write] = Source[Index];
+            Write++;
+            Code++;
+        }
+    }
+
+    Destination[CodeIndex] = Code;
+    Destination[Write]     = LOG_COBS_DELIMITER;
+
+    return (uint16)(Write + 1U);
+}
+
+/*******************************************************************************
+ * @fn              static uint8 Log_Pop(void)
+ * @brief           Function to take the oldest record from the ring buffer
+ *                  and encode it to g_logEncoded
+ * @param (in):     None
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          TRUE if a record was taken, FALSE if the ring buffer is empty
+ *******************************************************************************/
+static uint8 Log_Pop(void)
+{
+    /* Raw record (little endian) */
+    uint8 Record[LOG_RECORD_MAX_BYTES];
+
+    /* Local copy of the consumer index */
+    uint16 Tail = g_logRing.Tail;
+
+    /* Number of words of the record (Format + Args) */
+    uint32 Words = 0;
+
+    /* Word being serialized */
+    uint32 Word = 0;
+
+    /* Loop counter */
+    uint32 Index = 0;
+
+    if(Tail == g_logRing.Head)
+    {
+        return FALSE;
+    }
+
+    Words = g_logRing.Buffer[Tail & LOG_RING_MASK] + 1U;
+    Tail++;
+
+    for(Index = 0; Index < Words; Index++)
+    {
+        Word = g_logRing.Buffer[Tail & LOG_RING_MASK];
+        Tail++;
+
+        Record[(4U * Index) + 0U] = (uint8)(Word);
+        Record[(4U * Index) + 1U] = (uint8)(Word >> 8);
+        Record[(4U * Index) + 2U] = (uint8)(Word >> 16);
+        Record[(4U * Index) + 3U] = (uint8)(Word >> 24);
+    }
+
+    /* Release the words to the producers */
+    g_logRing.Tail = Tail;
+
+    g_logEncodedLength = Log_CobsEncode(Record, (uint16)(4U * Words), g_logEncoded);
+    g_logEncodedSent   = 0;
+
+    return TRUE;
+}
+
+
+/*******************************************************************************
+ *                      Public Functions Definitions                           *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * @fn              uint8 Log_Init(const Uart_Config* UartConfig)
+ * @brief           Function to choose the UART used to stream the records
+ * @note            UART MUST be initialized and its NVIC interrupt enabled,
+ *                  records are sent with Uart_Write()
+ * @param (in):     UartConfig - Pointer to UART configuration set
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Return Status
+ *******************************************************************************/
+uint8 Log_Init(const Uart_Config* UartConfig)
+{
+    if(NULL_PTR == UartConfig)
+    {
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    g_logUartConfig    = UartConfig;
+    g_logRing.Head     = 0;
+    g_logRing.Tail     = 0;
+    g_logEncodedLength = 0;
+    g_logEncodedSent   = 0;
+    g_logDroppedCount  = 0;
+
+    return RET_OK;
+}
+
+/*******************************************************************************
+ * @fn              void Log_Write(const char* Format, uint32 ArgCount,
+ *                                 uint32 Arg0, uint32 Arg1, uint32 Arg2, uint32 Arg3)
+ * @brief           Function to record one log message (use LOG0..LOG4 macros)
+ *                  It only copies up to 6 words, so it is safe and cheap in
+ *                  interrupt context. The record is dropped if there is no space
+ * @param (in):     Format   - Format string literal (its address is recorded)
+ *                  ArgCount - Number of used arguments (0 -> 4)
+ *                  Arg0..3  - Raw 32-bit arguments
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+void Log_Write(const char* Format, uint32 ArgCount, uint32 Arg0, uint32 Arg1, uint32 Arg2, uint32 Arg3)
+{
+    /* Saved PRIMASK */
+    uint32 Key = 0;
+
+    /* Local copy of the producer index */
+    uint16 Head = 0;
+
+    if(ArgCount > LOG_MAX_ARGS)
+    {
+        ArgCount = LOG_MAX_ARGS;
+    }
+
+    Key  = LOG_ENTER_CRITICAL();
+    Head = g_logRing.Head;
+
+    /* All argument slots are written (no branch per argument), so room for a full record is needed */
+    if( (uint16)(LOG_RING_WORDS - (uint16)(Head - g_logRing.Tail)) < (LOG_RECORD_HEADER_WORDS + LOG_MAX_ARGS) )
+    {
+        g_logDroppedCount++;
+        LOG_EXIT_CRITICAL(Key);
+        return;
+    }
+
+    g_logRing.Buffer[(uint16)(Head + 0U) & LOG_RING_MASK] = ArgCount;
+    g_logRing.Buffer[(uint16)(Head + 1U) & LOG_RING_MASK] = (uint32)Format;
+    g_logRing.Buffer[(uint16)(Head + 2U) & LOG_RING_MASK] = Arg0;
+    g_logRing.Buffer[(uint16)(Head + 3U) & LOG_RING_MASK] = Arg1;
+    g_logRing.Buffer[(uint16)(Head + 4U) & LOG_RING_MASK] = Arg2;
+    g_logRing.Buffer[(uint16)(Head + 5U) & LOG_RING_MASK] = Arg3;
+
+    /* Unused argument slots are free again for the next record */
+    g_logRing.Head = (uint16)(Head + LOG_RECORD_HEADER_WORDS + ArgCount);
+
+    LOG_EXIT_CRITICAL(Key);
+}
+
+/*******************************************************************************
+ * @fn              void Log_Process(void)
+ * @brief           Function to stream the recorded messages to the UART
+ *                  It never waits: it queues what fits in the UART Tx ring
+ *                  buffer and continues on the next call
+ * @note            Call it from the background loop (not from interrupts)
+ * @param (in):     None
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+void Log_Process(void)
+{
+    if(NULL_PTR == g_logUartConfig)
+    {
+        return;
+    }
+
+    while(1)
+    {
+        /* Finish the record being sent first */
+        if(g_logEncodedSent < g_logEncodedLength)
+        {
+            g_logEncodedSent += Uart_Write(g_logUartConfig, &g_logEncoded[g_logEncodedSent],
+                                           (uint16)(g_logEncodedLength - g_logEncodedSent));
+            if(g_logEncodedSent < g_logEncodedLength)
+            {
+                /* UART Tx ring buffer is full */
+                return;
+            }
+        }
+
+        if(Log_Pop() == FALSE)
+        {
+            return;
+        }
+    }
+}
+
+/*******************************************************************************
+ * @fn              uint32 Log_GetDroppedCount(void)
+ * @brief           Function to get number of records lost because the ring
+ *                  buffer was full
+ * @param (in):     None
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Number of dropped records
+ *******************************************************************************/
+uint32 Log_GetDroppedCount(void)
+{
+    return g_logDroppedCount;
+}
@@ -4,12 +4,6 @@
  * @date          15/8/2021
  * @author        Islam Ehab Ezzat
  * @version       1.0.0
- * @note          This driver still under development, so it doesn't support:
- *                - uDMA Mode
- *                - Remaining Interrupts handling
- *                - Handling Interrupts from UART1 -> UART7
- *                - FIFO Mode
- *                - 9-Bit Mode
  *******************************************************************************/
 
 #ifndef DRIVERS_UART_UART_INIT_H_
@@ -31,10 +25,36 @@
 #define PARITY_MODE_EVEN            (1U)
 #define PARITY_MODE_ODD             (2U)
 
-/* Define used to choose FIFO Mode (Future work)    */
+/* Define used to choose FIFO Mode                  */
 #define FIFO_MODE_DISABLE           (0U)
 #define FIFO_MODE_ENABLE            (1U)
 
+/* Define used to choose Rx/Tx FIFO interrupt trigger level (Value on Data sheet)
+ * Rx interrupt fires when Rx FIFO becomes >= level,
+ * Tx interrupt fires when Tx FIFO becomes <= level                              */
+#define FIFO_LEVEL_1_8              (0U)    /* 2  bytes of 16 */
+#define FIFO_LEVEL_1_4              (1U)    /* 4  bytes of 16 */
+#define FIFO_LEVEL_1_2              (2U)    /* 8  bytes of 16 */
+#define FIFO_LEVEL_3_4              (3U)    /* 12 bytes of 16 */
+#define FIFO_LEVEL_7_8              (4U)    /* 14 bytes of 16 */
+
+/* Define used to choose Flow Control Mode
+ * - UART1: hardware RTS/CTS (RTS driven by Rx FIFO level)
+ * - Others: software RTS on a GPIO pin driven by Rx ring buffer occupancy */
+#define FLOW_CONTROL_DISABLE        (0U)
+#define FLOW_CONTROL_ENABLE         (1U)
+
+/* Maximum accepted baud rate error in ppm (Uart_Init fails above it) */
+#define UART_BAUD_RATE_MAX_ERROR_PPM    (20000)     /* 2 % */
+
+/* Autobaud detection status (@ref UART_AUTOBAUD)
+ * Sender MUST send the sync character 'U' (0x55), 8 data bits, no parity */
+#define UART_AUTOBAUD_IDLE          (0U)
+#define UART_AUTOBAUD_RUNNING       (1U)
+#define UART_AUTOBAUD_DONE          (2U)
+#define UART_AUTOBAUD_FAILED        (3U)
+#define UART_AUTOBAUD_MEASURED      (4U)    /* Rate found, waiting for Uart_AutoBaudApply() */
+
 /* Define used to choose Baud Rate Clock source     */
 #define CLOCK_SRC_SYSTEM            (0U)
 #define CLOCK_SRC_PIOSC             (5U)    /* Value on Data sheet */
@@ -122,6 +142,36 @@ typedef enum{
  *         Member 'FifoMode' used to enable or disable FIFO Tx, Rx
  *         you can find this value @ref FIFO_MODE
  *
+ * @var    Uart_Config::RxFifoLevel
+ *         Member 'RxFifoLevel' used to choose Rx FIFO interrupt trigger level
+ *         (used only if FIFO Mode is enabled)
+ *         You can find this value @ref FIFO_LEVEL
+ *
+ * @var    Uart_Config::TxFifoLevel
+ *         Member 'TxFifoLevel' used to choose Tx FIFO interrupt trigger level
+ *         (used only if FIFO Mode is enabled)
+ *         You can find this value @ref FIFO_LEVEL
+ *
+ * @var    Uart_Config::NineBitAddress
+ *         Member 'NineBitAddress' used as node address in 9-Bit Mode
+ *         (used only if WordLength is NineBits)
+ *
+ * @var    Uart_Config::NineBitAddressMask
+ *         Member 'NineBitAddressMask' used to choose which address bits are
+ *         compared in 9-Bit Mode (0xFF means exact match)
+ *
+ * @var    Uart_Config::FlowControl
+ *         Member 'FlowControl' used to enable or disable RTS/CTS flow control
+ *         You can find this value @ref FLOW_CONTROL
+ *
+ * @var    Uart_Config::RtsGpioBase
+ *         Member 'RtsGpioBase' used to choose GPIO port base address of the
+ *         software RTS pin (not used by UART1)
+ *         @note The pin MUST be configured as digital output by the application
+ *
+ * @var    Uart_Config::RtsGpioPin
+ *         Member 'RtsGpioPin' used to choose the software RTS pin number (0 -> 7)
+ *
  * @var    Uart_Config::ClkSrc
  *         Member 'ClkSrc' used to decide what is the baud rate clock
  *         source (system clk or PIOSC)
@@ -162,17 +212,103 @@ typedef struct{
                                         FIFO Tx, Rx
                                         you can find this value @ref FIFO_MODE        */
 
+    uint8           RxFifoLevel;    /** Member 'RxFifoLevel' used to choose Rx FIFO
+                                        interrupt trigger level (FIFO Mode only)
+                                        You can find this value @ref FIFO_LEVEL       */
+
+    uint8           TxFifoLevel;    /** Member 'TxFifoLevel' used to choose Tx FIFO
+                                        interrupt trigger level (FIFO Mode only)
+                                        You can find this value @ref FIFO_LEVEL       */
+
+    uint8           NineBitAddress; /** Member 'NineBitAddress' used as node address
+                                        in 9-Bit Mode (NineBits word length only)     */
+
+    uint8           NineBitAddressMask; /** Member 'NineBitAddressMask' used to choose
+                                        which address bits are compared in 9-Bit Mode
+                                        (0xFF means exact match)                      */
+
+    uint8           FlowControl;    /** Member 'FlowControl' used to enable or disable
+                                        RTS/CTS flow control
+                                        You can find this value @ref FLOW_CONTROL     */
+
+    uint32          RtsGpioBase;    /** Member 'RtsGpioBase' used to choose GPIO port
+                                        base address of software RTS pin (not UART1)  */
+
+    uint8           RtsGpioPin;     /** Member 'RtsGpioPin' used to choose software
+                                        RTS pin number (0 -> 7)                       */
+
     uint8           ClkSrc;         /** Member 'ClkSrc' used to decide what is the baud
                                         rate clock source (system clk or PIOSC)
                                         You can find this value @ref CLOCK_SRC        */
 }Uart_Config;
 
 
+/*******************************************************************************
+ * @struct Uart_Stats
+ *
+ * @brief  Structure holds statistics of one UART instance since Uart_Init()
+ *         or since the last reset by Uart_GetStats()
+ ******************************************************************************/
+typedef struct{
+    uint32  TxBytes;            /* Bytes written to the Tx FIFO (ring, polling or uDMA)   */
+    uint32  RxBytes;            /* Bytes read from the Rx FIFO (ring, polling or uDMA)    */
+    uint32  OverrunErrors;      /* Characters flagged with Rx FIFO overrun                */
+    uint32  FramingErrors;      /* Characters flagged with framing error                  */
+    uint32  ParityErrors;       /* Characters flagged with parity error                   */
+    uint32  BreakErrors;        /* Break conditions received                              */
+    uint32  RxRingOverflows;    /* Bytes dropped because the Rx ring buffer was full      */
+    uint32  IsrCount;           /* UART ISR entries                                       */
+    uint64  IsrCycles;          /* CPU cycles spent in UART ISR (DWT cycle counter)       */
+    uint16  RxFifoHighWater;    /* Max bytes drained from the Rx FIFO in one ISR entry    */
+    uint16  RxRingHighWater;    /* Max bytes waiting in the Rx ring buffer                */
+    uint16  TxRingHighWater;    /* Max bytes waiting in the Tx ring buffer                */
+}Uart_Stats;
+
+
+/*******************************************************************************
+ * @struct Uart_Handle
+ *
+ * @brief  Structure holds an opened UART instance (returned by Uart_Open())
+ *         It caches everything the per byte functions need, so they don't
+ *         resolve the instance from its configuration on every call
+ ******************************************************************************/
+typedef struct{
+    volatile uint32*        Base;       /* UART base address                */
+    volatile uint32*        DataReg;    /* UARTDR address                   */
+    volatile uint32*        FlagReg;    /* UARTFR address                   */
+    volatile Uart_Stats*    Stats;      /* Statistics of this instance      */
+    Uart_Instance           UartNum;    /* UART instance                    */
+}Uart_Handle;
+
+
 //void UART0ISR(void);
 uint8 Uart_Init(const Uart_Config* ConfigPtr);
+const Uart_Handle* Uart_Open(const Uart_Config* ConfigPtr);
+void Uart_PutChar(const Uart_Handle* Handle, uint8 Data);
+uint8 Uart_GetChar(const Uart_Handle* Handle);
+void Uart_PutString(const Uart_Handle* Handle, const uint8* String);
+uint8 Uart_GetBaudRate(const Uart_Config* ConfigPtr, uint32* AchievedBaudRate, sint32* ErrorPpm);
+uint8 Uart_ChangeBaudRate(const Uart_Config* ConfigPtr, uint32 BaudRate);
+uint8 Uart_AutoBaudStart(const Uart_Config* ConfigPtr, uint32 TimestampClock);
+uint8 Uart_AutoBaudEdge(Uart_Instance UartNum, uint32 Timestamp, uint8 Level);
+uint8 Uart_AutoBaudApply(Uart_Instance UartNum);
+uint32 Uart_AutoBaudGetRate(Uart_Instance UartNum);
 void Uart0_SetCallBack(void (*f_ptr)(void));
+uint8 Uart_SetCallBack(Uart_Instance UartNum, Uart_Interrupts Interrupt, void (*f_ptr)(void));
 uint8 Uart_ReceiveIT(const Uart_Config* ConfigPtr);
+uint16 Uart_Read(const Uart_Config* ConfigPtr, uint8* Buffer, uint16 Length);
+uint16 Uart_Peek(const Uart_Config* ConfigPtr, const uint8** Data);
+void Uart_Consume(const Uart_Config* ConfigPtr, uint16 Length);
+uint32 Uart_GetOverrunCount(Uart_Instance UartNum);
+uint8 Uart_GetStats(Uart_Instance UartNum, Uart_Stats* Stats, uint8 Reset);
 uint8 Uart_Receive(const Uart_Config* ConfigPtr);
 uint8 Uart_Transmit(const Uart_Config* ConfigPtr, const uint8 Data);
+uint16 Uart_Write(const Uart_Config* ConfigPtr, const uint8* Buffer, uint16 Length);
+uint8 Uart_SetTxSource(Uart_Instance UartNum, uint16 (*Peek)(Uart_Instance UartNum, const uint8** Data),
+                       void (*Consume)(Uart_Instance UartNum, uint16 Length));
+void Uart_TxKick(Uart_Instance UartNum);
+uint16 Uart_SendAddressed(const Uart_Config* ConfigPtr, uint8 Address, const uint8* Buffer, uint16 Length);
 void Uart_SendString (const Uart_Config* ConfigPtr, const uint8* String);
+uint8 Uart_TransmitDMA(const Uart_Config* ConfigPtr, const uint8* Buffer, uint32 Length, void (*CallBack)(void));
+uint8 Uart_ReceiveDMA(const Uart_Config* ConfigPtr, uint8* Buffer, uint32 Length, void (*CallBack)(void));
 #endif /* DRIVERS_UART_UART_INIT_H_ */
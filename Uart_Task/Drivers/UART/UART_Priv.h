@@ -4,12 +4,6 @@
  * @date          16/8/2021
  * @author        Islam Ehab Ezzat
  * @version       1.0.0
- * @note          This driver still under development, so it doesn't support:
- *                - uDMA Mode
- *                - Remaining Interrupts handling
- *                - Handling Interrupts from UART1 -> UART7
- *                - FIFO Mode
- *                - 9-Bit Mode
  *
  *******************************************************************************/
 
@@ -17,6 +11,9 @@
 #ifndef DRIVERS_UART_UART_PRIV_H_
 #define DRIVERS_UART_UART_PRIV_H_
 
+#include "std_types.h"
+#include "UART_Init.h"
+
 
 /************************** UART_CTL Register defines *****************************/
 #define CTL_REG_UARTEN_POS              ((uint8) 0x0)   /* Uart Enable Bit Position                 */
@@ -46,6 +43,14 @@
 #define CTL_REG_CTSEN_ENABLE            ((uint8) 0x1)   /* Enable Clear To Send                     */
 
 
+/************************** UART_DR Register defines *****************************/
+#define DR_REG_DATA_MASK                ((uint32) 0xFF) /* UART Data Transmitted or Received Bits Mask  */
+#define DR_REG_FE_POS                   ((uint8) 0x8)   /* UART Framing Error Bit Position              */
+#define DR_REG_PE_POS                   ((uint8) 0x9)   /* UART Parity Error Bit Position               */
+#define DR_REG_BE_POS                   ((uint8) 0xA)   /* UART Break Error Bit Position                */
+#define DR_REG_OE_POS                   ((uint8) 0xB)   /* UART Overrun Error Bit Position              */
+#define DR_REG_ERRORS_MASK              ((uint32) 0xF00)/* UART FE, PE, BE and OE Bits Mask             */
+
 /************************** UART_LCRH Register defines *****************************/
 #define LCRH_REG_BRK_POS                ((uint8) 0x0)   /* UART Send Break Bit Position             */
 #define LCRH_REG_PEN_POS                ((uint8) 0x1)   /* UART Parity Enable bit position          */
@@ -63,13 +68,82 @@
 #define LCRH_REG_STP2_ENABLE            ((uint8) 0x1)   /* UART Two Stop Bits enable value          */
 #define LCRH_REG_FEN_ENABLE             ((uint8) 0x1)   /* UART FIFOs enable value                  */
 
+#define LCRH_REG_SPS_ENABLE            ((uint8) 0x1)   /* UART Stick Parity enable value           */
+
+/* 9-Bit Mode data byte: 9th bit (stick parity) = 0 */
+#define LCRH_9BIT_DATA_BYTE             ( (LCRH_REG_PEN_ENABLE << LCRH_REG_PEN_POS) | \
+                                          (LCRH_REG_EPS_EVEN   << LCRH_REG_EPS_POS) | \
+                                          (LCRH_REG_SPS_ENABLE << LCRH_REG_SPS_POS) )
+
 /************************** UART_9BITADDR Register defines *****************************/
+#define NINEBITADDR_REG_ADDR_POS        ((uint8) 0x0)   /* UART Self Address for 9-Bit Mode Bits Position */
 #define NINEBITADDR_REG_9BITEN_POS      ((uint8) 0xF)   /* UART Enable 9-Bit Mode Bit Position      */
 
 #define NINEBITADDR_REG_9BITEN_ENABLE   ((uint8) 0x1)   /* UART 9-Bit Mode enable value             */
 
+/************************** UART_9BITAMASK Register defines *****************************/
+#define NINEBITAMASK_REG_MASK_POS       ((uint8) 0x0)   /* UART Self Address Mask for 9-Bit Mode Bits Position */
+
 /************************** UART_IM Register defines *****************************/
-#define IM_REG_RXIM_POS                 ((uint8) 0x4)
+#define IM_REG_RXIM_POS                 ((uint8) 0x4)   /* UART Receive Interrupt Mask Bit Position                     */
+#define IM_REG_TXIM_POS                 ((uint8) 0x5)   /* UART Transmit Interrupt Mask Bit Position                    */
+
+#define IM_REG_RTIM_POS                 ((uint8) 0x6)   /* UART Receive Time-Out Interrupt Mask Bit Position            */
+
+/************************** UART_MIS Register defines *****************************/
+#define MIS_REG_RXMIS_POS               ((uint8) 0x4)   /* Receive Masked Interrupt Status Bit Position                 */
+#define MIS_REG_TXMIS_POS               ((uint8) 0x5)   /* Transmit Masked Interrupt Status Bit Position                */
+#define MIS_REG_RTMIS_POS               ((uint8) 0x6)   /* Receive Time-Out Masked Interrupt Status Bit Position        */
+
+/************************** UART_ICR Register defines *****************************/
+#define ICR_REG_RXIC_POS                ((uint8) 0x4)   /* Receive Interrupt Clear Bit Position                         */
+#define ICR_REG_TXIC_POS                ((uint8) 0x5)   /* Transmit Interrupt Clear Bit Position                        */
+#define ICR_REG_RTIC_POS                ((uint8) 0x6)   /* Receive Time-Out Interrupt Clear Bit Position                */
+
+/************************** UART_IFLS Register defines *****************************/
+#define IFLS_REG_TXIFLSEL_POS           ((uint8) 0x0)   /* UART Transmit Interrupt FIFO Level Select Bits Position      */
+#define IFLS_REG_RXIFLSEL_POS           ((uint8) 0x3)   /* UART Receive Interrupt FIFO Level Select Bits Position       */
+
+/* Number of interrupt causes bits in UARTIM/UARTMIS/UARTICR (Bit 0 -> Bit 12) */
+#define UART_INTERRUPT_CAUSES           (13U)
+
+/* Instance handle with register addresses computed at compile time */
+#define UART_HANDLE_ENTRY(NUM, BASE, STATS)                                     \
+    { (volatile uint32*)(BASE),                                                 \
+      (volatile uint32*)((BASE) + UART_DATA_REG_OFFSET),                        \
+      (volatile uint32*)((BASE) + UART_FR_REG_OFFSET),                          \
+      &(STATS)[NUM],                                                            \
+      (NUM) }
+
+/* Count leading zeros (single CLZ instruction on Cortex-M4) */
+#if defined(__TI_ARM__)
+#define UART_COUNT_LEADING_ZEROS(VALUE) ((uint32)_norm(VALUE))
+#else
+#define UART_COUNT_LEADING_ZEROS(VALUE) ((uint32)__builtin_clz(VALUE))
+#endif
+
+/************************** Core debug defines (ISR cycle measurement) *****************************/
+#define DEMCR_REG_TRCENA_POS            ((uint8) 0x18)  /* Trace Enable (DWT) Bit Position              */
+#define DWT_CTRL_REG_CYCCNTENA_POS      ((uint8) 0x0)   /* Cycle Counter Enable Bit Position            */
+
+/* Current value of the free running DWT cycle counter */
+#define UART_CYCLE_COUNTER()            (*(volatile uint32*)UART_DWT_CYCCNT_REG_ADDRESS)
+
+/* Mask/restore IRQs (PRIMASK), used for the statistics snapshot/reset and for UARTIM
+ * read-modify-writes done outside the ISRs */
+#if defined(__TI_ARM__)
+#define UART_ENTER_CRITICAL()           ((uint32)_disable_interrupts())
+#define UART_EXIT_CRITICAL(KEY)         ((void)_restore_interrupts(KEY))
+#elif defined(__GNUC__) && defined(__ARM_ARCH)
+#define UART_ENTER_CRITICAL()           __extension__({ uint32 Key_; __asm volatile ("mrs %0, primask\n\tcpsid i" : "=r" (Key_) : : "memory"); Key_; })
+#define UART_EXIT_CRITICAL(KEY)         __asm volatile ("msr primask, %0" : : "r" (KEY) : "memory")
+#elif defined(HOST_TEST)
+#include "Test_Critical.h"
+#define UART_ENTER_CRITICAL()           Test_EnterCritical()
+#define UART_EXIT_CRITICAL(KEY)         Test_ExitCritical(KEY)
+#else
+#error "UART: no critical section (PRIMASK) implementation for this toolchain"
+#endif
 
 /************************** UART_RIS Register defines *****************************/
 #define RIS_REG_CTSRIS_POS              ((uint8) 0x1)   /* UART Clear to Send Modem Raw Interrupt Status Bit Position   */
@@ -87,7 +161,7 @@
 #define FR_REG_CTS_POS                  ((uint8) 0x0)   /* Clear To Send Flag Bit Position                              */
 #define FR_REG_BUSY_POS                 ((uint8) 0x3)   /* UART Busy Flag Bit Position                                  */
 #define FR_REG_RXFE_POS                 ((uint8) 0x4)   /* Receive FIFO Empty Flag Bit Position                         */
-#define FR_REG_TXFE_POS                 ((uint8) 0x5)   /* Transmit FIFO Full Flag Bit Position                         */
+#define FR_REG_TXFF_POS                 ((uint8) 0x5)   /* Transmit FIFO Full Flag Bit Position                         */
 #define FR_REG_RXFF_POS                 ((uint8) 0x6)   /* Receive FIFO Full Flag Bit Position                          */
 #define FR_REG_TXFE_POS                 ((uint8) 0x7)   /* Transmit FIFO Empty Flag Bit Position                        */
 
@@ -95,9 +169,211 @@
 #define FR_REG_CTS_ENABLE               ((uint8) 0x1)   /* Clear To Send Flag Enable Value                              */
 #define FR_REG_BUSY_ENABLE              ((uint8) 0x1)   /* UART Busy Flag Enable Value                                  */
 #define FR_REG_RXFE_ENABLE              ((uint8) 0x1)   /* Receive FIFO Empty Flag Enable Value                         */
-#define FR_REG_TXFE_ENABLE              ((uint8) 0x1)   /* Transmit FIFO Full Flag Enable Value                         */
+#define FR_REG_TXFF_ENABLE              ((uint8) 0x1)   /* Transmit FIFO Full Flag Enable Value                         */
 #define FR_REG_RXFF_ENABLE              ((uint8) 0x1)   /* Receive FIFO Full Flag Enable Value                          */
 #define FR_REG_TXFE_ENABLE              ((uint8) 0x1)   /* Transmit FIFO Empty Flag Enable Value                        */
 
+/************************** UART_DMACTL Register defines *****************************/
+#define DMACTL_REG_RXDMAE_POS           ((uint8) 0x0)   /* Receive DMA Enable Bit Position                              */
+#define DMACTL_REG_TXDMAE_POS           ((uint8) 0x1)   /* Transmit DMA Enable Bit Position                             */
+#define DMACTL_REG_DMAERR_POS           ((uint8) 0x2)   /* DMA on Error Bit Position                                    */
+
+/************************** UART uDMA Channels defines *****************************/
+/* uDMA channel assignments of each UART (See Data sheet page 587) */
+#define UART0_DMA_RX_CHANNEL            ((uint8) 8U)
+#define UART0_DMA_TX_CHANNEL            ((uint8) 9U)
+#define UART0_DMA_ENCODING              ((uint8) 0U)
+#define UART1_DMA_RX_CHANNEL            ((uint8) 22U)
+#define UART1_DMA_TX_CHANNEL            ((uint8) 23U)
+#define UART1_DMA_ENCODING              ((uint8) 0U)
+#define UART2_DMA_RX_CHANNEL            ((uint8) 12U)
+#define UART2_DMA_TX_CHANNEL            ((uint8) 13U)
+#define UART2_DMA_ENCODING              ((uint8) 1U)
+#define UART3_DMA_RX_CHANNEL            ((uint8) 16U)
+#define UART3_DMA_TX_CHANNEL            ((uint8) 17U)
+#define UART3_DMA_ENCODING              ((uint8) 2U)
+#define UART4_DMA_RX_CHANNEL            ((uint8) 18U)
+#define UART4_DMA_TX_CHANNEL            ((uint8) 19U)
+#define UART4_DMA_ENCODING              ((uint8) 2U)
+#define UART5_DMA_RX_CHANNEL            ((uint8) 6U)
+#define UART5_DMA_TX_CHANNEL            ((uint8) 7U)
+#define UART5_DMA_ENCODING              ((uint8) 2U)
+#define UART6_DMA_RX_CHANNEL            ((uint8) 10U)
+#define UART6_DMA_TX_CHANNEL            ((uint8) 11U)
+#define UART6_DMA_ENCODING              ((uint8) 2U)
+#define UART7_DMA_RX_CHANNEL            ((uint8) 20U)
+#define UART7_DMA_TX_CHANNEL            ((uint8) 21U)
+#define UART7_DMA_ENCODING              ((uint8) 2U)
+
+/************************** UART Baud Rate defines *****************************/
+/* Baud rate clock divider (UARTCTL.HSE disabled -> 16, enabled -> 8) */
+#define UART_CLKDIV_NORMAL              (16U)
+#define UART_CLKDIV_HIGH_SPEED          (8U)
+
+/* Limits of the 22-bit divisor (IBRD:FBRD) in 1/64 units (See Data sheet page 896) */
+#define UART_BRD_DIV64_MIN              ((uint32) 64U)          /* IBRD = 1             */
+#define UART_BRD_DIV64_MAX              ((uint32) 0x3FFFFFU)    /* IBRD = 65535, FBRD=63 */
+#define FBRD_REG_DIVFRAC_BITS           ((uint8) 0x6)           /* FBRD width in bits    */
+#define FBRD_REG_DIVFRAC_MASK           ((uint32) 0x3FU)
+
+/* Rounded baud rate divisor in 1/64 units: round(CLK * 64 / (CLKDIV * BAUD)) */
+#define UART_BRD_DIV64(CLK, BAUD, CLKDIV) \
+    ( ( ( (uint32)(CLK) * (128U / (CLKDIV)) ) / (uint32)(BAUD) + 1U ) / 2U )
+
+/* Precomputed divisor table entry (ClkDiv = 16, chosen for better noise immunity) */
+#define UART_BAUD_TABLE_ENTRY(CLK, BAUD) \
+    { (CLK), (BAUD), \
+      (uint16)(UART_BRD_DIV64(CLK, BAUD, UART_CLKDIV_NORMAL) >> FBRD_REG_DIVFRAC_BITS), \
+      (uint8) (UART_BRD_DIV64(CLK, BAUD, UART_CLKDIV_NORMAL) &  FBRD_REG_DIVFRAC_MASK), \
+      FALSE }
+
+/* Common system clocks in the precomputed table */
+#define UART_TABLE_CLK_PIOSC_16MHZ      (16000000U)
+#define UART_TABLE_CLK_PLL_50MHZ        (50000000U)
+#define UART_TABLE_CLK_PLL_80MHZ        (80000000U)
+
+
+/*******************************************************************************
+ * @struct Uart_BaudDivisor
+ *
+ * @brief  Structure holds UART baud rate divisor of one Clock/BaudRate pair
+ ******************************************************************************/
+typedef struct{
+    uint32 ClkValue;        /* Baud rate clock frequency in Hz              */
+    uint32 BaudRate;        /* Requested baud rate                          */
+    uint16 Ibrd;            /* Integer part of the divisor (UARTIBRD)       */
+    uint8  Fbrd;            /* Fractional part of the divisor (UARTFBRD)    */
+    uint8  Hse;             /* TRUE if ClkDiv = 8 (UARTCTL.HSE)             */
+}Uart_BaudDivisor;
+
+/************************** UART Busy-wait bound defines *****************************/
+/* Longest character: start bit, 9 data bits and 2 stop bits */
+#define UART_CHARACTER_BITS_MAX         (12UL)
+
+/* Characters which can be ahead of a new one in hardware: Tx FIFO and shift register */
+#define UART_TX_HW_CHARACTERS           (17UL)
+
+/************************** UART Ring Buffers defines *****************************/
+/* Size of the software Tx/Rx ring buffers of each UART instance (MUST be a power of 2) */
+#define UART_RING_BUFFER_SIZE           ((uint16) 128U)
+#define UART_RING_BUFFER_MASK           ((uint16) (UART_RING_BUFFER_SIZE - 1U))
+
+
+/*******************************************************************************
+ * @struct Uart_RingBuffer
+ *
+ * @brief  Single Producer / Single Consumer ring buffer
+ *         - Tx: producer is Uart_Write(), consumer is the Tx interrupt
+ *         - Rx: producer is the Rx interrupt, consumer is Uart_Read()
+ *         The producer only writes 'Head' and the consumer only writes 'Tail',
+ *         so no locking is needed.
+ *         Both indices are free running and wrapped with UART_RING_BUFFER_MASK
+ ******************************************************************************/
+typedef struct{
+    uint8           Buffer[UART_RING_BUFFER_SIZE];  /* Bytes stored in the ring         */
+    volatile uint16 Head;                           /* Next free slot (producer index)  */
+    volatile uint16 Tail;                           /* Next byte to take (consumer)     */
+}Uart_RingBuffer;
+
+
+/************************** UART Flow Control defines *****************************/
+/* Only UART1 has RTS/CTS modem signals (See Data sheet page 895) */
+#define UART_HARDWARE_FLOW_CONTROL_INSTANCE     Uart1
+
+/* Rx ring buffer occupancy thresholds of software RTS */
+#define UART_RX_HIGH_WATER_MARK         ((uint16) ((UART_RING_BUFFER_SIZE * 3U) / 4U))  /* Deassert RTS at/above it */
+#define UART_RX_LOW_WATER_MARK          ((uint16) (UART_RING_BUFFER_SIZE / 4U))         /* Assert RTS at/below it   */
+
+/* Masked GPIODATA address which reads/writes only one pin (See Data sheet page 654) */
+#define UART_GPIO_DATA_PIN_ADDRESS(BASE, PIN)   ((uint32)(BASE) + ((1UL << (PIN)) << 2))
+
+/* RTS pin is active low: LOW means ready to receive */
+#define UART_RTS_GPIO_READY             ((uint32) 0x00)
+#define UART_RTS_GPIO_STOP              ((uint32) 0xFF)
+
+
+/*******************************************************************************
+ * @struct Uart_FlowControlState
+ *
+ * @brief  Structure holds software RTS state of one UART instance
+ ******************************************************************************/
+typedef struct{
+    uint32          RtsPinAddress;      /* Masked GPIODATA address of RTS pin (0 on UART1)  */
+    uint8           Software;           /* TRUE if RTS is driven from Rx ring occupancy     */
+    volatile uint8  RtsStopped;         /* TRUE while RTS tells the sender to stop          */
+}Uart_FlowControlState;
+
+
+/*******************************************************************************
+ * @struct Uart_TxSource
+ *
+ * @brief  Structure holds the external Tx data source of one UART instance
+ *         (registered by Uart_SetTxSource())
+ ******************************************************************************/
+typedef struct{
+    uint16 (*Peek)(Uart_Instance UartNum, const uint8** Data);  /* Contiguous bytes ready to send   */
+    void (*Consume)(Uart_Instance UartNum, uint16 Length);      /* Release bytes written to FIFO    */
+}Uart_TxSource;
+
+
+/************************** Autobaud defines *****************************/
+/* Sync character 0x55 gives 10 edges 1 bit apart (start falling edge -> stop rising edge) */
+#define UART_AUTOBAUD_SYNC_EDGES        (10U)
+#define UART_AUTOBAUD_SYNC_BITS         (UART_AUTOBAUD_SYNC_EDGES - 1U)
+
+/* Accepted deviation of each edge interval from the start bit width (1/4 = 25 %) */
+#define UART_AUTOBAUD_EDGE_TOLERANCE_SHIFT  (2U)
+
+/* Measured rate is snapped to a standard rate closer than this (3 %) */
+#define UART_AUTOBAUD_SNAP_PPM          (30000U)
+
+
+/*******************************************************************************
+ * @struct Uart_AutoBaudState
+ *
+ * @brief  Structure holds autobaud detection state of one UART instance
+ *         It is updated from the Rx pin edge interrupt of the application
+ ******************************************************************************/
+typedef struct{
+    const Uart_Config*  Config;         /* Configuration reprogrammed when detection ends   */
+    uint32              TimestampClock; /* Frequency of edge timestamps in Hz               */
+    uint32              FirstEdge;      /* Timestamp of start bit falling edge              */
+    uint32              PreviousEdge;   /* Timestamp of the previous edge                   */
+    uint32              BitTicks;       /* Start bit width                                  */
+    uint32              BaudRate;       /* Detected (and programmed) baud rate              */
+    uint8               Edges;          /* Edges of the sync character seen so far          */
+    volatile uint8      Status;         /* @ref UART_AUTOBAUD                               */
+}Uart_AutoBaudState;
+
+
+/*******************************************************************************
+ * @struct Uart_DmaChannels
+ *
+ * @brief  Structure holds uDMA channels used by one UART instance
+ ******************************************************************************/
+typedef struct{
+    uint8 RxChannel;    /* uDMA channel serving UART Rx requests    */
+    uint8 TxChannel;    /* uDMA channel serving UART Tx requests    */
+    uint8 Encoding;     /* Channel encoding selecting this UART     */
+}Uart_DmaChannels;
+
+
+/*******************************************************************************
+ * @struct Uart_DmaTransfer
+ *
+ * @brief  Structure holds the state of one uDMA transfer (Tx or Rx)
+ *         Transfers longer than UDMA_MAX_TRANSFER_SIZE are split into
+ *         chunks which are re-armed from the UART ISR
+ ******************************************************************************/
+typedef struct{
+    uint8*          Next;               /* First byte of the next chunk             */
+    volatile uint32 Remaining;          /* Bytes not handed to uDMA yet             */
+    volatile uint8  Busy;               /* TRUE while the transfer is running       */
+    volatile uint8  Draining;           /* Last bytes are in Tx FIFO (Tx)           */
+    uint32          SavedMask;          /* Interrupts restored when done            */
+    uint32          SavedEot;           /* End of Transmission mode (Tx)            */
+    void (*CallBack)(void);             /* Called when the whole transfer is done   */
+}Uart_DmaTransfer;
+
 
 #endif /* DRIVERS_UART_UART_PRIV_H_ */
@@ -4,12 +4,6 @@
  * @date          16/8/2021
  * @author        Islam Ehab Ezzat
  * @version       1.0.0
- * @note          This driver still under development, so it doesn't support:
- *                - uDMA Mode
- *                - Remaining Interrupts handling
- *                - Handling Interrupts from UART1 -> UART7
- *                - FIFO Mode
- *                - 9-Bit Mode
  *
  *******************************************************************************/
 
@@ -19,39 +13,136 @@
 #include "UART_Reg.h"
 #include "UART_Priv.h"
 #include "UART_Init.h"
+#include "UDMA_Init.h"
 
 
 /*******************************************************************************
  *                           Global Variables                                  *
  *******************************************************************************/
-/* Global variables to hold the address of the call back function for UART0 in the application */
-static volatile void (*g_callBackPtrUart0Interrupt)(void)      = NULL_PTR;
-
-///* Global variables to hold the address of the call back function for UART Receive in the application */
-//static volatile void (*g_callBackPtrUartReceive)(void)          = NULL_PTR;
-//
-///* Global variables to hold the address of the call back function for UART Transmit in the application */
-//static volatile void (*g_callBackPtrUartTransmit)(void)         = NULL_PTR;
-//
-///* Global variables to hold the address of the call back function for UART Receive Time-Out in the application */
-//static volatile void (*g_callBackPtrUartReceiveTimeOut)(void)   = NULL_PTR;
-//
-///* Global variables to hold the address of the call back function for UART Framing Error in the application */
-//static volatile void (*g_callBackPtrUartFramingError)(void)     = NULL_PTR;
-//
-///* Global variables to hold the address of the call back function for UART Parity Error in the application */
-//static volatile void (*g_callBackPtrUartParityError)(void)      = NULL_PTR;
-//
-///* Global variables to hold the address of the call back function for UART Break Error in the application */
-//static volatile void (*g_callBackPtrUartBreakError)(void)       = NULL_PTR;
-//
-///* Global variables to hold the address of the call back function for UART Overrun Error in the application */
-//static volatile void (*g_callBackPtrUartOverrunError)(void)     = NULL_PTR;
-//
-///* Global variables to hold the address of the call back function for UART 9-Bit Mode in the application */
-//static volatile void (*g_callBackPtrUart9_BitMode)(void)       = NULL_PTR;
-//
-//
+/* Global variables to hold the address of the call back functions in the application
+ * (one per UART instance per interrupt cause, indexed by the cause bit position)     */
+static void (*volatile g_callBackPtrUartInterrupt[UART_NUMBER_OF_INSTANCES][UART_INTERRUPT_CAUSES])(void);
+
+/* Precomputed baud rate divisors of common Clock/BaudRate pairs (Computed at compile time) */
+static const Uart_BaudDivisor g_uartBaudTable[] = {
+    UART_BAUD_TABLE_ENTRY(UART_TABLE_CLK_PIOSC_16MHZ,    9600U),
+    UART_BAUD_TABLE_ENTRY(UART_TABLE_CLK_PIOSC_16MHZ,   19200U),
+    UART_BAUD_TABLE_ENTRY(UART_TABLE_CLK_PIOSC_16MHZ,   38400U),
+    UART_BAUD_TABLE_ENTRY(UART_TABLE_CLK_PIOSC_16MHZ,   57600U),
+    UART_BAUD_TABLE_ENTRY(UART_TABLE_CLK_PIOSC_16MHZ,  115200U),
+    UART_BAUD_TABLE_ENTRY(UART_TABLE_CLK_PIOSC_16MHZ,  230400U),
+    UART_BAUD_TABLE_ENTRY(UART_TABLE_CLK_PIOSC_16MHZ,  460800U),
+    UART_BAUD_TABLE_ENTRY(UART_TABLE_CLK_PIOSC_16MHZ,  921600U),
+    UART_BAUD_TABLE_ENTRY(UART_TABLE_CLK_PIOSC_16MHZ, 1000000U),
+    UART_BAUD_TABLE_ENTRY(UART_TABLE_CLK_PLL_50MHZ,      9600U),
+    UART_BAUD_TABLE_ENTRY(UART_TABLE_CLK_PLL_50MHZ,     19200U),
+    UART_BAUD_TABLE_ENTRY(UART_TABLE_CLK_PLL_50MHZ,     38400U),
+    UART_BAUD_TABLE_ENTRY(UART_TABLE_CLK_PLL_50MHZ,     57600U),
+    UART_BAUD_TABLE_ENTRY(UART_TABLE_CLK_PLL_50MHZ,    115200U),
+    UART_BAUD_TABLE_ENTRY(UART_TABLE_CLK_PLL_50MHZ,    230400U),
+    UART_BAUD_TABLE_ENTRY(UART_TABLE_CLK_PLL_50MHZ,    460800U),
+    UART_BAUD_TABLE_ENTRY(UART_TABLE_CLK_PLL_50MHZ,    921600U),
+    UART_BAUD_TABLE_ENTRY(UART_TABLE_CLK_PLL_50MHZ,   1000000U),
+    UART_BAUD_TABLE_ENTRY(UART_TABLE_CLK_PLL_80MHZ,      9600U),
+    UART_BAUD_TABLE_ENTRY(UART_TABLE_CLK_PLL_80MHZ,     19200U),
+    UART_BAUD_TABLE_ENTRY(UART_TABLE_CLK_PLL_80MHZ,     38400U),
+    UART_BAUD_TABLE_ENTRY(UART_TABLE_CLK_PLL_80MHZ,     57600U),
+    UART_BAUD_TABLE_ENTRY(UART_TABLE_CLK_PLL_80MHZ,    115200U),
+    UART_BAUD_TABLE_ENTRY(UART_TABLE_CLK_PLL_80MHZ,    230400U),
+    UART_BAUD_TABLE_ENTRY(UART_TABLE_CLK_PLL_80MHZ,    460800U),
+    UART_BAUD_TABLE_ENTRY(UART_TABLE_CLK_PLL_80MHZ,    921600U),
+    UART_BAUD_TABLE_ENTRY(UART_TABLE_CLK_PLL_80MHZ,   1000000U)
+};
+
+/* Software Tx ring buffers (one per UART instance) drained by the Tx interrupt */
+static Uart_RingBuffer g_uartTxRing[UART_NUMBER_OF_INSTANCES];
+
+/* Software Rx ring buffers (one per UART instance) filled by the Rx interrupt */
+static Uart_RingBuffer g_uartRxRing[UART_NUMBER_OF_INSTANCES];
+
+/* Software RTS state of each UART instance */
+static Uart_FlowControlState g_uartFlowControl[UART_NUMBER_OF_INSTANCES];
+
+/* External Tx data source of each UART instance, sent after its Tx ring buffer */
+static Uart_TxSource g_uartTxSource[UART_NUMBER_OF_INSTANCES];
+
+/* Autobaud detection state of each UART instance */
+static Uart_AutoBaudState g_uartAutoBaud[UART_NUMBER_OF_INSTANCES];
+
+/* Standard baud rates the detected rate is snapped to */
+static const uint32 g_uartStandardBaudRates[] = {
+    1200U, 2400U, 4800U, 9600U, 14400U, 19200U, 38400U, 57600U, 115200U, 230400U, 460800U, 921600U
+};
+
+/* Statistics of each UART instance (read and reset by Uart_GetStats) */
+static volatile Uart_Stats g_uartStats[UART_NUMBER_OF_INSTANCES];
+
+/* Instance handles indexed by Uart_Instance (register addresses computed at compile time) */
+static const Uart_Handle g_uartHandles[UART_NUMBER_OF_INSTANCES] = {
+    UART_HANDLE_ENTRY(Uart0, UART_0_BASE_ADDRESS, g_uartStats), UART_HANDLE_ENTRY(Uart1, UART_1_BASE_ADDRESS, g_uartStats),
+    UART_HANDLE_ENTRY(Uart2, UART_2_BASE_ADDRESS, g_uartStats), UART_HANDLE_ENTRY(Uart3, UART_3_BASE_ADDRESS, g_uartStats),
+    UART_HANDLE_ENTRY(Uart4, UART_4_BASE_ADDRESS, g_uartStats), UART_HANDLE_ENTRY(Uart5, UART_5_BASE_ADDRESS, g_uartStats),
+    UART_HANDLE_ENTRY(Uart6, UART_6_BASE_ADDRESS, g_uartStats), UART_HANDLE_ENTRY(Uart7, UART_7_BASE_ADDRESS, g_uartStats)
+};
+
+/* uDMA channels of each UART instance */
+static const Uart_DmaChannels g_uartDmaChannels[UART_NUMBER_OF_INSTANCES] = {
+    {UART0_DMA_RX_CHANNEL, UART0_DMA_TX_CHANNEL, UART0_DMA_ENCODING},
+    {UART1_DMA_RX_CHANNEL, UART1_DMA_TX_CHANNEL, UART1_DMA_ENCODING},
+    {UART2_DMA_RX_CHANNEL, UART2_DMA_TX_CHANNEL, UART2_DMA_ENCODING},
+    {UART3_DMA_RX_CHANNEL, UART3_DMA_TX_CHANNEL, UART3_DMA_ENCODING},
+    {UART4_DMA_RX_CHANNEL, UART4_DMA_TX_CHANNEL, UART4_DMA_ENCODING},
+    {UART5_DMA_RX_CHANNEL, UART5_DMA_TX_CHANNEL, UART5_DMA_ENCODING},
+    {UART6_DMA_RX_CHANNEL, UART6_DMA_TX_CHANNEL, UART6_DMA_ENCODING},
+    {UART7_DMA_RX_CHANNEL, UART7_DMA_TX_CHANNEL, UART7_DMA_ENCODING}
+};
+
+/* State of uDMA Tx/Rx transfers of each UART instance */
+static Uart_DmaTransfer g_uartDmaTx[UART_NUMBER_OF_INSTANCES];
+static Uart_DmaTransfer g_uartDmaRx[UART_NUMBER_OF_INSTANCES];
+
+
+/*******************************************************************************
+ *                       Private Functions Prototypes                          *
+ *******************************************************************************/
+static uint16 Uart_TxFifoFill(volatile uint32* Uart_Ptr, Uart_RingBuffer* Ring);
+static uint8 Uart_TxFill(Uart_Instance UartNum, volatile uint32* Uart_Ptr);
+static void Uart_TxIsrHandler(Uart_Instance UartNum, volatile uint32* Uart_Ptr);
+static void Uart_RxIsrHandler(Uart_Instance UartNum, volatile uint32* Uart_Ptr);
+static void Uart_IsrDispatcher(Uart_Instance UartNum);
+static void Uart_RtsSet(Uart_Instance UartNum, uint8 Stop);
+static void Uart_RxRelease(Uart_Instance UartNum, uint16 Tail);
+static uint8 Uart_TxWaitIdle(Uart_Instance UartNum, volatile uint32* Uart_Ptr);
+static uint8 Uart_BaudRateSolve(uint32 ClkValue, uint32 BaudRate, Uart_BaudDivisor* Divisor);
+static uint32 Uart_BaudRateAchieved(const Uart_BaudDivisor* Divisor);
+static sint32 Uart_BaudRateErrorPpm(const Uart_BaudDivisor* Divisor);
+static uint8 Uart_BaudRateCheck(uint32 ClkValue, uint32 BaudRate, Uart_BaudDivisor* Divisor);
+static void Uart_SetBaudRate(volatile uint32* Uart_Ptr, const Uart_BaudDivisor* Divisor);
+static uint32 Uart_AutoBaudMeasure(const Uart_AutoBaudState* AutoBaud);
+static uint8 Uart_AutoBaudFinish(Uart_Instance UartNum);
+static uint32 Uart_DmaTxStart(volatile uint32* Uart_Ptr, uint8 Channel, Uart_DmaTransfer* Transfer);
+static uint32 Uart_DmaRxStart(volatile uint32* Uart_Ptr, uint8 Channel, Uart_DmaTransfer* Transfer);
+static void Uart_DmaTxFinish(volatile uint32* Uart_Ptr, Uart_DmaTransfer* Transfer);
+static void Uart_DmaIsrHandler(Uart_Instance UartNum, volatile uint32* Uart_Ptr);
+
+
+/* Driver handlers of each interrupt cause, indexed by the cause bit position in UARTMIS
+ * (NULL_PTR means the cause is only forwarded to the application call back)            */
+static void (*const g_uartIsrHandlers[UART_INTERRUPT_CAUSES])(Uart_Instance UartNum, volatile uint32* Uart_Ptr) = {
+    NULL_PTR,           /* Bit 0  : Reserved                */
+    NULL_PTR,           /* Bit 1  : Clear To Send Modem     */
+    NULL_PTR,           /* Bit 2  : Reserved                */
+    NULL_PTR,           /* Bit 3  : Reserved                */
+    Uart_RxIsrHandler,  /* Bit 4  : Receive                 */
+    Uart_TxIsrHandler,  /* Bit 5  : Transmit                */
+    Uart_RxIsrHandler,  /* Bit 6  : Receive Time-Out        */
+    NULL_PTR,           /* Bit 7  : Framing Error           */
+    NULL_PTR,           /* Bit 8  : Parity Error            */
+    NULL_PTR,           /* Bit 9  : Break Error             */
+    NULL_PTR,           /* Bit 10 : Overrun Error           */
+    NULL_PTR,           /* Bit 11 : Reserved                */
+    NULL_PTR            /* Bit 12 : 9-Bit Mode              */
+};
 
 
 /*******************************************************************************
@@ -59,7 +150,7 @@ static volatile void (*g_callBackPtrUart0Interrupt)(void)      = NULL_PTR;
  *******************************************************************************/
 
 /*******************************************************************************
- * @fn              void UART0ISR(void)
+ * @fn              void UART0_ISR(void)
  * @brief           Interrupt Service Routine for UART0
  * @param (in):     None
  * @param (out):    None
@@ -68,113 +159,98 @@ static volatile void (*g_callBackPtrUart0Interrupt)(void)      = NULL_PTR;
  *******************************************************************************/
 void UART0_ISR(void)
 {
-    /*** Clear to Send Interrupt is used only in UART1 (See DataSheet Page 929) ***/
-
-    /* Check if Receive Interrupt Occurred */
-    if(BIT_IS_SET( (*(volatile uint32*)(UART_0_BASE_ADDRESS + UART_RIS_REG_OFFSET)), RIS_REG_RXRIS_POS) )
-    {
-        /*
-         * Check if the Pointer not a Null one
-         * To avoid segmentation fault
-         */
-        if(g_callBackPtrUart0Interrupt != NULL_PTR){
-
-            /* Call the Call Back function for Uart0 Receive mode */
-            (*g_callBackPtrUart0Interrupt)();
-        }
-    }
-    /* Check if Transmit Interrupt Occurred */
-    else if(BIT_IS_SET((*(volatile uint32*)(UART_0_BASE_ADDRESS + UART_RIS_REG_OFFSET)), RIS_REG_TXRIS_POS) )
-    {
-        /*
-         * Check if the Pointer not a Null one
-         * To avoid segmentation fault
-         */
-        if(g_callBackPtrUart0Interrupt != NULL_PTR){
-
-            /* Call the Call Back function for Uart0 Transmit mode */
-            (*g_callBackPtrUart0Interrupt)();
-        }
-    }
-    /* Check if Receive Time-Out Interrupt Occurred */
-    else if(BIT_IS_SET((*(volatile uint32*)(UART_0_BASE_ADDRESS + UART_RIS_REG_OFFSET)), RIS_REG_RTRIS_POS) )
-    {
-        /*
-         * Check if the Pointer not a Null one
-         * To avoid segmentation fault
-         */
-        if(g_callBackPtrUart0Interrupt != NULL_PTR){
+    Uart_IsrDispatcher(Uart0);
+}
 
-            /* Call the Call Back function for Uart0 Receive Time-Out mode */
-            (*g_callBackPtrUart0Interrupt)();
-        }
-    }
-    /* Check if Framing Error Interrupt Occurred */
-    else if(BIT_IS_SET((*(volatile uint32*)(UART_0_BASE_ADDRESS + UART_RIS_REG_OFFSET)), RIS_REG_FERIS_POS) )
-    {
-        /*
-         * Check if the Pointer not a Null one
-         * To avoid segmentation fault
-         */
-        if(g_callBackPtrUart0Interrupt != NULL_PTR){
+/*******************************************************************************
+ * @fn              void UART1_ISR(void)
+ * @brief           Interrupt Service Routine for UART1
+ * @param (in):     None
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+void UART1_ISR(void)
+{
+    Uart_IsrDispatcher(Uart1);
+}
 
-            /* Call the Call Back function for Uart0 Framing Error mode */
-            (*g_callBackPtrUart0Interrupt)();
-        }
-    }
-    /* Check if Parity Error Interrupt Occurred */
-    else if(BIT_IS_SET((*(volatile uint32*)(UART_0_BASE_ADDRESS + UART_RIS_REG_OFFSET)), RIS_REG_PERIS_POS) )
-    {
-        /*
-         * Check if the Pointer not a Null one
-         * To avoid segmentation fault
-         */
-        if(g_callBackPtrUart0Interrupt != NULL_PTR){
+/*******************************************************************************
+ * @fn              void UART2_ISR(void)
+ * @brief           Interrupt Service Routine for UART2
+ * @param (in):     None
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+void UART2_ISR(void)
+{
+    Uart_IsrDispatcher(Uart2);
+}
 
-            /* Call the Call Back function for Uart0 Parity Error mode */
-            (*g_callBackPtrUart0Interrupt)();
-        }
-    }
-    /* Check if Break Error Interrupt Occurred */
-    else if(BIT_IS_SET((*(volatile uint32*)(UART_0_BASE_ADDRESS + UART_RIS_REG_OFFSET)), RIS_REG_BERIS_POS) )
-    {
-        /*
-         * Check if the Pointer not a Null one
-         * To avoid segmentation fault
-         */
-        if(g_callBackPtrUart0Interrupt != NULL_PTR){
+/*******************************************************************************
+ * @fn              void UART3_ISR(void)
+ * @brief           Interrupt Service Routine for UART3
+ * @param (in):     None
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+void UART3_ISR(void)
+{
+    Uart_IsrDispatcher(Uart3);
+}
 
-            /* Call the Call Back function for Uart0 Break Error mode */
-            (*g_callBackPtrUart0Interrupt)();
-        }
-    }
-    /* Check if OverRun Error Interrupt Occurred */
-    else if(BIT_IS_SET((*(volatile uint32*)(UART_0_BASE_ADDRESS + UART_RIS_REG_OFFSET)), RIS_REG_OERIS_POS) )
-    {
-        /*
-         * Check if the Pointer not a Null one
-         * To avoid segmentation fault
-         */
-        if(g_callBackPtrUart0Interrupt != NULL_PTR){
+/*******************************************************************************
+ * @fn              void UART4_ISR(void)
+ * @brief           Interrupt Service Routine for UART4
+ * @param (in):     None
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+void UART4_ISR(void)
+{
+    Uart_IsrDispatcher(Uart4);
+}
 
-            /* Call the Call Back function for Uart0 OverRun Error mode */
-            (*g_callBackPtrUart0Interrupt)();
-        }
-    }
-    /* Check if 9-Bit Mode Interrupt Occurred */
-    else if(BIT_IS_SET((*(volatile uint32*)(UART_0_BASE_ADDRESS + UART_RIS_REG_OFFSET)), RIS_REG_9BITRIS_POS) )
-    {
-        /*
-         * Check if the Pointer not a Null one
-         * To avoid segmentation fault
-         */
-        if(g_callBackPtrUart0Interrupt != NULL_PTR){
+/*******************************************************************************
+ * @fn              void UART5_ISR(void)
+ * @brief           Interrupt Service Routine for UART5
+ * @param (in):     None
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+void UART5_ISR(void)
+{
+    Uart_IsrDispatcher(Uart5);
+}
 
-            /* Call the Call Back function for Uart0 9-Bit Mode mode */
-            (*g_callBackPtrUart0Interrupt )();
-        }
-    }
+/*******************************************************************************
+ * @fn              void UART6_ISR(void)
+ * @brief           Interrupt Service Routine for UART6
+ * @param (in):     None
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+void UART6_ISR(void)
+{
+    Uart_IsrDispatcher(Uart6);
+}
 
+/*******************************************************************************
+ * @fn              void UART7_ISR(void)
+ * @brief           Interrupt Service Routine for UART7
+ * @param (in):     None
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+void UART7_ISR(void)
+{
+    Uart_IsrDispatcher(Uart7);
 }
 
 
@@ -189,9 +265,8 @@ void UART0_ISR(void)
  *******************************************************************************/
 uint8 Uart_Init(const Uart_Config* ConfigPtr)
 {
-    /* Variable used to Operate with BaudRate Given by the used in Structure */
-    uint32 BaudRateValue = 0;
-    uint32 BaudRateDiv = 0;
+    /* Baud rate divisor of the requested Clock/BaudRate pair */
+    Uart_BaudDivisor Divisor;
 
     /* Pointer to Requested UART Base address Register */
     volatile uint32* Uart_Ptr = NULL_PTR;
@@ -200,55 +275,42 @@ uint8 Uart_Init(const Uart_Config* ConfigPtr)
     volatile uint32  delay = 0;
 
     /* Check if the input configuration pointer to structure is Not a Null Pointer */
-    if(NULL_PTR == ConfigPtr)
+    if( (NULL_PTR == ConfigPtr) || (ConfigPtr->UartNum > Uart7) )
     {
         /* ConfigPtr is a Null Pointer. Return with RET_NOT_OK */
         return RET_NOT_OK;
     }
     /* There is no need for else because if the if statement occurred, a return will happened */
 
-    /* Switch case to decide which UART will operate */
-    switch (ConfigPtr->UartNum) {
-    case Uart0:
-        /* Point the pointer to UART0 Base Address */
-        Uart_Ptr = (volatile uint32*)UART_0_BASE_ADDRESS;
-        break;
-    case Uart1:
-        /* Point the pointer to UART1 Base Address */
-        Uart_Ptr = (volatile uint32*)UART_1_BASE_ADDRESS;
-        break;
-    case Uart2:
-        /* Point the pointer to UART2 Base Address */
-        Uart_Ptr = (volatile uint32*)UART_2_BASE_ADDRESS;
-        break;
-    case Uart3:
-        /* Point the pointer to UART3 Base Address */
-        Uart_Ptr = (volatile uint32*)UART_3_BASE_ADDRESS;
-        break;
-    case Uart4:
-        /* Point the pointer to UART4 Base Address */
-        Uart_Ptr = (volatile uint32*)UART_4_BASE_ADDRESS;
-        break;
-    case Uart5:
-        /* Point the pointer to UART5 Base Address */
-        Uart_Ptr = (volatile uint32*)UART_5_BASE_ADDRESS;
-        break;
-    case Uart6:
-        /* Point the pointer to UART6 Base Address */
-        Uart_Ptr = (volatile uint32*)UART_6_BASE_ADDRESS;
-        break;
-    case Uart7:
-        /* Point the pointer to UART7 Base Address */
-        Uart_Ptr = (volatile uint32*)UART_7_BASE_ADDRESS;
-        break;
+    /* Software RTS needs a GPIO pin on all UARTs except UART1 */
+    if( (ConfigPtr->FlowControl == FLOW_CONTROL_ENABLE) && (ConfigPtr->UartNum != UART_HARDWARE_FLOW_CONTROL_INSTANCE) &&
+        ( (ConfigPtr->RtsGpioBase == 0) || (ConfigPtr->RtsGpioPin > 7) ) )
+    {
+        return RET_NOT_OK;
+    }
+
+    /* Reject Clock/BaudRate pairs that can't be generated within UART tolerance */
+    if(Uart_BaudRateCheck(ConfigPtr->ClkValue, ConfigPtr->BaudRate, &Divisor) != RET_OK)
+    {
+        return RET_NOT_OK;
     }
 
+    /* Base address cached in the instance handle */
+    Uart_Ptr = g_uartHandles[ConfigPtr->UartNum].Base;
+
     /* Enable clock for requested UART Module (MUST BE TESTED) */
     SYSCTL_RCGCUART_REG |= (1 << ConfigPtr->UartNum);
 
     /* Delay to waste sometime to ensure clock stability */
     delay = SYSCTL_RCGCUART_REG;
 
+    /* Start the DWT cycle counter used to measure ISR cycles */
+    SET_BIT( (*(volatile uint32*)UART_DEMCR_REG_ADDRESS), DEMCR_REG_TRCENA_POS);
+    SET_BIT( (*(volatile uint32*)UART_DWT_CTRL_REG_ADDRESS), DWT_CTRL_REG_CYCCNTENA_POS);
+
+    /* Start statistics from zero */
+    (void)Uart_GetStats(ConfigPtr->UartNum, NULL_PTR, TRUE);
+
     /*********************** UART Configurations **********************/
 
     /* First, Disable UART by clearing First bit in CTL Reg */
@@ -263,55 +325,34 @@ uint8 Uart_Init(const Uart_Config* ConfigPtr)
      */
     *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_CTL_REG_OFFSET) &= ~(CTL_REG_UARTEN_ENABLE << CTL_REG_UARTEN_POS);
 
-    /* Second, BaudRate Calculations */
-    /********************* BaudRate Calculations **********************
-     *                  BRD = Freq / ClkDiv* BaudRate                 *
-     *                  Freq = System Clock or POISC                  *
-     *                  ClkDiv = 16 (if HSE is disabled) or           *
-     *                           8  (if HSE is enabled)               *
-     ******************************************************************/
-    /* Save the BaudRate given by the user */
-    BaudRateValue = ConfigPtr->BaudRate;
-
-    /* First, check if BaudRate Value needs HSE to be Enabled */
-    if( ( (ConfigPtr->BaudRate) * 16) > (ConfigPtr->ClkValue) )
-    {
-        /* Enable HSE (High Speed Mode) */
-        SET_BIT( (*(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_CTL_REG_OFFSET) ), CTL_REG_HSE_POS);
-
-        /* Divide the baud rate by 2 to be able to calculate it correctly */
-        BaudRateValue/=2;
-    }
-    else{
-        /* Disable HSE */
-        CLEAR_BIT( (*(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_CTL_REG_OFFSET) ), CTL_REG_HSE_POS);
-    }
-
-    /* Calculate BaudRate Fractional */
-    BaudRateDiv = ( ( (ConfigPtr->ClkValue * 8) / BaudRateValue) + 1) / 2;
-
-    /* Set Integer BaudRate value */
-    *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_IBRD_REG_OFFSET) = BaudRateDiv/64;
-
-
-    /* Set Fractional BaudRate value */
-    *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_FBRD_REG_OFFSET) = BaudRateDiv%64;
+    /* Second, Set BaudRate divisor (precomputed or solved above) */
+    Uart_SetBaudRate(Uart_Ptr, &Divisor);
 
     /********************** Set UART Configurations *************************/
     /* 1- Set Stop bits (1 or 2 stop Bits)
      * 2- Select FIFOs Mode (Enable or disable)
      */
     *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_LCRH_REG_OFFSET) =
-            ( ( (ConfigPtr->StopBits)<<LCRH_REG_SPS_POS) | ((ConfigPtr->FifoMode)<<LCRH_REG_FEN_POS) );
+            ( ( (ConfigPtr->StopBits)<<LCRH_REG_STP2_POS) | ((ConfigPtr->FifoMode)<<LCRH_REG_FEN_POS) );
+
+    /* Set Rx/Tx FIFOs interrupt trigger levels */
+    if(ConfigPtr->FifoMode == FIFO_MODE_ENABLE)
+    {
+        *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_IFLS_REG_OFFSET) =
+                ( ( (ConfigPtr->RxFifoLevel)<<IFLS_REG_RXIFLSEL_POS) | ((ConfigPtr->TxFifoLevel)<<IFLS_REG_TXIFLSEL_POS) );
+    }
 
     /****** Parity Mode Selection (Even, Odd or disable) *********/
     if(ConfigPtr->ParityMode != PARITY_MODE_DISABLE)
     {
         /* Enable Parity Check */
-        *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_LCRH_REG_OFFSET) |= (ConfigPtr->ParityMode << LCRH_REG_PEN_POS);
+        *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_LCRH_REG_OFFSET) |= (LCRH_REG_PEN_ENABLE << LCRH_REG_PEN_POS);
 
         /* Select Even or Odd Parity */
-        *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_LCRH_REG_OFFSET) |= (ConfigPtr->ParityMode << LCRH_REG_EPS_POS);
+        if(ConfigPtr->ParityMode == PARITY_MODE_EVEN)
+        {
+            *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_LCRH_REG_OFFSET) |= (LCRH_REG_EPS_EVEN << LCRH_REG_EPS_POS);
+        }
     }
     /* Parity Check Disabled */
     else
@@ -329,17 +370,56 @@ uint8 Uart_Init(const Uart_Config* ConfigPtr)
     /* 9 Bit Mode selected */
     else
     {
-        /* Enable 9-bit mode from 9BITADDRESS Register*/
-        *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_9BITADDR_REG_OFFSET) = (NINEBITADDR_REG_9BITEN_ENABLE << NINEBITADDR_REG_9BITEN_POS);
+        /* 9th bit is sent in parity bit position, so the frame data is 8 bits */
+        *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_LCRH_REG_OFFSET) |= (EightBits << LCRH_REG_WLEN_POS);
 
-        /* Disable parity check (See Data sheet page 900) */
-        *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_LCRH_REG_OFFSET) &= ~(LCRH_REG_PEN_ENABLE << LCRH_REG_PEN_POS);
+        /* Data bytes are sent with 9th bit = 0 (Stick parity 0: PEN = 1, SPS = 1, EPS = 1)
+         * Uart_SendAddressed() changes it to 1 only for the address byte             */
+        *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_LCRH_REG_OFFSET) |= LCRH_9BIT_DATA_BYTE;
+
+        /* Node address and mask used by hardware to filter addressed frames */
+        *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_9BITAMASK_REG_OFFSET) = (ConfigPtr->NineBitAddressMask << NINEBITAMASK_REG_MASK_POS);
 
+        /* Enable 9-bit mode from 9BITADDRESS Register*/
+        *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_9BITADDR_REG_OFFSET) =
+                ( (NINEBITADDR_REG_9BITEN_ENABLE << NINEBITADDR_REG_9BITEN_POS) | (ConfigPtr->NineBitAddress << NINEBITADDR_REG_ADDR_POS) );
     }
 
     /* Set Interrupts Enabled from configuration structure */
     *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_IM_REG_OFFSET) = (ConfigPtr->UartInterrupts);
 
+    /* In FIFO Mode, bytes below the Rx trigger level are flushed by the Receive Time-Out interrupt */
+    if( (ConfigPtr->FifoMode == FIFO_MODE_ENABLE) && ((ConfigPtr->UartInterrupts & InterruptMaskReceive) != 0) )
+    {
+        SET_BIT( (*(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_IM_REG_OFFSET) ), IM_REG_RTIM_POS);
+    }
+
+    /****************** Flow Control Selection *******************/
+    g_uartFlowControl[ConfigPtr->UartNum].Software   = FALSE;
+    g_uartFlowControl[ConfigPtr->UartNum].RtsStopped = FALSE;
+    if(ConfigPtr->FlowControl == FLOW_CONTROL_ENABLE)
+    {
+        if(ConfigPtr->UartNum == UART_HARDWARE_FLOW_CONTROL_INSTANCE)
+        {
+            /* Hardware RTS (Rx FIFO level) and CTS (Tx gating) */
+            *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_CTL_REG_OFFSET) |=
+                    ( (CTL_REG_RTSEN_ENABLE << CTL_REG_RTSEN_POS) | (CTL_REG_CTSEN_ENABLE << CTL_REG_CTSEN_POS) );
+        }
+        else
+        {
+            /* Software RTS on GPIO pin, start ready to receive */
+            g_uartFlowControl[ConfigPtr->UartNum].RtsPinAddress = UART_GPIO_DATA_PIN_ADDRESS(ConfigPtr->RtsGpioBase, ConfigPtr->RtsGpioPin);
+            g_uartFlowControl[ConfigPtr->UartNum].Software      = TRUE;
+            Uart_RtsSet(ConfigPtr->UartNum, FALSE);
+        }
+    }
+    else if(ConfigPtr->UartNum == UART_HARDWARE_FLOW_CONTROL_INSTANCE)
+    {
+        /* Disable hardware RTS/CTS */
+        *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_CTL_REG_OFFSET) &=
+                ~( (CTL_REG_RTSEN_ENABLE << CTL_REG_RTSEN_POS) | (CTL_REG_CTSEN_ENABLE << CTL_REG_CTSEN_POS) );
+    }
+
     /* Set Clock Source to the Uart Module */
     *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_CC_REG_OFFSET) = (ConfigPtr->ClkSrc);
 
@@ -352,244 +432,1875 @@ uint8 Uart_Init(const Uart_Config* ConfigPtr)
 }
 
 /*******************************************************************************
- * @fn              void UART0ISR(void)
- * @brief           Function callback to serve UART0 Receive
- * @param (in):     f_ptr: Pointer to void function
-                    which will save address of ISR Handler Function in main
- * @param (out):    None
+ * @fn              uint8 Uart_GetBaudRate(const Uart_Config* ConfigPtr,
+ *                                         uint32* AchievedBaudRate, sint32* ErrorPpm)
+ * @brief           Function to get the baud rate really generated for the
+ *                  configuration and its error, so bad configurations can be
+ *                  rejected at boot (no hardware access)
+ * @param (in):     ConfigPtr - Pointer to configuration set
+ * @param (out):    AchievedBaudRate: Generated baud rate
+ *                  ErrorPpm: (Achieved - Requested) / Requested in ppm
  * @param (inout):  None
- * @return          None
+ * @return          Return Status (RET_NOT_OK if the divisor is out of range)
  *******************************************************************************/
-void Uart0_SetCallBack(void (*f_ptr)(void)){
-    g_callBackPtrUart0Interrupt = f_ptr;
+uint8 Uart_GetBaudRate(const Uart_Config* ConfigPtr, uint32* AchievedBaudRate, sint32* ErrorPpm)
+{
+    /* Baud rate divisor of the requested Clock/BaudRate pair */
+    Uart_BaudDivisor Divisor;
+
+    /* Check if the input pointers are Not Null Pointers */
+    if( (NULL_PTR == ConfigPtr) || (NULL_PTR == AchievedBaudRate) || (NULL_PTR == ErrorPpm) )
+    {
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    if(Uart_BaudRateSolve(ConfigPtr->ClkValue, ConfigPtr->BaudRate, &Divisor) != RET_OK)
+    {
+        return RET_NOT_OK;
+    }
+
+    *AchievedBaudRate = Uart_BaudRateAchieved(&Divisor);
+    *ErrorPpm         = Uart_BaudRateErrorPpm(&Divisor);
+
+    return RET_OK;
 }
 
 /*******************************************************************************
- * @fn              uint8 Uart_ReceiveIT(void)
- * @brief           Function to receive UART data using interrupt
+ * @fn              uint8 Uart_ChangeBaudRate(const Uart_Config* ConfigPtr, uint32 BaudRate)
+ * @brief           Function to reprogram the baud rate of an initialized UART
+ *                  using the same divisor solver and checks as Uart_Init()
+ *                  The character being sent/received is completed first
+ * @note            ConfigPtr->BaudRate is not changed, use Uart_AutoBaudGetRate()
+ *                  or keep the new rate in the application
  * @param (in):     ConfigPtr - Pointer to configuration set
+ *                  BaudRate  - New baud rate
  * @param (out):    None
  * @param (inout):  None
- * @return          Received Byte
+ * @return          Return Status (RET_NOT_OK if the rate can't be generated)
  *******************************************************************************/
-uint8 Uart_ReceiveIT(const Uart_Config* ConfigPtr)
+uint8 Uart_ChangeBaudRate(const Uart_Config* ConfigPtr, uint32 BaudRate)
 {
     /* Pointer to Requested UART Base address Register */
     volatile uint32* Uart_Ptr = NULL_PTR;
 
+    /* Baud rate divisor of the requested Clock/BaudRate pair */
+    Uart_BaudDivisor Divisor;
+
     /* Check if the input configuration pointer to structure is Not a Null Pointer */
-    if(NULL_PTR == ConfigPtr)
+    if( (NULL_PTR == ConfigPtr) || (ConfigPtr->UartNum > Uart7) )
     {
-        /* ConfigPtr is a Null Pointer. Return with RET_NOT_OK */
         return RET_NOT_OK;
     }
     /* There is no need for else because if the if statement occurred, a return will happened */
 
-    /* Switch case to decide which UART will operate */
-    switch (ConfigPtr->UartNum) {
-    case Uart0:
-        /* Point the pointer to UART0 Base Address */
-        Uart_Ptr = (volatile uint32*)UART_0_BASE_ADDRESS;
-        break;
-    case Uart1:
-        /* Point the pointer to UART1 Base Address */
-        Uart_Ptr = (volatile uint32*)UART_1_BASE_ADDRESS;
-        break;
-    case Uart2:
-        /* Point the pointer to UART2 Base Address */
-        Uart_Ptr = (volatile uint32*)UART_2_BASE_ADDRESS;
-        break;
-    case Uart3:
-        /* Point the pointer to UART3 Base Address */
-        Uart_Ptr = (volatile uint32*)UART_3_BASE_ADDRESS;
-        break;
-    case Uart4:
-        /* Point the pointer to UART4 Base Address */
-        Uart_Ptr = (volatile uint32*)UART_4_BASE_ADDRESS;
-        break;
-    case Uart5:
-        /* Point the pointer to UART5 Base Address */
-        Uart_Ptr = (volatile uint32*)UART_5_BASE_ADDRESS;
-        break;
-    case Uart6:
-        /* Point the pointer to UART6 Base Address */
-        Uart_Ptr = (volatile uint32*)UART_6_BASE_ADDRESS;
-        break;
-    case Uart7:
-        /* Point the pointer to UART7 Base Address */
-        Uart_Ptr = (volatile uint32*)UART_7_BASE_ADDRESS;
-        break;
-    }
-
-    /******** Check if Received Interrupt Mask is enabled or not ********/
-    if(BIT_IS_CLEAR( (*(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_IM_REG_OFFSET)), IM_REG_RXIM_POS) )
+    if(Uart_BaudRateCheck(ConfigPtr->ClkValue, BaudRate, &Divisor) != RET_OK)
     {
-        /* Interrupt Receive Mask isn't enabled, return with RET_NOT_OK */
         return RET_NOT_OK;
     }
-    /****** Interrupt Receive Mask is enabled, Read the received data *****/
-    /* Read Received byte */
-    uint8 c = (*(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_DATA_REG_OFFSET) );
 
-    /* Clear the Receive Flag by writing 1 on it */
-    *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_FR_REG_OFFSET) |= (1 << 4);
-    /* return Received byte */
-    return c;
+    Uart_Ptr = g_uartHandles[ConfigPtr->UartNum].Base;
+
+    /* Wait for the current character to finish */
+    while( BIT_IS_SET( (*(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_FR_REG_OFFSET)), FR_REG_BUSY_POS) );
+
+    /* Divisors MUST be changed while UART is disabled */
+    CLEAR_BIT( (*(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_CTL_REG_OFFSET) ), CTL_REG_UARTEN_POS);
+
+    Uart_SetBaudRate(Uart_Ptr, &Divisor);
+
+    /* IBRD/FBRD are latched by a write to LCRH */
+    *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_LCRH_REG_OFFSET) =
+            *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_LCRH_REG_OFFSET);
+
+    SET_BIT( (*(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_CTL_REG_OFFSET) ), CTL_REG_UARTEN_POS);
+
+    return RET_OK;
 }
 
 /*******************************************************************************
- * @fn              uint8 Uart_Transmit(const Uart_Config* ConfigPtr, const uint8 Data)
- * @brief           Function to Transmit Byte (Wordlength) using UART
- * @param (in):     ConfigPtr - Pointer to configuration set
- *                  Data: Byte which will be sent using UART
+ * @fn              uint8 Uart_AutoBaudStart(const Uart_Config* ConfigPtr, uint32 TimestampClock)
+ * @brief           Function to start baud rate detection on an initialized UART
+ *                  UART receiver is disabled until the sync character 'U' (0x55)
+ *                  is measured, then the rate is reprogrammed and the receiver
+ *                  is enabled again (the sync character itself is not received)
+ * @note            The application MUST call Uart_AutoBaudEdge() on each edge
+ *                  of the Rx pin (GPIO interrupt on both edges), with a timestamp
+ *                  from a free running counter (e.g. DWT cycle counter or a
+ *                  timer in edge-time capture mode), then Uart_AutoBaudApply()
+ *                  from thread mode (e.g. main loop) to reprogram the rate
+ * @param (in):     ConfigPtr      - Pointer to configuration set
+ *                  TimestampClock - Frequency of the edge timestamps in Hz
  * @param (out):    None
  * @param (inout):  None
  * @return          Return Status
  *******************************************************************************/
-uint8 Uart_Transmit(const Uart_Config* ConfigPtr, const uint8 Data)
+uint8 Uart_AutoBaudStart(const Uart_Config* ConfigPtr, uint32 TimestampClock)
 {
-    /* Pointer to Requested UART Base address Register */
-    volatile uint32* Uart_Ptr = NULL_PTR;
+    /* Autobaud state of requested UART */
+    Uart_AutoBaudState* AutoBaud = NULL_PTR;
 
     /* Check if the input configuration pointer to structure is Not a Null Pointer */
-    if(NULL_PTR == ConfigPtr)
+    if( (NULL_PTR == ConfigPtr) || (ConfigPtr->UartNum > Uart7) || (0 == TimestampClock) )
     {
-        /* ConfigPtr is a Null Pointer. Return with RET_NOT_OK */
         return RET_NOT_OK;
     }
     /* There is no need for else because if the if statement occurred, a return will happened */
 
-    /* Switch case to decide which UART will operate */
-    switch (ConfigPtr->UartNum) {
-    case Uart0:
-        /* Point the pointer to UART0 Base Address */
-        Uart_Ptr = (volatile uint32*)UART_0_BASE_ADDRESS;
-        break;
-    case Uart1:
-        /* Point the pointer to UART1 Base Address */
-        Uart_Ptr = (volatile uint32*)UART_1_BASE_ADDRESS;
-        break;
-    case Uart2:
-        /* Point the pointer to UART2 Base Address */
-        Uart_Ptr = (volatile uint32*)UART_2_BASE_ADDRESS;
-        break;
-    case Uart3:
-        /* Point the pointer to UART3 Base Address */
-        Uart_Ptr = (volatile uint32*)UART_3_BASE_ADDRESS;
-        break;
-    case Uart4:
-        /* Point the pointer to UART4 Base Address */
-        Uart_Ptr = (volatile uint32*)UART_4_BASE_ADDRESS;
-        break;
-    case Uart5:
-        /* Point the pointer to UART5 Base Address */
-        Uart_Ptr = (volatile uint32*)UART_5_BASE_ADDRESS;
-        break;
-    case Uart6:
-        /* Point the pointer to UART6 Base Address */
-        Uart_Ptr = (volatile uint32*)UART_6_BASE_ADDRESS;
-        break;
-    case Uart7:
-        /* Point the pointer to UART7 Base Address */
-        Uart_Ptr = (volatile uint32*)UART_7_BASE_ADDRESS;
-        break;
-    }
-    /* Wait until transmit holding register is NOT Full (when = 1 then the Transmit reg is full)*/
-    while( ( *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_FR_REG_OFFSET) & (1 << 5) ) != 0 );
+    AutoBaud = &g_uartAutoBaud[ConfigPtr->UartNum];
 
-    /* Send the Char */
-    (*(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_DATA_REG_OFFSET) ) = Data;
+    /* Don't receive garbage while the sender talks at the unknown rate */
+    CLEAR_BIT( (*(volatile uint32*)((volatile uint8*)g_uartHandles[ConfigPtr->UartNum].Base + UART_CTL_REG_OFFSET) ), CTL_REG_RXE_POS);
 
+    AutoBaud->Config         = ConfigPtr;
+    AutoBaud->TimestampClock = TimestampClock;
+    AutoBaud->BaudRate       = 0;
+    AutoBaud->Edges          = 0;
+    AutoBaud->Status         = UART_AUTOBAUD_RUNNING;
 
     return RET_OK;
 }
 
 /*******************************************************************************
- * @fn              void Uart_SendString (const Uart_Config* ConfigPtr, const uint8* String)
- * @brief           Function to Transmit String using UART
- * @param (in):     ConfigPtr - Pointer to configuration set
- *                  Data: Data which will be sent using UART
+ * @fn              uint8 Uart_AutoBaudEdge(Uart_Instance UartNum, uint32 Timestamp, uint8 Level)
+ * @brief           Function to feed one Rx pin edge to the baud rate detection
+ *                  - Start bit falling edge starts the measurement
+ *                  - Each next edge MUST come one bit (+/- 25 %) after the
+ *                    previous one, otherwise the measurement restarts
+ *                  - On the 10th edge (start of stop bit) the rate is computed
+ *                    over the 9 bit periods and snapped to a standard rate
+ *                  UART isn't reprogrammed here (it waits for the character
+ *                  being sent), Uart_AutoBaudApply() does it out of the ISR
+ * @param (in):     UartNum   - UART instance
+ *                  Timestamp - Edge time (TimestampClock ticks, wraps around)
+ *                  Level     - Rx pin level after the edge (0 for falling edge)
  * @param (out):    None
  * @param (inout):  None
- * @return          None
+ * @return          Detection status @ref UART_AUTOBAUD
  *******************************************************************************/
-void Uart_SendString (const Uart_Config* ConfigPtr, const uint8* String)
+uint8 Uart_AutoBaudEdge(Uart_Instance UartNum, uint32 Timestamp, uint8 Level)
 {
-    /* When String is Not Null */
-    while(*String != '\0')
+    /* Autobaud state of requested UART */
+    Uart_AutoBaudState* AutoBaud = NULL_PTR;
+
+    /* Ticks since the previous edge */
+    uint32 Interval = 0;
+
+    /* Deviation of the interval from the start bit width */
+    uint32 Deviation = 0;
+
+    if(UartNum > Uart7)
+    {
+        return UART_AUTOBAUD_FAILED;
+    }
+
+    AutoBaud = &g_uartAutoBaud[UartNum];
+    if(AutoBaud->Status != UART_AUTOBAUD_RUNNING)
     {
-        /* Send the corresponding Byte */
-        Uart_Transmit(ConfigPtr ,*String);
+        return AutoBaud->Status;
+    }
 
-        /* Increment the pointer to point to next element of the given string */
-        String++;
+    if(AutoBaud->Edges != 0)
+    {
+        Interval = Timestamp - AutoBaud->PreviousEdge;
+        if(AutoBaud->Edges == 1)
+        {
+            /* End of start bit, it is the reference of the next bits */
+            AutoBaud->BitTicks = Interval;
+        }
+        Deviation = (Interval > AutoBaud->BitTicks) ? (Interval - AutoBaud->BitTicks) : (AutoBaud->BitTicks - Interval);
+
+        /* 0x55 edges alternate: falling on even edges, rising on odd edges */
+        if( (0 == Interval) || (((Level != 0) ? 1U : 0U) != (AutoBaud->Edges & 1U)) ||
+            (Deviation > (AutoBaud->BitTicks >> UART_AUTOBAUD_EDGE_TOLERANCE_SHIFT)) )
+        {
+            /* Not the sync character, restart (a falling edge may be a new start bit) */
+            AutoBaud->Edges = 0;
+        }
+    }
+
+    if(AutoBaud->Edges == 0)
+    {
+        if(Level == 0)
+        {
+            AutoBaud->FirstEdge    = Timestamp;
+            AutoBaud->PreviousEdge = Timestamp;
+            AutoBaud->Edges        = 1;
+        }
+        return UART_AUTOBAUD_RUNNING;
+    }
+
+    AutoBaud->PreviousEdge = Timestamp;
+    AutoBaud->Edges++;
+
+    if(AutoBaud->Edges == UART_AUTOBAUD_SYNC_EDGES)
+    {
+        AutoBaud->BaudRate = Uart_AutoBaudMeasure(AutoBaud);
+        AutoBaud->Status   = UART_AUTOBAUD_MEASURED;
     }
+
+    return AutoBaud->Status;
 }
 
 /*******************************************************************************
- * @fn              uint8 Uart_Receive(void)
- * @brief           Function to receive UART data using Polling Mode
- * @param (in):     ConfigPtr - Pointer to configuration set
+ * @fn              uint8 Uart_AutoBaudApply(Uart_Instance UartNum)
+ * @brief           Function to reprogram UART with the rate measured by
+ *                  Uart_AutoBaudEdge() and enable its receiver again
+ *                  It waits for the character being sent, so it MUST be called
+ *                  from thread mode, it can be polled (nothing is done until
+ *                  the rate is measured)
+ * @param (in):     UartNum - UART instance
  * @param (out):    None
  * @param (inout):  None
- * @return          Received Byte
+ * @return          Detection status @ref UART_AUTOBAUD
+ *                  (UART_AUTOBAUD_DONE or UART_AUTOBAUD_FAILED once applied)
  *******************************************************************************/
-uint8 Uart_Receive(const Uart_Config* ConfigPtr)
+uint8 Uart_AutoBaudApply(Uart_Instance UartNum)
 {
-    /* Variable to save the received byte on it */
-    uint8 c;
-    /* Pointer to Requested UART Base address Register */
-    volatile uint32* Uart_Ptr = NULL_PTR;
+    if(UartNum > Uart7)
+    {
+        return UART_AUTOBAUD_FAILED;
+    }
 
-    /* Check if the input configuration pointer to structure is Not a Null Pointer */
-    if(NULL_PTR == ConfigPtr)
+    if(g_uartAutoBaud[UartNum].Status == UART_AUTOBAUD_MEASURED)
+    {
+        g_uartAutoBaud[UartNum].Status = Uart_AutoBaudFinish(UartNum);
+    }
+
+    return g_uartAutoBaud[UartNum].Status;
+}
+
+/*******************************************************************************
+ * @fn              uint32 Uart_AutoBaudGetRate(Uart_Instance UartNum)
+ * @brief           Function to get the baud rate found by the last detection
+ * @param (in):     UartNum - UART instance
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Detected baud rate (0 if detection isn't done)
+ *******************************************************************************/
+uint32 Uart_AutoBaudGetRate(Uart_Instance UartNum)
+{
+    if( (UartNum > Uart7) || (g_uartAutoBaud[UartNum].Status != UART_AUTOBAUD_DONE) )
+    {
+        return 0;
+    }
+
+    return g_uartAutoBaud[UartNum].BaudRate;
+}
+
+/*******************************************************************************
+ * @fn              void Uart0_SetCallBack(void (*f_ptr)(void))
+ * @brief           Function callback to serve UART0 Receive
+ *                  It is set for both Receive and Receive Time-Out, because bytes
+ *                  below the Rx FIFO trigger level are only signaled by Time-Out
+ * @param (in):     f_ptr: Pointer to void function
+                    which will save address of ISR Handler Function in main
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+void Uart0_SetCallBack(void (*f_ptr)(void)){
+    Uart_SetCallBack(Uart0, InterruptMaskReceive, f_ptr);
+    Uart_SetCallBack(Uart0, InterruptMaskReceiveTimeOut, f_ptr);
+}
+
+/*******************************************************************************
+ * @fn              uint8 Uart_SetCallBack(Uart_Instance UartNum, Uart_Interrupts Interrupt,
+ *                                         void (*f_ptr)(void))
+ * @brief           Function to set the application call back of one interrupt
+ *                  cause of one UART instance
+ * @note            Receive and Receive Time-Out call backs are called after the
+ *                  Rx FIFO is drained to the Rx ring buffer, set both to get
+ *                  every received byte in FIFO Mode
+ * @param (in):     UartNum: UART instance
+ *                  Interrupt: One interrupt cause @ref Uart_Interrupts
+ *                  f_ptr: Pointer to void function (NULL_PTR to remove it)
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Return Status (RET_NOT_OK if Interrupt isn't a single cause)
+ *******************************************************************************/
+uint8 Uart_SetCallBack(Uart_Instance UartNum, Uart_Interrupts Interrupt, void (*f_ptr)(void))
+{
+    /* Bit position of the interrupt cause */
+    uint8 Bit = 0;
+
+    /* Check that exactly one valid cause is given */
+    if( (UartNum > Uart7) || (Interrupt == InterruptsDisbaled) ||
+        ( ((uint32)Interrupt & ((uint32)Interrupt - 1U)) != 0 ) )
     {
-        /* ConfigPtr is a Null Pointer. Return with RET_NOT_OK */
         return RET_NOT_OK;
     }
     /* There is no need for else because if the if statement occurred, a return will happened */
 
-    /* Switch case to decide which UART will operate */
-    switch (ConfigPtr->UartNum) {
-    case Uart0:
-        /* Point the pointer to UART0 Base Address */
-        Uart_Ptr = (volatile uint32*)UART_0_BASE_ADDRESS;
-        break;
-    case Uart1:
-        /* Point the pointer to UART1 Base Address */
-        Uart_Ptr = (volatile uint32*)UART_1_BASE_ADDRESS;
-        break;
-    case Uart2:
-        /* Point the pointer to UART2 Base Address */
-        Uart_Ptr = (volatile uint32*)UART_2_BASE_ADDRESS;
-        break;
-    case Uart3:
-        /* Point the pointer to UART3 Base Address */
-        Uart_Ptr = (volatile uint32*)UART_3_BASE_ADDRESS;
-        break;
-    case Uart4:
-        /* Point the pointer to UART4 Base Address */
-        Uart_Ptr = (volatile uint32*)UART_4_BASE_ADDRESS;
-        break;
-    case Uart5:
-        /* Point the pointer to UART5 Base Address */
-        Uart_Ptr = (volatile uint32*)UART_5_BASE_ADDRESS;
-        break;
-    case Uart6:
-        /* Point the pointer to UART6 Base Address */
-        Uart_Ptr = (volatile uint32*)UART_6_BASE_ADDRESS;
-        break;
-    case Uart7:
-        /* Point the pointer to UART7 Base Address */
-        Uart_Ptr = (volatile uint32*)UART_7_BASE_ADDRESS;
-        break;
+    Bit = (uint8)(31U - UART_COUNT_LEADING_ZEROS((uint32)Interrupt));
+    if(Bit >= UART_INTERRUPT_CAUSES)
+    {
+        return RET_NOT_OK;
     }
 
-    /* Wait until receive holding register is NOT empty (when = 1 then the receive reg is empty). */
-    while( ( *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_FR_REG_OFFSET) & (FR_REG_RXFE_ENABLE << FR_REG_RXFE_POS) ) != 0 );
-
-    /* Read Received byte */
-    c = *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_DATA_REG_OFFSET);
+    g_callBackPtrUartInterrupt[UartNum][Bit] = f_ptr;
 
+    return RET_OK;
+}
+
+/*******************************************************************************
+ * @fn              uint8 Uart_ReceiveIT(void)
+ * @brief           Function to receive UART data using interrupt
+ * @param (in):     ConfigPtr - Pointer to configuration set
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Received Byte
+ *******************************************************************************/
+uint8 Uart_ReceiveIT(const Uart_Config* ConfigPtr)
+{
+    /* Variable used to read the received byte on it */
+    uint8 c = 0;
+
+    /* Pointer to Requested UART Base address Register */
+    volatile uint32* Uart_Ptr = NULL_PTR;
+
+    /* Check if the input configuration pointer to structure is Not a Null Pointer */
+    if( (NULL_PTR == ConfigPtr) || (ConfigPtr->UartNum > Uart7) )
+    {
+        /* ConfigPtr is a Null Pointer or UART instance is out of range. Return with RET_NOT_OK */
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    /* Base address cached in the instance handle */
+    Uart_Ptr = g_uartHandles[ConfigPtr->UartNum].Base;
+
+    /******** Check if Received Interrupt Mask is enabled or not ********/
+    if(BIT_IS_CLEAR( (*(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_IM_REG_OFFSET)), IM_REG_RXIM_POS) )
+    {
+        /* Interrupt Receive Mask isn't enabled, return with RET_NOT_OK */
+        return RET_NOT_OK;
+    }
+    /****** Interrupt Receive Mask is enabled, Read the received data *****/
+    /* Take the oldest byte drained by the Rx interrupt */
+    if(Uart_Read(ConfigPtr, &c, 1) == 0)
+    {
+        /* Nothing received, return with RET_NOT_OK */
+        return RET_NOT_OK;
+    }
+
+    /* return Received byte */
     return c;
 }
+
+/*******************************************************************************
+ * @fn              uint16 Uart_Read(const Uart_Config* ConfigPtr, uint8* Buffer, uint16 Length)
+ * @brief           Function to read bytes received by the Rx interrupt
+ *                  without blocking
+ * @param (in):     ConfigPtr - Pointer to configuration set
+ *                  Length: Maximum number of bytes to read
+ * @param (out):    Buffer: Buffer to copy received bytes to
+ * @param (inout):  None
+ * @return          Number of bytes copied to Buffer
+ *******************************************************************************/
+uint16 Uart_Read(const Uart_Config* ConfigPtr, uint8* Buffer, uint16 Length)
+{
+    /* Pointer to Rx ring buffer of requested UART */
+    Uart_RingBuffer* Ring = NULL_PTR;
+
+    /* Local copy of the consumer index */
+    uint16 Tail = 0;
+
+    /* Number of bytes available in the ring buffer */
+    uint16 Available = 0;
+
+    /* Loop counter */
+    uint16 Count = 0;
+
+    /* Check if the input configuration pointer and buffer are Not Null Pointers */
+    if( (NULL_PTR == ConfigPtr) || (ConfigPtr->UartNum > Uart7) || (NULL_PTR == Buffer) )
+    {
+        /* Nothing read */
+        return 0;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    Ring = &g_uartRxRing[ConfigPtr->UartNum];
+
+    /* Only the consumer writes Tail, so it is safe to read it once */
+    Tail = Ring->Tail;
+
+    /* Read only what is available */
+    Available = (uint16)(Ring->Head - Tail);
+    if(Length > Available)
+    {
+        Length = Available;
+    }
+
+    /* Copy the data from the ring buffer */
+    for(Count = 0; Count < Length; Count++)
+    {
+        Buffer[Count] = Ring->Buffer[(uint16)(Tail + Count) & UART_RING_BUFFER_MASK];
+    }
+
+    /* Release the read slots to the producer after they are copied */
+    Uart_RxRelease(ConfigPtr->UartNum, (uint16)(Tail + Length));
+
+    return Length;
+}
+
+/*******************************************************************************
+ * @fn              uint16 Uart_Peek(const Uart_Config* ConfigPtr, const uint8** Data)
+ * @brief           Function to get received bytes in place (zero copy)
+ *                  It returns the longest contiguous block of the Rx ring buffer,
+ *                  which stays valid until it is released by Uart_Consume()
+ * @param (in):     ConfigPtr - Pointer to configuration set
+ * @param (out):    Data: Pointer to the first received byte
+ * @param (inout):  None
+ * @return          Number of contiguous bytes at Data (0 if nothing received)
+ *******************************************************************************/
+uint16 Uart_Peek(const Uart_Config* ConfigPtr, const uint8** Data)
+{
+    /* Pointer to Rx ring buffer of requested UART */
+    Uart_RingBuffer* Ring = NULL_PTR;
+
+    /* Local copy of the consumer index */
+    uint16 Tail = 0;
+
+    /* Number of bytes available in the ring buffer */
+    uint16 Available = 0;
+
+    /* Check if the input pointers are Not Null Pointers */
+    if( (NULL_PTR == ConfigPtr) || (ConfigPtr->UartNum > Uart7) || (NULL_PTR == Data) )
+    {
+        return 0;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    Ring      = &g_uartRxRing[ConfigPtr->UartNum];
+    Tail      = Ring->Tail;
+    Available = (uint16)(Ring->Head - Tail);
+
+    /* Stop at the end of the ring buffer memory */
+    if(Available > (UART_RING_BUFFER_SIZE - (Tail & UART_RING_BUFFER_MASK)))
+    {
+        Available = UART_RING_BUFFER_SIZE - (Tail & UART_RING_BUFFER_MASK);
+    }
+
+    *Data = &Ring->Buffer[Tail & UART_RING_BUFFER_MASK];
+
+    return Available;
+}
+
+/*******************************************************************************
+ * @fn              void Uart_Consume(const Uart_Config* ConfigPtr, uint16 Length)
+ * @brief           Function to release bytes taken in place by Uart_Peek()
+ * @param (in):     ConfigPtr - Pointer to configuration set
+ *                  Length: Number of bytes to release (at most Uart_Peek() return)
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+void Uart_Consume(const Uart_Config* ConfigPtr, uint16 Length)
+{
+    /* Pointer to Rx ring buffer of requested UART */
+    Uart_RingBuffer* Ring = NULL_PTR;
+
+    if( (NULL_PTR == ConfigPtr) || (ConfigPtr->UartNum > Uart7) )
+    {
+        return;
+    }
+
+    Ring = &g_uartRxRing[ConfigPtr->UartNum];
+
+    /* Never release more than what was received */
+    if(Length > (uint16)(Ring->Head - Ring->Tail))
+    {
+        Length = (uint16)(Ring->Head - Ring->Tail);
+    }
+
+    Uart_RxRelease(ConfigPtr->UartNum, (uint16)(Ring->Tail + Length));
+}
+
+/*******************************************************************************
+ * @fn              uint32 Uart_GetOverrunCount(Uart_Instance UartNum)
+ * @brief           Function to get number of received bytes lost because
+ *                  Rx FIFO overrun or Rx ring buffer was full
+ * @param (in):     UartNum - UART instance
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Number of lost bytes since reset
+ *******************************************************************************/
+uint32 Uart_GetOverrunCount(Uart_Instance UartNum)
+{
+    if(UartNum > Uart7)
+    {
+        return 0;
+    }
+
+    return g_uartStats[UartNum].OverrunErrors + g_uartStats[UartNum].RxRingOverflows;
+}
+
+/*******************************************************************************
+ * @fn              uint8 Uart_GetStats(Uart_Instance UartNum, Uart_Stats* Stats, uint8 Reset)
+ * @brief           Function to get statistics of one UART instance
+ *                  Snapshot and reset are done with IRQs masked, so no event
+ *                  counted by the ISR is lost or counted twice between them
+ * @param (in):     UartNum - UART instance
+ *                  Reset   - TRUE to clear the statistics after reading them
+ * @param (out):    Stats   - Snapshot of the statistics (can be NULL_PTR to reset only)
+ * @param (inout):  None
+ * @return          Return Status
+ *******************************************************************************/
+uint8 Uart_GetStats(Uart_Instance UartNum, Uart_Stats* Stats, uint8 Reset)
+{
+    /* Zeroed statistics used for reset */
+    static const Uart_Stats ZeroStats = {0};
+
+    /* Saved PRIMASK */
+    uint32 Key = 0;
+
+    if( (UartNum > Uart7) || ( (NULL_PTR == Stats) && (Reset != TRUE) ) )
+    {
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    Key = UART_ENTER_CRITICAL();
+
+    if(NULL_PTR != Stats)
+    {
+        *Stats = g_uartStats[UartNum];
+    }
+
+    if(Reset == TRUE)
+    {
+        g_uartStats[UartNum] = ZeroStats;
+    }
+
+    UART_EXIT_CRITICAL(Key);
+
+    return RET_OK;
+}
+
+/*******************************************************************************
+ * @fn              uint8 Uart_Transmit(const Uart_Config* ConfigPtr, const uint8 Data)
+ * @brief           Function to Transmit Byte (Wordlength) using UART
+ * @param (in):     ConfigPtr - Pointer to configuration set
+ *                  Data: Byte which will be sent using UART
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Return Status
+ *******************************************************************************/
+uint8 Uart_Transmit(const Uart_Config* ConfigPtr, const uint8 Data)
+{
+    /* Check if the input configuration pointer to structure is Not a Null Pointer */
+    if( (NULL_PTR == ConfigPtr) || (ConfigPtr->UartNum > Uart7) )
+    {
+        /* ConfigPtr is a Null Pointer or UART instance is out of range. Return with RET_NOT_OK */
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    Uart_PutChar(&g_uartHandles[ConfigPtr->UartNum], Data);
+
+    return RET_OK;
+}
+
+/*******************************************************************************
+ * @fn              uint16 Uart_Write(const Uart_Config* ConfigPtr, const uint8* Buffer, uint16 Length)
+ * @brief           Function to Transmit a buffer using UART without blocking
+ *                  Bytes are copied to the instance Tx ring buffer and sent
+ *                  from the Tx interrupt, so the function returns immediately
+ * @note            UART NVIC interrupt must be enabled by the application
+ * @note            Don't mix it with Uart_Transmit() on the same instance while
+ *                  the ring buffer is not empty, otherwise bytes will be reordered
+ * @param (in):     ConfigPtr - Pointer to configuration set
+ *                  Buffer: Data which will be sent using UART
+ *                  Length: Number of bytes in Buffer
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Number of bytes queued (less than Length if ring buffer is full)
+ *******************************************************************************/
+uint16 Uart_Write(const Uart_Config* ConfigPtr, const uint8* Buffer, uint16 Length)
+{
+    /* Pointer to Requested UART Base address Register */
+    volatile uint32* Uart_Ptr = NULL_PTR;
+
+    /* Pointer to Tx ring buffer of requested UART */
+    Uart_RingBuffer* Ring = NULL_PTR;
+
+    /* Local copy of the producer index */
+    uint16 Head = 0;
+
+    /* Free space in the ring buffer */
+    uint16 FreeSpace = 0;
+
+    /* Loop counter */
+    uint16 Count = 0;
+
+    /* Saved PRIMASK */
+    uint32 Key = 0;
+
+    /* Check if the input configuration pointer and buffer are Not Null Pointers */
+    if( (NULL_PTR == ConfigPtr) || (ConfigPtr->UartNum > Uart7) || (NULL_PTR == Buffer) )
+    {
+        /* Nothing queued */
+        return 0;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    /* Base address cached in the instance handle */
+    Uart_Ptr = g_uartHandles[ConfigPtr->UartNum].Base;
+
+    Ring = &g_uartTxRing[ConfigPtr->UartNum];
+
+    /* Only the producer writes Head, so it is safe to read it once */
+    Head = Ring->Head;
+
+    /* Queue only what fits in the ring buffer */
+    FreeSpace = UART_RING_BUFFER_SIZE - (uint16)(Head - Ring->Tail);
+    if(Length > FreeSpace)
+    {
+        Length = FreeSpace;
+    }
+
+    /* Copy the data to the ring buffer */
+    for(Count = 0; Count < Length; Count++)
+    {
+        Ring->Buffer[(uint16)(Head + Count) & UART_RING_BUFFER_MASK] = Buffer[Count];
+    }
+
+    /* Publish the new bytes to the consumer after they are written */
+    Ring->Head = (uint16)(Head + Length);
+
+    /* Mask Tx interrupt, so this function is the only consumer while priming the FIFO
+     * (UARTIM is shared with the ISRs, so its read-modify-write is done with IRQs masked) */
+    Key = UART_ENTER_CRITICAL();
+    CLEAR_BIT( (*(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_IM_REG_OFFSET) ), IM_REG_TXIM_POS);
+    UART_EXIT_CRITICAL(Key);
+
+    if( (uint16)(Ring->Head - Ring->Tail) > g_uartStats[ConfigPtr->UartNum].TxRingHighWater )
+    {
+        g_uartStats[ConfigPtr->UartNum].TxRingHighWater = (uint16)(Ring->Head - Ring->Tail);
+    }
+
+    /* Start the transmission by filling the Tx holding register/FIFO */
+    if(Uart_TxFill(ConfigPtr->UartNum, Uart_Ptr) == TRUE)
+    {
+        /* Let the Tx interrupt send the rest of the bytes */
+        Key = UART_ENTER_CRITICAL();
+        SET_BIT( (*(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_IM_REG_OFFSET) ), IM_REG_TXIM_POS);
+        UART_EXIT_CRITICAL(Key);
+    }
+
+    return Length;
+}
+
+/*******************************************************************************
+ * @fn              uint8 Uart_SetTxSource(Uart_Instance UartNum,
+ *                                         uint16 (*Peek)(Uart_Instance UartNum, const uint8** Data),
+ *                                         void (*Consume)(Uart_Instance UartNum, uint16 Length))
+ * @brief           Function to register an external Tx data source
+ *                  The Tx interrupt writes the source bytes directly to the
+ *                  Tx FIFO (no copy to the Tx ring buffer):
+ *                  - Peek returns the number of contiguous bytes ready at *Data
+ *                  - Consume releases the bytes written to the FIFO
+ * @note            Both are called from the Tx ISR (or Uart_TxKick()), call
+ *                  Uart_TxKick() each time the source gets new bytes
+ * @param (in):     UartNum - UART instance
+ *                  Peek    - Source peek function (NULL_PTR to remove the source)
+ *                  Consume - Source consume function
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Return Status
+ *******************************************************************************/
+uint8 Uart_SetTxSource(Uart_Instance UartNum, uint16 (*Peek)(Uart_Instance UartNum, const uint8** Data),
+                       void (*Consume)(Uart_Instance UartNum, uint16 Length))
+{
+    if( (UartNum > Uart7) || ( (NULL_PTR != Peek) && (NULL_PTR == Consume) ) )
+    {
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    g_uartTxSource[UartNum].Consume = Consume;
+    g_uartTxSource[UartNum].Peek    = Peek;
+
+    return RET_OK;
+}
+
+/*******************************************************************************
+ * @fn              void Uart_TxKick(Uart_Instance UartNum)
+ * @brief           Function to start sending new bytes of the external Tx source
+ *                  It primes the Tx FIFO and enables Tx interrupt if needed
+ * @param (in):     UartNum - UART instance
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+void Uart_TxKick(Uart_Instance UartNum)
+{
+    /* Pointer to UART Base address Register */
+    volatile uint32* Uart_Ptr = NULL_PTR;
+
+    /* Saved PRIMASK */
+    uint32 Key = 0;
+
+    if(UartNum > Uart7)
+    {
+        return;
+    }
+
+    Uart_Ptr = g_uartHandles[UartNum].Base;
+
+    /* Mask Tx interrupt, so this function is the only consumer while priming the FIFO */
+    Key = UART_ENTER_CRITICAL();
+    CLEAR_BIT( (*(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_IM_REG_OFFSET) ), IM_REG_TXIM_POS);
+    UART_EXIT_CRITICAL(Key);
+
+    if(Uart_TxFill(UartNum, Uart_Ptr) == TRUE)
+    {
+        Key = UART_ENTER_CRITICAL();
+        SET_BIT( (*(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_IM_REG_OFFSET) ), IM_REG_TXIM_POS);
+        UART_EXIT_CRITICAL(Key);
+    }
+}
+
+/*******************************************************************************
+ * @fn              uint8 Uart_TransmitDMA(const Uart_Config* ConfigPtr, const uint8* Buffer,
+ *                                         uint32 Length, void (*CallBack)(void))
+ * @brief           Function to Transmit a buffer using uDMA (zero copy)
+ *                  The buffer is handed directly to uDMA, so it MUST stay valid
+ *                  and unchanged until CallBack is called
+ * @note            Udma_Init() and UART NVIC interrupt must be enabled by the application
+ * @param (in):     ConfigPtr - Pointer to configuration set
+ *                  Buffer: Data which will be sent using UART
+ *                  Length: Number of bytes in Buffer
+ *                  CallBack: Function called from UART ISR when the last byte
+ *                            left the wire (can be NULL_PTR)
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Return Status (RET_NOT_OK if a Tx uDMA transfer is already running)
+ *******************************************************************************/
+uint8 Uart_TransmitDMA(const Uart_Config* ConfigPtr, const uint8* Buffer, uint32 Length, void (*CallBack)(void))
+{
+    /* Pointer to Requested UART Base address Register */
+    volatile uint32* Uart_Ptr = NULL_PTR;
+
+    /* Pointer to Tx uDMA transfer state of requested UART */
+    Uart_DmaTransfer* Transfer = NULL_PTR;
+
+    /* Check if the input configuration pointer and buffer are Not Null Pointers */
+    if( (NULL_PTR == ConfigPtr) || (ConfigPtr->UartNum > Uart7) || (NULL_PTR == Buffer) || (0 == Length) )
+    {
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    Transfer = &g_uartDmaTx[ConfigPtr->UartNum];
+
+    /* Only one Tx uDMA transfer per UART at a time */
+    if(Transfer->Busy == TRUE)
+    {
+        return RET_NOT_OK;
+    }
+
+    /* Base address cached in the instance handle */
+    Uart_Ptr = g_uartHandles[ConfigPtr->UartNum].Base;
+
+    /* Save transfer state */
+    Transfer->Next      = (uint8*)Buffer;
+    Transfer->Remaining = Length;
+    Transfer->CallBack  = CallBack;
+    Transfer->Draining  = FALSE;
+    Transfer->Busy      = TRUE;
+
+    /* Connect Tx uDMA channel to this UART */
+    Udma_ChannelAssign(g_uartDmaChannels[ConfigPtr->UartNum].TxChannel, g_uartDmaChannels[ConfigPtr->UartNum].Encoding);
+
+    /* Hand the first chunk to uDMA */
+    g_uartStats[ConfigPtr->UartNum].TxBytes += Uart_DmaTxStart(Uart_Ptr, g_uartDmaChannels[ConfigPtr->UartNum].TxChannel, Transfer);
+
+    /* Let UART request Tx uDMA transfers */
+    SET_BIT( (*(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_DMACTL_REG_OFFSET) ), DMACTL_REG_TXDMAE_POS);
+
+    return RET_OK;
+}
+
+/*******************************************************************************
+ * @fn              uint8 Uart_ReceiveDMA(const Uart_Config* ConfigPtr, uint8* Buffer,
+ *                                        uint32 Length, void (*CallBack)(void))
+ * @brief           Function to Receive a buffer using uDMA (zero copy)
+ *                  Received bytes are written directly to Buffer
+ * @note            Udma_Init() and UART NVIC interrupt must be enabled by the application
+ * @note            Receive and Receive Time-Out interrupts are masked while the
+ *                  transfer runs and restored when it is done
+ * @param (in):     ConfigPtr - Pointer to configuration set
+ *                  Length: Number of bytes to receive
+ *                  CallBack: Function called from UART ISR when transfer is done
+ *                            (can be NULL_PTR)
+ * @param (out):    Buffer: Buffer to receive data on it
+ * @param (inout):  None
+ * @return          Return Status (RET_NOT_OK if a Rx uDMA transfer is already running)
+ *******************************************************************************/
+uint8 Uart_ReceiveDMA(const Uart_Config* ConfigPtr, uint8* Buffer, uint32 Length, void (*CallBack)(void))
+{
+    /* Pointer to Requested UART Base address Register */
+    volatile uint32* Uart_Ptr = NULL_PTR;
+
+    /* Pointer to Rx uDMA transfer state of requested UART */
+    Uart_DmaTransfer* Transfer = NULL_PTR;
+
+    /* Saved PRIMASK */
+    uint32 Key = 0;
+
+    /* Check if the input configuration pointer and buffer are Not Null Pointers */
+    if( (NULL_PTR == ConfigPtr) || (ConfigPtr->UartNum > Uart7) || (NULL_PTR == Buffer) || (0 == Length) )
+    {
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    Transfer = &g_uartDmaRx[ConfigPtr->UartNum];
+
+    /* Only one Rx uDMA transfer per UART at a time */
+    if(Transfer->Busy == TRUE)
+    {
+        return RET_NOT_OK;
+    }
+
+    /* Base address cached in the instance handle */
+    Uart_Ptr = g_uartHandles[ConfigPtr->UartNum].Base;
+
+    /* Save transfer state */
+    Transfer->Next      = Buffer;
+    Transfer->Remaining = Length;
+    Transfer->CallBack  = CallBack;
+    Transfer->Busy      = TRUE;
+
+    /* Save Rx interrupts mask, then mask them so Rx ISR doesn't steal bytes from uDMA
+     * (UARTIM is shared with the ISRs, so its read-modify-write is done with IRQs masked) */
+    Key = UART_ENTER_CRITICAL();
+    Transfer->SavedMask = *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_IM_REG_OFFSET) &
+                          ( (1 << IM_REG_RXIM_POS) | (1 << IM_REG_RTIM_POS) );
+    *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_IM_REG_OFFSET) &= ~( (1 << IM_REG_RXIM_POS) | (1 << IM_REG_RTIM_POS) );
+    UART_EXIT_CRITICAL(Key);
+
+    /* Connect Rx uDMA channel to this UART */
+    Udma_ChannelAssign(g_uartDmaChannels[ConfigPtr->UartNum].RxChannel, g_uartDmaChannels[ConfigPtr->UartNum].Encoding);
+
+    /* Hand the first chunk to uDMA */
+    g_uartStats[ConfigPtr->UartNum].RxBytes += Uart_DmaRxStart(Uart_Ptr, g_uartDmaChannels[ConfigPtr->UartNum].RxChannel, Transfer);
+
+    /* Let UART request Rx uDMA transfers */
+    SET_BIT( (*(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_DMACTL_REG_OFFSET) ), DMACTL_REG_RXDMAE_POS);
+
+    return RET_OK;
+}
+
+/*******************************************************************************
+ * @fn              uint16 Uart_SendAddressed(const Uart_Config* ConfigPtr, uint8 Address,
+ *                                            const uint8* Buffer, uint16 Length)
+ * @brief           Function to send a frame to one node on a 9-bit multidrop bus
+ *                  - Address byte is sent with 9th bit = 1, so only the nodes
+ *                    matching it (UART9BITADDR/UART9BITAMASK) receive the frame
+ *                  - Data bytes are queued with 9th bit = 0 using Uart_Write()
+ * @note            It blocks until previous bytes are sent (9th bit is taken from
+ *                  UARTLCRH when the byte is shifted out) and until the address
+ *                  byte itself is sent. Each wait gives up if the line stops
+ *                  moving (see Uart_TxWaitIdle()), then nothing is queued
+ * @param (in):     ConfigPtr - Pointer to configuration set (NineBits word length)
+ *                  Address: Destination node address
+ *                  Buffer: Data which will be sent using UART
+ *                  Length: Number of bytes in Buffer
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Number of data bytes queued (0 on time-out)
+ *******************************************************************************/
+uint16 Uart_SendAddressed(const Uart_Config* ConfigPtr, uint8 Address, const uint8* Buffer, uint16 Length)
+{
+    /* Pointer to Requested UART Base address Register */
+    volatile uint32* Uart_Ptr = NULL_PTR;
+
+    /* Status of the wait for the address byte */
+    uint8 Status = RET_OK;
+
+    /* Check if the input configuration pointer and buffer are Not Null Pointers */
+    if( (NULL_PTR == ConfigPtr) || (ConfigPtr->UartNum > Uart7) || (NULL_PTR == Buffer) ||
+        (ConfigPtr->WordLength != NineBits) )
+    {
+        /* Nothing queued */
+        return 0;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    /* Base address cached in the instance handle */
+    Uart_Ptr = g_uartHandles[ConfigPtr->UartNum].Base;
+
+    /* Wait until previous frame left the Tx ring buffer, the Tx FIFO and the shift register */
+    if(Uart_TxWaitIdle(ConfigPtr->UartNum, Uart_Ptr) != RET_OK)
+    {
+        /* Line is stalled, nothing queued */
+        return 0;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    /* Address byte: 9th bit = 1 (Stick parity 1: EPS = 0) */
+    CLEAR_BIT( (*(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_LCRH_REG_OFFSET) ), LCRH_REG_EPS_POS);
+
+    /* Send the address */
+    (*(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_DATA_REG_OFFSET) ) = Address;
+
+    /* Wait until the address is sent */
+    Status = Uart_TxWaitIdle(ConfigPtr->UartNum, Uart_Ptr);
+
+    /* Data bytes: 9th bit = 0 (Stick parity 0: EPS = 1), also after a time-out,
+     * so later Uart_Write() bytes are never sent as addresses                  */
+    SET_BIT( (*(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_LCRH_REG_OFFSET) ), LCRH_REG_EPS_POS);
+
+    if(Status != RET_OK)
+    {
+        /* Address byte is stuck in Tx FIFO, don't queue the data behind it */
+        return 0;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    /* Queue the data without blocking */
+    return Uart_Write(ConfigPtr, Buffer, Length);
+}
+
+/*******************************************************************************
+ * @fn              void Uart_SendString (const Uart_Config* ConfigPtr, const uint8* String)
+ * @brief           Function to Transmit String using UART
+ * @param (in):     ConfigPtr - Pointer to configuration set
+ *                  Data: Data which will be sent using UART
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+void Uart_SendString (const Uart_Config* ConfigPtr, const uint8* String)
+{
+    if( (NULL_PTR == ConfigPtr) || (ConfigPtr->UartNum > Uart7) || (NULL_PTR == String) )
+    {
+        return;
+    }
+
+    /* Resolve the instance once, not per byte */
+    Uart_PutString(&g_uartHandles[ConfigPtr->UartNum], String);
+}
+
+/*******************************************************************************
+ * @fn              uint8 Uart_Receive(void)
+ * @brief           Function to receive UART data using Polling Mode
+ * @param (in):     ConfigPtr - Pointer to configuration set
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Received Byte
+ *******************************************************************************/
+uint8 Uart_Receive(const Uart_Config* ConfigPtr)
+{
+    /* Check if the input configuration pointer to structure is Not a Null Pointer */
+    if( (NULL_PTR == ConfigPtr) || (ConfigPtr->UartNum > Uart7) )
+    {
+        /* ConfigPtr is a Null Pointer or UART instance is out of range. Return with RET_NOT_OK */
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    return Uart_GetChar(&g_uartHandles[ConfigPtr->UartNum]);
+}
+
+/*******************************************************************************
+ * @fn              const Uart_Handle* Uart_Open(const Uart_Config* ConfigPtr)
+ * @brief           Function to initialize a UART and get its instance handle
+ *                  The handle caches the base address, the Data/Flag register
+ *                  addresses and the statistics of the instance, so the per
+ *                  byte functions (Uart_PutChar, Uart_GetChar, Uart_PutString)
+ *                  don't need to resolve the instance on every call
+ * @param (in):     ConfigPtr - Pointer to configuration set
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Instance handle, NULL_PTR if initialization failed
+ *******************************************************************************/
+const Uart_Handle* Uart_Open(const Uart_Config* ConfigPtr)
+{
+    if(Uart_Init(ConfigPtr) != RET_OK)
+    {
+        return NULL_PTR;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    return &g_uartHandles[ConfigPtr->UartNum];
+}
+
+/*******************************************************************************
+ * @fn              void Uart_PutChar(const Uart_Handle* Handle, uint8 Data)
+ * @brief           Function to Transmit Byte using Polling Mode
+ * @note            Handle isn't checked, it MUST come from Uart_Open()
+ * @param (in):     Handle - Instance handle
+ *                  Data   - Byte which will be sent using UART
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+void Uart_PutChar(const Uart_Handle* Handle, uint8 Data)
+{
+    /* Wait until transmit holding register is NOT Full (when = 1 then the Transmit reg is full)*/
+    while( (*Handle->FlagReg & (FR_REG_TXFF_ENABLE << FR_REG_TXFF_POS)) != 0 );
+
+    /* Send the Char */
+    *Handle->DataReg = Data;
+
+    Handle->Stats->TxBytes++;
+}
+
+/*******************************************************************************
+ * @fn              uint8 Uart_GetChar(const Uart_Handle* Handle)
+ * @brief           Function to receive Byte using Polling Mode
+ * @note            Handle isn't checked, it MUST come from Uart_Open()
+ * @param (in):     Handle - Instance handle
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Received Byte
+ *******************************************************************************/
+uint8 Uart_GetChar(const Uart_Handle* Handle)
+{
+    /* Wait until receive holding register is NOT empty (when = 1 then the receive reg is empty). */
+    while( (*Handle->FlagReg & (FR_REG_RXFE_ENABLE << FR_REG_RXFE_POS)) != 0 );
+
+    Handle->Stats->RxBytes++;
+
+    /* Read Received byte */
+    return (uint8)*Handle->DataReg;
+}
+
+/*******************************************************************************
+ * @fn              void Uart_PutString(const Uart_Handle* Handle, const uint8* String)
+ * @brief           Function to Transmit String using Polling Mode
+ *                  Per byte work is one Flag register poll and one Data write
+ * @note            Handle isn't checked, it MUST come from Uart_Open()
+ * @param (in):     Handle - Instance handle
+ *                  String - Null terminated string
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+void Uart_PutString(const Uart_Handle* Handle, const uint8* String)
+{
+    /* Cached register addresses */
+    volatile uint32* DataReg = Handle->DataReg;
+    volatile uint32* FlagReg = Handle->FlagReg;
+
+    /* Start of the string */
+    const uint8* Start = String;
+
+    while(*String != '\0')
+    {
+        /* Wait until transmit holding register/FIFO is NOT Full */
+        while( (*FlagReg & (FR_REG_TXFF_ENABLE << FR_REG_TXFF_POS)) != 0 );
+
+        *DataReg = *String;
+        String++;
+    }
+
+    Handle->Stats->TxBytes += (uint32)(String - Start);
+}
+
+/*******************************************************************************
+ *                          Private Functions                                  *
+ *******************************************************************************/
+
+/*******************************************************************************
+ * @fn              static uint16 Uart_TxFifoFill(volatile uint32* Uart_Ptr, Uart_RingBuffer* Ring)
+ * @brief           Function to move bytes from the ring buffer to UART Tx FIFO
+ *                  until the ring buffer is empty or the FIFO is full
+ * @note            Caller must be the only consumer of the ring buffer
+ *                  (Tx ISR, or Uart_Write() with Tx interrupt masked)
+ * @param (in):     Uart_Ptr - Pointer to UART Base address
+ * @param (out):    None
+ * @param (inout):  Ring - Pointer to Tx ring buffer of this UART
+ * @return          None
+ *******************************************************************************/
+static uint16 Uart_TxFifoFill(volatile uint32* Uart_Ptr, Uart_RingBuffer* Ring)
+{
+    /* Local copy of the consumer index */
+    uint16 Tail = Ring->Tail;
+
+    /* Consumer index before filling */
+    uint16 Start = Tail;
+
+    /* Send while there are bytes in the ring buffer and the Tx FIFO is NOT Full */
+    while( (Tail != Ring->Head) &&
+           ( ( *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_FR_REG_OFFSET) & (FR_REG_TXFF_ENABLE << FR_REG_TXFF_POS) ) == 0 ) )
+    {
+        (*(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_DATA_REG_OFFSET) ) = Ring->Buffer[Tail & UART_RING_BUFFER_MASK];
+        Tail++;
+    }
+
+    /* Release the sent slots to the producer */
+    Ring->Tail = Tail;
+
+    return (uint16)(Tail - Start);
+}
+
+/*******************************************************************************
+ * @fn              static uint8 Uart_TxFill(Uart_Instance UartNum, volatile uint32* Uart_Ptr)
+ * @brief           Function to fill the Tx FIFO from the Tx ring buffer, then
+ *                  (when the ring buffer is empty) directly from the external
+ *                  Tx source of the instance without copying
+ * @note            Caller must be the only consumer (Tx ISR, or Tx interrupt masked)
+ * @param (in):     UartNum  - UART instance
+ *                  Uart_Ptr - Pointer to UART Base address
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          TRUE if bytes are still waiting (Tx interrupt is needed)
+ *******************************************************************************/
+static uint8 Uart_TxFill(Uart_Instance UartNum, volatile uint32* Uart_Ptr)
+{
+    /* Tx ring buffer of this UART */
+    Uart_RingBuffer* Ring = &g_uartTxRing[UartNum];
+
+    /* External Tx source of this UART */
+    const Uart_TxSource* Source = &g_uartTxSource[UartNum];
+
+    /* Contiguous bytes given by the source */
+    const uint8* Data = NULL_PTR;
+
+    /* Number of contiguous bytes given by the source */
+    uint16 Available = 0;
+
+    /* Number of source bytes written to the FIFO */
+    uint16 Sent = 0;
+
+    g_uartStats[UartNum].TxBytes += Uart_TxFifoFill(Uart_Ptr, Ring);
+    if(Ring->Head != Ring->Tail)
+    {
+        /* Tx FIFO is full */
+        return TRUE;
+    }
+
+    if(NULL_PTR == Source->Peek)
+    {
+        return FALSE;
+    }
+
+    while( (Available = (*Source->Peek)(UartNum, &Data)) != 0 )
+    {
+        Sent = 0;
+        while( (Sent < Available) &&
+               ( ( *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_FR_REG_OFFSET) & (FR_REG_TXFF_ENABLE << FR_REG_TXFF_POS) ) == 0 ) )
+        {
+            (*(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_DATA_REG_OFFSET) ) = Data[Sent];
+            Sent++;
+        }
+
+        g_uartStats[UartNum].TxBytes += Sent;
+        (*Source->Consume)(UartNum, Sent);
+
+        if(Sent < Available)
+        {
+            /* Tx FIFO is full */
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+/*******************************************************************************
+ * @fn              static void Uart_TxIsrHandler(Uart_Instance UartNum, volatile uint32* Uart_Ptr)
+ * @brief           Function to serve UART Transmit interrupt of Uart_Write()
+ *                  and of the external Tx source
+ * @note            Tx interrupt is already cleared by the dispatcher before filling,
+ *                  so a FIFO level crossing while filling isn't lost
+ * @param (in):     UartNum  - UART instance
+ *                  Uart_Ptr - Pointer to UART Base address
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+static void Uart_TxIsrHandler(Uart_Instance UartNum, volatile uint32* Uart_Ptr)
+{
+    /* Send the next bytes, stop Tx interrupt if nothing is left until the next
+     * Uart_Write() or Uart_TxKick() */
+    if(Uart_TxFill(UartNum, Uart_Ptr) == FALSE)
+    {
+        CLEAR_BIT( (*(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_IM_REG_OFFSET) ), IM_REG_TXIM_POS);
+    }
+}
+
+/*******************************************************************************
+ * @fn              static void Uart_RxIsrHandler(Uart_Instance UartNum, volatile uint32* Uart_Ptr)
+ * @brief           Function to serve UART Receive and Receive Time-Out interrupts
+ *                  It drains the whole Rx FIFO to the ring buffer (when both causes
+ *                  are pending, the second call only finds the Rx FIFO empty)
+ * @note            Bytes are dropped if the ring buffer is full
+ * @param (in):     UartNum  - UART instance
+ *                  Uart_Ptr - Pointer to UART Base address
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+static void Uart_RxIsrHandler(Uart_Instance UartNum, volatile uint32* Uart_Ptr)
+{
+    /* Rx ring buffer of this UART */
+    Uart_RingBuffer* Ring = &g_uartRxRing[UartNum];
+
+    /* Local copy of the producer index */
+    uint16 Head = Ring->Head;
+
+    /* Received byte with its error flags */
+    uint32 Data = 0;
+
+    /* Bytes drained from the Rx FIFO in this call */
+    uint16 Drained = 0;
+
+    /* Statistics of this UART */
+    volatile Uart_Stats* Stats = &g_uartStats[UartNum];
+
+    /* Read while the Rx FIFO is NOT Empty */
+    while( ( *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_FR_REG_OFFSET) & (FR_REG_RXFE_ENABLE << FR_REG_RXFE_POS) ) == 0 )
+    {
+        Data = *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_DATA_REG_OFFSET);
+        Drained++;
+
+        /* Single test on the clean path, each error flag is checked only if one is set */
+        if( (Data & DR_REG_ERRORS_MASK) != 0 )
+        {
+            /* Bytes were lost before this one because Rx FIFO was full */
+            if(BIT_IS_SET(Data, DR_REG_OE_POS))
+            {
+                Stats->OverrunErrors++;
+            }
+            if(BIT_IS_SET(Data, DR_REG_BE_POS))
+            {
+                Stats->BreakErrors++;
+            }
+            else
+            {
+                if(BIT_IS_SET(Data, DR_REG_FE_POS))
+                {
+                    Stats->FramingErrors++;
+                }
+                if(BIT_IS_SET(Data, DR_REG_PE_POS))
+                {
+                    Stats->ParityErrors++;
+                }
+            }
+        }
+
+        /* Store the byte if there is a free slot */
+        if( (uint16)(Head - Ring->Tail) < UART_RING_BUFFER_SIZE )
+        {
+            Ring->Buffer[Head & UART_RING_BUFFER_MASK] = (uint8)(Data & DR_REG_DATA_MASK);
+            Head++;
+        }
+        else
+        {
+            Stats->RxRingOverflows++;
+        }
+    }
+
+    /* Publish the new bytes to the consumer */
+    Ring->Head = Head;
+
+    Stats->RxBytes += Drained;
+    if(Drained > Stats->RxFifoHighWater)
+    {
+        Stats->RxFifoHighWater = Drained;
+    }
+    if( (uint16)(Head - Ring->Tail) > Stats->RxRingHighWater )
+    {
+        Stats->RxRingHighWater = (uint16)(Head - Ring->Tail);
+    }
+
+    /* Ask the sender to stop before the ring buffer overflows */
+    if( (g_uartFlowControl[UartNum].Software == TRUE) &&
+        ( (uint16)(Head - Ring->Tail) >= UART_RX_HIGH_WATER_MARK ) )
+    {
+        Uart_RtsSet(UartNum, TRUE);
+    }
+}
+
+/*******************************************************************************
+ * @fn              static void Uart_RxRelease(Uart_Instance UartNum, uint16 Tail)
+ * @brief           Function to give read slots of Rx ring buffer back to the
+ *                  Rx interrupt, and to let the sender continue (software RTS)
+ *                  when the ring buffer is drained enough
+ * @param (in):     UartNum - UART instance
+ *                  Tail    - New consumer index
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+static void Uart_RxRelease(Uart_Instance UartNum, uint16 Tail)
+{
+    /* Rx ring buffer of this UART */
+    Uart_RingBuffer* Ring = &g_uartRxRing[UartNum];
+
+    Ring->Tail = Tail;
+
+    if( (g_uartFlowControl[UartNum].RtsStopped == TRUE) &&
+        ( (uint16)(Ring->Head - Tail) <= UART_RX_LOW_WATER_MARK ) )
+    {
+        Uart_RtsSet(UartNum, FALSE);
+    }
+}
+
+/*******************************************************************************
+ * @fn              static uint8 Uart_TxWaitIdle(Uart_Instance UartNum, volatile uint32* Uart_Ptr)
+ * @brief           Function to wait until the Tx ring buffer, the Tx FIFO and the
+ *                  shift register are empty
+ *                  It gives up if nothing left the Tx ring buffer for the time of a
+ *                  full Tx FIFO and the shift register, so a stalled line (CTS
+ *                  deasserted, Tx interrupt off) doesn't block forever
+ * @note            The bound counts one UART clock per loop iteration, an iteration
+ *                  takes longer, so it never gives up on a moving line
+ * @param (in):     UartNum  - UART instance
+ *                  Uart_Ptr - Pointer to UART Base address
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Return Status (RET_NOT_OK on time-out)
+ *******************************************************************************/
+static uint8 Uart_TxWaitIdle(Uart_Instance UartNum, volatile uint32* Uart_Ptr)
+{
+    /* Tx ring buffer of this UART */
+    Uart_RingBuffer* Ring = &g_uartTxRing[UartNum];
+
+    /* Consumer index at the last progress */
+    uint16 Tail = Ring->Tail;
+
+    /* Loop iterations since the last progress */
+    uint32 Count = 0;
+
+    /* UART clocks of one bit: ClkDiv * (IBRD + 1), the fractional part rounded up */
+    uint32 BitClocks = ( BIT_IS_SET( (*(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_CTL_REG_OFFSET)), CTL_REG_HSE_POS) ?
+                         UART_CLKDIV_HIGH_SPEED : UART_CLKDIV_NORMAL ) *
+                       ( (*(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_IBRD_REG_OFFSET) & 0xFFFFU) + 1U );
+
+    /* Iterations without progress before giving up */
+    uint32 Bound = UART_TX_HW_CHARACTERS * UART_CHARACTER_BITS_MAX * BitClocks;
+
+    while( (Ring->Head != Ring->Tail) ||
+           ( ( *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_FR_REG_OFFSET) & (FR_REG_BUSY_ENABLE << FR_REG_BUSY_POS) ) != 0 ) )
+    {
+        if(Tail != Ring->Tail)
+        {
+            /* Tx interrupt moved bytes to the Tx FIFO, the line is moving */
+            Tail  = Ring->Tail;
+            Count = 0;
+        }
+        else if(++Count > Bound)
+        {
+            return RET_NOT_OK;
+        }
+    }
+
+    return RET_OK;
+}
+
+/*******************************************************************************
+ * @fn              static void Uart_RtsSet(Uart_Instance UartNum, uint8 Stop)
+ * @brief           Function to drive software RTS of one UART instance
+ * @param (in):     UartNum  - UART instance
+ *                  Stop     - TRUE to ask the sender to stop, FALSE to let it send
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+static void Uart_RtsSet(Uart_Instance UartNum, uint8 Stop)
+{
+    if(g_uartFlowControl[UartNum].Software != TRUE)
+    {
+        return;
+    }
+
+    g_uartFlowControl[UartNum].RtsStopped = Stop;
+
+    /* Drive the masked GPIODATA address, so only RTS pin is changed */
+    *(volatile uint32*)g_uartFlowControl[UartNum].RtsPinAddress = (Stop == TRUE) ? UART_RTS_GPIO_STOP : UART_RTS_GPIO_READY;
+}
+
+/*******************************************************************************
+ * @fn              static uint32 Uart_DmaTxStart(volatile uint32* Uart_Ptr, uint8 Channel,
+ *                                              Uart_DmaTransfer* Transfer)
+ * @brief           Function to hand the next Tx chunk (up to 1024 bytes) to uDMA
+ * @param (in):     Uart_Ptr - Pointer to UART Base address
+ *                  Channel  - Tx uDMA channel of this UART
+ * @param (out):    None
+ * @param (inout):  Transfer - Tx uDMA transfer state
+ * @return          Number of bytes handed to uDMA
+ *******************************************************************************/
+static uint32 Uart_DmaTxStart(volatile uint32* Uart_Ptr, uint8 Channel, Uart_DmaTransfer* Transfer)
+{
+    /* Number of bytes of this chunk */
+    uint32 Chunk = Transfer->Remaining;
+
+    if(Chunk > UDMA_MAX_TRANSFER_SIZE)
+    {
+        Chunk = UDMA_MAX_TRANSFER_SIZE;
+    }
+
+    /* Memory (incrementing) -> UART Data Register (fixed) */
+    Udma_ChannelTransferSet(Channel,
+                            Transfer->Next + Chunk - 1,
+                            (volatile uint8*)Uart_Ptr + UART_DATA_REG_OFFSET,
+                            (UDMA_SIZE_8 | UDMA_SRC_INC_8 | UDMA_DST_INC_NONE | UDMA_ARB_1 | UDMA_XFER_SIZE(Chunk) | UDMA_MODE_BASIC) );
+
+    Transfer->Next      += Chunk;
+    Transfer->Remaining -= Chunk;
+
+    Udma_ChannelEnable(Channel);
+
+    return Chunk;
+}
+
+/*******************************************************************************
+ * @fn              static uint32 Uart_DmaRxStart(volatile uint32* Uart_Ptr, uint8 Channel,
+ *                                              Uart_DmaTransfer* Transfer)
+ * @brief           Function to hand the next Rx chunk (up to 1024 bytes) to uDMA
+ * @param (in):     Uart_Ptr - Pointer to UART Base address
+ *                  Channel  - Rx uDMA channel of this UART
+ * @param (out):    None
+ * @param (inout):  Transfer - Rx uDMA transfer state
+ * @return          Number of bytes handed to uDMA
+ *******************************************************************************/
+static uint32 Uart_DmaRxStart(volatile uint32* Uart_Ptr, uint8 Channel, Uart_DmaTransfer* Transfer)
+{
+    /* Number of bytes of this chunk */
+    uint32 Chunk = Transfer->Remaining;
+
+    if(Chunk > UDMA_MAX_TRANSFER_SIZE)
+    {
+        Chunk = UDMA_MAX_TRANSFER_SIZE;
+    }
+
+    /* UART Data Register (fixed) -> Memory (incrementing) */
+    Udma_ChannelTransferSet(Channel,
+                            (volatile uint8*)Uart_Ptr + UART_DATA_REG_OFFSET,
+                            Transfer->Next + Chunk - 1,
+                            (UDMA_SIZE_8 | UDMA_SRC_INC_NONE | UDMA_DST_INC_8 | UDMA_ARB_1 | UDMA_XFER_SIZE(Chunk) | UDMA_MODE_BASIC) );
+
+    Transfer->Next      += Chunk;
+    Transfer->Remaining -= Chunk;
+
+    Udma_ChannelEnable(Channel);
+
+    return Chunk;
+}
+
+/*******************************************************************************
+ * @fn              static void Uart_DmaTxFinish(volatile uint32* Uart_Ptr, Uart_DmaTransfer* Transfer)
+ * @brief           Function to end a Tx uDMA transfer once the wire is idle
+ *                  It restores Transmit interrupt and End of Transmission mode,
+ *                  clears the End of Transmission interrupt and calls the callback
+ * @param (in):     Uart_Ptr - Pointer to UART Base address
+ * @param (out):    None
+ * @param (inout):  Transfer - Tx uDMA transfer state
+ * @return          None
+ *******************************************************************************/
+static void Uart_DmaTxFinish(volatile uint32* Uart_Ptr, Uart_DmaTransfer* Transfer)
+{
+    *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_IM_REG_OFFSET) =
+            (*(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_IM_REG_OFFSET) & ~(1 << IM_REG_TXIM_POS)) | Transfer->SavedMask;
+    *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_CTL_REG_OFFSET) =
+            (*(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_CTL_REG_OFFSET) & ~(CTL_REG_EOT_ENABLE << CTL_REG_EOT_POS)) | Transfer->SavedEot;
+    *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_ICR_REG_OFFSET) = (1 << ICR_REG_TXIC_POS);
+
+    Transfer->Draining = FALSE;
+    Transfer->Busy     = FALSE;
+
+    if(Transfer->CallBack != NULL_PTR)
+    {
+        (*Transfer->CallBack)();
+    }
+}
+
+/*******************************************************************************
+ * @fn              static void Uart_DmaIsrHandler(Uart_Instance UartNum, volatile uint32* Uart_Ptr)
+ * @brief           Function to serve uDMA completion of one UART instance
+ *                  It re-arms the next chunk or finishes the transfer
+ *                  and calls its callback (Tx waits for End of Transmission)
+ * @param (in):     UartNum  - UART instance
+ *                  Uart_Ptr - Pointer to UART Base address
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+static void Uart_DmaIsrHandler(Uart_Instance UartNum, volatile uint32* Uart_Ptr)
+{
+    /* Tx/Rx uDMA transfer states of this UART */
+    Uart_DmaTransfer* Transfer = NULL_PTR;
+
+    /************************** Tx uDMA completion **************************/
+    Transfer = &g_uartDmaTx[UartNum];
+    if( (Transfer->Busy == TRUE) && (Transfer->Draining == TRUE) )
+    {
+        /* End of Transmission: Tx FIFO is empty and the last stop bit left the wire */
+        if(BIT_IS_SET( (*(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_MIS_REG_OFFSET)), MIS_REG_TXMIS_POS) )
+        {
+            Uart_DmaTxFinish(Uart_Ptr, Transfer);
+        }
+    }
+    else if( (Transfer->Busy == TRUE) && (Udma_ChannelDone(g_uartDmaChannels[UartNum].TxChannel) == TRUE) )
+    {
+        if(Transfer->Remaining != 0)
+        {
+            /* Continue with the next chunk */
+            g_uartStats[UartNum].TxBytes += Uart_DmaTxStart(Uart_Ptr, g_uartDmaChannels[UartNum].TxChannel, Transfer);
+        }
+        else
+        {
+            /* Last bytes are still in Tx FIFO (at most 16), stop Tx uDMA requests
+             * and finish on End of Transmission interrupt */
+            CLEAR_BIT( (*(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_DMACTL_REG_OFFSET) ), DMACTL_REG_TXDMAE_POS);
+            Transfer->SavedMask = *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_IM_REG_OFFSET) & (1 << IM_REG_TXIM_POS);
+            Transfer->SavedEot  = *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_CTL_REG_OFFSET) & (CTL_REG_EOT_ENABLE << CTL_REG_EOT_POS);
+            *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_CTL_REG_OFFSET) |= (CTL_REG_EOT_ENABLE << CTL_REG_EOT_POS);
+            Transfer->Draining = TRUE;
+            SET_BIT( (*(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_IM_REG_OFFSET) ), IM_REG_TXIM_POS);
+
+            /* Wire went idle before End of Transmission mode was set, its interrupt won't come */
+            if(BIT_IS_CLEAR( (*(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_FR_REG_OFFSET)), FR_REG_BUSY_POS) )
+            {
+                Uart_DmaTxFinish(Uart_Ptr, Transfer);
+            }
+        }
+    }
+
+    /************************** Rx uDMA completion **************************/
+    Transfer = &g_uartDmaRx[UartNum];
+    if( (Transfer->Busy == TRUE) && (Udma_ChannelDone(g_uartDmaChannels[UartNum].RxChannel) == TRUE) )
+    {
+        if(Transfer->Remaining != 0)
+        {
+            /* Continue with the next chunk */
+            g_uartStats[UartNum].RxBytes += Uart_DmaRxStart(Uart_Ptr, g_uartDmaChannels[UartNum].RxChannel, Transfer);
+        }
+        else
+        {
+            /* Whole buffer received, stop Rx uDMA requests and restore Rx interrupts */
+            CLEAR_BIT( (*(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_DMACTL_REG_OFFSET) ), DMACTL_REG_RXDMAE_POS);
+            *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_IM_REG_OFFSET) |= Transfer->SavedMask;
+            Transfer->Busy = FALSE;
+
+            if(Transfer->CallBack != NULL_PTR)
+            {
+                (*Transfer->CallBack)();
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+ * @fn              static void Uart_IsrDispatcher(Uart_Instance UartNum)
+ * @brief           Interrupt dispatcher shared by all UART ISRs
+ *                  - Reads UARTMIS once and clears exactly these causes in UARTICR
+ *                  - Serves only the set bits (highest first, so errors are seen
+ *                    before the Rx FIFO is drained) using the handlers table
+ *                  - Calls the application call back of each served cause
+ *                  - Counts ISR entries and cycles (application call backs included)
+ * @param (in):     UartNum - UART instance which raised the interrupt
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+static void Uart_IsrDispatcher(Uart_Instance UartNum)
+{
+    /* Pointer to UART Base address Register */
+    volatile uint32* Uart_Ptr = g_uartHandles[UartNum].Base;
+
+    /* Statistics of this instance */
+    volatile Uart_Stats* Stats = g_uartHandles[UartNum].Stats;
+
+    /* Application call backs of this instance */
+    void (*volatile *CallBacks)(void) = g_callBackPtrUartInterrupt[UartNum];
+
+    /* Application call back of the cause being served */
+    void (*CallBack)(void) = NULL_PTR;
+
+    /* Masked interrupt status */
+    uint32 Status = 0;
+
+    /* Bit position of the cause being served */
+    uint8 Bit = 0;
+
+    /* Cycle counter at ISR entry */
+    uint32 EntryCycles = UART_CYCLE_COUNTER();
+
+    /* uDMA completion is signaled on UART vector but not in UARTMIS */
+    Uart_DmaIsrHandler(UartNum, Uart_Ptr);
+
+    /* Read the masked status once */
+    Status = *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_MIS_REG_OFFSET);
+
+    /* Clear exactly the causes that will be served */
+    *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_ICR_REG_OFFSET) = Status;
+
+    /* Serve set bits only */
+    while(Status != 0)
+    {
+        Bit = (uint8)(31U - UART_COUNT_LEADING_ZEROS(Status));
+        Status &= ~(1UL << Bit);
+
+        if(Bit < UART_INTERRUPT_CAUSES)
+        {
+            /* Driver work of this cause */
+            if(g_uartIsrHandlers[Bit] != NULL_PTR)
+            {
+                (*g_uartIsrHandlers[Bit])(UartNum, Uart_Ptr);
+            }
+
+            /*
+             * Check if the Pointer not a Null one
+             * To avoid segmentation fault (read once, it can change from thread mode)
+             */
+            CallBack = CallBacks[Bit];
+            if(CallBack != NULL_PTR)
+            {
+                (*CallBack)();
+            }
+        }
+    }
+
+    /* Unsigned difference stays correct across counter wrap around */
+    Stats->IsrCount++;
+    Stats->IsrCycles += (uint32)(UART_CYCLE_COUNTER() - EntryCycles);
+}
+
+/*******************************************************************************
+ * @fn              static uint8 Uart_BaudRateSolve(uint32 ClkValue, uint32 BaudRate,
+ *                                                  Uart_BaudDivisor* Divisor)
+ * @brief           Function to find baud rate divisor of Clock/BaudRate pair
+ *                  - Common pairs are taken from the precomputed table
+ *                  - Otherwise, both ClkDiv = 16 and ClkDiv = 8 (HSE) are tried
+ *                    and the one with lower error is chosen (16 on a tie)
+ *                  BRD = ClkValue / (ClkDiv * BaudRate), FBRD = round(frac * 64)
+ * @param (in):     ClkValue - Baud rate clock in Hz
+ *                  BaudRate - Requested baud rate
+ * @param (out):    Divisor  - Solved divisor
+ * @param (inout):  None
+ * @return          Return Status (RET_NOT_OK if no valid divisor exists)
+ *******************************************************************************/
+static uint8 Uart_BaudRateSolve(uint32 ClkValue, uint32 BaudRate, Uart_BaudDivisor* Divisor)
+{
+    /* Loop counter */
+    uint8 Index = 0;
+
+    /* Candidate divisors in 1/64 units */
+    uint32 Div64Normal = 0;
+    uint32 Div64HighSpeed = 0;
+
+    /* Candidate divisor with HSE enabled */
+    Uart_BaudDivisor HighSpeed;
+
+    /* Baud rate must be given and baud clock must be at least 8 times faster */
+    if( (0 == BaudRate) || ((uint64)BaudRate * UART_CLKDIV_HIGH_SPEED > ClkValue) )
+    {
+        return RET_NOT_OK;
+    }
+
+    /* First, look for precomputed divisor */
+    for(Index = 0; Index < (sizeof(g_uartBaudTable) / sizeof(g_uartBaudTable[0])); Index++)
+    {
+        if( (g_uartBaudTable[Index].ClkValue == ClkValue) && (g_uartBaudTable[Index].BaudRate == BaudRate) )
+        {
+            *Divisor = g_uartBaudTable[Index];
+            return RET_OK;
+        }
+    }
+
+    /* Second, runtime fallback */
+    Divisor->ClkValue = ClkValue;
+    Divisor->BaudRate = BaudRate;
+    HighSpeed         = *Divisor;
+
+    Div64Normal    = (uint32)( ( ((uint64)ClkValue * (128U / UART_CLKDIV_NORMAL))     / BaudRate + 1U) / 2U );
+    Div64HighSpeed = (uint32)( ( ((uint64)ClkValue * (128U / UART_CLKDIV_HIGH_SPEED)) / BaudRate + 1U) / 2U );
+
+    /* HSE candidate (always valid because ClkValue >= 8 * BaudRate) */
+    if(Div64HighSpeed > UART_BRD_DIV64_MAX)
+    {
+        Div64HighSpeed = UART_BRD_DIV64_MAX;
+    }
+    HighSpeed.Ibrd = (uint16)(Div64HighSpeed >> FBRD_REG_DIVFRAC_BITS);
+    HighSpeed.Fbrd = (uint8) (Div64HighSpeed &  FBRD_REG_DIVFRAC_MASK);
+    HighSpeed.Hse  = TRUE;
+
+    /* Normal candidate (needs ClkValue >= 16 * BaudRate) */
+    if(Div64Normal < UART_BRD_DIV64_MIN)
+    {
+        *Divisor = HighSpeed;
+        return RET_OK;
+    }
+    if(Div64Normal > UART_BRD_DIV64_MAX)
+    {
+        Div64Normal = UART_BRD_DIV64_MAX;
+    }
+    Divisor->Ibrd = (uint16)(Div64Normal >> FBRD_REG_DIVFRAC_BITS);
+    Divisor->Fbrd = (uint8) (Div64Normal &  FBRD_REG_DIVFRAC_MASK);
+    Divisor->Hse  = FALSE;
+
+    /* Choose the lower error */
+    if( ( (Uart_BaudRateErrorPpm(&HighSpeed) < 0) ? -Uart_BaudRateErrorPpm(&HighSpeed) : Uart_BaudRateErrorPpm(&HighSpeed) ) <
+        ( (Uart_BaudRateErrorPpm(Divisor)    < 0) ? -Uart_BaudRateErrorPpm(Divisor)    : Uart_BaudRateErrorPpm(Divisor)    ) )
+    {
+        *Divisor = HighSpeed;
+    }
+
+    return RET_OK;
+}
+
+/*******************************************************************************
+ * @fn              static uint32 Uart_BaudRateAchieved(const Uart_BaudDivisor* Divisor)
+ * @brief           Function to calculate baud rate generated by a divisor
+ *                  Baud = ClkValue * 64 / (ClkDiv * (IBRD * 64 + FBRD))
+ * @param (in):     Divisor - Baud rate divisor
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Generated baud rate (rounded)
+ *******************************************************************************/
+static uint32 Uart_BaudRateAchieved(const Uart_BaudDivisor* Divisor)
+{
+    /* Divisor in 1/64 units */
+    uint32 Div64 = ((uint32)Divisor->Ibrd << FBRD_REG_DIVFRAC_BITS) | Divisor->Fbrd;
+
+    /* ClkDiv used by this divisor */
+    uint32 ClkDiv = (Divisor->Hse == TRUE) ? UART_CLKDIV_HIGH_SPEED : UART_CLKDIV_NORMAL;
+
+    if(0 == Div64)
+    {
+        return 0;
+    }
+
+    return (uint32)( ( ((uint64)Divisor->ClkValue * 64U * 2U) / (ClkDiv * Div64) + 1U) / 2U );
+}
+
+/*******************************************************************************
+ * @fn              static sint32 Uart_BaudRateErrorPpm(const Uart_BaudDivisor* Divisor)
+ * @brief           Function to calculate baud rate error of a divisor in ppm
+ * @param (in):     Divisor - Baud rate divisor
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          (Achieved - Requested) * 1000000 / Requested
+ *******************************************************************************/
+static sint32 Uart_BaudRateErrorPpm(const Uart_BaudDivisor* Divisor)
+{
+    return (sint32)( ( ((sint64)Uart_BaudRateAchieved(Divisor) - (sint64)Divisor->BaudRate) * 1000000 ) /
+                     (sint64)Divisor->BaudRate );
+}
+
+/*******************************************************************************
+ * @fn              static uint8 Uart_BaudRateCheck(uint32 ClkValue, uint32 BaudRate,
+ *                                                  Uart_BaudDivisor* Divisor)
+ * @brief           Function to solve the baud rate divisor and reject it if
+ *                  its error is above UART_BAUD_RATE_MAX_ERROR_PPM
+ * @param (in):     ClkValue - Baud rate clock in Hz
+ *                  BaudRate - Requested baud rate
+ * @param (out):    Divisor  - Solved divisor
+ * @param (inout):  None
+ * @return          Return Status
+ *******************************************************************************/
+static uint8 Uart_BaudRateCheck(uint32 ClkValue, uint32 BaudRate, Uart_BaudDivisor* Divisor)
+{
+    if( (Uart_BaudRateSolve(ClkValue, BaudRate, Divisor) != RET_OK) ||
+        (Uart_BaudRateErrorPpm(Divisor) >  UART_BAUD_RATE_MAX_ERROR_PPM) ||
+        (Uart_BaudRateErrorPpm(Divisor) < -UART_BAUD_RATE_MAX_ERROR_PPM) )
+    {
+        return RET_NOT_OK;
+    }
+
+    return RET_OK;
+}
+
+/*******************************************************************************
+ * @fn              static uint32 Uart_AutoBaudMeasure(const Uart_AutoBaudState* AutoBaud)
+ * @brief           Function to compute the rate of a measured sync character
+ *                  and snap it to a standard rate (no hardware access, it is
+ *                  called from the Rx pin edge interrupt)
+ * @param (in):     AutoBaud - Autobaud state holding the sync character edges
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Measured baud rate
+ *******************************************************************************/
+static uint32 Uart_AutoBaudMeasure(const Uart_AutoBaudState* AutoBaud)
+{
+    /* Ticks of the 9 measured bits */
+    uint32 Span = AutoBaud->PreviousEdge - AutoBaud->FirstEdge;
+
+    /* Measured baud rate (rounded) */
+    uint32 BaudRate = (uint32)( ( ((uint64)AutoBaud->TimestampClock * UART_AUTOBAUD_SYNC_BITS) + (Span / 2U) ) / Span );
+
+    /* Distance to a standard rate */
+    uint32 Difference = 0;
+
+    /* Loop counter */
+    uint8 Index = 0;
+
+    /* Snap to the standard rate the sender most probably uses */
+    for(Index = 0; Index < (sizeof(g_uartStandardBaudRates) / sizeof(g_uartStandardBaudRates[0])); Index++)
+    {
+        Difference = (BaudRate > g_uartStandardBaudRates[Index]) ? (BaudRate - g_uartStandardBaudRates[Index]) :
+                                                                    (g_uartStandardBaudRates[Index] - BaudRate);
+        if( ((uint64)Difference * 1000000U) <= ((uint64)g_uartStandardBaudRates[Index] * UART_AUTOBAUD_SNAP_PPM) )
+        {
+            BaudRate = g_uartStandardBaudRates[Index];
+            break;
+        }
+    }
+
+    return BaudRate;
+}
+
+/*******************************************************************************
+ * @fn              static uint8 Uart_AutoBaudFinish(Uart_Instance UartNum)
+ * @brief           Function to reprogram UART with the measured rate and
+ *                  enable its receiver again
+ * @param (in):     UartNum - UART instance
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          UART_AUTOBAUD_DONE or UART_AUTOBAUD_FAILED
+ *******************************************************************************/
+static uint8 Uart_AutoBaudFinish(Uart_Instance UartNum)
+{
+    /* Autobaud state of this UART */
+    Uart_AutoBaudState* AutoBaud = &g_uartAutoBaud[UartNum];
+
+    /* Receiver is enabled again in both cases (old rate is kept on failure) */
+    if(Uart_ChangeBaudRate(AutoBaud->Config, AutoBaud->BaudRate) != RET_OK)
+    {
+        SET_BIT( (*(volatile uint32*)((volatile uint8*)g_uartHandles[UartNum].Base + UART_CTL_REG_OFFSET) ), CTL_REG_RXE_POS);
+        return UART_AUTOBAUD_FAILED;
+    }
+
+    SET_BIT( (*(volatile uint32*)((volatile uint8*)g_uartHandles[UartNum].Base + UART_CTL_REG_OFFSET) ), CTL_REG_RXE_POS);
+    return UART_AUTOBAUD_DONE;
+}
+
+/*******************************************************************************
+ * @fn              static void Uart_SetBaudRate(volatile uint32* Uart_Ptr,
+ *                                               const Uart_BaudDivisor* Divisor)
+ * @brief           Function to write baud rate divisor to UART registers
+ * @note            UART MUST be disabled, and LCRH MUST be written after it
+ *                  to latch IBRD/FBRD (See Data sheet page 896)
+ * @param (in):     Uart_Ptr - Pointer to UART Base address
+ *                  Divisor  - Baud rate divisor
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+static void Uart_SetBaudRate(volatile uint32* Uart_Ptr, const Uart_BaudDivisor* Divisor)
+{
+    if(Divisor->Hse == TRUE)
+    {
+        /* Enable HSE (High Speed Mode), ClkDiv = 8 */
+        SET_BIT( (*(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_CTL_REG_OFFSET) ), CTL_REG_HSE_POS);
+    }
+    else
+    {
+        /* Disable HSE, ClkDiv = 16 */
+        CLEAR_BIT( (*(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_CTL_REG_OFFSET) ), CTL_REG_HSE_POS);
+    }
+
+    /* Set Integer BaudRate value */
+    *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_IBRD_REG_OFFSET) = Divisor->Ibrd;
+
+    /* Set Fractional BaudRate value */
+    *(volatile uint32*)((volatile uint8*)Uart_Ptr + UART_FBRD_REG_OFFSET) = Divisor->Fbrd;
+}
@@ -4,12 +4,6 @@
  * @date          15/8/2021
  * @author        Islam Ehab Ezzat
  * @version       1.0.0
- * @note          This driver still under development, so it doesn't support:
- *                - uDMA Mode
- *                - Remaining Interrupts handling
- *                - Handling Interrupts from UART1 -> UART7
- *                - FIFO Mode
- *                - 9-Bit Mode
  *******************************************************************************/
 
 #ifndef DRIVERS_UART_UART_REG_H_
@@ -27,6 +21,8 @@
 #define UART_5_BASE_ADDRESS     0x40011000  /* UART5 Base Address */
 #define UART_6_BASE_ADDRESS     0x40012000  /* UART6 Base Address */
 #define UART_7_BASE_ADDRESS     0x40013000  /* UART7 Base Address */
+
+#define UART_NUMBER_OF_INSTANCES    8U      /* Number of UART modules */
 /*******************************************************************************/
 
 /*******************************************************************************
@@ -68,5 +64,10 @@
 
 #define SYSCTL_RCGCUART_REG        (*((volatile unsigned long *)0x400FE618))
 
+/* Cortex-M4 core debug registers used to measure UART ISR cycles */
+#define UART_DEMCR_REG_ADDRESS      0xE000EDFC  /* Debug Exception and Monitor Control  */
+#define UART_DWT_CTRL_REG_ADDRESS   0xE0001000  /* Data Watchpoint and Trace Control    */
+#define UART_DWT_CYCCNT_REG_ADDRESS 0xE0001004  /* Data Watchpoint and Trace Cycle Count */
+
 
 #endif /* DRIVERS_UART_UART_REG_H_ */
@@ -0,0 +1,72 @@
+/********************************************************************************
+ * @headerfile    UDMA_Init.h
+ * @brief         Header file for uDMA module on TM4C123GH6PM Microcontroller
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ * @note          This driver still under development, so it doesn't support:
+ *                - Scatter-Gather Modes
+ *                - Software Requests
+ *******************************************************************************/
+
+#ifndef DRIVERS_UDMA_UDMA_INIT_H_
+#define DRIVERS_UDMA_UDMA_INIT_H_
+
+#include "std_types.h"
+#include "common_macros.h"
+
+
+/*******************************************************************************
+ *                       Defines used in uDMA Control Word                     *
+ *******************************************************************************/
+/* Number of uDMA channels in TM4C123GH6PM                      */
+#define UDMA_NUMBER_OF_CHANNELS     (32U)
+
+/* Maximum number of items moved by one uDMA transfer           */
+#define UDMA_MAX_TRANSFER_SIZE      (1024U)
+
+/* Define used to choose destination address increment          */
+#define UDMA_DST_INC_8              ((uint32)0x0 << 30)
+#define UDMA_DST_INC_16             ((uint32)0x1 << 30)
+#define UDMA_DST_INC_32             ((uint32)0x2 << 30)
+#define UDMA_DST_INC_NONE           ((uint32)0x3 << 30)
+
+/* Define used to choose source address increment               */
+#define UDMA_SRC_INC_8              ((uint32)0x0 << 26)
+#define UDMA_SRC_INC_16             ((uint32)0x1 << 26)
+#define UDMA_SRC_INC_32             ((uint32)0x2 << 26)
+#define UDMA_SRC_INC_NONE           ((uint32)0x3 << 26)
+
+/* Define used to choose data size (source and destination)     */
+#define UDMA_SIZE_8                 (((uint32)0x0 << 28) | ((uint32)0x0 << 24))
+#define UDMA_SIZE_16                (((uint32)0x1 << 28) | ((uint32)0x1 << 24))
+#define UDMA_SIZE_32                (((uint32)0x2 << 28) | ((uint32)0x2 << 24))
+
+/* Define used to choose arbitration size (items per burst)     */
+#define UDMA_ARB_1                  ((uint32)0x0 << 14)
+#define UDMA_ARB_2                  ((uint32)0x1 << 14)
+#define UDMA_ARB_4                  ((uint32)0x2 << 14)
+#define UDMA_ARB_8                  ((uint32)0x3 << 14)
+
+/* Define used to set number of items of the transfer (1 -> 1024) */
+#define UDMA_XFER_SIZE(ITEMS)       ((((uint32)(ITEMS) - 1U) & 0x3FFU) << 4)
+
+/* Define used to choose transfer mode                          */
+#define UDMA_MODE_STOP              ((uint32)0x0)
+#define UDMA_MODE_BASIC             ((uint32)0x1)
+#define UDMA_MODE_AUTO              ((uint32)0x2)
+#define UDMA_MODE_PINGPONG          ((uint32)0x3)
+
+
+/*******************************************************************************
+ *                              Functions Prototype                            *
+ *******************************************************************************/
+void  Udma_Init(void);
+uint8 Udma_ChannelAssign(uint8 Channel, uint8 Encoding);
+uint8 Udma_ChannelTransferSet(uint8 Channel, const volatile void* SrcEnd, volatile void* DstEnd, uint32 Control);
+void  Udma_ChannelEnable(uint8 Channel);
+void  Udma_ChannelDisable(uint8 Channel);
+uint8 Udma_ChannelIsEnabled(uint8 Channel);
+uint8 Udma_ChannelDone(uint8 Channel);
+
+#endif /* DRIVERS_UDMA_UDMA_INIT_H_ */
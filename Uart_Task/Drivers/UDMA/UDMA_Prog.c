@@ -0,0 +1,204 @@
+/********************************************************************************
+ * @file          UDMA_Prog.c
+ * @brief         Source file for uDMA module on TM4C123GH6PM Microcontroller
+ * @date          17/10/2026
+ * @author        Islam Ehab Ezzat
+ * @version       1.0.0
+ * @note          This driver still under development, so it doesn't support:
+ *                - Scatter-Gather Modes
+ *                - Software Requests
+ *
+ *******************************************************************************/
+
+/********************************************************************************
+ *                                Includes Needed                               *
+ *******************************************************************************/
+#include "UDMA_Reg.h"
+#include "UDMA_Init.h"
+#include "UDMA_Priv.h"
+
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+/* Channel control table (Primary structures followed by Alternate structures)
+ * It is owned by this driver and MUST be aligned on 1024 bytes boundary      */
+#if defined(__TI_ARM__)
+#pragma DATA_ALIGN(g_udmaControlTable, UDMA_CONTROL_TABLE_ALIGNMENT)
+static volatile uint32 g_udmaControlTable[UDMA_CONTROL_TABLE_WORDS];
+#else
+static volatile uint32 g_udmaControlTable[UDMA_CONTROL_TABLE_WORDS] __attribute__((aligned(UDMA_CONTROL_TABLE_ALIGNMENT)));
+#endif
+
+
+/*******************************************************************************
+ * @fn              void Udma_Init(void)
+ * @brief           Function to initialize uDMA Controller
+ *                  - Enable uDMA clock
+ *                  - Enable the controller
+ *                  - Set the channel control table base address
+ * @param (in):     None
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+void Udma_Init(void)
+{
+    /* Variable to waste time to ensure clock stability */
+    volatile uint32  delay = 0;
+
+    /* Enable clock for uDMA Module */
+    SYSCTL_RCGCDMA_REG |= (1 << 0);
+
+    /* Delay to waste sometime to ensure clock stability */
+    delay = SYSCTL_RCGCDMA_REG;
+
+    /* Enable uDMA Controller */
+    *(volatile uint32*)(UDMA_BASE_ADDRESS + UDMA_CFG_REG_OFFSET) = (CFG_REG_MASTEN_ENABLE << CFG_REG_MASTEN_POS);
+
+    /* Set the channel control table base address */
+    *(volatile uint32*)(UDMA_BASE_ADDRESS + UDMA_CTLBASE_REG_OFFSET) = (uint32)g_udmaControlTable;
+}
+
+/*******************************************************************************
+ * @fn              uint8 Udma_ChannelAssign(uint8 Channel, uint8 Encoding)
+ * @brief           Function to select which peripheral drives the channel
+ *                  and to prepare the channel for peripheral requests
+ *                  (primary structure, single + burst requests, not masked)
+ * @param (in):     Channel  - uDMA channel number (0 -> 31)
+ *                  Encoding - Channel encoding (See Data sheet page 587)
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Return Status (RET_OK if everything is ok)
+ *******************************************************************************/
+uint8 Udma_ChannelAssign(uint8 Channel, uint8 Encoding)
+{
+    /* Pointer to DMACHMAPn Register of the requested channel */
+    volatile uint32* Map_Ptr = NULL_PTR;
+
+    /* Bits position of the channel in DMACHMAPn Register */
+    uint8 Shift = 0;
+
+    /* Check if the channel number is valid */
+    if(Channel >= UDMA_NUMBER_OF_CHANNELS)
+    {
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    /* Each DMACHMAPn Register holds 8 channels, 4 bits each */
+    Map_Ptr = (volatile uint32*)(UDMA_BASE_ADDRESS + UDMA_CHMAP0_REG_OFFSET + ((Channel / CHMAP_CHANNELS_PER_REG) * 4U));
+    Shift   = (Channel % CHMAP_CHANNELS_PER_REG) * CHMAP_BITS_PER_CHANNEL;
+
+    /* Set channel encoding */
+    *Map_Ptr = (*Map_Ptr & ~(CHMAP_CHANNEL_MASK << Shift)) | (((uint32)Encoding & CHMAP_CHANNEL_MASK) << Shift);
+
+    /* Use primary control structure */
+    *(volatile uint32*)(UDMA_BASE_ADDRESS + UDMA_ALTCLR_REG_OFFSET) = (1UL << Channel);
+
+    /* Respond to both single and burst requests */
+    *(volatile uint32*)(UDMA_BASE_ADDRESS + UDMA_USEBURSTCLR_REG_OFFSET) = (1UL << Channel);
+
+    /* Allow the peripheral to request transfers */
+    *(volatile uint32*)(UDMA_BASE_ADDRESS + UDMA_REQMASKCLR_REG_OFFSET) = (1UL << Channel);
+
+    return RET_OK;
+}
+
+/*******************************************************************************
+ * @fn              uint8 Udma_ChannelTransferSet(uint8 Channel, const volatile void* SrcEnd,
+ *                                                volatile void* DstEnd, uint32 Control)
+ * @brief           Function to fill the primary control structure of a channel
+ * @param (in):     Channel - uDMA channel number (0 -> 31)
+ *                  SrcEnd  - Address of the LAST source item (or register address)
+ *                  DstEnd  - Address of the LAST destination item (or register address)
+ *                  Control - Control word built from UDMA_xxx defines
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          Return Status (RET_OK if everything is ok)
+ *******************************************************************************/
+uint8 Udma_ChannelTransferSet(uint8 Channel, const volatile void* SrcEnd, volatile void* DstEnd, uint32 Control)
+{
+    /* Pointer to the primary control structure of the channel */
+    volatile uint32* Struct_Ptr = NULL_PTR;
+
+    /* Check if the channel number is valid */
+    if(Channel >= UDMA_NUMBER_OF_CHANNELS)
+    {
+        return RET_NOT_OK;
+    }
+    /* There is no need for else because if the if statement occurred, a return will happened */
+
+    Struct_Ptr = &g_udmaControlTable[Channel * UDMA_CHANNEL_STRUCT_WORDS];
+
+    Struct_Ptr[UDMA_SRC_END_WORD] = (uint32)SrcEnd;
+    Struct_Ptr[UDMA_DST_END_WORD] = (uint32)DstEnd;
+    Struct_Ptr[UDMA_CONTROL_WORD] = Control;
+
+    return RET_OK;
+}
+
+/*******************************************************************************
+ * @fn              void Udma_ChannelEnable(uint8 Channel)
+ * @brief           Function to enable uDMA channel (start servicing requests)
+ * @param (in):     Channel - uDMA channel number (0 -> 31)
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+void Udma_ChannelEnable(uint8 Channel)
+{
+    *(volatile uint32*)(UDMA_BASE_ADDRESS + UDMA_ENASET_REG_OFFSET) = (1UL << Channel);
+}
+
+/*******************************************************************************
+ * @fn              void Udma_ChannelDisable(uint8 Channel)
+ * @brief           Function to disable uDMA channel
+ * @param (in):     Channel - uDMA channel number (0 -> 31)
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+void Udma_ChannelDisable(uint8 Channel)
+{
+    *(volatile uint32*)(UDMA_BASE_ADDRESS + UDMA_ENACLR_REG_OFFSET) = (1UL << Channel);
+}
+
+/*******************************************************************************
+ * @fn              uint8 Udma_ChannelIsEnabled(uint8 Channel)
+ * @brief           Function to check if uDMA channel is still transferring
+ *                  (the controller disables the channel when transfer is done)
+ * @param (in):     Channel - uDMA channel number (0 -> 31)
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          TRUE if channel is enabled, FALSE otherwise
+ *******************************************************************************/
+uint8 Udma_ChannelIsEnabled(uint8 Channel)
+{
+    if( (*(volatile uint32*)(UDMA_BASE_ADDRESS + UDMA_ENASET_REG_OFFSET) & (1UL << Channel)) != 0 )
+    {
+        return TRUE;
+    }
+    return FALSE;
+}
+
+/*******************************************************************************
+ * @fn              uint8 Udma_ChannelDone(uint8 Channel)
+ * @brief           Function to check and clear channel completion interrupt
+ *                  It should be called from the peripheral ISR, because
+ *                  uDMA completion is signaled on the peripheral interrupt vector
+ * @param (in):     Channel - uDMA channel number (0 -> 31)
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          TRUE if the channel completed its transfer, FALSE otherwise
+ *******************************************************************************/
+uint8 Udma_ChannelDone(uint8 Channel)
+{
+    if( (*(volatile uint32*)(UDMA_BASE_ADDRESS + UDMA_CHIS_REG_OFFSET) & (1UL << Channel)) != 0 )
+    {
+        /* Clear completion status by writing 1 on it */
+        *(volatile uint32*)(UDMA_BASE_ADDRESS + UDMA_CHIS_REG_OFFSET) = (1UL << Channel);
+        return TRUE;
+    }
+    return FALSE;
+}
@@ -0,0 +1,142 @@
+#!/usr/bin/env python3
+"""Host decoder of the deferred UART log (Drivers/LOG).
+
+Each record on the wire is COBS encoded and terminated by 0x00:
+    | Format address (u32 LE) | Arg0 (u32 LE) | ... | ArgN-1 (u32 LE) |
+
+Format strings (and %s arguments) are read from the flash image of the
+.out file built by CCS, so the target never formats or sends any text.
+
+Usage:
+    log_decode.py Debug/Uart_Task.out capture.bin
+    log_decode.py Debug/Uart_Task.out --port COM5 --baud 115200   (needs pyserial)
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+SHT_NOBITS = 8
+SHF_ALLOC = 0x2
+
+CONVERSION = re.compile(r"%(?:%|[-+ #0]*\d*(?:\.\d+)?(?:hh|h|ll|l)?([diuxXcps]))")
+
+
+class ElfImage:
+    """Loadable sections of a 32-bit little endian ELF file."""
+
+    def __init__(self, path):
+        with open(path, "rb") as elf:
+            data = elf.read()
+        if data[:4] != b"\x7fELF" or data[4] != 1 or data[5] != 1:
+            raise ValueError("%s is not a 32-bit little endian ELF file" % path)
+        shoff, = struct.unpack_from("<I", data, 0x20)
+        shentsize, shnum = struct.unpack_from("<HH", data, 0x2E)
+        self.sections = []
+        for index in range(shnum):
+            (_, sh_type, flags, addr, offset, size) = struct.unpack_from(
+                "<IIIIII", data, shoff + index * shentsize)
+            if (flags & SHF_ALLOC) and sh_type != SHT_NOBITS and size:
+                self.sections.append((addr, data[offset:offset + size]))
+
+    def string(self, address):
+        for start, content in self.sections:
+            if start <= address < start + len(content):
+                end = content.find(b"\0", address - start)
+                if end < 0:
+                    end = len(content)
+                return content[address - start:end].decode("latin-1")
+        return None
+
+
+def cobs_decode(frame):
+    out = bytearray()
+    index = 0
+    while index < len(frame):
+        code = frame[index]
+        if code == 0 or index + code > len(frame):
+            return None
+        out += frame[index + 1:index + code]
+        index += code
+        if code < 0xFF and index < len(frame):
+            out.append(0)
+    return bytes(out)
+
+
+def format_record(image, record):
+    if len(record) < 4 or len(record) % 4:
+        return "<malformed record: %s>" % record.hex()
+    words = struct.unpack("<%dI" % (len(record) // 4), record)
+    fmt = image.string(words[0])
+    if fmt is None:
+        return "<unknown format 0x%08X %s>" % (words[0], list(words[1:]))
+    args = list(words[1:])
+
+    def convert(match):
+        kind = match.group(1)
+        if kind is None:
+            return "%"
+        if not args:
+            return "<missing>"
+        value = args.pop(0)
+        spec = match.group(0)
+        spec = re.sub(r"(hh|h|ll|l)(?=[diuxXcps]$)", "", spec)
+        if kind in "di":
+            value = value - (1 << 32) if value & 0x80000000 else value
+            return spec % value
+        if kind == "c":
+            return spec % chr(value & 0xFF)
+        if kind == "p":
+            return "0x%08X" % value
+        if kind == "s":
+            text = image.string(value)
+            return spec % (text if text is not None else "<0x%08X>" % value)
+        return spec % value
+
+    return CONVERSION.sub(convert, fmt)
+
+
+def frames(stream):
+    pending = bytearray()
+    while True:
+        chunk = stream.read(1)
+        if not chunk:
+            return
+        if chunk[0] == 0:
+            if pending:
+                yield bytes(pending)
+            pending.clear()
+        else:
+            pending += chunk
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("elf", help=".out file running on the target")
+    parser.add_argument("capture", nargs="?", help="raw capture file (default: stdin)")
+    parser.add_argument("--port", help="serial port to read from (needs pyserial)")
+    parser.add_argument("--baud", type=int, default=9600)
+    options = parser.parse_args()
+
+    image = ElfImage(options.elf)
+    if options.port:
+        import serial
+        stream = serial.Serial(options.port, options.baud)
+    elif options.capture:
+        stream = open(options.capture, "rb")
+    else:
+        stream = sys.stdin.buffer
+
+    for frame in frames(stream):
+        record = cobs_decode(frame)
+        if record is None:
+            print("<corrupted frame: %s>" % frame.hex())
+        else:
+            print(format_record(image, record))
+        sys.stdout.flush()
+
+
+if __name__ == "__main__":
+    main()
@@ -25,6 +25,12 @@ Uart_Config Uart0Configurations;
 /***************************************************************************/
 
 
+/*****************************************************************************
+                            Static Functions Prototype
+*****************************************************************************/
+static void UART_HandleByte(void);
+
+
 int main(void)
 {
     /* UART0 Pins Configurations */
@@ -39,7 +45,7 @@ int main(void)
      *                          1 Stop bit                            *
      *                           No Parity                            *
      *                   Receive Interrupt Enable                     *
-     *                       FIFO Mode Disabled                       *
+     *          FIFO Mode Enabled (Rx level 1/2, Tx level 1/8)        *
      ******************************************************************/
     Uart0Configurations.UartNum         = Uart0;
     Uart0Configurations.WordLength      = EightBits;
@@ -48,7 +54,9 @@ int main(void)
     Uart0Configurations.BaudRate        = 9600;
     Uart0Configurations.StopBits        = STOP_BITS_1_BIT;
     Uart0Configurations.ParityMode      = PARITY_MODE_DISABLE;
-    Uart0Configurations.FifoMode        = FIFO_MODE_DISABLE;
+    Uart0Configurations.FifoMode        = FIFO_MODE_ENABLE;
+    Uart0Configurations.RxFifoLevel     = FIFO_LEVEL_1_2;
+    Uart0Configurations.TxFifoLevel     = FIFO_LEVEL_1_8;
     Uart0Configurations.ClkSrc          = CLOCK_SRC_SYSTEM;
 
     /* Uart Initialization */
@@ -117,11 +125,31 @@ static void Uart_PinsConfigurations(void)
  *******************************************************************************/
 void UART_ReceiveInterrupt(void)
 {
-    /* Receive the byte */
-    ByteReceievd = Uart_ReceiveIT(&Uart0Configurations);
+    /* Serve every byte received in this burst */
+    while(Uart_Read(&Uart0Configurations, (uint8*)&ByteReceievd, 1) != 0)
+    {
+        UART_HandleByte();
+    }
+}
+
+/*******************************************************************************
+ * @fn              static void UART_HandleByte(void)
+ * @brief           Function to reply to one received byte
+ * @note            It runs from UART Rx ISR, so the reply is queued to the Tx
+ *                  ring buffer (Uart_Write) instead of waiting for the Tx FIFO
+ * @param (in):     None
+ * @param (out):    None
+ * @param (inout):  None
+ * @return          None
+ *******************************************************************************/
+static void UART_HandleByte(void)
+{
+    /* Replies sent back */
+    static const uint8 NewLine[]     = "\r\n";
+    static const uint8 NoSuccessor[] = "~ Doesn't have a successive letter";
 
     /* Print New Line */
-    Uart_SendString(&Uart0Configurations, "\r\n");
+    (void)Uart_Write(&Uart0Configurations, NewLine, sizeof(NewLine) - 1U);
     /* CHeck if the received byte is a character that can be displayed */
     if( (ByteReceievd>= '!') && (ByteReceievd<= '~') )
     {
@@ -132,24 +160,24 @@ void UART_ReceiveInterrupt(void)
             ByteReceievd-=32;
 
             /* Send back the Capital Letter */
-            Uart_Transmit(&Uart0Configurations, ByteReceievd);
+            (void)Uart_Write(&Uart0Configurations, (const uint8*)&ByteReceievd, 1);
         }
         /* The received char is '~', if we add 1 to it
          * the ASCII will be DEL which cannot be displayed on terminal
          * so if '~' is sent, Display a error msg */
         else if(ByteReceievd == '~')
         {
-            Uart_SendString(&Uart0Configurations, "~ Doesn't have a successive letter");
+            (void)Uart_Write(&Uart0Configurations, NoSuccessor, sizeof(NoSuccessor) - 1U);
         }
         /* The received char isn't a small alphabetical letter.
          * Display the successive letter of the sent one*/
         else{
             ByteReceievd+=1;
             /* Send back the Successive Letter */
-            Uart_Transmit(&Uart0Configurations, ByteReceievd);
+            (void)Uart_Write(&Uart0Configurations, (const uint8*)&ByteReceievd, 1);
         }
     }
     /* Print New Line */
-    Uart_SendString(&Uart0Configurations, "\r\n");
+    (void)Uart_Write(&Uart0Configurations, NewLine, sizeof(NewLine) - 1U);
 
 }